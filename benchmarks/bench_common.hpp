@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BENCH_COMMON_HPP_
+#define _ONEMKL_BENCH_COMMON_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace bench {
+
+// Calls f once to warm up, then repeatedly until at least min_seconds have passed, and returns the
+// average time of one call in seconds.
+template <typename F>
+double seconds_per_call(F &&f, double min_seconds = 0.25) {
+    using clock = std::chrono::steady_clock;
+    f();
+    int64_t calls = 0, batch = 1;
+    double elapsed = 0.0;
+    const auto start = clock::now();
+    do {
+        for (int64_t i = 0; i < batch; i++)
+            f();
+        calls += batch;
+        batch *= 2;
+        elapsed = std::chrono::duration<double>(clock::now() - start).count();
+    } while (elapsed < min_seconds);
+    return elapsed / calls;
+}
+
+// Prints one result line: the time per call, and the rate when flops is not zero.
+inline void report(const std::string &name, double seconds, double flops = 0.0) {
+    std::cout << std::left << std::setw(56) << name << std::right << std::fixed
+              << std::setprecision(3) << std::setw(14) << seconds * 1e6 << " us";
+    if (flops > 0.0)
+        std::cout << std::setw(12) << flops / seconds * 1e-9 << " GFLOP/s";
+    std::cout << std::endl;
+}
+
+} // namespace bench
+
+#endif //_ONEMKL_BENCH_COMMON_HPP_
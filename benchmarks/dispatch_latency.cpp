@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Latency of small BLAS calls made through the run-time API and through the compile-time API of
+// the mklcpu backend. The difference is the cost of run-time dispatching: the function table
+// lookup and indirect call, or with ENABLE_STATIC_DISPATCH only the device check. Build once with
+// and once without static dispatch to compare the two run-time paths.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+
+#include "bench_common.hpp"
+#include "oneapi/mkl.hpp"
+
+int main() {
+    cl::sycl::queue queue(cl::sycl::cpu_selector{});
+    std::cout << "device: " << queue.get_device().get_info<cl::sycl::info::device::name>()
+              << std::endl;
+#ifdef ENABLE_STATIC_DISPATCH
+    std::cout << "run-time API: static dispatch to mklcpu" << std::endl;
+#else
+    std::cout << "run-time API: dynamically loaded function table" << std::endl;
+#endif
+
+    namespace blas = oneapi::mkl::blas::column_major;
+    const oneapi::mkl::backend_selector<oneapi::mkl::backend::mklcpu> mklcpu{ queue };
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    constexpr std::int64_t n = 4;
+    float *x = cl::sycl::malloc_shared<float>(n * n, queue);
+    float *y = cl::sycl::malloc_shared<float>(n * n, queue);
+    float *z = cl::sycl::malloc_shared<float>(n * n, queue);
+    for (std::int64_t i = 0; i < n * n; i++)
+        x[i] = y[i] = z[i] = 1.0f;
+
+    bench::report("run-time scal, n = 1", bench::seconds_per_call([&] {
+                      blas::scal(queue, 1, 1.0f, x, 1).wait();
+                  }));
+    bench::report("compile-time mklcpu scal, n = 1", bench::seconds_per_call([&] {
+                      blas::scal(mklcpu, 1, 1.0f, x, 1).wait();
+                  }));
+    bench::report("run-time sgemm, 4x4x4",
+                  bench::seconds_per_call([&] {
+                      blas::gemm(queue, nontrans, nontrans, n, n, n, 1.0f, x, n, y, n, 0.0f, z, n)
+                          .wait();
+                  }),
+                  2.0 * n * n * n);
+    bench::report("compile-time mklcpu sgemm, 4x4x4",
+                  bench::seconds_per_call([&] {
+                      blas::gemm(mklcpu, nontrans, nontrans, n, n, n, 1.0f, x, n, y, n, 0.0f, z, n)
+                          .wait();
+                  }),
+                  2.0 * n * n * n);
+
+    cl::sycl::free(x, queue);
+    cl::sycl::free(y, queue);
+    cl::sycl::free(z, queue);
+    return 0;
+}
@@ -0,0 +1,76 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Time per call of square complex gemm and gemm3m through the netlib compile-time API. The rate
+// is given for the 8 * n^3 operations of gemm in both cases.
+
+#include <CL/sycl.hpp>
+#include <complex>
+#include <cstdint>
+#include <string>
+
+#include "bench_common.hpp"
+#include "oneapi/mkl.hpp"
+
+namespace {
+
+template <typename T>
+void run(cl::sycl::queue &queue, const std::string &name, std::int64_t n) {
+    namespace blas = oneapi::mkl::blas::column_major;
+    const oneapi::mkl::backend_selector<oneapi::mkl::backend::netlib> netlib{ queue };
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    T *a = cl::sycl::malloc_shared<T>(n * n, queue);
+    T *b = cl::sycl::malloc_shared<T>(n * n, queue);
+    T *c = cl::sycl::malloc_shared<T>(n * n, queue);
+    for (std::int64_t i = 0; i < n * n; i++) {
+        a[i] = T(1.0f / (1 + i % 7), 1.0f / (1 + i % 3));
+        b[i] = T(1.0f / (1 + i % 5), -1.0f / (1 + i % 11));
+        c[i] = T(0.0f);
+    }
+    const std::string size = " " + std::to_string(n);
+    const double flops = 8.0 * n * n * n;
+    bench::report(name + " gemm" + size, bench::seconds_per_call([&] {
+                      blas::gemm(netlib, nontrans, nontrans, n, n, n, T(1.0f), a, n, b, n,
+                                 T(0.0f), c, n)
+                          .wait();
+                  }),
+                  flops);
+    bench::report(name + " gemm3m" + size, bench::seconds_per_call([&] {
+                      blas::gemm3m(netlib, nontrans, nontrans, n, n, n, T(1.0f), a, n, b, n,
+                                   T(0.0f), c, n)
+                          .wait();
+                  }),
+                  flops);
+    cl::sycl::free(a, queue);
+    cl::sycl::free(b, queue);
+    cl::sycl::free(c, queue);
+}
+
+} // namespace
+
+int main() {
+    cl::sycl::queue queue(cl::sycl::cpu_selector{});
+    std::cout << "device: " << queue.get_device().get_info<cl::sycl::info::device::name>()
+              << std::endl;
+    for (std::int64_t n : { 64, 256, 1024 }) {
+        run<std::complex<float>>(queue, "complex<float>", n);
+        run<std::complex<double>>(queue, "complex<double>", n);
+    }
+    return 0;
+}
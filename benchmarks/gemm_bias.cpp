@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Throughput of the mklcpu column major gemm_bias for every combination of int8 and uint8 A and
+// B. int8 x uint8 is computed by MKL, the other three by the backend's integer kernel.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <string>
+
+#include "bench_common.hpp"
+#include "oneapi/mkl.hpp"
+
+namespace {
+
+template <typename Ta, typename Tb>
+void run(cl::sycl::queue &queue, const std::string &name, std::int64_t n) {
+    namespace blas = oneapi::mkl::blas::column_major;
+    const oneapi::mkl::backend_selector<oneapi::mkl::backend::mklcpu> mklcpu{ queue };
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    Ta *a = cl::sycl::malloc_shared<Ta>(n * n, queue);
+    Tb *b = cl::sycl::malloc_shared<Tb>(n * n, queue);
+    std::int32_t *c = cl::sycl::malloc_shared<std::int32_t>(n * n, queue);
+    std::int32_t *co = cl::sycl::malloc_shared<std::int32_t>(n, queue);
+    for (std::int64_t i = 0; i < n * n; i++) {
+        a[i] = Ta(i % 7);
+        b[i] = Tb(i % 5);
+        c[i] = 0;
+    }
+    for (std::int64_t i = 0; i < n; i++)
+        co[i] = std::int32_t(i % 3);
+    auto call = [&] {
+        blas::gemm_bias(mklcpu, nontrans, nontrans, oneapi::mkl::offset::column, n, n, n, 1.0f, a,
+                        n, Ta(1), b, n, Tb(2), 0.0f, c, n, co)
+            .wait();
+    };
+    bench::report(name + " " + std::to_string(n), bench::seconds_per_call(call),
+                  2.0 * n * n * n);
+    cl::sycl::free(a, queue);
+    cl::sycl::free(b, queue);
+    cl::sycl::free(c, queue);
+    cl::sycl::free(co, queue);
+}
+
+} // namespace
+
+int main() {
+    cl::sycl::queue queue(cl::sycl::cpu_selector{});
+    std::cout << "device: " << queue.get_device().get_info<cl::sycl::info::device::name>()
+              << std::endl;
+    for (std::int64_t n : { 256, 512, 1024 }) {
+        run<std::int8_t, std::uint8_t>(queue, "gemm_bias s8 x u8 (MKL)", n);
+        run<std::int8_t, std::int8_t>(queue, "gemm_bias s8 x s8", n);
+        run<std::uint8_t, std::int8_t>(queue, "gemm_bias u8 x s8", n);
+        run<std::uint8_t, std::uint8_t>(queue, "gemm_bias u8 x u8", n);
+    }
+    return 0;
+}
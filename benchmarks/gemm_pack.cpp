@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Time of repeated mklcpu sgemm calls with small k that multiply one constant matrix A by
+// different B matrices, with A passed to gemm every time and with A packed once by gemm_pack and
+// reused by gemm_compute.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "oneapi/mkl.hpp"
+
+namespace {
+
+void run(cl::sycl::queue &queue, std::int64_t m, std::int64_t n, std::int64_t k) {
+    namespace blas = oneapi::mkl::blas::column_major;
+    const oneapi::mkl::backend_selector<oneapi::mkl::backend::mklcpu> mklcpu{ queue };
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    const auto which = oneapi::mkl::identifier::A;
+    constexpr int batches = 64;
+
+    float *a = cl::sycl::malloc_shared<float>(m * k, queue);
+    float *b = cl::sycl::malloc_shared<float>(k * n * batches, queue);
+    float *c = cl::sycl::malloc_shared<float>(m * n, queue);
+    for (std::int64_t i = 0; i < m * k; i++)
+        a[i] = 1.0f / (1 + i % 7);
+    for (std::int64_t i = 0; i < k * n * batches; i++)
+        b[i] = 1.0f / (1 + i % 5);
+
+    const std::int64_t size = blas::gemm_pack_get_size<float>(mklcpu, which, m, n, k);
+    float *packed = cl::sycl::malloc_shared<float>(size, queue);
+    blas::gemm_pack(mklcpu, which, nontrans, m, n, k, 1.0f, a, m, packed).wait();
+
+    // Each timed call multiplies A by all the B matrices in turn.
+    auto unpacked = [&] {
+        for (int i = 0; i < batches; i++)
+            blas::gemm(mklcpu, nontrans, nontrans, m, n, k, 1.0f, a, m, b + i * k * n, k, 0.0f,
+                       c, m)
+                .wait();
+    };
+    auto reused = [&] {
+        for (int i = 0; i < batches; i++)
+            blas::gemm_compute(mklcpu, which, nontrans, m, n, k, packed, b + i * k * n, k, 0.0f,
+                               c, m)
+                .wait();
+    };
+    const std::string shape =
+        " m " + std::to_string(m) + " n " + std::to_string(n) + " k " + std::to_string(k);
+    const double flops = 2.0 * m * n * k * batches;
+    bench::report("gemm" + shape, bench::seconds_per_call(unpacked), flops);
+    bench::report("gemm_compute" + shape, bench::seconds_per_call(reused), flops);
+
+    cl::sycl::free(a, queue);
+    cl::sycl::free(b, queue);
+    cl::sycl::free(c, queue);
+    cl::sycl::free(packed, queue);
+}
+
+} // namespace
+
+int main() {
+    cl::sycl::queue queue(cl::sycl::cpu_selector{});
+    std::cout << "device: " << queue.get_device().get_info<cl::sycl::info::device::name>()
+              << std::endl;
+    for (std::int64_t k : { 16, 32, 64 }) {
+        run(queue, 1024, 16, k);
+        run(queue, 1024, 256, k);
+    }
+    return 0;
+}
@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Time per call of small square sgemm through the mklcpu compile-time API, and through gemm plans
+// run on the calling thread with the MKL JIT kernel and with the compiled kernels.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "oneapi/mkl.hpp"
+#include "oneapi/mkl/blas/detail/mklcpu/gemm_plan.hpp"
+
+int main() {
+    namespace blas = oneapi::mkl::blas::column_major;
+    using oneapi::mkl::blas::mklcpu::gemm_plan;
+    cl::sycl::queue queue(cl::sycl::cpu_selector{});
+    const oneapi::mkl::backend_selector<oneapi::mkl::backend::mklcpu> mklcpu{ queue };
+    const auto layout = oneapi::mkl::layout::column_major;
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    std::cout << "device: " << queue.get_device().get_info<cl::sycl::info::device::name>()
+              << std::endl;
+
+    for (std::int64_t n : { 8, 12, 16, 24, 32 }) {
+        float *a = cl::sycl::malloc_shared<float>(n * n, queue);
+        float *b = cl::sycl::malloc_shared<float>(n * n, queue);
+        float *c = cl::sycl::malloc_shared<float>(n * n, queue);
+        for (std::int64_t i = 0; i < n * n; i++) {
+            a[i] = 1.0f / (1 + i % 7);
+            b[i] = 1.0f / (1 + i % 5);
+            c[i] = 0.0f;
+        }
+        gemm_plan<float> jit(layout, nontrans, nontrans, n, n, n, 1.0f, n, n, 0.0f, n);
+        gemm_plan<float> compiled(layout, nontrans, nontrans, n, n, n, 1.0f, n, n, 0.0f, n, false);
+
+        const std::string size = " " + std::to_string(n);
+        const double flops = 2.0 * n * n * n;
+        bench::report("gemm" + size,
+                      bench::seconds_per_call([&] {
+                          blas::gemm(mklcpu, nontrans, nontrans, n, n, n, 1.0f, a, n, b, n, 0.0f,
+                                     c, n)
+                              .wait();
+                      }),
+                      flops);
+        bench::report(std::string(jit.is_jit() ? "plan, JIT kernel" : "plan, no JIT available") +
+                          size,
+                      bench::seconds_per_call([&] { jit(a, b, c); }), flops);
+        bench::report("plan, compiled kernel" + size,
+                      bench::seconds_per_call([&] { compiled(a, b, c); }), flops);
+
+        cl::sycl::free(a, queue);
+        cl::sycl::free(b, queue);
+        cl::sycl::free(c, queue);
+    }
+    return 0;
+}
@@ -0,0 +1,49 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Per-call cost of resolving the device of a queue, which every run-time BLAS, LAPACK and RNG
+// call does before dispatching, and of a minimal run-time BLAS call for comparison.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+
+#include "bench_common.hpp"
+#include "oneapi/mkl.hpp"
+
+int main() {
+    cl::sycl::queue queue;
+    const cl::sycl::device device = queue.get_device();
+    std::cout << "device: " << device.get_info<cl::sycl::info::device::name>() << std::endl;
+
+    volatile int sink = 0;
+    bench::report("classify_device (uncached queries)", bench::seconds_per_call([&] {
+                      sink = int(oneapi::mkl::detail::classify_device(queue.get_device()));
+                  }));
+    bench::report("get_device_id(queue) (cached)", bench::seconds_per_call([&] {
+                      sink = int(oneapi::mkl::get_device_id(queue));
+                  }));
+
+    float *x = cl::sycl::malloc_shared<float>(1, queue);
+    x[0] = 1.0f;
+    bench::report("blas::column_major::scal, n = 1, with wait", bench::seconds_per_call([&] {
+                      oneapi::mkl::blas::column_major::scal(queue, 1, 1.0f, x, 1).wait();
+                  }));
+    cl::sycl::free(x, queue);
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Throughput and extra memory of the mklcpu half precision gemm (half -> half and half -> float)
+// for large square sizes, next to sgemm on the same sizes. The extra memory is the growth of the
+// peak resident set size during the calls, beyond the operands, as reported by Linux.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "bench_common.hpp"
+#include "oneapi/mkl.hpp"
+
+namespace {
+
+// Value in kB of a field of /proc/self/status, 0 if it cannot be read
+std::int64_t status_kb(const std::string &field) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, field.size() + 1, field + ":") == 0)
+            return std::stoll(line.substr(field.size() + 1));
+    }
+    return 0;
+}
+
+// Runs f with the peak resident set size reset, and returns how far the peak rose above the
+// resident size before the call, in MB
+template <typename F>
+double extra_memory_mb(F &&f) {
+    std::ofstream("/proc/self/clear_refs") << "5";
+    const std::int64_t before = status_kb("VmRSS");
+    f();
+    return (status_kb("VmHWM") - before) / 1024.0;
+}
+
+template <typename Ta, typename Tc>
+void run(cl::sycl::queue &queue, const std::string &name, std::int64_t n) {
+    namespace blas = oneapi::mkl::blas::column_major;
+    const oneapi::mkl::backend_selector<oneapi::mkl::backend::mklcpu> mklcpu{ queue };
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    Ta *a = cl::sycl::malloc_shared<Ta>(n * n, queue);
+    Ta *b = cl::sycl::malloc_shared<Ta>(n * n, queue);
+    Tc *c = cl::sycl::malloc_shared<Tc>(n * n, queue);
+    for (std::int64_t i = 0; i < n * n; i++) {
+        a[i] = Ta(1.0f / (1 + i % 7));
+        b[i] = Ta(1.0f / (1 + i % 5));
+        c[i] = Tc(0.0f);
+    }
+    auto call = [&] {
+        blas::gemm(mklcpu, nontrans, nontrans, n, n, n, Tc(1.0f), a, n, b, n, Tc(0.0f), c, n)
+            .wait();
+    };
+    const double extra = extra_memory_mb(call);
+    bench::report(name + " " + std::to_string(n) + ", extra " + std::to_string(int(extra)) + " MB",
+                  bench::seconds_per_call(call, 1.0), 2.0 * n * n * n);
+    cl::sycl::free(a, queue);
+    cl::sycl::free(b, queue);
+    cl::sycl::free(c, queue);
+}
+
+} // namespace
+
+int main() {
+    cl::sycl::queue queue(cl::sycl::cpu_selector{});
+    std::cout << "device: " << queue.get_device().get_info<cl::sycl::info::device::name>()
+              << std::endl;
+    using cl::sycl::half;
+    for (std::int64_t n : { 1024, 2048, 4096 }) {
+        run<float, float>(queue, "sgemm", n);
+        run<half, half>(queue, "gemm half -> half", n);
+        run<half, float>(queue, "gemm half -> float", n);
+    }
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Time of the axpy, axpy, dot, nrm2, scal step of a Krylov iteration on vectors larger than the
+// last level cache, as separate mklcpu calls and as one pass recorded by level1_fusion.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <string>
+
+#include "bench_common.hpp"
+#include "oneapi/mkl.hpp"
+#include "oneapi/mkl/blas/detail/mklcpu/level1_fusion.hpp"
+
+int main() {
+    namespace blas = oneapi::mkl::blas::column_major;
+    cl::sycl::queue queue(cl::sycl::cpu_selector{});
+    const oneapi::mkl::backend_selector<oneapi::mkl::backend::mklcpu> mklcpu{ queue };
+    std::cout << "device: " << queue.get_device().get_info<cl::sycl::info::device::name>()
+              << std::endl;
+
+    for (std::int64_t n : { 1 << 22, 1 << 24 }) {
+        double *x = cl::sycl::malloc_shared<double>(n, queue);
+        double *p = cl::sycl::malloc_shared<double>(n, queue);
+        double *r = cl::sycl::malloc_shared<double>(n, queue);
+        double *result = cl::sycl::malloc_shared<double>(2, queue);
+        for (std::int64_t i = 0; i < n; i++) {
+            x[i] = 0.0;
+            p[i] = 1.0 / (1 + i % 7);
+            r[i] = 1.0 / (1 + i % 5);
+        }
+        auto unfused = [&] {
+            blas::axpy(mklcpu, n, 1e-3, p, 1, x, 1).wait();
+            blas::axpy(mklcpu, n, -1e-3, p, 1, r, 1).wait();
+            blas::dot(mklcpu, n, r, 1, r, 1, result).wait();
+            blas::nrm2(mklcpu, n, x, 1, result + 1).wait();
+            blas::scal(mklcpu, n, 0.5, p, 1).wait();
+        };
+        auto fused = [&] {
+            oneapi::mkl::blas::mklcpu::level1_fusion fusion(queue);
+            fusion.axpy(n, 1e-3, p, 1, x, 1);
+            fusion.axpy(n, -1e-3, p, 1, r, 1);
+            fusion.dot(n, r, 1, r, 1, result);
+            fusion.nrm2(n, x, 1, result + 1);
+            fusion.scal(n, 0.5, p, 1);
+            fusion.flush().wait();
+        };
+        // Two flops per element for each of the five calls
+        const std::string size = " " + std::to_string(n);
+        bench::report("unfused" + size, bench::seconds_per_call(unfused), 10.0 * n);
+        bench::report("fused" + size, bench::seconds_per_call(fused), 10.0 * n);
+
+        cl::sycl::free(x, queue);
+        cl::sycl::free(p, queue);
+        cl::sycl::free(r, queue);
+        cl::sycl::free(result, queue);
+    }
+    return 0;
+}
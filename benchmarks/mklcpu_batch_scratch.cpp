@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Time per call of strided sgemv_batch and sgemm_batch of 4x4 matrices through the mklcpu
+// compile-time API, for batch sizes from 16 to 65536. The pointer arrays these calls build on the
+// host come from the thread-local scratch arena, so after the warm-up call they do not allocate.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <string>
+
+#include "bench_common.hpp"
+#include "oneapi/mkl.hpp"
+
+int main() {
+    namespace blas = oneapi::mkl::blas::column_major;
+    cl::sycl::queue queue(cl::sycl::cpu_selector{});
+    std::cout << "device: " << queue.get_device().get_info<cl::sycl::info::device::name>()
+              << std::endl;
+    const oneapi::mkl::backend_selector<oneapi::mkl::backend::mklcpu> mklcpu{ queue };
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    const std::int64_t n = 4, max_batch = 65536;
+    float *a = cl::sycl::malloc_shared<float>(n * n * max_batch, queue);
+    float *b = cl::sycl::malloc_shared<float>(n * n * max_batch, queue);
+    float *c = cl::sycl::malloc_shared<float>(n * n * max_batch, queue);
+    for (std::int64_t i = 0; i < n * n * max_batch; i++) {
+        a[i] = 1.0f / (1 + i % 7);
+        b[i] = 1.0f / (1 + i % 5);
+        c[i] = 0.0f;
+    }
+
+    for (std::int64_t batch : { std::int64_t(16), std::int64_t(1024), max_batch }) {
+        const std::string suffix = " " + std::to_string(batch) + " x " + std::to_string(n);
+        bench::report("sgemv_batch" + suffix, bench::seconds_per_call([&] {
+                          blas::gemv_batch(mklcpu, nontrans, n, n, 1.0f, a, n, n * n, b, 1, n, 0.0f,
+                                           c, 1, n, batch)
+                              .wait();
+                      }),
+                      2.0 * n * n * batch);
+        bench::report("sgemm_batch" + suffix, bench::seconds_per_call([&] {
+                          blas::gemm_batch(mklcpu, nontrans, nontrans, n, n, n, 1.0f, a, n, n * n,
+                                           b, n, n * n, 0.0f, c, n, n * n, batch)
+                              .wait();
+                      }),
+                      2.0 * n * n * n * batch);
+    }
+    cl::sycl::free(a, queue);
+    cl::sycl::free(b, queue);
+    cl::sycl::free(c, queue);
+    return 0;
+}
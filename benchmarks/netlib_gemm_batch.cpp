@@ -0,0 +1,71 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Time per call of strided gemm_batch through the netlib compile-time API, for batches of small
+// and medium square matrices in half, float and double precision.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <string>
+
+#include "bench_common.hpp"
+#include "oneapi/mkl.hpp"
+
+namespace {
+
+template <typename T>
+void run(cl::sycl::queue &queue, const std::string &name, std::int64_t n, std::int64_t batch) {
+    namespace blas = oneapi::mkl::blas::column_major;
+    const oneapi::mkl::backend_selector<oneapi::mkl::backend::netlib> netlib{ queue };
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    const std::int64_t stride = n * n;
+    T *a = cl::sycl::malloc_shared<T>(stride * batch, queue);
+    T *b = cl::sycl::malloc_shared<T>(stride * batch, queue);
+    T *c = cl::sycl::malloc_shared<T>(stride * batch, queue);
+    for (std::int64_t i = 0; i < stride * batch; i++) {
+        a[i] = T(1.0f / (1 + i % 7));
+        b[i] = T(1.0f / (1 + i % 5));
+        c[i] = T(0.0f);
+    }
+    bench::report(name + " " + std::to_string(batch) + " x " + std::to_string(n),
+                  bench::seconds_per_call([&] {
+                      blas::gemm_batch(netlib, nontrans, nontrans, n, n, n, T(1.0f), a, n, stride,
+                                       b, n, stride, T(0.0f), c, n, stride, batch)
+                          .wait();
+                  }),
+                  2.0 * n * n * n * batch);
+    cl::sycl::free(a, queue);
+    cl::sycl::free(b, queue);
+    cl::sycl::free(c, queue);
+}
+
+} // namespace
+
+int main() {
+    cl::sycl::queue queue(cl::sycl::cpu_selector{});
+    std::cout << "device: " << queue.get_device().get_info<cl::sycl::info::device::name>()
+              << std::endl;
+    for (std::int64_t n : { 16, 128 }) {
+        const std::int64_t batch = n == 16 ? 4096 : 64;
+        run<cl::sycl::half>(queue, "half", n, batch);
+        run<float>(queue, "float", n, batch);
+        run<double>(queue, "double", n, batch);
+    }
+    return 0;
+}
@@ -0,0 +1,72 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Time per call of strided gemv_batch through the netlib compile-time API, with one matrix per
+// item and with one matrix shared by the whole batch (matrix stride 0, which runs as gemm).
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <string>
+
+#include "bench_common.hpp"
+#include "oneapi/mkl.hpp"
+
+namespace {
+
+template <typename T>
+void run(cl::sycl::queue &queue, const std::string &name, std::int64_t n, std::int64_t batch) {
+    namespace blas = oneapi::mkl::blas::column_major;
+    const oneapi::mkl::backend_selector<oneapi::mkl::backend::netlib> netlib{ queue };
+    T *a = cl::sycl::malloc_shared<T>(n * n * batch, queue);
+    T *x = cl::sycl::malloc_shared<T>(n * batch, queue);
+    T *y = cl::sycl::malloc_shared<T>(n * batch, queue);
+    for (std::int64_t i = 0; i < n * n * batch; i++)
+        a[i] = T(1.0f / (1 + i % 7));
+    for (std::int64_t i = 0; i < n * batch; i++) {
+        x[i] = T(1.0f / (1 + i % 5));
+        y[i] = T(0.0f);
+    }
+    for (std::int64_t stride_a : { n * n, std::int64_t(0) }) {
+        bench::report(name + " " + std::to_string(batch) + " x " + std::to_string(n) +
+                          (stride_a == 0 ? " shared A" : ""),
+                      bench::seconds_per_call([&] {
+                          blas::gemv_batch(netlib, oneapi::mkl::transpose::nontrans, n, n, T(1.0f),
+                                           a, n, stride_a, x, 1, n, T(0.0f), y, 1, n, batch)
+                              .wait();
+                      }),
+                      2.0 * n * n * batch);
+    }
+    cl::sycl::free(a, queue);
+    cl::sycl::free(x, queue);
+    cl::sycl::free(y, queue);
+}
+
+} // namespace
+
+int main() {
+    cl::sycl::queue queue(cl::sycl::cpu_selector{});
+    std::cout << "device: " << queue.get_device().get_info<cl::sycl::info::device::name>()
+              << std::endl;
+    for (std::int64_t n : { 32, 256 }) {
+        const std::int64_t batch = n == 32 ? 4096 : 256;
+        run<float>(queue, "float", n, batch);
+        run<double>(queue, "double", n, batch);
+    }
+    return 0;
+}
@@ -0,0 +1,78 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Time per call of double precision gemm and trsm through the netlib compile-time API, with one
+// cblas call and with the work split into tiles over 2 and 4 level 3 threads.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <string>
+
+#include "bench_common.hpp"
+#include "oneapi/mkl.hpp"
+
+namespace {
+
+void run(cl::sycl::queue &queue, std::int64_t n, int threads) {
+    namespace blas = oneapi::mkl::blas::column_major;
+    const oneapi::mkl::backend_selector<oneapi::mkl::backend::netlib> netlib{ queue };
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    double *a = cl::sycl::malloc_shared<double>(n * n, queue);
+    double *b = cl::sycl::malloc_shared<double>(n * n, queue);
+    double *c = cl::sycl::malloc_shared<double>(n * n, queue);
+    for (std::int64_t i = 0; i < n * n; i++) {
+        a[i] = 1.0 / (1 + i % 7);
+        b[i] = 1.0 / (1 + i % 5);
+        c[i] = 0.0;
+    }
+    // A diagonally dominant triangle keeps the solves bounded.
+    for (std::int64_t i = 0; i < n; i++)
+        a[i + i * n] = double(n);
+
+    oneapi::mkl::blas::netlib::level3_threads_scope scope(netlib, threads);
+    const std::string suffix =
+        " " + std::to_string(n) + ", " + std::to_string(threads) + " threads";
+    bench::report("gemm" + suffix, bench::seconds_per_call([&] {
+                      blas::gemm(netlib, nontrans, nontrans, n, n, n, 1.0, a, n, b, n, 0.0, c, n)
+                          .wait();
+                  }),
+                  2.0 * n * n * n);
+    bench::report("trsm" + suffix, bench::seconds_per_call([&] {
+                      blas::trsm(netlib, oneapi::mkl::side::left, oneapi::mkl::uplo::lower,
+                                 nontrans, oneapi::mkl::diag::nonunit, n, n, 1.0, a, n, b, n)
+                          .wait();
+                  }),
+                  1.0 * n * n * n);
+    cl::sycl::free(a, queue);
+    cl::sycl::free(b, queue);
+    cl::sycl::free(c, queue);
+}
+
+} // namespace
+
+int main() {
+    cl::sycl::queue queue(cl::sycl::cpu_selector{});
+    std::cout << "device: " << queue.get_device().get_info<cl::sycl::info::device::name>()
+              << std::endl;
+    for (std::int64_t n : { 256, 1024 }) {
+        for (int threads : { 1, 2, 4 })
+            run(queue, n, threads);
+    }
+    return 0;
+}
@@ -0,0 +1,66 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Time per call of small double precision dot, gemv and gemm through the netlib compile-time API,
+// where the conversion of the integer arguments to the CBLAS integer type is part of the cost.
+// Comparing builds with and without ENABLE_NETLIB_ILP64 shows the cost of either integer size.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <string>
+
+#include "bench_common.hpp"
+#include "oneapi/mkl.hpp"
+
+int main() {
+    namespace blas = oneapi::mkl::blas::column_major;
+    cl::sycl::queue queue(cl::sycl::cpu_selector{});
+    std::cout << "device: " << queue.get_device().get_info<cl::sycl::info::device::name>()
+              << std::endl;
+    const oneapi::mkl::backend_selector<oneapi::mkl::backend::netlib> netlib{ queue };
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    const std::int64_t n = 8;
+    double *a = cl::sycl::malloc_shared<double>(n * n, queue);
+    double *x = cl::sycl::malloc_shared<double>(n, queue);
+    double *y = cl::sycl::malloc_shared<double>(n * n, queue);
+    for (std::int64_t i = 0; i < n * n; i++) {
+        a[i] = 1.0 / (1 + i % 7);
+        y[i] = 0.0;
+    }
+    for (std::int64_t i = 0; i < n; i++)
+        x[i] = 1.0 / (1 + i % 5);
+
+    bench::report("dot " + std::to_string(n), bench::seconds_per_call([&] {
+                      blas::dot(netlib, n, x, 1, x, 1, y).wait();
+                  }),
+                  2.0 * n);
+    bench::report("gemv " + std::to_string(n), bench::seconds_per_call([&] {
+                      blas::gemv(netlib, nontrans, n, n, 1.0, a, n, x, 1, 0.0, y, 1).wait();
+                  }),
+                  2.0 * n * n);
+    bench::report("gemm " + std::to_string(n), bench::seconds_per_call([&] {
+                      blas::gemm(netlib, nontrans, nontrans, n, n, n, 1.0, a, n, a, n, 0.0, y, n)
+                          .wait();
+                  }),
+                  2.0 * n * n * n);
+    cl::sycl::free(a, queue);
+    cl::sycl::free(x, queue);
+    cl::sycl::free(y, queue);
+    return 0;
+}
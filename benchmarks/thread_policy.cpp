@@ -0,0 +1,78 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Throughput of batches of independent medium-sized mklcpu sgemm calls submitted together to an
+// out-of-order queue, with every call using all MKL threads and with the shared thread policy.
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bench_common.hpp"
+#include "oneapi/mkl.hpp"
+
+namespace {
+
+void run(cl::sycl::queue &queue, const std::string &name, std::int64_t n, int calls) {
+    namespace blas = oneapi::mkl::blas::column_major;
+    const oneapi::mkl::backend_selector<oneapi::mkl::backend::mklcpu> mklcpu{ queue };
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    std::vector<float *> matrices;
+    for (int i = 0; i < 3 * calls; i++) {
+        float *x = cl::sycl::malloc_shared<float>(n * n, queue);
+        for (std::int64_t j = 0; j < n * n; j++)
+            x[j] = 1.0f / (1 + (i + j) % 7);
+        matrices.push_back(x);
+    }
+    auto batch = [&] {
+        std::vector<cl::sycl::event> events;
+        for (int i = 0; i < calls; i++) {
+            float *a = matrices[3 * i], *b = matrices[3 * i + 1], *c = matrices[3 * i + 2];
+            events.push_back(
+                blas::gemm(mklcpu, nontrans, nontrans, n, n, n, 1.0f, a, n, b, n, 0.0f, c, n));
+        }
+        for (auto &event : events)
+            event.wait();
+    };
+    bench::report(name + " " + std::to_string(calls) + " x " + std::to_string(n),
+                  bench::seconds_per_call(batch), 2.0 * calls * n * n * n);
+    for (float *x : matrices)
+        cl::sycl::free(x, queue);
+}
+
+} // namespace
+
+int main() {
+    namespace mklcpu = oneapi::mkl::blas::mklcpu;
+    cl::sycl::queue queue(cl::sycl::cpu_selector{});
+    std::cout << "device: " << queue.get_device().get_info<cl::sycl::info::device::name>()
+              << std::endl;
+    for (std::int64_t n : { 256, 512, 1024 }) {
+        {
+            mklcpu::thread_policy_scope scope(queue, mklcpu::thread_policy::unrestricted);
+            run(queue, "sgemm unrestricted", n, 8);
+        }
+        {
+            mklcpu::thread_policy_scope scope(queue, mklcpu::thread_policy::shared);
+            run(queue, "sgemm shared", n, 8);
+        }
+    }
+    return 0;
+}
@@ -20,9 +20,12 @@
 include_guard()
 
 include(FindPackageHandleStandardArgs)
-find_library(NETLIB_CBLAS_LIBRARY NAMES cblas.dll.lib cblas.lib cblas HINTS ${REF_BLAS_ROOT} PATH_SUFFIXES lib lib64)
+if(ENABLE_NETLIB_ILP64)
+  set(NETLIB_SUFFIX 64)
+endif()
+find_library(NETLIB_CBLAS_LIBRARY NAMES cblas${NETLIB_SUFFIX}.dll.lib cblas${NETLIB_SUFFIX}.lib cblas${NETLIB_SUFFIX} HINTS ${REF_BLAS_ROOT} PATH_SUFFIXES lib lib64)
 find_package_handle_standard_args(NETLIB REQUIRED_VARS NETLIB_CBLAS_LIBRARY)
-find_library(NETLIB_BLAS_LIBRARY NAMES blas.dll.lib blas.lib blas HINTS ${REF_BLAS_ROOT} PATH_SUFFIXES lib lib64)
+find_library(NETLIB_BLAS_LIBRARY NAMES blas${NETLIB_SUFFIX}.dll.lib blas${NETLIB_SUFFIX}.lib blas${NETLIB_SUFFIX} HINTS ${REF_BLAS_ROOT} PATH_SUFFIXES lib lib64)
 find_package_handle_standard_args(NETLIB REQUIRED_VARS NETLIB_BLAS_LIBRARY)
 
 get_filename_component(NETLIB_LIB_DIR ${NETLIB_CBLAS_LIBRARY} DIRECTORY)
@@ -42,6 +42,11 @@ find_library(TBB_LIBRARIES NAMES tbb
                  "../tbb/lib/intel64/vc14" "lib/intel64/vc14"
                  )
 
+find_path(TBB_INCLUDE tbb/tbb.h
+        HINTS $ENV{TBBROOT} $ENV{MKLROOT} ${MKL_ROOT} ${TBB_ROOT}
+        PATH_SUFFIXES "include" "../tbb/include" "../../tbb/latest/include"
+)
+
 #Workaround for ref problem
 if(UNIX)
   set(TBB_LINK "-Wl,-rpath,${TBB_LIB_DIR} -L${TBB_LIB_DIR} -ltbb")
@@ -49,5 +54,5 @@ else()
   set(TBB_LINK ${TBB_LIBRARIES})
 endif()
 include(FindPackageHandleStandardArgs)
-find_package_handle_standard_args(TBB REQUIRED_VARS TBB_LIBRARIES TBB_LINK)
+find_package_handle_standard_args(TBB REQUIRED_VARS TBB_LIBRARIES TBB_LINK TBB_INCLUDE)
 
@@ -26,4 +26,7 @@
 #include "oneapi/mkl/lapack.hpp"
 #include "oneapi/mkl/rng.hpp"
 
+#include "oneapi/mkl/preload.hpp"
+#include "oneapi/mkl/stats.hpp"
+
 #endif //_ONEMKL_HPP_
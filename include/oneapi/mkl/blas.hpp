@@ -28,10 +28,12 @@
 #include "oneapi/mkl/types.hpp"
 
 #include "oneapi/mkl/detail/get_device_id.hpp"
+#include "oneapi/mkl/preload.hpp"
 
 #include "oneapi/mkl/blas/predicates.hpp"
 
 #include "oneapi/mkl/blas/detail/blas_loader.hpp"
+#include "oneapi/mkl/blas/detail/pointer_traits.hpp"
 #ifdef ENABLE_CUBLAS_BACKEND
 #include "oneapi/mkl/blas/detail/cublas/blas_ct.hpp"
 #endif
@@ -51,11 +53,13 @@ namespace blas {
 namespace column_major {
 
 #include "blas.hxx"
+#include "oneapi/mkl/blas/context.hxx"
 
 } //namespace column_major
 namespace row_major {
 
 #include "blas.hxx"
+#include "oneapi/mkl/blas/context.hxx"
 
 } //namespace row_major
 } //namespace blas
@@ -0,0 +1,4669 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Generated by scripts/generate_context.py from blas.hxx, do not edit.
+//
+// Execution context of the run-time API bound to one queue. The device id is resolved, the
+// backend is loaded and, unless size-based routing is configured, its function table is looked
+// up once on construction, so calls skip device classification, routing and the table lookup.
+class context {
+public:
+    explicit context(cl::sycl::queue queue)
+            : queue_(queue),
+              device_id_(get_device_id(queue_)),
+              backend_(detail::resolve_backend(device_id_)) {}
+
+    cl::sycl::queue &get_queue() {
+        return queue_;
+    }
+
+    oneapi::mkl::device get_device() const {
+        return device_id_;
+    }
+
+    // Buffer APIs
+
+    void asum(std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<float, 1> &result) {
+        asum_precondition(queue_, n, x, incx, result);
+        detail::asum(backend_, queue_, n, x, incx, result);
+        asum_postcondition(queue_, n, x, incx, result);
+    }
+
+    void asum(std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<double, 1> &result) {
+        asum_precondition(queue_, n, x, incx, result);
+        detail::asum(backend_, queue_, n, x, incx, result);
+        asum_postcondition(queue_, n, x, incx, result);
+    }
+
+    void asum(std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<float, 1> &result) {
+        asum_precondition(queue_, n, x, incx, result);
+        detail::asum(backend_, queue_, n, x, incx, result);
+        asum_postcondition(queue_, n, x, incx, result);
+    }
+
+    void asum(std::int64_t n, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<double, 1> &result) {
+        asum_precondition(queue_, n, x, incx, result);
+        detail::asum(backend_, queue_, n, x, incx, result);
+        asum_postcondition(queue_, n, x, incx, result);
+    }
+
+    void axpy(std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+        axpy_precondition(queue_, n, alpha, x, incx, y, incy);
+        detail::axpy(backend_, queue_, n, alpha, x, incx, y, incy);
+        axpy_postcondition(queue_, n, alpha, x, incx, y, incy);
+    }
+
+    void axpy(std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+        axpy_precondition(queue_, n, alpha, x, incx, y, incy);
+        detail::axpy(backend_, queue_, n, alpha, x, incx, y, incy);
+        axpy_postcondition(queue_, n, alpha, x, incx, y, incy);
+    }
+
+    void axpy(std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+        axpy_precondition(queue_, n, alpha, x, incx, y, incy);
+        detail::axpy(backend_, queue_, n, alpha, x, incx, y, incy);
+        axpy_postcondition(queue_, n, alpha, x, incx, y, incy);
+    }
+
+    void axpy(std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+        axpy_precondition(queue_, n, alpha, x, incx, y, incy);
+        detail::axpy(backend_, queue_, n, alpha, x, incx, y, incy);
+        axpy_postcondition(queue_, n, alpha, x, incx, y, incy);
+    }
+
+    void axpy_batch(std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                    std::int64_t stridex, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                    std::int64_t stridey, std::int64_t batch_size) {
+        axpy_batch_precondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+        detail::axpy_batch(backend_, queue_, n, alpha, x, incx, stridex, y, incy, stridey,
+                           batch_size);
+        axpy_batch_postcondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    }
+
+    void axpy_batch(std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                    std::int64_t stridex, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                    std::int64_t stridey, std::int64_t batch_size) {
+        axpy_batch_precondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+        detail::axpy_batch(backend_, queue_, n, alpha, x, incx, stridex, y, incy, stridey,
+                           batch_size);
+        axpy_batch_postcondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    }
+
+    void axpy_batch(std::int64_t n, std::complex<float> alpha,
+                    cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                    std::int64_t stridex, cl::sycl::buffer<std::complex<float>, 1> &y,
+                    std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
+        axpy_batch_precondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+        detail::axpy_batch(backend_, queue_, n, alpha, x, incx, stridex, y, incy, stridey,
+                           batch_size);
+        axpy_batch_postcondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    }
+
+    void axpy_batch(std::int64_t n, std::complex<double> alpha,
+                    cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                    std::int64_t stridex, cl::sycl::buffer<std::complex<double>, 1> &y,
+                    std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
+        axpy_batch_precondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+        detail::axpy_batch(backend_, queue_, n, alpha, x, incx, stridex, y, incy, stridey,
+                           batch_size);
+        axpy_batch_postcondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+    }
+
+    void axpby(std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+               float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+        axpby_precondition(queue_, n, alpha, x, incx, beta, y, incy);
+        detail::axpby(backend_, queue_, n, alpha, x, incx, beta, y, incy);
+        axpby_postcondition(queue_, n, alpha, x, incx, beta, y, incy);
+    }
+
+    void axpby(std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+               double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+        axpby_precondition(queue_, n, alpha, x, incx, beta, y, incy);
+        detail::axpby(backend_, queue_, n, alpha, x, incx, beta, y, incy);
+        axpby_postcondition(queue_, n, alpha, x, incx, beta, y, incy);
+    }
+
+    void axpby(std::int64_t n, std::complex<float> alpha,
+               cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+               std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
+               std::int64_t incy) {
+        axpby_precondition(queue_, n, alpha, x, incx, beta, y, incy);
+        detail::axpby(backend_, queue_, n, alpha, x, incx, beta, y, incy);
+        axpby_postcondition(queue_, n, alpha, x, incx, beta, y, incy);
+    }
+
+    void axpby(std::int64_t n, std::complex<double> alpha,
+               cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+               std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+               std::int64_t incy) {
+        axpby_precondition(queue_, n, alpha, x, incx, beta, y, incy);
+        detail::axpby(backend_, queue_, n, alpha, x, incx, beta, y, incy);
+        axpby_postcondition(queue_, n, alpha, x, incx, beta, y, incy);
+    }
+
+    void copy(std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+        copy_precondition(queue_, n, x, incx, y, incy);
+        detail::copy(backend_, queue_, n, x, incx, y, incy);
+        copy_postcondition(queue_, n, x, incx, y, incy);
+    }
+
+    void copy(std::int64_t n, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+        copy_precondition(queue_, n, x, incx, y, incy);
+        detail::copy(backend_, queue_, n, x, incx, y, incy);
+        copy_postcondition(queue_, n, x, incx, y, incy);
+    }
+
+    void copy(std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+        copy_precondition(queue_, n, x, incx, y, incy);
+        detail::copy(backend_, queue_, n, x, incx, y, incy);
+        copy_postcondition(queue_, n, x, incx, y, incy);
+    }
+
+    void copy(std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+        copy_precondition(queue_, n, x, incx, y, incy);
+        detail::copy(backend_, queue_, n, x, incx, y, incy);
+        copy_postcondition(queue_, n, x, incx, y, incy);
+    }
+
+    void copy_batch(std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                    std::int64_t stridex, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                    std::int64_t stridey, std::int64_t batch_size) {
+        copy_batch_precondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size);
+        detail::copy_batch(backend_, queue_, n, x, incx, stridex, y, incy, stridey, batch_size);
+        copy_batch_postcondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size);
+    }
+
+    void copy_batch(std::int64_t n, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+                    std::int64_t stridex, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                    std::int64_t stridey, std::int64_t batch_size) {
+        copy_batch_precondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size);
+        detail::copy_batch(backend_, queue_, n, x, incx, stridex, y, incy, stridey, batch_size);
+        copy_batch_postcondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size);
+    }
+
+    void copy_batch(std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+                    std::int64_t stridex, cl::sycl::buffer<std::complex<float>, 1> &y,
+                    std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
+        copy_batch_precondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size);
+        detail::copy_batch(backend_, queue_, n, x, incx, stridex, y, incy, stridey, batch_size);
+        copy_batch_postcondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size);
+    }
+
+    void copy_batch(std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+                    std::int64_t stridex, cl::sycl::buffer<std::complex<double>, 1> &y,
+                    std::int64_t incy, std::int64_t stridey, std::int64_t batch_size) {
+        copy_batch_precondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size);
+        detail::copy_batch(backend_, queue_, n, x, incx, stridex, y, incy, stridey, batch_size);
+        copy_batch_postcondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size);
+    }
+
+    void dot(std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+             cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &result) {
+        dot_precondition(queue_, n, x, incx, y, incy, result);
+        detail::dot(backend_, queue_, n, x, incx, y, incy, result);
+        dot_postcondition(queue_, n, x, incx, y, incy, result);
+    }
+
+    void dot(std::int64_t n, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+             cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+             cl::sycl::buffer<double, 1> &result) {
+        dot_precondition(queue_, n, x, incx, y, incy, result);
+        detail::dot(backend_, queue_, n, x, incx, y, incy, result);
+        dot_postcondition(queue_, n, x, incx, y, incy, result);
+    }
+
+    void dot(std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+             cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+             cl::sycl::buffer<double, 1> &result) {
+        dot_precondition(queue_, n, x, incx, y, incy, result);
+        detail::dot(backend_, queue_, n, x, incx, y, incy, result);
+        dot_postcondition(queue_, n, x, incx, y, incy, result);
+    }
+
+    void dotc(std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<std::complex<float>, 1> &result) {
+        dotc_precondition(queue_, n, x, incx, y, incy, result);
+        detail::dotc(backend_, queue_, n, x, incx, y, incy, result);
+        dotc_postcondition(queue_, n, x, incx, y, incy, result);
+    }
+
+    void dotc(std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<std::complex<double>, 1> &result) {
+        dotc_precondition(queue_, n, x, incx, y, incy, result);
+        detail::dotc(backend_, queue_, n, x, incx, y, incy, result);
+        dotc_postcondition(queue_, n, x, incx, y, incy, result);
+    }
+
+    void dotu(std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<std::complex<float>, 1> &result) {
+        dotu_precondition(queue_, n, x, incx, y, incy, result);
+        detail::dotu(backend_, queue_, n, x, incx, y, incy, result);
+        dotu_postcondition(queue_, n, x, incx, y, incy, result);
+    }
+
+    void dotu(std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<std::complex<double>, 1> &result) {
+        dotu_precondition(queue_, n, x, incx, y, incy, result);
+        detail::dotu(backend_, queue_, n, x, incx, y, incy, result);
+        dotu_postcondition(queue_, n, x, incx, y, incy, result);
+    }
+
+    void gbmv(transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
+              float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+              cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+        gbmv_precondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
+        detail::gbmv(backend_, queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
+        gbmv_postcondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void gbmv(transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
+              double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+              cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+        gbmv_precondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
+        detail::gbmv(backend_, queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
+        gbmv_postcondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void gbmv(transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
+              std::int64_t incy) {
+        gbmv_precondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
+        detail::gbmv(backend_, queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
+        gbmv_postcondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void gbmv(transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+              std::int64_t incy) {
+        gbmv_precondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
+        detail::gbmv(backend_, queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
+        gbmv_postcondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void gemm(transpose transa, transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+              float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+              cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+        gemm_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        detail::gemm(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                     ldc);
+        gemm_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+    void gemm(transpose transa, transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+              double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+              cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+        gemm_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        detail::gemm(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                     ldc);
+        gemm_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+    void gemm(transpose transa, transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+              std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+              std::int64_t ldc) {
+        gemm_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        detail::gemm(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                     ldc);
+        gemm_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+    void gemm(transpose transa, transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+              std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+              std::int64_t ldc) {
+        gemm_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        detail::gemm(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                     ldc);
+        gemm_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+    void gemm(transpose transa, transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+              half alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
+              cl::sycl::buffer<half, 1> &c, std::int64_t ldc) {
+        gemm_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        detail::gemm(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                     ldc);
+        gemm_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+    void gemm(transpose transa, transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+              float alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<half, 1> &b, std::int64_t ldb, float beta,
+              cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+        gemm_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        detail::gemm(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                     ldc);
+        gemm_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+    void gemm(transpose transa, transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+              float alpha, cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
+              cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+        gemm_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        detail::gemm(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                     ldc);
+        gemm_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+    void gemm_batch(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                    std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, float beta, cl::sycl::buffer<float, 1> &c,
+                    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+        gemm_batch_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size);
+        detail::gemm_batch(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b,
+                           ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+        gemm_batch_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                 stride_b, beta, c, ldc, stride_c, batch_size);
+    }
+
+    void gemm_batch(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                    std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, double beta, cl::sycl::buffer<double, 1> &c,
+                    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+        gemm_batch_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size);
+        detail::gemm_batch(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b,
+                           ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+        gemm_batch_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                 stride_b, beta, c, ldc, stride_c, batch_size);
+    }
+
+    void gemm_batch(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                    std::int64_t k, std::complex<float> alpha,
+                    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
+                    cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                    std::int64_t stride_c, std::int64_t batch_size) {
+        gemm_batch_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size);
+        detail::gemm_batch(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b,
+                           ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+        gemm_batch_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                 stride_b, beta, c, ldc, stride_c, batch_size);
+    }
+
+    void gemm_batch(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                    std::int64_t k, std::complex<double> alpha,
+                    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
+                    cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                    std::int64_t stride_c, std::int64_t batch_size) {
+        gemm_batch_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size);
+        detail::gemm_batch(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b,
+                           ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+        gemm_batch_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                 stride_b, beta, c, ldc, stride_c, batch_size);
+    }
+
+    void gemm_batch(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                    std::int64_t k, half alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<half, 1> &b, std::int64_t ldb,
+                    std::int64_t stride_b, half beta, cl::sycl::buffer<half, 1> &c,
+                    std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+        gemm_batch_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size);
+        detail::gemm_batch(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b,
+                           ldb, stride_b, beta, c, ldc, stride_c, batch_size);
+        gemm_batch_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                 stride_b, beta, c, ldc, stride_c, batch_size);
+    }
+
+    void gemm_bias(transpose transa, transpose transb, offset offsetc, std::int64_t m,
+                   std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &a,
+                   std::int64_t lda, int8_t ao, cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+                   uint8_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                   cl::sycl::buffer<int32_t, 1> &co) {
+        gemm_bias_precondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                               bo, beta, c, ldc, co);
+        detail::gemm_bias(backend_, queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b,
+                          ldb, bo, beta, c, ldc, co);
+        gemm_bias_postcondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                                bo, beta, c, ldc, co);
+    }
+
+    void gemm_bias(transpose transa, transpose transb, offset offsetc, std::int64_t m,
+                   std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &a,
+                   std::int64_t lda, int8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb,
+                   int8_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                   cl::sycl::buffer<int32_t, 1> &co) {
+        gemm_bias_precondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                               bo, beta, c, ldc, co);
+        detail::gemm_bias(backend_, queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b,
+                          ldb, bo, beta, c, ldc, co);
+        gemm_bias_postcondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                                bo, beta, c, ldc, co);
+    }
+
+    void gemm_bias(transpose transa, transpose transb, offset offsetc, std::int64_t m,
+                   std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<uint8_t, 1> &a,
+                   std::int64_t lda, uint8_t ao, cl::sycl::buffer<int8_t, 1> &b, std::int64_t ldb,
+                   int8_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                   cl::sycl::buffer<int32_t, 1> &co) {
+        gemm_bias_precondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                               bo, beta, c, ldc, co);
+        detail::gemm_bias(backend_, queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b,
+                          ldb, bo, beta, c, ldc, co);
+        gemm_bias_postcondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                                bo, beta, c, ldc, co);
+    }
+
+    void gemm_bias(transpose transa, transpose transb, offset offsetc, std::int64_t m,
+                   std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<uint8_t, 1> &a,
+                   std::int64_t lda, uint8_t ao, cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb,
+                   uint8_t bo, float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
+                   cl::sycl::buffer<int32_t, 1> &co) {
+        gemm_bias_precondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                               bo, beta, c, ldc, co);
+        detail::gemm_bias(backend_, queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b,
+                          ldb, bo, beta, c, ldc, co);
+        gemm_bias_postcondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                                bo, beta, c, ldc, co);
+    }
+
+    // gemm_pack stores alpha * op(X), X = A (m x k) or B (k x n) as given by which, in a backend
+    // specific format of gemm_pack_get_size<T> elements. gemm_compute multiplies the packed
+    // operand with the other one, transposed by trans, and adds beta * C, so the packing is
+    // reused across calls.
+    template <typename T>
+    std::int64_t gemm_pack_get_size(identifier which, std::int64_t m, std::int64_t n,
+                                    std::int64_t k) {
+        return detail::gemm_pack_get_size<T>(backend_, queue_, which, m, n, k);
+    }
+
+    void gemm_pack(identifier which, transpose trans, std::int64_t m, std::int64_t n,
+                   std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &src, std::int64_t ld,
+                   cl::sycl::buffer<float, 1> &dest) {
+        gemm_pack_precondition(queue_, which, trans, m, n, k, alpha, src, ld, dest);
+        detail::gemm_pack(backend_, queue_, which, trans, m, n, k, alpha, src, ld, dest);
+        gemm_pack_postcondition(queue_, which, trans, m, n, k, alpha, src, ld, dest);
+    }
+
+    void gemm_pack(identifier which, transpose trans, std::int64_t m, std::int64_t n,
+                   std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &src, std::int64_t ld,
+                   cl::sycl::buffer<double, 1> &dest) {
+        gemm_pack_precondition(queue_, which, trans, m, n, k, alpha, src, ld, dest);
+        detail::gemm_pack(backend_, queue_, which, trans, m, n, k, alpha, src, ld, dest);
+        gemm_pack_postcondition(queue_, which, trans, m, n, k, alpha, src, ld, dest);
+    }
+
+    void gemm_compute(identifier which, transpose trans, std::int64_t m, std::int64_t n,
+                      std::int64_t k, cl::sycl::buffer<float, 1> &packed,
+                      cl::sycl::buffer<float, 1> &other, std::int64_t ld, float beta,
+                      cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+        gemm_compute_precondition(queue_, which, trans, m, n, k, packed, other, ld, beta, c, ldc);
+        detail::gemm_compute(backend_, queue_, which, trans, m, n, k, packed, other, ld, beta, c,
+                             ldc);
+        gemm_compute_postcondition(queue_, which, trans, m, n, k, packed, other, ld, beta, c, ldc);
+    }
+
+    void gemm_compute(identifier which, transpose trans, std::int64_t m, std::int64_t n,
+                      std::int64_t k, cl::sycl::buffer<double, 1> &packed,
+                      cl::sycl::buffer<double, 1> &other, std::int64_t ld, double beta,
+                      cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+        gemm_compute_precondition(queue_, which, trans, m, n, k, packed, other, ld, beta, c, ldc);
+        detail::gemm_compute(backend_, queue_, which, trans, m, n, k, packed, other, ld, beta, c,
+                             ldc);
+        gemm_compute_postcondition(queue_, which, trans, m, n, k, packed, other, ld, beta, c, ldc);
+    }
+
+    // gemm3m computes the complex gemm with three real matrix products instead of four, which
+    // saves about 25% of the floating point operations at the cost of slightly different
+    // rounding.
+    void gemm3m(transpose transa, transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+                std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+                std::int64_t ldc) {
+        gemm3m_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        detail::gemm3m(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                       ldc);
+        gemm3m_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+    void gemm3m(transpose transa, transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+                std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+                std::int64_t ldc) {
+        gemm3m_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        detail::gemm3m(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                       ldc);
+        gemm3m_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+    void gemmt(uplo upper_lower, transpose transa, transpose transb, std::int64_t n, std::int64_t k,
+               float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+               cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
+               cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+        gemmt_precondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                           c, ldc);
+        detail::gemmt(backend_, queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb,
+                      beta, c, ldc);
+        gemmt_postcondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                            c, ldc);
+    }
+
+    void gemmt(uplo upper_lower, transpose transa, transpose transb, std::int64_t n, std::int64_t k,
+               double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+               cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
+               cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+        gemmt_precondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                           c, ldc);
+        detail::gemmt(backend_, queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb,
+                      beta, c, ldc);
+        gemmt_postcondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                            c, ldc);
+    }
+
+    void gemmt(uplo upper_lower, transpose transa, transpose transb, std::int64_t n, std::int64_t k,
+               std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+               std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+               std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+               std::int64_t ldc) {
+        gemmt_precondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                           c, ldc);
+        detail::gemmt(backend_, queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb,
+                      beta, c, ldc);
+        gemmt_postcondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                            c, ldc);
+    }
+
+    void gemmt(uplo upper_lower, transpose transa, transpose transb, std::int64_t n, std::int64_t k,
+               std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+               std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+               std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+               std::int64_t ldc) {
+        gemmt_precondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                           c, ldc);
+        detail::gemmt(backend_, queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb,
+                      beta, c, ldc);
+        gemmt_postcondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                            c, ldc);
+    }
+
+    void gemv(transpose trans, std::int64_t m, std::int64_t n, float alpha,
+              cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &x,
+              std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+        gemv_precondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+        detail::gemv(backend_, queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+        gemv_postcondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void gemv(transpose trans, std::int64_t m, std::int64_t n, double alpha,
+              cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &x,
+              std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+        gemv_precondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+        detail::gemv(backend_, queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+        gemv_postcondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void gemv(transpose trans, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
+              std::int64_t incy) {
+        gemv_precondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+        detail::gemv(backend_, queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+        gemv_postcondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void gemv(transpose trans, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+              std::int64_t incy) {
+        gemv_precondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+        detail::gemv(backend_, queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+        gemv_postcondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void gemv_batch(transpose trans, std::int64_t m, std::int64_t n, float alpha,
+                    cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stridea,
+                    cl::sycl::buffer<float, 1> &x, std::int64_t incx, std::int64_t stridex,
+                    float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                    std::int64_t stridey, std::int64_t batch_size) {
+        gemv_batch_precondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size);
+        detail::gemv_batch(backend_, queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex,
+                           beta, y, incy, stridey, batch_size);
+        gemv_batch_postcondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex,
+                                 beta, y, incy, stridey, batch_size);
+    }
+
+    void gemv_batch(transpose trans, std::int64_t m, std::int64_t n, double alpha,
+                    cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stridea,
+                    cl::sycl::buffer<double, 1> &x, std::int64_t incx, std::int64_t stridex,
+                    double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+                    std::int64_t stridey, std::int64_t batch_size) {
+        gemv_batch_precondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size);
+        detail::gemv_batch(backend_, queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex,
+                           beta, y, incy, stridey, batch_size);
+        gemv_batch_postcondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex,
+                                 beta, y, incy, stridey, batch_size);
+    }
+
+    void gemv_batch(transpose trans, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                    std::int64_t stridea, cl::sycl::buffer<std::complex<float>, 1> &x,
+                    std::int64_t incx, std::int64_t stridex, std::complex<float> beta,
+                    cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+                    std::int64_t stridey, std::int64_t batch_size) {
+        gemv_batch_precondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size);
+        detail::gemv_batch(backend_, queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex,
+                           beta, y, incy, stridey, batch_size);
+        gemv_batch_postcondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex,
+                                 beta, y, incy, stridey, batch_size);
+    }
+
+    void gemv_batch(transpose trans, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                    std::int64_t stridea, cl::sycl::buffer<std::complex<double>, 1> &x,
+                    std::int64_t incx, std::int64_t stridex, std::complex<double> beta,
+                    cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+                    std::int64_t stridey, std::int64_t batch_size) {
+        gemv_batch_precondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size);
+        detail::gemv_batch(backend_, queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex,
+                           beta, y, incy, stridey, batch_size);
+        gemv_batch_postcondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex,
+                                 beta, y, incy, stridey, batch_size);
+    }
+
+    void dgmm_batch(side left_right, std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
+                    std::int64_t lda, std::int64_t stridea, cl::sycl::buffer<float, 1> &x,
+                    std::int64_t incx, std::int64_t stridex, cl::sycl::buffer<float, 1> &c,
+                    std::int64_t ldc, std::int64_t stridec, std::int64_t batch_size) {
+        dgmm_batch_precondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size);
+        detail::dgmm_batch(backend_, queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c,
+                           ldc, stridec, batch_size);
+        dgmm_batch_postcondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c,
+                                 ldc, stridec, batch_size);
+    }
+
+    void dgmm_batch(side left_right, std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
+                    std::int64_t lda, std::int64_t stridea, cl::sycl::buffer<double, 1> &x,
+                    std::int64_t incx, std::int64_t stridex, cl::sycl::buffer<double, 1> &c,
+                    std::int64_t ldc, std::int64_t stridec, std::int64_t batch_size) {
+        dgmm_batch_precondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size);
+        detail::dgmm_batch(backend_, queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c,
+                           ldc, stridec, batch_size);
+        dgmm_batch_postcondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c,
+                                 ldc, stridec, batch_size);
+    }
+
+    void dgmm_batch(side left_right, std::int64_t m, std::int64_t n,
+                    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                    std::int64_t stridea, cl::sycl::buffer<std::complex<float>, 1> &x,
+                    std::int64_t incx, std::int64_t stridex,
+                    cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                    std::int64_t stridec, std::int64_t batch_size) {
+        dgmm_batch_precondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size);
+        detail::dgmm_batch(backend_, queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c,
+                           ldc, stridec, batch_size);
+        dgmm_batch_postcondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c,
+                                 ldc, stridec, batch_size);
+    }
+
+    void dgmm_batch(side left_right, std::int64_t m, std::int64_t n,
+                    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                    std::int64_t stridea, cl::sycl::buffer<std::complex<double>, 1> &x,
+                    std::int64_t incx, std::int64_t stridex,
+                    cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                    std::int64_t stridec, std::int64_t batch_size) {
+        dgmm_batch_precondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size);
+        detail::dgmm_batch(backend_, queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c,
+                           ldc, stridec, batch_size);
+        dgmm_batch_postcondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c,
+                                 ldc, stridec, batch_size);
+    }
+
+    void ger(std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+             std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+             cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
+        ger_precondition(queue_, m, n, alpha, x, incx, y, incy, a, lda);
+        detail::ger(backend_, queue_, m, n, alpha, x, incx, y, incy, a, lda);
+        ger_postcondition(queue_, m, n, alpha, x, incx, y, incy, a, lda);
+    }
+
+    void ger(std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+             std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+             cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
+        ger_precondition(queue_, m, n, alpha, x, incx, y, incy, a, lda);
+        detail::ger(backend_, queue_, m, n, alpha, x, incx, y, incy, a, lda);
+        ger_postcondition(queue_, m, n, alpha, x, incx, y, incy, a, lda);
+    }
+
+    void gerc(std::int64_t m, std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+        gerc_precondition(queue_, m, n, alpha, x, incx, y, incy, a, lda);
+        detail::gerc(backend_, queue_, m, n, alpha, x, incx, y, incy, a, lda);
+        gerc_postcondition(queue_, m, n, alpha, x, incx, y, incy, a, lda);
+    }
+
+    void gerc(std::int64_t m, std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+        gerc_precondition(queue_, m, n, alpha, x, incx, y, incy, a, lda);
+        detail::gerc(backend_, queue_, m, n, alpha, x, incx, y, incy, a, lda);
+        gerc_postcondition(queue_, m, n, alpha, x, incx, y, incy, a, lda);
+    }
+
+    void geru(std::int64_t m, std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+        geru_precondition(queue_, m, n, alpha, x, incx, y, incy, a, lda);
+        detail::geru(backend_, queue_, m, n, alpha, x, incx, y, incy, a, lda);
+        geru_postcondition(queue_, m, n, alpha, x, incx, y, incy, a, lda);
+    }
+
+    void geru(std::int64_t m, std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+        geru_precondition(queue_, m, n, alpha, x, incx, y, incy, a, lda);
+        detail::geru(backend_, queue_, m, n, alpha, x, incx, y, incy, a, lda);
+        geru_postcondition(queue_, m, n, alpha, x, incx, y, incy, a, lda);
+    }
+
+    void hbmv(uplo upper_lower, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
+              std::int64_t incy) {
+        hbmv_precondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
+        detail::hbmv(backend_, queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
+        hbmv_postcondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void hbmv(uplo upper_lower, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+              std::int64_t incy) {
+        hbmv_precondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
+        detail::hbmv(backend_, queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
+        hbmv_postcondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void hemm(side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+              std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+              std::int64_t ldc) {
+        hemm_precondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                          ldc);
+        detail::hemm(backend_, queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta,
+                     c, ldc);
+        hemm_postcondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                           ldc);
+    }
+
+    void hemm(side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+              std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+              std::int64_t ldc) {
+        hemm_precondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                          ldc);
+        detail::hemm(backend_, queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta,
+                     c, ldc);
+        hemm_postcondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                           ldc);
+    }
+
+    void hemv(uplo upper_lower, std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
+              std::int64_t incy) {
+        hemv_precondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
+        detail::hemv(backend_, queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
+        hemv_postcondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void hemv(uplo upper_lower, std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+              std::int64_t incy) {
+        hemv_precondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
+        detail::hemv(backend_, queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
+        hemv_postcondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void her(uplo upper_lower, std::int64_t n, float alpha,
+             cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+             cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+        her_precondition(queue_, upper_lower, n, alpha, x, incx, a, lda);
+        detail::her(backend_, queue_, upper_lower, n, alpha, x, incx, a, lda);
+        her_postcondition(queue_, upper_lower, n, alpha, x, incx, a, lda);
+    }
+
+    void her(uplo upper_lower, std::int64_t n, double alpha,
+             cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+             cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+        her_precondition(queue_, upper_lower, n, alpha, x, incx, a, lda);
+        detail::her(backend_, queue_, upper_lower, n, alpha, x, incx, a, lda);
+        her_postcondition(queue_, upper_lower, n, alpha, x, incx, a, lda);
+    }
+
+    void her2(uplo upper_lower, std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda) {
+        her2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+        detail::her2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+        her2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+    }
+
+    void her2(uplo upper_lower, std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda) {
+        her2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+        detail::her2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+        her2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+    }
+
+    void her2k(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+               std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+               std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+               float beta, cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+        her2k_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        detail::her2k(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c,
+                      ldc);
+        her2k_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+    void her2k(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+               std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+               std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+               double beta, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+        her2k_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        detail::her2k(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c,
+                      ldc);
+        her2k_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+    void herk(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, float beta,
+              cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+        herk_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+        detail::herk(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+        herk_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+    }
+
+    void herk(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k, double alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, double beta,
+              cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+        herk_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+        detail::herk(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+        herk_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+    }
+
+    void hpmv(uplo upper_lower, std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &a,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
+              std::int64_t incy) {
+        hpmv_precondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+        detail::hpmv(backend_, queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+        hpmv_postcondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+    }
+
+    void hpmv(uplo upper_lower, std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &a,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
+              std::int64_t incy) {
+        hpmv_precondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+        detail::hpmv(backend_, queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+        hpmv_postcondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+    }
+
+    void hpr(uplo upper_lower, std::int64_t n, float alpha,
+             cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+             cl::sycl::buffer<std::complex<float>, 1> &a) {
+        hpr_precondition(queue_, upper_lower, n, alpha, x, incx, a);
+        detail::hpr(backend_, queue_, upper_lower, n, alpha, x, incx, a);
+        hpr_postcondition(queue_, upper_lower, n, alpha, x, incx, a);
+    }
+
+    void hpr(uplo upper_lower, std::int64_t n, double alpha,
+             cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+             cl::sycl::buffer<std::complex<double>, 1> &a) {
+        hpr_precondition(queue_, upper_lower, n, alpha, x, incx, a);
+        detail::hpr(backend_, queue_, upper_lower, n, alpha, x, incx, a);
+        hpr_postcondition(queue_, upper_lower, n, alpha, x, incx, a);
+    }
+
+    void hpr2(uplo upper_lower, std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<std::complex<float>, 1> &a) {
+        hpr2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a);
+        detail::hpr2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a);
+        hpr2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a);
+    }
+
+    void hpr2(uplo upper_lower, std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<std::complex<double>, 1> &a) {
+        hpr2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a);
+        detail::hpr2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a);
+        hpr2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a);
+    }
+
+    void iamax(std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+               cl::sycl::buffer<std::int64_t, 1> &result) {
+        iamax_precondition(queue_, n, x, incx, result);
+        detail::iamax(backend_, queue_, n, x, incx, result);
+        iamax_postcondition(queue_, n, x, incx, result);
+    }
+
+    void iamax(std::int64_t n, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+               cl::sycl::buffer<std::int64_t, 1> &result) {
+        iamax_precondition(queue_, n, x, incx, result);
+        detail::iamax(backend_, queue_, n, x, incx, result);
+        iamax_postcondition(queue_, n, x, incx, result);
+    }
+
+    void iamax(std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+               cl::sycl::buffer<std::int64_t, 1> &result) {
+        iamax_precondition(queue_, n, x, incx, result);
+        detail::iamax(backend_, queue_, n, x, incx, result);
+        iamax_postcondition(queue_, n, x, incx, result);
+    }
+
+    void iamax(std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+               cl::sycl::buffer<std::int64_t, 1> &result) {
+        iamax_precondition(queue_, n, x, incx, result);
+        detail::iamax(backend_, queue_, n, x, incx, result);
+        iamax_postcondition(queue_, n, x, incx, result);
+    }
+
+    void iamin(std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+               cl::sycl::buffer<std::int64_t, 1> &result) {
+        iamin_precondition(queue_, n, x, incx, result);
+        detail::iamin(backend_, queue_, n, x, incx, result);
+        iamin_postcondition(queue_, n, x, incx, result);
+    }
+
+    void iamin(std::int64_t n, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+               cl::sycl::buffer<std::int64_t, 1> &result) {
+        iamin_precondition(queue_, n, x, incx, result);
+        detail::iamin(backend_, queue_, n, x, incx, result);
+        iamin_postcondition(queue_, n, x, incx, result);
+    }
+
+    void iamin(std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+               cl::sycl::buffer<std::int64_t, 1> &result) {
+        iamin_precondition(queue_, n, x, incx, result);
+        detail::iamin(backend_, queue_, n, x, incx, result);
+        iamin_postcondition(queue_, n, x, incx, result);
+    }
+
+    void iamin(std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+               cl::sycl::buffer<std::int64_t, 1> &result) {
+        iamin_precondition(queue_, n, x, incx, result);
+        detail::iamin(backend_, queue_, n, x, incx, result);
+        iamin_postcondition(queue_, n, x, incx, result);
+    }
+
+    void nrm2(std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<float, 1> &result) {
+        nrm2_precondition(queue_, n, x, incx, result);
+        detail::nrm2(backend_, queue_, n, x, incx, result);
+        nrm2_postcondition(queue_, n, x, incx, result);
+    }
+
+    void nrm2(std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<double, 1> &result) {
+        nrm2_precondition(queue_, n, x, incx, result);
+        detail::nrm2(backend_, queue_, n, x, incx, result);
+        nrm2_postcondition(queue_, n, x, incx, result);
+    }
+
+    void nrm2(std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<float, 1> &result) {
+        nrm2_precondition(queue_, n, x, incx, result);
+        detail::nrm2(backend_, queue_, n, x, incx, result);
+        nrm2_postcondition(queue_, n, x, incx, result);
+    }
+
+    void nrm2(std::int64_t n, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<double, 1> &result) {
+        nrm2_precondition(queue_, n, x, incx, result);
+        detail::nrm2(backend_, queue_, n, x, incx, result);
+        nrm2_postcondition(queue_, n, x, incx, result);
+    }
+
+    void rot(std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+             cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, float c, float s) {
+        rot_precondition(queue_, n, x, incx, y, incy, c, s);
+        detail::rot(backend_, queue_, n, x, incx, y, incy, c, s);
+        rot_postcondition(queue_, n, x, incx, y, incy, c, s);
+    }
+
+    void rot(std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+             cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy, double c, double s) {
+        rot_precondition(queue_, n, x, incx, y, incy, c, s);
+        detail::rot(backend_, queue_, n, x, incx, y, incy, c, s);
+        rot_postcondition(queue_, n, x, incx, y, incy, c, s);
+    }
+
+    void rot(std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+             cl::sycl::buffer<float, 1> &y, std::int64_t incy, float c, float s) {
+        rot_precondition(queue_, n, x, incx, y, incy, c, s);
+        detail::rot(backend_, queue_, n, x, incx, y, incy, c, s);
+        rot_postcondition(queue_, n, x, incx, y, incy, c, s);
+    }
+
+    void rot(std::int64_t n, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+             cl::sycl::buffer<double, 1> &y, std::int64_t incy, double c, double s) {
+        rot_precondition(queue_, n, x, incx, y, incy, c, s);
+        detail::rot(backend_, queue_, n, x, incx, y, incy, c, s);
+        rot_postcondition(queue_, n, x, incx, y, incy, c, s);
+    }
+
+    void rotg(cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<float, 1> &b,
+              cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<float, 1> &s) {
+        rotg_precondition(queue_, a, b, c, s);
+        detail::rotg(backend_, queue_, a, b, c, s);
+        rotg_postcondition(queue_, a, b, c, s);
+    }
+
+    void rotg(cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<double, 1> &b,
+              cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<double, 1> &s) {
+        rotg_precondition(queue_, a, b, c, s);
+        detail::rotg(backend_, queue_, a, b, c, s);
+        rotg_postcondition(queue_, a, b, c, s);
+    }
+
+    void rotg(cl::sycl::buffer<std::complex<float>, 1> &a,
+              cl::sycl::buffer<std::complex<float>, 1> &b, cl::sycl::buffer<float, 1> &c,
+              cl::sycl::buffer<std::complex<float>, 1> &s) {
+        rotg_precondition(queue_, a, b, c, s);
+        detail::rotg(backend_, queue_, a, b, c, s);
+        rotg_postcondition(queue_, a, b, c, s);
+    }
+
+    void rotg(cl::sycl::buffer<std::complex<double>, 1> &a,
+              cl::sycl::buffer<std::complex<double>, 1> &b, cl::sycl::buffer<double, 1> &c,
+              cl::sycl::buffer<std::complex<double>, 1> &s) {
+        rotg_precondition(queue_, a, b, c, s);
+        detail::rotg(backend_, queue_, a, b, c, s);
+        rotg_postcondition(queue_, a, b, c, s);
+    }
+
+    void rotm(std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<float, 1> &y, std::int64_t incy, cl::sycl::buffer<float, 1> &param) {
+        rotm_precondition(queue_, n, x, incx, y, incy, param);
+        detail::rotm(backend_, queue_, n, x, incx, y, incy, param);
+        rotm_postcondition(queue_, n, x, incx, y, incy, param);
+    }
+
+    void rotm(std::int64_t n, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<double, 1> &param) {
+        rotm_precondition(queue_, n, x, incx, y, incy, param);
+        detail::rotm(backend_, queue_, n, x, incx, y, incy, param);
+        rotm_postcondition(queue_, n, x, incx, y, incy, param);
+    }
+
+    void rotmg(cl::sycl::buffer<float, 1> &d1, cl::sycl::buffer<float, 1> &d2,
+               cl::sycl::buffer<float, 1> &x1, float y1, cl::sycl::buffer<float, 1> &param) {
+        rotmg_precondition(queue_, d1, d2, x1, y1, param);
+        detail::rotmg(backend_, queue_, d1, d2, x1, y1, param);
+        rotmg_postcondition(queue_, d1, d2, x1, y1, param);
+    }
+
+    void rotmg(cl::sycl::buffer<double, 1> &d1, cl::sycl::buffer<double, 1> &d2,
+               cl::sycl::buffer<double, 1> &x1, double y1, cl::sycl::buffer<double, 1> &param) {
+        rotmg_precondition(queue_, d1, d2, x1, y1, param);
+        detail::rotmg(backend_, queue_, d1, d2, x1, y1, param);
+        rotmg_postcondition(queue_, d1, d2, x1, y1, param);
+    }
+
+    void sbmv(uplo upper_lower, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &x,
+              std::int64_t incx, float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+        sbmv_precondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
+        detail::sbmv(backend_, queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
+        sbmv_postcondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void sbmv(uplo upper_lower, std::int64_t n, std::int64_t k, double alpha,
+              cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &x,
+              std::int64_t incx, double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+        sbmv_precondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
+        detail::sbmv(backend_, queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
+        sbmv_postcondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void scal(std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
+        scal_precondition(queue_, n, alpha, x, incx);
+        detail::scal(backend_, queue_, n, alpha, x, incx);
+        scal_postcondition(queue_, n, alpha, x, incx);
+    }
+
+    void scal(std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
+        scal_precondition(queue_, n, alpha, x, incx);
+        detail::scal(backend_, queue_, n, alpha, x, incx);
+        scal_postcondition(queue_, n, alpha, x, incx);
+    }
+
+    void scal(std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+        scal_precondition(queue_, n, alpha, x, incx);
+        detail::scal(backend_, queue_, n, alpha, x, incx);
+        scal_postcondition(queue_, n, alpha, x, incx);
+    }
+
+    void scal(std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+        scal_precondition(queue_, n, alpha, x, incx);
+        detail::scal(backend_, queue_, n, alpha, x, incx);
+        scal_postcondition(queue_, n, alpha, x, incx);
+    }
+
+    void scal(std::int64_t n, float alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
+              std::int64_t incx) {
+        scal_precondition(queue_, n, alpha, x, incx);
+        detail::scal(backend_, queue_, n, alpha, x, incx);
+        scal_postcondition(queue_, n, alpha, x, incx);
+    }
+
+    void scal(std::int64_t n, double alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
+              std::int64_t incx) {
+        scal_precondition(queue_, n, alpha, x, incx);
+        detail::scal(backend_, queue_, n, alpha, x, incx);
+        scal_postcondition(queue_, n, alpha, x, incx);
+    }
+
+    void sdsdot(std::int64_t n, float sb, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+                cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+                cl::sycl::buffer<float, 1> &result) {
+        sdsdot_precondition(queue_, n, sb, x, incx, y, incy, result);
+        detail::sdsdot(backend_, queue_, n, sb, x, incx, y, incy, result);
+        sdsdot_postcondition(queue_, n, sb, x, incx, y, incy, result);
+    }
+
+    void spmv(uplo upper_lower, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+              cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+              cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+        spmv_precondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+        detail::spmv(backend_, queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+        spmv_postcondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+    }
+
+    void spmv(uplo upper_lower, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+              cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+              cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+        spmv_precondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+        detail::spmv(backend_, queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+        spmv_postcondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy);
+    }
+
+    void spr(uplo upper_lower, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+             std::int64_t incx, cl::sycl::buffer<float, 1> &a) {
+        spr_precondition(queue_, upper_lower, n, alpha, x, incx, a);
+        detail::spr(backend_, queue_, upper_lower, n, alpha, x, incx, a);
+        spr_postcondition(queue_, upper_lower, n, alpha, x, incx, a);
+    }
+
+    void spr(uplo upper_lower, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+             std::int64_t incx, cl::sycl::buffer<double, 1> &a) {
+        spr_precondition(queue_, upper_lower, n, alpha, x, incx, a);
+        detail::spr(backend_, queue_, upper_lower, n, alpha, x, incx, a);
+        spr_postcondition(queue_, upper_lower, n, alpha, x, incx, a);
+    }
+
+    void spr2(uplo upper_lower, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+              std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<float, 1> &a) {
+        spr2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a);
+        detail::spr2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a);
+        spr2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a);
+    }
+
+    void spr2(uplo upper_lower, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+              std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<double, 1> &a) {
+        spr2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a);
+        detail::spr2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a);
+        spr2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a);
+    }
+
+    void swap(std::int64_t n, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+        swap_precondition(queue_, n, x, incx, y, incy);
+        detail::swap(backend_, queue_, n, x, incx, y, incy);
+        swap_postcondition(queue_, n, x, incx, y, incy);
+    }
+
+    void swap(std::int64_t n, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+        swap_precondition(queue_, n, x, incx, y, incy);
+        detail::swap(backend_, queue_, n, x, incx, y, incy);
+        swap_postcondition(queue_, n, x, incx, y, incy);
+    }
+
+    void swap(std::int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy) {
+        swap_precondition(queue_, n, x, incx, y, incy);
+        detail::swap(backend_, queue_, n, x, incx, y, incy);
+        swap_postcondition(queue_, n, x, incx, y, incy);
+    }
+
+    void swap(std::int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
+              cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy) {
+        swap_precondition(queue_, n, x, incx, y, incy);
+        detail::swap(backend_, queue_, n, x, incx, y, incy);
+        swap_postcondition(queue_, n, x, incx, y, incy);
+    }
+
+    void symm(side left_right, uplo upper_lower, std::int64_t m, std::int64_t n, float alpha,
+              cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+              std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+        symm_precondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                          ldc);
+        detail::symm(backend_, queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta,
+                     c, ldc);
+        symm_postcondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                           ldc);
+    }
+
+    void symm(side left_right, uplo upper_lower, std::int64_t m, std::int64_t n, double alpha,
+              cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+              std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+        symm_precondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                          ldc);
+        detail::symm(backend_, queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta,
+                     c, ldc);
+        symm_postcondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                           ldc);
+    }
+
+    void symm(side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+              std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+              std::int64_t ldc) {
+        symm_precondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                          ldc);
+        detail::symm(backend_, queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta,
+                     c, ldc);
+        symm_postcondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                           ldc);
+    }
+
+    void symm(side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+              std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+              std::int64_t ldc) {
+        symm_precondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                          ldc);
+        detail::symm(backend_, queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta,
+                     c, ldc);
+        symm_postcondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                           ldc);
+    }
+
+    void symv(uplo upper_lower, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
+              cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
+        symv_precondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
+        detail::symv(backend_, queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
+        symv_postcondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void symv(uplo upper_lower, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+              std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
+              cl::sycl::buffer<double, 1> &y, std::int64_t incy) {
+        symv_precondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
+        detail::symv(backend_, queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
+        symv_postcondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy);
+    }
+
+    void syr(uplo upper_lower, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+             std::int64_t incx, cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
+        syr_precondition(queue_, upper_lower, n, alpha, x, incx, a, lda);
+        detail::syr(backend_, queue_, upper_lower, n, alpha, x, incx, a, lda);
+        syr_postcondition(queue_, upper_lower, n, alpha, x, incx, a, lda);
+    }
+
+    void syr(uplo upper_lower, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+             std::int64_t incx, cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
+        syr_precondition(queue_, upper_lower, n, alpha, x, incx, a, lda);
+        detail::syr(backend_, queue_, upper_lower, n, alpha, x, incx, a, lda);
+        syr_postcondition(queue_, upper_lower, n, alpha, x, incx, a, lda);
+    }
+
+    void syr2(uplo upper_lower, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
+              std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<float, 1> &a, std::int64_t lda) {
+        syr2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+        detail::syr2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+        syr2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+    }
+
+    void syr2(uplo upper_lower, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
+              std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
+              cl::sycl::buffer<double, 1> &a, std::int64_t lda) {
+        syr2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+        detail::syr2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+        syr2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda);
+    }
+
+    void syr2k(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k, float alpha,
+               cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &b,
+               std::int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+        syr2k_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        detail::syr2k(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c,
+                      ldc);
+        syr2k_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+    void syr2k(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k, double alpha,
+               cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &b,
+               std::int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+        syr2k_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        detail::syr2k(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c,
+                      ldc);
+        syr2k_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+    void syr2k(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+               std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+               std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+               std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
+               std::int64_t ldc) {
+        syr2k_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        detail::syr2k(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c,
+                      ldc);
+        syr2k_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+    void syr2k(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+               std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+               std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+               std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+               std::int64_t ldc) {
+        syr2k_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        detail::syr2k(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c,
+                      ldc);
+        syr2k_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+    void syrk(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k, float alpha,
+              cl::sycl::buffer<float, 1> &a, std::int64_t lda, float beta,
+              cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+        syrk_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+        detail::syrk(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+        syrk_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+    }
+
+    void syrk(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k, double alpha,
+              cl::sycl::buffer<double, 1> &a, std::int64_t lda, double beta,
+              cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+        syrk_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+        detail::syrk(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+        syrk_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+    }
+
+    void syrk(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+              std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+              std::int64_t lda, std::complex<float> beta,
+              cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+        syrk_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+        detail::syrk(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+        syrk_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+    }
+
+    void syrk(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+              std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+              std::int64_t lda, std::complex<double> beta,
+              cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+        syrk_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+        detail::syrk(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+        syrk_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+    }
+
+    void syrk_batch(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k, float alpha,
+                    cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                    float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
+                    std::int64_t stride_c, std::int64_t batch_size) {
+        syrk_batch_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size);
+        detail::syrk_batch(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a,
+                           beta, c, ldc, stride_c, batch_size);
+        syrk_batch_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                 ldc, stride_c, batch_size);
+    }
+
+    void syrk_batch(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k, double alpha,
+                    cl::sycl::buffer<double, 1> &a, std::int64_t lda, std::int64_t stride_a,
+                    double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
+                    std::int64_t stride_c, std::int64_t batch_size) {
+        syrk_batch_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size);
+        detail::syrk_batch(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a,
+                           beta, c, ldc, stride_c, batch_size);
+        syrk_batch_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                 ldc, stride_c, batch_size);
+    }
+
+    void syrk_batch(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                    std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                    std::int64_t lda, std::int64_t stride_a, std::complex<float> beta,
+                    cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
+                    std::int64_t stride_c, std::int64_t batch_size) {
+        syrk_batch_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size);
+        detail::syrk_batch(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a,
+                           beta, c, ldc, stride_c, batch_size);
+        syrk_batch_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                 ldc, stride_c, batch_size);
+    }
+
+    void syrk_batch(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                    std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                    std::int64_t lda, std::int64_t stride_a, std::complex<double> beta,
+                    cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
+                    std::int64_t stride_c, std::int64_t batch_size) {
+        syrk_batch_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size);
+        detail::syrk_batch(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a,
+                           beta, c, ldc, stride_c, batch_size);
+        syrk_batch_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                 ldc, stride_c, batch_size);
+    }
+
+    void tbmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &x,
+              std::int64_t incx) {
+        tbmv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        detail::tbmv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        tbmv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+    }
+
+    void tbmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &x,
+              std::int64_t incx) {
+        tbmv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        detail::tbmv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        tbmv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+    }
+
+    void tbmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+        tbmv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        detail::tbmv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        tbmv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+    }
+
+    void tbmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+        tbmv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        detail::tbmv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        tbmv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+    }
+
+    void tbsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &x,
+              std::int64_t incx) {
+        tbsv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        detail::tbsv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        tbsv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+    }
+
+    void tbsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &x,
+              std::int64_t incx) {
+        tbsv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        detail::tbsv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        tbsv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+    }
+
+    void tbsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+        tbsv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        detail::tbsv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        tbsv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+    }
+
+    void tbsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+        tbsv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        detail::tbsv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+        tbsv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx);
+    }
+
+    void tpmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
+        tpmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        detail::tpmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        tpmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+    }
+
+    void tpmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
+        tpmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        detail::tpmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        tpmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+    }
+
+    void tpmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<std::complex<float>, 1> &a,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+        tpmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        detail::tpmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        tpmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+    }
+
+    void tpmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<std::complex<double>, 1> &a,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+        tpmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        detail::tpmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        tpmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+    }
+
+    void tpsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<float, 1> &x, std::int64_t incx) {
+        tpsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        detail::tpsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        tpsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+    }
+
+    void tpsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<double, 1> &x, std::int64_t incx) {
+        tpsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        detail::tpsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        tpsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+    }
+
+    void tpsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<std::complex<float>, 1> &a,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+        tpsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        detail::tpsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        tpsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+    }
+
+    void tpsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<std::complex<double>, 1> &a,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+        tpsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        detail::tpsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+        tpsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx);
+    }
+
+    void trmm(side left_right, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
+              std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+        trmm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb);
+        detail::trmm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                     lda, b, ldb);
+        trmm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb);
+    }
+
+    void trmm(side left_right, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
+              std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<double, 1> &b, std::int64_t ldb) {
+        trmm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb);
+        detail::trmm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                     lda, b, ldb);
+        trmm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb);
+    }
+
+    void trmm(side left_right, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
+              std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
+        trmm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb);
+        detail::trmm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                     lda, b, ldb);
+        trmm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb);
+    }
+
+    void trmm(side left_right, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
+              std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+        trmm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb);
+        detail::trmm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                     lda, b, ldb);
+        trmm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb);
+    }
+
+    void trmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &x,
+              std::int64_t incx) {
+        trmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        detail::trmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        trmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    }
+
+    void trmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &x,
+              std::int64_t incx) {
+        trmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        detail::trmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        trmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    }
+
+    void trmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+        trmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        detail::trmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        trmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    }
+
+    void trmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+        trmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        detail::trmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        trmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    }
+
+    void trsm(side left_right, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
+              std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<float, 1> &b, std::int64_t ldb) {
+        trsm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb);
+        detail::trsm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                     lda, b, ldb);
+        trsm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb);
+    }
+
+    void trsm(side left_right, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
+              std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<double, 1> &b, std::int64_t ldb) {
+        trsm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb);
+        detail::trsm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                     lda, b, ldb);
+        trsm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb);
+    }
+
+    void trsm(side left_right, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
+              std::int64_t n, std::complex<float> alpha,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb) {
+        trsm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb);
+        detail::trsm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                     lda, b, ldb);
+        trsm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb);
+    }
+
+    void trsm(side left_right, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
+              std::int64_t n, std::complex<double> alpha,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb) {
+        trsm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb);
+        detail::trsm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                     lda, b, ldb);
+        trsm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb);
+    }
+
+    void trsm_batch(side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+                    std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
+                    std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+        trsm_batch_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size);
+        detail::trsm_batch(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                           a, lda, stride_a, b, ldb, stride_b, batch_size);
+        trsm_batch_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                 lda, stride_a, b, ldb, stride_b, batch_size);
+    }
+
+    void trsm_batch(side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+                    std::int64_t m, std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
+                    std::int64_t lda, std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+        trsm_batch_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size);
+        detail::trsm_batch(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                           a, lda, stride_a, b, ldb, stride_b, batch_size);
+        trsm_batch_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                 lda, stride_a, b, ldb, stride_b, batch_size);
+    }
+
+    void trsm_batch(side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+                    std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+        trsm_batch_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size);
+        detail::trsm_batch(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                           a, lda, stride_a, b, ldb, stride_b, batch_size);
+        trsm_batch_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                 lda, stride_a, b, ldb, stride_b, batch_size);
+    }
+
+    void trsm_batch(side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+                    std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+                    std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
+                    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size) {
+        trsm_batch_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size);
+        detail::trsm_batch(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                           a, lda, stride_a, b, ldb, stride_b, batch_size);
+        trsm_batch_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                 lda, stride_a, b, ldb, stride_b, batch_size);
+    }
+
+    void trsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<float, 1> &a, std::int64_t lda, cl::sycl::buffer<float, 1> &x,
+              std::int64_t incx) {
+        trsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        detail::trsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        trsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    }
+
+    void trsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<double, 1> &a, std::int64_t lda, cl::sycl::buffer<double, 1> &x,
+              std::int64_t incx) {
+        trsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        detail::trsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        trsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    }
+
+    void trsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx) {
+        trsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        detail::trsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        trsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    }
+
+    void trsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+              cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+              cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx) {
+        trsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        detail::trsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+        trsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx);
+    }
+
+    // USM APIs
+
+    cl::sycl::event asum(std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+                         float *result, const std::vector<cl::sycl::event> &dependencies = {}) {
+        asum_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::asum(backend_, queue_, n, x, incx, result, dependencies);
+        asum_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event asum(std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+                         double *result, const std::vector<cl::sycl::event> &dependencies = {}) {
+        asum_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::asum(backend_, queue_, n, x, incx, result, dependencies);
+        asum_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event asum(std::int64_t n, const float *x, std::int64_t incx, float *result,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        asum_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::asum(backend_, queue_, n, x, incx, result, dependencies);
+        asum_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event asum(std::int64_t n, const double *x, std::int64_t incx, double *result,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        asum_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::asum(backend_, queue_, n, x, incx, result, dependencies);
+        asum_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpy(std::int64_t n, float alpha, const float *x, std::int64_t incx, float *y,
+                         std::int64_t incy, const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_precondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        auto done = detail::axpy(backend_, queue_, n, alpha, x, incx, y, incy, dependencies);
+        axpy_postcondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpy(std::int64_t n, double alpha, const double *x, std::int64_t incx,
+                         double *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_precondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        auto done = detail::axpy(backend_, queue_, n, alpha, x, incx, y, incy, dependencies);
+        axpy_postcondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpy(std::int64_t n, std::complex<float> alpha, const std::complex<float> *x,
+                         std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_precondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        auto done = detail::axpy(backend_, queue_, n, alpha, x, incx, y, incy, dependencies);
+        axpy_postcondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpy(std::int64_t n, std::complex<double> alpha, const std::complex<double> *x,
+                         std::int64_t incx, std::complex<double> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_precondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        auto done = detail::axpy(backend_, queue_, n, alpha, x, incx, y, incy, dependencies);
+        axpy_postcondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    // The axpy and scal overloads taking alpha by pointer read it when the computation runs, after
+    // the dependencies, so alpha can be the result of an earlier call such as dot without waiting
+    // for it on the host. alpha must be accessible on the device of the queue.
+    template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, float> = nullptr>
+    cl::sycl::event axpy(std::int64_t n, Ta alpha, const float *x, std::int64_t incx, float *y,
+                         std::int64_t incy, const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_precondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        auto done = detail::axpy(backend_, queue_, n, alpha, x, incx, y, incy, dependencies);
+        axpy_postcondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, double> = nullptr>
+    cl::sycl::event axpy(std::int64_t n, Ta alpha, const double *x, std::int64_t incx, double *y,
+                         std::int64_t incy, const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_precondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        auto done = detail::axpy(backend_, queue_, n, alpha, x, incx, y, incy, dependencies);
+        axpy_postcondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    template <typename Ta,
+              oneapi::mkl::blas::detail::is_pointer_to<Ta, std::complex<float>> = nullptr>
+    cl::sycl::event axpy(std::int64_t n, Ta alpha, const std::complex<float> *x, std::int64_t incx,
+                         std::complex<float> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_precondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        auto done = detail::axpy(backend_, queue_, n, alpha, x, incx, y, incy, dependencies);
+        axpy_postcondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    template <typename Ta,
+              oneapi::mkl::blas::detail::is_pointer_to<Ta, std::complex<double>> = nullptr>
+    cl::sycl::event axpy(std::int64_t n, Ta alpha, const std::complex<double> *x, std::int64_t incx,
+                         std::complex<double> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_precondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        auto done = detail::axpy(backend_, queue_, n, alpha, x, incx, y, incy, dependencies);
+        axpy_postcondition(queue_, n, alpha, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpy_batch(std::int64_t *n, double *alpha, const double **x, std::int64_t *incx,
+                               double **y, std::int64_t *incy, std::int64_t group_count,
+                               std::int64_t *group_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_batch_precondition(queue_, n, alpha, x, incx, y, incy, group_count, group_size,
+                                dependencies);
+        auto done = detail::axpy_batch(backend_, queue_, n, alpha, x, incx, y, incy, group_count,
+                                       group_size, dependencies);
+        axpy_batch_postcondition(queue_, n, alpha, x, incx, y, incy, group_count, group_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpy_batch(std::int64_t *n, float *alpha, const float **x, std::int64_t *incx,
+                               float **y, std::int64_t *incy, std::int64_t group_count,
+                               std::int64_t *group_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_batch_precondition(queue_, n, alpha, x, incx, y, incy, group_count, group_size,
+                                dependencies);
+        auto done = detail::axpy_batch(backend_, queue_, n, alpha, x, incx, y, incy, group_count,
+                                       group_size, dependencies);
+        axpy_batch_postcondition(queue_, n, alpha, x, incx, y, incy, group_count, group_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpy_batch(
+        std::int64_t *n, std::complex<double> *alpha, const std::complex<double> **x,
+        std::int64_t *incx, std::complex<double> **y, std::int64_t *incy, std::int64_t group_count,
+        std::int64_t *group_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_batch_precondition(queue_, n, alpha, x, incx, y, incy, group_count, group_size,
+                                dependencies);
+        auto done = detail::axpy_batch(backend_, queue_, n, alpha, x, incx, y, incy, group_count,
+                                       group_size, dependencies);
+        axpy_batch_postcondition(queue_, n, alpha, x, incx, y, incy, group_count, group_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpy_batch(
+        std::int64_t *n, std::complex<float> *alpha, const std::complex<float> **x,
+        std::int64_t *incx, std::complex<float> **y, std::int64_t *incy, std::int64_t group_count,
+        std::int64_t *group_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_batch_precondition(queue_, n, alpha, x, incx, y, incy, group_count, group_size,
+                                dependencies);
+        auto done = detail::axpy_batch(backend_, queue_, n, alpha, x, incx, y, incy, group_count,
+                                       group_size, dependencies);
+        axpy_batch_postcondition(queue_, n, alpha, x, incx, y, incy, group_count, group_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpy_batch(std::int64_t n, float alpha, const float *x, std::int64_t incx,
+                               std::int64_t stridex, float *y, std::int64_t incy,
+                               std::int64_t stridey, std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_batch_precondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
+        auto done = detail::axpy_batch(backend_, queue_, n, alpha, x, incx, stridex, y, incy,
+                                       stridey, batch_size, dependencies);
+        axpy_batch_postcondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpy_batch(std::int64_t n, double alpha, const double *x, std::int64_t incx,
+                               std::int64_t stridex, double *y, std::int64_t incy,
+                               std::int64_t stridey, std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_batch_precondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
+        auto done = detail::axpy_batch(backend_, queue_, n, alpha, x, incx, stridex, y, incy,
+                                       stridey, batch_size, dependencies);
+        axpy_batch_postcondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpy_batch(
+        std::int64_t n, std::complex<float> alpha, const std::complex<float> *x, std::int64_t incx,
+        std::int64_t stridex, std::complex<float> *y, std::int64_t incy, std::int64_t stridey,
+        std::int64_t batch_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_batch_precondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
+        auto done = detail::axpy_batch(backend_, queue_, n, alpha, x, incx, stridex, y, incy,
+                                       stridey, batch_size, dependencies);
+        axpy_batch_postcondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpy_batch(std::int64_t n, std::complex<double> alpha,
+                               const std::complex<double> *x, std::int64_t incx,
+                               std::int64_t stridex, std::complex<double> *y, std::int64_t incy,
+                               std::int64_t stridey, std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpy_batch_precondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
+        auto done = detail::axpy_batch(backend_, queue_, n, alpha, x, incx, stridex, y, incy,
+                                       stridey, batch_size, dependencies);
+        axpy_batch_postcondition(queue_, n, alpha, x, incx, stridex, y, incy, stridey, batch_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpby(std::int64_t n, float alpha, const float *x, std::int64_t incx,
+                          const float beta, float *y, std::int64_t incy,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpby_precondition(queue_, n, alpha, x, incx, beta, y, incy, dependencies);
+        auto done = detail::axpby(backend_, queue_, n, alpha, x, incx, beta, y, incy, dependencies);
+        axpby_postcondition(queue_, n, alpha, x, incx, beta, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpby(std::int64_t n, double alpha, const double *x, std::int64_t incx,
+                          const double beta, double *y, std::int64_t incy,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpby_precondition(queue_, n, alpha, x, incx, beta, y, incy, dependencies);
+        auto done = detail::axpby(backend_, queue_, n, alpha, x, incx, beta, y, incy, dependencies);
+        axpby_postcondition(queue_, n, alpha, x, incx, beta, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpby(std::int64_t n, std::complex<float> alpha, const std::complex<float> *x,
+                          std::int64_t incx, const std::complex<float> beta, std::complex<float> *y,
+                          std::int64_t incy,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpby_precondition(queue_, n, alpha, x, incx, beta, y, incy, dependencies);
+        auto done = detail::axpby(backend_, queue_, n, alpha, x, incx, beta, y, incy, dependencies);
+        axpby_postcondition(queue_, n, alpha, x, incx, beta, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event axpby(std::int64_t n, std::complex<double> alpha, const std::complex<double> *x,
+                          std::int64_t incx, const std::complex<double> beta,
+                          std::complex<double> *y, std::int64_t incy,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        axpby_precondition(queue_, n, alpha, x, incx, beta, y, incy, dependencies);
+        auto done = detail::axpby(backend_, queue_, n, alpha, x, incx, beta, y, incy, dependencies);
+        axpby_postcondition(queue_, n, alpha, x, incx, beta, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event copy(std::int64_t n, const float *x, std::int64_t incx, float *y,
+                         std::int64_t incy, const std::vector<cl::sycl::event> &dependencies = {}) {
+        copy_precondition(queue_, n, x, incx, y, incy, dependencies);
+        auto done = detail::copy(backend_, queue_, n, x, incx, y, incy, dependencies);
+        copy_postcondition(queue_, n, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event copy(std::int64_t n, const double *x, std::int64_t incx, double *y,
+                         std::int64_t incy, const std::vector<cl::sycl::event> &dependencies = {}) {
+        copy_precondition(queue_, n, x, incx, y, incy, dependencies);
+        auto done = detail::copy(backend_, queue_, n, x, incx, y, incy, dependencies);
+        copy_postcondition(queue_, n, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event copy(std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+                         std::complex<float> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        copy_precondition(queue_, n, x, incx, y, incy, dependencies);
+        auto done = detail::copy(backend_, queue_, n, x, incx, y, incy, dependencies);
+        copy_postcondition(queue_, n, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event copy(std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+                         std::complex<double> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        copy_precondition(queue_, n, x, incx, y, incy, dependencies);
+        auto done = detail::copy(backend_, queue_, n, x, incx, y, incy, dependencies);
+        copy_postcondition(queue_, n, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event copy_batch(std::int64_t *n, const float **x, std::int64_t *incx, float **y,
+                               std::int64_t *incy, std::int64_t group_count,
+                               std::int64_t *group_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        copy_batch_precondition(queue_, n, x, incx, y, incy, group_count, group_size, dependencies);
+        auto done = detail::copy_batch(backend_, queue_, n, x, incx, y, incy, group_count,
+                                       group_size, dependencies);
+        copy_batch_postcondition(queue_, n, x, incx, y, incy, group_count, group_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event copy_batch(std::int64_t *n, const double **x, std::int64_t *incx, double **y,
+                               std::int64_t *incy, std::int64_t group_count,
+                               std::int64_t *group_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        copy_batch_precondition(queue_, n, x, incx, y, incy, group_count, group_size, dependencies);
+        auto done = detail::copy_batch(backend_, queue_, n, x, incx, y, incy, group_count,
+                                       group_size, dependencies);
+        copy_batch_postcondition(queue_, n, x, incx, y, incy, group_count, group_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event copy_batch(std::int64_t *n, const std::complex<float> **x, std::int64_t *incx,
+                               std::complex<float> **y, std::int64_t *incy,
+                               std::int64_t group_count, std::int64_t *group_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        copy_batch_precondition(queue_, n, x, incx, y, incy, group_count, group_size, dependencies);
+        auto done = detail::copy_batch(backend_, queue_, n, x, incx, y, incy, group_count,
+                                       group_size, dependencies);
+        copy_batch_postcondition(queue_, n, x, incx, y, incy, group_count, group_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event copy_batch(std::int64_t *n, const std::complex<double> **x, std::int64_t *incx,
+                               std::complex<double> **y, std::int64_t *incy,
+                               std::int64_t group_count, std::int64_t *group_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        copy_batch_precondition(queue_, n, x, incx, y, incy, group_count, group_size, dependencies);
+        auto done = detail::copy_batch(backend_, queue_, n, x, incx, y, incy, group_count,
+                                       group_size, dependencies);
+        copy_batch_postcondition(queue_, n, x, incx, y, incy, group_count, group_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event copy_batch(std::int64_t n, const float *x, std::int64_t incx,
+                               std::int64_t stridex, float *y, std::int64_t incy,
+                               std::int64_t stridey, std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        copy_batch_precondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
+        auto done = detail::copy_batch(backend_, queue_, n, x, incx, stridex, y, incy, stridey,
+                                       batch_size, dependencies);
+        copy_batch_postcondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event copy_batch(std::int64_t n, const double *x, std::int64_t incx,
+                               std::int64_t stridex, double *y, std::int64_t incy,
+                               std::int64_t stridey, std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        copy_batch_precondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
+        auto done = detail::copy_batch(backend_, queue_, n, x, incx, stridex, y, incy, stridey,
+                                       batch_size, dependencies);
+        copy_batch_postcondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event copy_batch(std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+                               std::int64_t stridex, std::complex<float> *y, std::int64_t incy,
+                               std::int64_t stridey, std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        copy_batch_precondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
+        auto done = detail::copy_batch(backend_, queue_, n, x, incx, stridex, y, incy, stridey,
+                                       batch_size, dependencies);
+        copy_batch_postcondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event copy_batch(std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+                               std::int64_t stridex, std::complex<double> *y, std::int64_t incy,
+                               std::int64_t stridey, std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        copy_batch_precondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                dependencies);
+        auto done = detail::copy_batch(backend_, queue_, n, x, incx, stridex, y, incy, stridey,
+                                       batch_size, dependencies);
+        copy_batch_postcondition(queue_, n, x, incx, stridex, y, incy, stridey, batch_size,
+                                 dependencies);
+        return done;
+    }
+
+    cl::sycl::event dot(std::int64_t n, const float *x, std::int64_t incx, const float *y,
+                        std::int64_t incy, float *result,
+                        const std::vector<cl::sycl::event> &dependencies = {}) {
+        dot_precondition(queue_, n, x, incx, y, incy, result, dependencies);
+        auto done = detail::dot(backend_, queue_, n, x, incx, y, incy, result, dependencies);
+        dot_postcondition(queue_, n, x, incx, y, incy, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event dot(std::int64_t n, const double *x, std::int64_t incx, const double *y,
+                        std::int64_t incy, double *result,
+                        const std::vector<cl::sycl::event> &dependencies = {}) {
+        dot_precondition(queue_, n, x, incx, y, incy, result, dependencies);
+        auto done = detail::dot(backend_, queue_, n, x, incx, y, incy, result, dependencies);
+        dot_postcondition(queue_, n, x, incx, y, incy, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event dot(std::int64_t n, const float *x, std::int64_t incx, const float *y,
+                        std::int64_t incy, double *result,
+                        const std::vector<cl::sycl::event> &dependencies = {}) {
+        dot_precondition(queue_, n, x, incx, y, incy, result, dependencies);
+        auto done = detail::dot(backend_, queue_, n, x, incx, y, incy, result, dependencies);
+        dot_postcondition(queue_, n, x, incx, y, incy, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event dotc(std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+                         const std::complex<float> *y, std::int64_t incy,
+                         std::complex<float> *result,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        dotc_precondition(queue_, n, x, incx, y, incy, result, dependencies);
+        auto done = detail::dotc(backend_, queue_, n, x, incx, y, incy, result, dependencies);
+        dotc_postcondition(queue_, n, x, incx, y, incy, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event dotc(std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+                         const std::complex<double> *y, std::int64_t incy,
+                         std::complex<double> *result,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        dotc_precondition(queue_, n, x, incx, y, incy, result, dependencies);
+        auto done = detail::dotc(backend_, queue_, n, x, incx, y, incy, result, dependencies);
+        dotc_postcondition(queue_, n, x, incx, y, incy, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event dotu(std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+                         const std::complex<float> *y, std::int64_t incy,
+                         std::complex<float> *result,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        dotu_precondition(queue_, n, x, incx, y, incy, result, dependencies);
+        auto done = detail::dotu(backend_, queue_, n, x, incx, y, incy, result, dependencies);
+        dotu_postcondition(queue_, n, x, incx, y, incy, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event dotu(std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+                         const std::complex<double> *y, std::int64_t incy,
+                         std::complex<double> *result,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        dotu_precondition(queue_, n, x, incx, y, incy, result, dependencies);
+        auto done = detail::dotu(backend_, queue_, n, x, incx, y, incy, result, dependencies);
+        dotu_postcondition(queue_, n, x, incx, y, incy, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gbmv(transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, float alpha, const float *a, std::int64_t lda,
+                         const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        gbmv_precondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                          dependencies);
+        auto done = detail::gbmv(backend_, queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx,
+                                 beta, y, incy, dependencies);
+        gbmv_postcondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event gbmv(transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, double alpha, const double *a, std::int64_t lda,
+                         const double *x, std::int64_t incx, double beta, double *y,
+                         std::int64_t incy, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gbmv_precondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                          dependencies);
+        auto done = detail::gbmv(backend_, queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx,
+                                 beta, y, incy, dependencies);
+        gbmv_postcondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event gbmv(transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, std::complex<float> alpha, const std::complex<float> *a,
+                         std::int64_t lda, const std::complex<float> *x, std::int64_t incx,
+                         std::complex<float> beta, std::complex<float> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        gbmv_precondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                          dependencies);
+        auto done = detail::gbmv(backend_, queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx,
+                                 beta, y, incy, dependencies);
+        gbmv_postcondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event gbmv(transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl,
+                         std::int64_t ku, std::complex<double> alpha, const std::complex<double> *a,
+                         std::int64_t lda, const std::complex<double> *x, std::int64_t incx,
+                         std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        gbmv_precondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                          dependencies);
+        auto done = detail::gbmv(backend_, queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx,
+                                 beta, y, incy, dependencies);
+        gbmv_postcondition(queue_, trans, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                         std::int64_t k, float alpha, const float *a, std::int64_t lda,
+                         const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                          dependencies);
+        auto done = detail::gemm(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                 beta, c, ldc, dependencies);
+        gemm_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                         std::int64_t k, double alpha, const double *a, std::int64_t lda,
+                         const double *b, std::int64_t ldb, double beta, double *c,
+                         std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                          dependencies);
+        auto done = detail::gemm(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                 beta, c, ldc, dependencies);
+        gemm_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                         std::int64_t k, std::complex<float> alpha, const std::complex<float> *a,
+                         std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+                         std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                          dependencies);
+        auto done = detail::gemm(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                 beta, c, ldc, dependencies);
+        gemm_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                         std::int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                         std::int64_t lda, const std::complex<double> *b, std::int64_t ldb,
+                         std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                          dependencies);
+        auto done = detail::gemm(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                 beta, c, ldc, dependencies);
+        gemm_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                         std::int64_t k, half alpha, const half *a, std::int64_t lda, const half *b,
+                         std::int64_t ldb, half beta, half *c, std::int64_t ldc,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                          dependencies);
+        auto done = detail::gemm(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                 beta, c, ldc, dependencies);
+        gemm_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                         std::int64_t k, float alpha, const half *a, std::int64_t lda,
+                         const half *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                          dependencies);
+        auto done = detail::gemm(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                 beta, c, ldc, dependencies);
+        gemm_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                         std::int64_t k, float alpha, const bfloat16 *a, std::int64_t lda,
+                         const bfloat16 *b, std::int64_t ldb, float beta, float *c,
+                         std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                          dependencies);
+        auto done = detail::gemm(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                 beta, c, ldc, dependencies);
+        gemm_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_batch(
+        transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+        float *alpha, const float **a, std::int64_t *lda, const float **b, std::int64_t *ldb,
+        float *beta, float **c, std::int64_t *ldc, std::int64_t group_count,
+        std::int64_t *group_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_batch_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                ldc, group_count, group_size, dependencies);
+        auto done = detail::gemm_batch(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b,
+                                       ldb, beta, c, ldc, group_count, group_size, dependencies);
+        gemm_batch_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                 ldc, group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_batch(
+        transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+        double *alpha, const double **a, std::int64_t *lda, const double **b, std::int64_t *ldb,
+        double *beta, double **c, std::int64_t *ldc, std::int64_t group_count,
+        std::int64_t *group_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_batch_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                ldc, group_count, group_size, dependencies);
+        auto done = detail::gemm_batch(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b,
+                                       ldb, beta, c, ldc, group_count, group_size, dependencies);
+        gemm_batch_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                 ldc, group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_batch(
+        transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+        std::complex<float> *alpha, const std::complex<float> **a, std::int64_t *lda,
+        const std::complex<float> **b, std::int64_t *ldb, std::complex<float> *beta,
+        std::complex<float> **c, std::int64_t *ldc, std::int64_t group_count,
+        std::int64_t *group_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_batch_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                ldc, group_count, group_size, dependencies);
+        auto done = detail::gemm_batch(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b,
+                                       ldb, beta, c, ldc, group_count, group_size, dependencies);
+        gemm_batch_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                 ldc, group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_batch(
+        transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+        std::complex<double> *alpha, const std::complex<double> **a, std::int64_t *lda,
+        const std::complex<double> **b, std::int64_t *ldb, std::complex<double> *beta,
+        std::complex<double> **c, std::int64_t *ldc, std::int64_t group_count,
+        std::int64_t *group_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_batch_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                ldc, group_count, group_size, dependencies);
+        auto done = detail::gemm_batch(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b,
+                                       ldb, beta, c, ldc, group_count, group_size, dependencies);
+        gemm_batch_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                 ldc, group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_batch(
+        transpose *transa, transpose *transb, std::int64_t *m, std::int64_t *n, std::int64_t *k,
+        half *alpha, const half **a, std::int64_t *lda, const half **b, std::int64_t *ldb,
+        half *beta, half **c, std::int64_t *ldc, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_batch_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                ldc, group_count, group_size, dependencies);
+        auto done = detail::gemm_batch(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b,
+                                       ldb, beta, c, ldc, group_count, group_size, dependencies);
+        gemm_batch_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                                 ldc, group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_batch(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                               std::int64_t k, float alpha, const float *a, std::int64_t lda,
+                               std::int64_t stride_a, const float *b, std::int64_t ldb,
+                               std::int64_t stride_b, float beta, float *c, std::int64_t ldc,
+                               std::int64_t stride_c, std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_batch_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+        auto done = detail::gemm_batch(backend_, queue_, transa, transb, m, n, k, alpha, a, lda,
+                                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                       batch_size, dependencies);
+        gemm_batch_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                 stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_batch(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                               std::int64_t k, double alpha, const double *a, std::int64_t lda,
+                               std::int64_t stride_a, const double *b, std::int64_t ldb,
+                               std::int64_t stride_b, double beta, double *c, std::int64_t ldc,
+                               std::int64_t stride_c, std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_batch_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+        auto done = detail::gemm_batch(backend_, queue_, transa, transb, m, n, k, alpha, a, lda,
+                                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                       batch_size, dependencies);
+        gemm_batch_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                 stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_batch(
+        transpose transa, transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+        std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+        std::int64_t stride_a, const std::complex<float> *b, std::int64_t ldb,
+        std::int64_t stride_b, std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+        std::int64_t stride_c, std::int64_t batch_size,
+        const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_batch_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+        auto done = detail::gemm_batch(backend_, queue_, transa, transb, m, n, k, alpha, a, lda,
+                                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                       batch_size, dependencies);
+        gemm_batch_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                 stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_batch(
+        transpose transa, transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+        std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+        std::int64_t stride_a, const std::complex<double> *b, std::int64_t ldb,
+        std::int64_t stride_b, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+        std::int64_t stride_c, std::int64_t batch_size,
+        const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_batch_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+        auto done = detail::gemm_batch(backend_, queue_, transa, transb, m, n, k, alpha, a, lda,
+                                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                       batch_size, dependencies);
+        gemm_batch_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                 stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_batch(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                               std::int64_t k, half alpha, const half *a, std::int64_t lda,
+                               std::int64_t stride_a, const half *b, std::int64_t ldb,
+                               std::int64_t stride_b, half beta, half *c, std::int64_t ldc,
+                               std::int64_t stride_c, std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_batch_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+        auto done = detail::gemm_batch(backend_, queue_, transa, transb, m, n, k, alpha, a, lda,
+                                       stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                       batch_size, dependencies);
+        gemm_batch_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                                 stride_b, beta, c, ldc, stride_c, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemmt(uplo upper_lower, transpose transa, transpose transb, std::int64_t n,
+                          std::int64_t k, float alpha, const float *a, std::int64_t lda,
+                          const float *b, std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemmt_precondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                           c, ldc, dependencies);
+        auto done = detail::gemmt(backend_, queue_, upper_lower, transa, transb, n, k, alpha, a,
+                                  lda, b, ldb, beta, c, ldc, dependencies);
+        gemmt_postcondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                            c, ldc, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemmt(uplo upper_lower, transpose transa, transpose transb, std::int64_t n,
+                          std::int64_t k, double alpha, const double *a, std::int64_t lda,
+                          const double *b, std::int64_t ldb, double beta, double *c,
+                          std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemmt_precondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                           c, ldc, dependencies);
+        auto done = detail::gemmt(backend_, queue_, upper_lower, transa, transb, n, k, alpha, a,
+                                  lda, b, ldb, beta, c, ldc, dependencies);
+        gemmt_postcondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                            c, ldc, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemmt(uplo upper_lower, transpose transa, transpose transb, std::int64_t n,
+                          std::int64_t k, std::complex<float> alpha, const std::complex<float> *a,
+                          std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+                          std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemmt_precondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                           c, ldc, dependencies);
+        auto done = detail::gemmt(backend_, queue_, upper_lower, transa, transb, n, k, alpha, a,
+                                  lda, b, ldb, beta, c, ldc, dependencies);
+        gemmt_postcondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                            c, ldc, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemmt(uplo upper_lower, transpose transa, transpose transb, std::int64_t n,
+                          std::int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                          std::int64_t lda, const std::complex<double> *b, std::int64_t ldb,
+                          std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemmt_precondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                           c, ldc, dependencies);
+        auto done = detail::gemmt(backend_, queue_, upper_lower, transa, transb, n, k, alpha, a,
+                                  lda, b, ldb, beta, c, ldc, dependencies);
+        gemmt_postcondition(queue_, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta,
+                            c, ldc, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_bias(transpose transa, transpose transb, offset offsetc, std::int64_t m,
+                              std::int64_t n, std::int64_t k, float alpha, const std::int8_t *a,
+                              std::int64_t lda, std::int8_t ao, const std::uint8_t *b,
+                              std::int64_t ldb, std::uint8_t bo, float beta, std::int32_t *c,
+                              std::int64_t ldc, const std::int32_t *co,
+                              const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_bias_precondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                               bo, beta, c, ldc, co, dependencies);
+        auto done = detail::gemm_bias(backend_, queue_, transa, transb, offsetc, m, n, k, alpha, a,
+                                      lda, ao, b, ldb, bo, beta, c, ldc, co, dependencies);
+        gemm_bias_postcondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                                bo, beta, c, ldc, co, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_bias(transpose transa, transpose transb, offset offsetc, std::int64_t m,
+                              std::int64_t n, std::int64_t k, float alpha, const std::int8_t *a,
+                              std::int64_t lda, std::int8_t ao, const std::int8_t *b,
+                              std::int64_t ldb, std::int8_t bo, float beta, std::int32_t *c,
+                              std::int64_t ldc, const std::int32_t *co,
+                              const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_bias_precondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                               bo, beta, c, ldc, co, dependencies);
+        auto done = detail::gemm_bias(backend_, queue_, transa, transb, offsetc, m, n, k, alpha, a,
+                                      lda, ao, b, ldb, bo, beta, c, ldc, co, dependencies);
+        gemm_bias_postcondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                                bo, beta, c, ldc, co, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_bias(transpose transa, transpose transb, offset offsetc, std::int64_t m,
+                              std::int64_t n, std::int64_t k, float alpha, const std::uint8_t *a,
+                              std::int64_t lda, std::uint8_t ao, const std::int8_t *b,
+                              std::int64_t ldb, std::int8_t bo, float beta, std::int32_t *c,
+                              std::int64_t ldc, const std::int32_t *co,
+                              const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_bias_precondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                               bo, beta, c, ldc, co, dependencies);
+        auto done = detail::gemm_bias(backend_, queue_, transa, transb, offsetc, m, n, k, alpha, a,
+                                      lda, ao, b, ldb, bo, beta, c, ldc, co, dependencies);
+        gemm_bias_postcondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                                bo, beta, c, ldc, co, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_bias(transpose transa, transpose transb, offset offsetc, std::int64_t m,
+                              std::int64_t n, std::int64_t k, float alpha, const std::uint8_t *a,
+                              std::int64_t lda, std::uint8_t ao, const std::uint8_t *b,
+                              std::int64_t ldb, std::uint8_t bo, float beta, std::int32_t *c,
+                              std::int64_t ldc, const std::int32_t *co,
+                              const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_bias_precondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                               bo, beta, c, ldc, co, dependencies);
+        auto done = detail::gemm_bias(backend_, queue_, transa, transb, offsetc, m, n, k, alpha, a,
+                                      lda, ao, b, ldb, bo, beta, c, ldc, co, dependencies);
+        gemm_bias_postcondition(queue_, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                                bo, beta, c, ldc, co, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_pack(identifier which, transpose trans, std::int64_t m, std::int64_t n,
+                              std::int64_t k, float alpha, const float *src, std::int64_t ld,
+                              float *dest, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_pack_precondition(queue_, which, trans, m, n, k, alpha, src, ld, dest, dependencies);
+        auto done = detail::gemm_pack(backend_, queue_, which, trans, m, n, k, alpha, src, ld, dest,
+                                      dependencies);
+        gemm_pack_postcondition(queue_, which, trans, m, n, k, alpha, src, ld, dest, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_pack(identifier which, transpose trans, std::int64_t m, std::int64_t n,
+                              std::int64_t k, double alpha, const double *src, std::int64_t ld,
+                              double *dest, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_pack_precondition(queue_, which, trans, m, n, k, alpha, src, ld, dest, dependencies);
+        auto done = detail::gemm_pack(backend_, queue_, which, trans, m, n, k, alpha, src, ld, dest,
+                                      dependencies);
+        gemm_pack_postcondition(queue_, which, trans, m, n, k, alpha, src, ld, dest, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_compute(identifier which, transpose trans, std::int64_t m, std::int64_t n,
+                                 std::int64_t k, const float *packed, const float *other,
+                                 std::int64_t ld, float beta, float *c, std::int64_t ldc,
+                                 const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_compute_precondition(queue_, which, trans, m, n, k, packed, other, ld, beta, c, ldc,
+                                  dependencies);
+        auto done = detail::gemm_compute(backend_, queue_, which, trans, m, n, k, packed, other, ld,
+                                         beta, c, ldc, dependencies);
+        gemm_compute_postcondition(queue_, which, trans, m, n, k, packed, other, ld, beta, c, ldc,
+                                   dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm_compute(identifier which, transpose trans, std::int64_t m, std::int64_t n,
+                                 std::int64_t k, const double *packed, const double *other,
+                                 std::int64_t ld, double beta, double *c, std::int64_t ldc,
+                                 const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm_compute_precondition(queue_, which, trans, m, n, k, packed, other, ld, beta, c, ldc,
+                                  dependencies);
+        auto done = detail::gemm_compute(backend_, queue_, which, trans, m, n, k, packed, other, ld,
+                                         beta, c, ldc, dependencies);
+        gemm_compute_postcondition(queue_, which, trans, m, n, k, packed, other, ld, beta, c, ldc,
+                                   dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm3m(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                           std::int64_t k, std::complex<float> alpha, const std::complex<float> *a,
+                           std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+                           std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+                           const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm3m_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            dependencies);
+        auto done = detail::gemm3m(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                   beta, c, ldc, dependencies);
+        gemm3m_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemm3m(transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+                           std::int64_t k, std::complex<double> alpha,
+                           const std::complex<double> *a, std::int64_t lda,
+                           const std::complex<double> *b, std::int64_t ldb,
+                           std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+                           const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemm3m_precondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            dependencies);
+        auto done = detail::gemm3m(backend_, queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                                   beta, c, ldc, dependencies);
+        gemm3m_postcondition(queue_, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemv(transpose trans, std::int64_t m, std::int64_t n, float alpha,
+                         const float *a, std::int64_t lda, const float *x, std::int64_t incx,
+                         float beta, float *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemv_precondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+        auto done = detail::gemv(backend_, queue_, trans, m, n, alpha, a, lda, x, incx, beta, y,
+                                 incy, dependencies);
+        gemv_postcondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemv(transpose trans, std::int64_t m, std::int64_t n, double alpha,
+                         const double *a, std::int64_t lda, const double *x, std::int64_t incx,
+                         double beta, double *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemv_precondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+        auto done = detail::gemv(backend_, queue_, trans, m, n, alpha, a, lda, x, incx, beta, y,
+                                 incy, dependencies);
+        gemv_postcondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemv(transpose trans, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                         const std::complex<float> *a, std::int64_t lda,
+                         const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
+                         std::complex<float> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemv_precondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+        auto done = detail::gemv(backend_, queue_, trans, m, n, alpha, a, lda, x, incx, beta, y,
+                                 incy, dependencies);
+        gemv_postcondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemv(transpose trans, std::int64_t m, std::int64_t n,
+                         std::complex<double> alpha, const std::complex<double> *a,
+                         std::int64_t lda, const std::complex<double> *x, std::int64_t incx,
+                         std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemv_precondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy, dependencies);
+        auto done = detail::gemv(backend_, queue_, trans, m, n, alpha, a, lda, x, incx, beta, y,
+                                 incy, dependencies);
+        gemv_postcondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemv_batch(
+        transpose trans, std::int64_t m, std::int64_t n, float alpha, const float *a,
+        std::int64_t lda, std::int64_t stridea, const float *x, std::int64_t incx,
+        std::int64_t stridex, float beta, float *y, std::int64_t incy, std::int64_t stridey,
+        std::int64_t batch_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemv_batch_precondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size, dependencies);
+        auto done = detail::gemv_batch(backend_, queue_, trans, m, n, alpha, a, lda, stridea, x,
+                                       incx, stridex, beta, y, incy, stridey, batch_size,
+                                       dependencies);
+        gemv_batch_postcondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex,
+                                 beta, y, incy, stridey, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemv_batch(
+        transpose trans, std::int64_t m, std::int64_t n, double alpha, const double *a,
+        std::int64_t lda, std::int64_t stridea, const double *x, std::int64_t incx,
+        std::int64_t stridex, double beta, double *y, std::int64_t incy, std::int64_t stridey,
+        std::int64_t batch_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemv_batch_precondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size, dependencies);
+        auto done = detail::gemv_batch(backend_, queue_, trans, m, n, alpha, a, lda, stridea, x,
+                                       incx, stridex, beta, y, incy, stridey, batch_size,
+                                       dependencies);
+        gemv_batch_postcondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex,
+                                 beta, y, incy, stridey, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemv_batch(
+        transpose trans, std::int64_t m, std::int64_t n, std::complex<float> alpha,
+        const std::complex<float> *a, std::int64_t lda, std::int64_t stridea,
+        const std::complex<float> *x, std::int64_t incx, std::int64_t stridex,
+        std::complex<float> beta, std::complex<float> *y, std::int64_t incy, std::int64_t stridey,
+        std::int64_t batch_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemv_batch_precondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size, dependencies);
+        auto done = detail::gemv_batch(backend_, queue_, trans, m, n, alpha, a, lda, stridea, x,
+                                       incx, stridex, beta, y, incy, stridey, batch_size,
+                                       dependencies);
+        gemv_batch_postcondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex,
+                                 beta, y, incy, stridey, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemv_batch(
+        transpose trans, std::int64_t m, std::int64_t n, std::complex<double> alpha,
+        const std::complex<double> *a, std::int64_t lda, std::int64_t stridea,
+        const std::complex<double> *x, std::int64_t incx, std::int64_t stridex,
+        std::complex<double> beta, std::complex<double> *y, std::int64_t incy, std::int64_t stridey,
+        std::int64_t batch_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemv_batch_precondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex, beta,
+                                y, incy, stridey, batch_size, dependencies);
+        auto done = detail::gemv_batch(backend_, queue_, trans, m, n, alpha, a, lda, stridea, x,
+                                       incx, stridex, beta, y, incy, stridey, batch_size,
+                                       dependencies);
+        gemv_batch_postcondition(queue_, trans, m, n, alpha, a, lda, stridea, x, incx, stridex,
+                                 beta, y, incy, stridey, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemv_batch(transpose *trans, std::int64_t *m, std::int64_t *n, float *alpha,
+                               const float **a, std::int64_t *lda, const float **x,
+                               std::int64_t *incx, float *beta, float **y, std::int64_t *incy,
+                               std::int64_t group_count, std::int64_t *group_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemv_batch_precondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                group_count, group_size, dependencies);
+        auto done = detail::gemv_batch(backend_, queue_, trans, m, n, alpha, a, lda, x, incx, beta,
+                                       y, incy, group_count, group_size, dependencies);
+        gemv_batch_postcondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                 group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemv_batch(transpose *trans, std::int64_t *m, std::int64_t *n, double *alpha,
+                               const double **a, std::int64_t *lda, const double **x,
+                               std::int64_t *incx, double *beta, double **y, std::int64_t *incy,
+                               std::int64_t group_count, std::int64_t *group_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemv_batch_precondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                group_count, group_size, dependencies);
+        auto done = detail::gemv_batch(backend_, queue_, trans, m, n, alpha, a, lda, x, incx, beta,
+                                       y, incy, group_count, group_size, dependencies);
+        gemv_batch_postcondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                 group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemv_batch(
+        transpose *trans, std::int64_t *m, std::int64_t *n, std::complex<float> *alpha,
+        const std::complex<float> **a, std::int64_t *lda, const std::complex<float> **x,
+        std::int64_t *incx, std::complex<float> *beta, std::complex<float> **y, std::int64_t *incy,
+        std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemv_batch_precondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                group_count, group_size, dependencies);
+        auto done = detail::gemv_batch(backend_, queue_, trans, m, n, alpha, a, lda, x, incx, beta,
+                                       y, incy, group_count, group_size, dependencies);
+        gemv_batch_postcondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                 group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gemv_batch(
+        transpose *trans, std::int64_t *m, std::int64_t *n, std::complex<double> *alpha,
+        const std::complex<double> **a, std::int64_t *lda, const std::complex<double> **x,
+        std::int64_t *incx, std::complex<double> *beta, std::complex<double> **y,
+        std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<cl::sycl::event> &dependencies = {}) {
+        gemv_batch_precondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                group_count, group_size, dependencies);
+        auto done = detail::gemv_batch(backend_, queue_, trans, m, n, alpha, a, lda, x, incx, beta,
+                                       y, incy, group_count, group_size, dependencies);
+        gemv_batch_postcondition(queue_, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                                 group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event dgmm_batch(side left_right, std::int64_t m, std::int64_t n, const float *a,
+                               std::int64_t lda, std::int64_t stridea, const float *x,
+                               std::int64_t incx, std::int64_t stridex, float *c, std::int64_t ldc,
+                               std::int64_t stridec, std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        dgmm_batch_precondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size, dependencies);
+        auto done = detail::dgmm_batch(backend_, queue_, left_right, m, n, a, lda, stridea, x, incx,
+                                       stridex, c, ldc, stridec, batch_size, dependencies);
+        dgmm_batch_postcondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c,
+                                 ldc, stridec, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event dgmm_batch(side left_right, std::int64_t m, std::int64_t n, const double *a,
+                               std::int64_t lda, std::int64_t stridea, const double *x,
+                               std::int64_t incx, std::int64_t stridex, double *c, std::int64_t ldc,
+                               std::int64_t stridec, std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        dgmm_batch_precondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size, dependencies);
+        auto done = detail::dgmm_batch(backend_, queue_, left_right, m, n, a, lda, stridea, x, incx,
+                                       stridex, c, ldc, stridec, batch_size, dependencies);
+        dgmm_batch_postcondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c,
+                                 ldc, stridec, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event dgmm_batch(
+        side left_right, std::int64_t m, std::int64_t n, const std::complex<float> *a,
+        std::int64_t lda, std::int64_t stridea, const std::complex<float> *x, std::int64_t incx,
+        std::int64_t stridex, std::complex<float> *c, std::int64_t ldc, std::int64_t stridec,
+        std::int64_t batch_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        dgmm_batch_precondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size, dependencies);
+        auto done = detail::dgmm_batch(backend_, queue_, left_right, m, n, a, lda, stridea, x, incx,
+                                       stridex, c, ldc, stridec, batch_size, dependencies);
+        dgmm_batch_postcondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c,
+                                 ldc, stridec, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event dgmm_batch(
+        side left_right, std::int64_t m, std::int64_t n, const std::complex<double> *a,
+        std::int64_t lda, std::int64_t stridea, const std::complex<double> *x, std::int64_t incx,
+        std::int64_t stridex, std::complex<double> *c, std::int64_t ldc, std::int64_t stridec,
+        std::int64_t batch_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        dgmm_batch_precondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c, ldc,
+                                stridec, batch_size, dependencies);
+        auto done = detail::dgmm_batch(backend_, queue_, left_right, m, n, a, lda, stridea, x, incx,
+                                       stridex, c, ldc, stridec, batch_size, dependencies);
+        dgmm_batch_postcondition(queue_, left_right, m, n, a, lda, stridea, x, incx, stridex, c,
+                                 ldc, stridec, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event dgmm_batch(
+        side *left_right, std::int64_t *m, std::int64_t *n, const float **a, std::int64_t *lda,
+        const float **x, std::int64_t *incx, float **c, std::int64_t *ldc, std::int64_t group_count,
+        std::int64_t *group_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        dgmm_batch_precondition(queue_, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                                group_size, dependencies);
+        auto done = detail::dgmm_batch(backend_, queue_, left_right, m, n, a, lda, x, incx, c, ldc,
+                                       group_count, group_size, dependencies);
+        dgmm_batch_postcondition(queue_, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                                 group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event dgmm_batch(side *left_right, std::int64_t *m, std::int64_t *n, const double **a,
+                               std::int64_t *lda, const double **x, std::int64_t *incx, double **c,
+                               std::int64_t *ldc, std::int64_t group_count,
+                               std::int64_t *group_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        dgmm_batch_precondition(queue_, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                                group_size, dependencies);
+        auto done = detail::dgmm_batch(backend_, queue_, left_right, m, n, a, lda, x, incx, c, ldc,
+                                       group_count, group_size, dependencies);
+        dgmm_batch_postcondition(queue_, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                                 group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event dgmm_batch(
+        side *left_right, std::int64_t *m, std::int64_t *n, const std::complex<float> **a,
+        std::int64_t *lda, const std::complex<float> **x, std::int64_t *incx,
+        std::complex<float> **c, std::int64_t *ldc, std::int64_t group_count,
+        std::int64_t *group_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        dgmm_batch_precondition(queue_, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                                group_size, dependencies);
+        auto done = detail::dgmm_batch(backend_, queue_, left_right, m, n, a, lda, x, incx, c, ldc,
+                                       group_count, group_size, dependencies);
+        dgmm_batch_postcondition(queue_, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                                 group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event dgmm_batch(
+        side *left_right, std::int64_t *m, std::int64_t *n, const std::complex<double> **a,
+        std::int64_t *lda, const std::complex<double> **x, std::int64_t *incx,
+        std::complex<double> **c, std::int64_t *ldc, std::int64_t group_count,
+        std::int64_t *group_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        dgmm_batch_precondition(queue_, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                                group_size, dependencies);
+        auto done = detail::dgmm_batch(backend_, queue_, left_right, m, n, a, lda, x, incx, c, ldc,
+                                       group_count, group_size, dependencies);
+        dgmm_batch_postcondition(queue_, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                                 group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event ger(std::int64_t m, std::int64_t n, float alpha, const float *x,
+                        std::int64_t incx, const float *y, std::int64_t incy, float *a,
+                        std::int64_t lda, const std::vector<cl::sycl::event> &dependencies = {}) {
+        ger_precondition(queue_, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        auto done = detail::ger(backend_, queue_, m, n, alpha, x, incx, y, incy, a, lda,
+                                dependencies);
+        ger_postcondition(queue_, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        return done;
+    }
+
+    cl::sycl::event ger(std::int64_t m, std::int64_t n, double alpha, const double *x,
+                        std::int64_t incx, const double *y, std::int64_t incy, double *a,
+                        std::int64_t lda, const std::vector<cl::sycl::event> &dependencies = {}) {
+        ger_precondition(queue_, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        auto done = detail::ger(backend_, queue_, m, n, alpha, x, incx, y, incy, a, lda,
+                                dependencies);
+        ger_postcondition(queue_, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gerc(std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                         const std::complex<float> *x, std::int64_t incx,
+                         const std::complex<float> *y, std::int64_t incy, std::complex<float> *a,
+                         std::int64_t lda, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gerc_precondition(queue_, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        auto done = detail::gerc(backend_, queue_, m, n, alpha, x, incx, y, incy, a, lda,
+                                 dependencies);
+        gerc_postcondition(queue_, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        return done;
+    }
+
+    cl::sycl::event gerc(std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                         const std::complex<double> *x, std::int64_t incx,
+                         const std::complex<double> *y, std::int64_t incy, std::complex<double> *a,
+                         std::int64_t lda, const std::vector<cl::sycl::event> &dependencies = {}) {
+        gerc_precondition(queue_, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        auto done = detail::gerc(backend_, queue_, m, n, alpha, x, incx, y, incy, a, lda,
+                                 dependencies);
+        gerc_postcondition(queue_, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        return done;
+    }
+
+    cl::sycl::event geru(std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                         const std::complex<float> *x, std::int64_t incx,
+                         const std::complex<float> *y, std::int64_t incy, std::complex<float> *a,
+                         std::int64_t lda, const std::vector<cl::sycl::event> &dependencies = {}) {
+        geru_precondition(queue_, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        auto done = detail::geru(backend_, queue_, m, n, alpha, x, incx, y, incy, a, lda,
+                                 dependencies);
+        geru_postcondition(queue_, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        return done;
+    }
+
+    cl::sycl::event geru(std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                         const std::complex<double> *x, std::int64_t incx,
+                         const std::complex<double> *y, std::int64_t incy, std::complex<double> *a,
+                         std::int64_t lda, const std::vector<cl::sycl::event> &dependencies = {}) {
+        geru_precondition(queue_, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        auto done = detail::geru(backend_, queue_, m, n, alpha, x, incx, y, incy, a, lda,
+                                 dependencies);
+        geru_postcondition(queue_, m, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        return done;
+    }
+
+    cl::sycl::event hbmv(uplo upper_lower, std::int64_t n, std::int64_t k,
+                         std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                         const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
+                         std::complex<float> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        hbmv_precondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                          dependencies);
+        auto done = detail::hbmv(backend_, queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta,
+                                 y, incy, dependencies);
+        hbmv_postcondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event hbmv(uplo upper_lower, std::int64_t n, std::int64_t k,
+                         std::complex<double> alpha, const std::complex<double> *a,
+                         std::int64_t lda, const std::complex<double> *x, std::int64_t incx,
+                         std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        hbmv_precondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                          dependencies);
+        auto done = detail::hbmv(backend_, queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta,
+                                 y, incy, dependencies);
+        hbmv_postcondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event hemm(side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+                         std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                         const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+                         std::complex<float> *c, std::int64_t ldc,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        hemm_precondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                          ldc, dependencies);
+        auto done = detail::hemm(backend_, queue_, left_right, upper_lower, m, n, alpha, a, lda, b,
+                                 ldb, beta, c, ldc, dependencies);
+        hemm_postcondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                           ldc, dependencies);
+        return done;
+    }
+
+    cl::sycl::event hemm(side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+                         std::complex<double> alpha, const std::complex<double> *a,
+                         std::int64_t lda, const std::complex<double> *b, std::int64_t ldb,
+                         std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        hemm_precondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                          ldc, dependencies);
+        auto done = detail::hemm(backend_, queue_, left_right, upper_lower, m, n, alpha, a, lda, b,
+                                 ldb, beta, c, ldc, dependencies);
+        hemm_postcondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                           ldc, dependencies);
+        return done;
+    }
+
+    cl::sycl::event hemv(uplo upper_lower, std::int64_t n, std::complex<float> alpha,
+                         const std::complex<float> *a, std::int64_t lda,
+                         const std::complex<float> *x, std::int64_t incx, std::complex<float> beta,
+                         std::complex<float> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        hemv_precondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                          dependencies);
+        auto done = detail::hemv(backend_, queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y,
+                                 incy, dependencies);
+        hemv_postcondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event hemv(uplo upper_lower, std::int64_t n, std::complex<double> alpha,
+                         const std::complex<double> *a, std::int64_t lda,
+                         const std::complex<double> *x, std::int64_t incx,
+                         std::complex<double> beta, std::complex<double> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        hemv_precondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                          dependencies);
+        auto done = detail::hemv(backend_, queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y,
+                                 incy, dependencies);
+        hemv_postcondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event her(uplo upper_lower, std::int64_t n, float alpha, const std::complex<float> *x,
+                        std::int64_t incx, std::complex<float> *a, std::int64_t lda,
+                        const std::vector<cl::sycl::event> &dependencies = {}) {
+        her_precondition(queue_, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+        auto done = detail::her(backend_, queue_, upper_lower, n, alpha, x, incx, a, lda,
+                                dependencies);
+        her_postcondition(queue_, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+        return done;
+    }
+
+    cl::sycl::event her(uplo upper_lower, std::int64_t n, double alpha,
+                        const std::complex<double> *x, std::int64_t incx, std::complex<double> *a,
+                        std::int64_t lda, const std::vector<cl::sycl::event> &dependencies = {}) {
+        her_precondition(queue_, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+        auto done = detail::her(backend_, queue_, upper_lower, n, alpha, x, incx, a, lda,
+                                dependencies);
+        her_postcondition(queue_, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+        return done;
+    }
+
+    cl::sycl::event her2(uplo upper_lower, std::int64_t n, std::complex<float> alpha,
+                         const std::complex<float> *x, std::int64_t incx,
+                         const std::complex<float> *y, std::int64_t incy, std::complex<float> *a,
+                         std::int64_t lda, const std::vector<cl::sycl::event> &dependencies = {}) {
+        her2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        auto done = detail::her2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda,
+                                 dependencies);
+        her2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        return done;
+    }
+
+    cl::sycl::event her2(uplo upper_lower, std::int64_t n, std::complex<double> alpha,
+                         const std::complex<double> *x, std::int64_t incx,
+                         const std::complex<double> *y, std::int64_t incy, std::complex<double> *a,
+                         std::int64_t lda, const std::vector<cl::sycl::event> &dependencies = {}) {
+        her2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        auto done = detail::her2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda,
+                                 dependencies);
+        her2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        return done;
+    }
+
+    cl::sycl::event her2k(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                          std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                          const std::complex<float> *b, std::int64_t ldb, float beta,
+                          std::complex<float> *c, std::int64_t ldc,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        her2k_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+        auto done = detail::her2k(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
+                                  beta, c, ldc, dependencies);
+        her2k_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            dependencies);
+        return done;
+    }
+
+    cl::sycl::event her2k(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                          std::complex<double> alpha, const std::complex<double> *a,
+                          std::int64_t lda, const std::complex<double> *b, std::int64_t ldb,
+                          double beta, std::complex<double> *c, std::int64_t ldc,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        her2k_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+        auto done = detail::her2k(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
+                                  beta, c, ldc, dependencies);
+        her2k_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            dependencies);
+        return done;
+    }
+
+    cl::sycl::event herk(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                         float alpha, const std::complex<float> *a, std::int64_t lda, float beta,
+                         std::complex<float> *c, std::int64_t ldc,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        herk_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                          dependencies);
+        auto done = detail::herk(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c,
+                                 ldc, dependencies);
+        herk_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event herk(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                         double alpha, const std::complex<double> *a, std::int64_t lda, double beta,
+                         std::complex<double> *c, std::int64_t ldc,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        herk_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                          dependencies);
+        auto done = detail::herk(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c,
+                                 ldc, dependencies);
+        herk_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event hpmv(uplo upper_lower, std::int64_t n, std::complex<float> alpha,
+                         const std::complex<float> *a, const std::complex<float> *x,
+                         std::int64_t incx, std::complex<float> beta, std::complex<float> *y,
+                         std::int64_t incy, const std::vector<cl::sycl::event> &dependencies = {}) {
+        hpmv_precondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+        auto done = detail::hpmv(backend_, queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy,
+                                 dependencies);
+        hpmv_postcondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event hpmv(uplo upper_lower, std::int64_t n, std::complex<double> alpha,
+                         const std::complex<double> *a, const std::complex<double> *x,
+                         std::int64_t incx, std::complex<double> beta, std::complex<double> *y,
+                         std::int64_t incy, const std::vector<cl::sycl::event> &dependencies = {}) {
+        hpmv_precondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+        auto done = detail::hpmv(backend_, queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy,
+                                 dependencies);
+        hpmv_postcondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event hpr(uplo upper_lower, std::int64_t n, float alpha, const std::complex<float> *x,
+                        std::int64_t incx, std::complex<float> *a,
+                        const std::vector<cl::sycl::event> &dependencies = {}) {
+        hpr_precondition(queue_, upper_lower, n, alpha, x, incx, a, dependencies);
+        auto done = detail::hpr(backend_, queue_, upper_lower, n, alpha, x, incx, a, dependencies);
+        hpr_postcondition(queue_, upper_lower, n, alpha, x, incx, a, dependencies);
+        return done;
+    }
+
+    cl::sycl::event hpr(uplo upper_lower, std::int64_t n, double alpha,
+                        const std::complex<double> *x, std::int64_t incx, std::complex<double> *a,
+                        const std::vector<cl::sycl::event> &dependencies = {}) {
+        hpr_precondition(queue_, upper_lower, n, alpha, x, incx, a, dependencies);
+        auto done = detail::hpr(backend_, queue_, upper_lower, n, alpha, x, incx, a, dependencies);
+        hpr_postcondition(queue_, upper_lower, n, alpha, x, incx, a, dependencies);
+        return done;
+    }
+
+    cl::sycl::event hpr2(uplo upper_lower, std::int64_t n, std::complex<float> alpha,
+                         const std::complex<float> *x, std::int64_t incx,
+                         const std::complex<float> *y, std::int64_t incy, std::complex<float> *a,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        hpr2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+        auto done = detail::hpr2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a,
+                                 dependencies);
+        hpr2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+        return done;
+    }
+
+    cl::sycl::event hpr2(uplo upper_lower, std::int64_t n, std::complex<double> alpha,
+                         const std::complex<double> *x, std::int64_t incx,
+                         const std::complex<double> *y, std::int64_t incy, std::complex<double> *a,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        hpr2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+        auto done = detail::hpr2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a,
+                                 dependencies);
+        hpr2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+        return done;
+    }
+
+    cl::sycl::event iamax(std::int64_t n, const float *x, std::int64_t incx, std::int64_t *result,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        iamax_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::iamax(backend_, queue_, n, x, incx, result, dependencies);
+        iamax_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event iamax(std::int64_t n, const double *x, std::int64_t incx, std::int64_t *result,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        iamax_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::iamax(backend_, queue_, n, x, incx, result, dependencies);
+        iamax_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event iamax(std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+                          std::int64_t *result,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        iamax_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::iamax(backend_, queue_, n, x, incx, result, dependencies);
+        iamax_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event iamax(std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+                          std::int64_t *result,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        iamax_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::iamax(backend_, queue_, n, x, incx, result, dependencies);
+        iamax_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event iamin(std::int64_t n, const float *x, std::int64_t incx, std::int64_t *result,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        iamin_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::iamin(backend_, queue_, n, x, incx, result, dependencies);
+        iamin_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event iamin(std::int64_t n, const double *x, std::int64_t incx, std::int64_t *result,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        iamin_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::iamin(backend_, queue_, n, x, incx, result, dependencies);
+        iamin_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event iamin(std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+                          std::int64_t *result,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        iamin_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::iamin(backend_, queue_, n, x, incx, result, dependencies);
+        iamin_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event iamin(std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+                          std::int64_t *result,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        iamin_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::iamin(backend_, queue_, n, x, incx, result, dependencies);
+        iamin_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event nrm2(std::int64_t n, const std::complex<float> *x, std::int64_t incx,
+                         float *result, const std::vector<cl::sycl::event> &dependencies = {}) {
+        nrm2_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::nrm2(backend_, queue_, n, x, incx, result, dependencies);
+        nrm2_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event nrm2(std::int64_t n, const std::complex<double> *x, std::int64_t incx,
+                         double *result, const std::vector<cl::sycl::event> &dependencies = {}) {
+        nrm2_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::nrm2(backend_, queue_, n, x, incx, result, dependencies);
+        nrm2_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event nrm2(std::int64_t n, const float *x, std::int64_t incx, float *result,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        nrm2_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::nrm2(backend_, queue_, n, x, incx, result, dependencies);
+        nrm2_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event nrm2(std::int64_t n, const double *x, std::int64_t incx, double *result,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        nrm2_precondition(queue_, n, x, incx, result, dependencies);
+        auto done = detail::nrm2(backend_, queue_, n, x, incx, result, dependencies);
+        nrm2_postcondition(queue_, n, x, incx, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event rot(std::int64_t n, std::complex<float> *x, std::int64_t incx,
+                        std::complex<float> *y, std::int64_t incy, float c, float s,
+                        const std::vector<cl::sycl::event> &dependencies = {}) {
+        rot_precondition(queue_, n, x, incx, y, incy, c, s, dependencies);
+        auto done = detail::rot(backend_, queue_, n, x, incx, y, incy, c, s, dependencies);
+        rot_postcondition(queue_, n, x, incx, y, incy, c, s, dependencies);
+        return done;
+    }
+
+    cl::sycl::event rot(std::int64_t n, std::complex<double> *x, std::int64_t incx,
+                        std::complex<double> *y, std::int64_t incy, double c, double s,
+                        const std::vector<cl::sycl::event> &dependencies = {}) {
+        rot_precondition(queue_, n, x, incx, y, incy, c, s, dependencies);
+        auto done = detail::rot(backend_, queue_, n, x, incx, y, incy, c, s, dependencies);
+        rot_postcondition(queue_, n, x, incx, y, incy, c, s, dependencies);
+        return done;
+    }
+
+    cl::sycl::event rot(std::int64_t n, float *x, std::int64_t incx, float *y, std::int64_t incy,
+                        float c, float s, const std::vector<cl::sycl::event> &dependencies = {}) {
+        rot_precondition(queue_, n, x, incx, y, incy, c, s, dependencies);
+        auto done = detail::rot(backend_, queue_, n, x, incx, y, incy, c, s, dependencies);
+        rot_postcondition(queue_, n, x, incx, y, incy, c, s, dependencies);
+        return done;
+    }
+
+    cl::sycl::event rot(std::int64_t n, double *x, std::int64_t incx, double *y, std::int64_t incy,
+                        double c, double s, const std::vector<cl::sycl::event> &dependencies = {}) {
+        rot_precondition(queue_, n, x, incx, y, incy, c, s, dependencies);
+        auto done = detail::rot(backend_, queue_, n, x, incx, y, incy, c, s, dependencies);
+        rot_postcondition(queue_, n, x, incx, y, incy, c, s, dependencies);
+        return done;
+    }
+
+    cl::sycl::event rotg(float *a, float *b, float *c, float *s,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        rotg_precondition(queue_, a, b, c, s, dependencies);
+        auto done = detail::rotg(backend_, queue_, a, b, c, s, dependencies);
+        rotg_postcondition(queue_, a, b, c, s, dependencies);
+        return done;
+    }
+
+    cl::sycl::event rotg(double *a, double *b, double *c, double *s,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        rotg_precondition(queue_, a, b, c, s, dependencies);
+        auto done = detail::rotg(backend_, queue_, a, b, c, s, dependencies);
+        rotg_postcondition(queue_, a, b, c, s, dependencies);
+        return done;
+    }
+
+    cl::sycl::event rotg(std::complex<float> *a, std::complex<float> *b, float *c,
+                         std::complex<float> *s,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        rotg_precondition(queue_, a, b, c, s, dependencies);
+        auto done = detail::rotg(backend_, queue_, a, b, c, s, dependencies);
+        rotg_postcondition(queue_, a, b, c, s, dependencies);
+        return done;
+    }
+
+    cl::sycl::event rotg(std::complex<double> *a, std::complex<double> *b, double *c,
+                         std::complex<double> *s,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        rotg_precondition(queue_, a, b, c, s, dependencies);
+        auto done = detail::rotg(backend_, queue_, a, b, c, s, dependencies);
+        rotg_postcondition(queue_, a, b, c, s, dependencies);
+        return done;
+    }
+
+    cl::sycl::event rotm(std::int64_t n, float *x, std::int64_t incx, float *y, std::int64_t incy,
+                         float *param, const std::vector<cl::sycl::event> &dependencies = {}) {
+        rotm_precondition(queue_, n, x, incx, y, incy, param, dependencies);
+        auto done = detail::rotm(backend_, queue_, n, x, incx, y, incy, param, dependencies);
+        rotm_postcondition(queue_, n, x, incx, y, incy, param, dependencies);
+        return done;
+    }
+
+    cl::sycl::event rotm(std::int64_t n, double *x, std::int64_t incx, double *y, std::int64_t incy,
+                         double *param, const std::vector<cl::sycl::event> &dependencies = {}) {
+        rotm_precondition(queue_, n, x, incx, y, incy, param, dependencies);
+        auto done = detail::rotm(backend_, queue_, n, x, incx, y, incy, param, dependencies);
+        rotm_postcondition(queue_, n, x, incx, y, incy, param, dependencies);
+        return done;
+    }
+
+    cl::sycl::event rotmg(float *d1, float *d2, float *x1, float y1, float *param,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        rotmg_precondition(queue_, d1, d2, x1, y1, param, dependencies);
+        auto done = detail::rotmg(backend_, queue_, d1, d2, x1, y1, param, dependencies);
+        rotmg_postcondition(queue_, d1, d2, x1, y1, param, dependencies);
+        return done;
+    }
+
+    cl::sycl::event rotmg(double *d1, double *d2, double *x1, double y1, double *param,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        rotmg_precondition(queue_, d1, d2, x1, y1, param, dependencies);
+        auto done = detail::rotmg(backend_, queue_, d1, d2, x1, y1, param, dependencies);
+        rotmg_postcondition(queue_, d1, d2, x1, y1, param, dependencies);
+        return done;
+    }
+
+    cl::sycl::event sbmv(uplo upper_lower, std::int64_t n, std::int64_t k, float alpha,
+                         const float *a, std::int64_t lda, const float *x, std::int64_t incx,
+                         float beta, float *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        sbmv_precondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                          dependencies);
+        auto done = detail::sbmv(backend_, queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta,
+                                 y, incy, dependencies);
+        sbmv_postcondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event sbmv(uplo upper_lower, std::int64_t n, std::int64_t k, double alpha,
+                         const double *a, std::int64_t lda, const double *x, std::int64_t incx,
+                         double beta, double *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        sbmv_precondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                          dependencies);
+        auto done = detail::sbmv(backend_, queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta,
+                                 y, incy, dependencies);
+        sbmv_postcondition(queue_, upper_lower, n, k, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event scal(std::int64_t n, float alpha, float *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        scal_precondition(queue_, n, alpha, x, incx, dependencies);
+        auto done = detail::scal(backend_, queue_, n, alpha, x, incx, dependencies);
+        scal_postcondition(queue_, n, alpha, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event scal(std::int64_t n, double alpha, double *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        scal_precondition(queue_, n, alpha, x, incx, dependencies);
+        auto done = detail::scal(backend_, queue_, n, alpha, x, incx, dependencies);
+        scal_postcondition(queue_, n, alpha, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event scal(std::int64_t n, std::complex<float> alpha, std::complex<float> *x,
+                         std::int64_t incx, const std::vector<cl::sycl::event> &dependencies = {}) {
+        scal_precondition(queue_, n, alpha, x, incx, dependencies);
+        auto done = detail::scal(backend_, queue_, n, alpha, x, incx, dependencies);
+        scal_postcondition(queue_, n, alpha, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event scal(std::int64_t n, std::complex<double> alpha, std::complex<double> *x,
+                         std::int64_t incx, const std::vector<cl::sycl::event> &dependencies = {}) {
+        scal_precondition(queue_, n, alpha, x, incx, dependencies);
+        auto done = detail::scal(backend_, queue_, n, alpha, x, incx, dependencies);
+        scal_postcondition(queue_, n, alpha, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event scal(std::int64_t n, float alpha, std::complex<float> *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        scal_precondition(queue_, n, alpha, x, incx, dependencies);
+        auto done = detail::scal(backend_, queue_, n, alpha, x, incx, dependencies);
+        scal_postcondition(queue_, n, alpha, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event scal(std::int64_t n, double alpha, std::complex<double> *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        scal_precondition(queue_, n, alpha, x, incx, dependencies);
+        auto done = detail::scal(backend_, queue_, n, alpha, x, incx, dependencies);
+        scal_postcondition(queue_, n, alpha, x, incx, dependencies);
+        return done;
+    }
+
+    template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, float> = nullptr>
+    cl::sycl::event scal(std::int64_t n, Ta alpha, float *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        scal_precondition(queue_, n, alpha, x, incx, dependencies);
+        auto done = detail::scal(backend_, queue_, n, alpha, x, incx, dependencies);
+        scal_postcondition(queue_, n, alpha, x, incx, dependencies);
+        return done;
+    }
+
+    template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, double> = nullptr>
+    cl::sycl::event scal(std::int64_t n, Ta alpha, double *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        scal_precondition(queue_, n, alpha, x, incx, dependencies);
+        auto done = detail::scal(backend_, queue_, n, alpha, x, incx, dependencies);
+        scal_postcondition(queue_, n, alpha, x, incx, dependencies);
+        return done;
+    }
+
+    template <typename Ta,
+              oneapi::mkl::blas::detail::is_pointer_to<Ta, std::complex<float>> = nullptr>
+    cl::sycl::event scal(std::int64_t n, Ta alpha, std::complex<float> *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        scal_precondition(queue_, n, alpha, x, incx, dependencies);
+        auto done = detail::scal(backend_, queue_, n, alpha, x, incx, dependencies);
+        scal_postcondition(queue_, n, alpha, x, incx, dependencies);
+        return done;
+    }
+
+    template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, float> = nullptr>
+    cl::sycl::event scal(std::int64_t n, Ta alpha, std::complex<float> *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        scal_precondition(queue_, n, alpha, x, incx, dependencies);
+        auto done = detail::scal(backend_, queue_, n, alpha, x, incx, dependencies);
+        scal_postcondition(queue_, n, alpha, x, incx, dependencies);
+        return done;
+    }
+
+    template <typename Ta,
+              oneapi::mkl::blas::detail::is_pointer_to<Ta, std::complex<double>> = nullptr>
+    cl::sycl::event scal(std::int64_t n, Ta alpha, std::complex<double> *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        scal_precondition(queue_, n, alpha, x, incx, dependencies);
+        auto done = detail::scal(backend_, queue_, n, alpha, x, incx, dependencies);
+        scal_postcondition(queue_, n, alpha, x, incx, dependencies);
+        return done;
+    }
+
+    template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, double> = nullptr>
+    cl::sycl::event scal(std::int64_t n, Ta alpha, std::complex<double> *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        scal_precondition(queue_, n, alpha, x, incx, dependencies);
+        auto done = detail::scal(backend_, queue_, n, alpha, x, incx, dependencies);
+        scal_postcondition(queue_, n, alpha, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event sdsdot(std::int64_t n, float sb, const float *x, std::int64_t incx,
+                           const float *y, std::int64_t incy, float *result,
+                           const std::vector<cl::sycl::event> &dependencies = {}) {
+        sdsdot_precondition(queue_, n, sb, x, incx, y, incy, result, dependencies);
+        auto done = detail::sdsdot(backend_, queue_, n, sb, x, incx, y, incy, result, dependencies);
+        sdsdot_postcondition(queue_, n, sb, x, incx, y, incy, result, dependencies);
+        return done;
+    }
+
+    cl::sycl::event spmv(uplo upper_lower, std::int64_t n, float alpha, const float *a,
+                         const float *x, std::int64_t incx, float beta, float *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        spmv_precondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+        auto done = detail::spmv(backend_, queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy,
+                                 dependencies);
+        spmv_postcondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event spmv(uplo upper_lower, std::int64_t n, double alpha, const double *a,
+                         const double *x, std::int64_t incx, double beta, double *y,
+                         std::int64_t incy, const std::vector<cl::sycl::event> &dependencies = {}) {
+        spmv_precondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+        auto done = detail::spmv(backend_, queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy,
+                                 dependencies);
+        spmv_postcondition(queue_, upper_lower, n, alpha, a, x, incx, beta, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event spr(uplo upper_lower, std::int64_t n, float alpha, const float *x,
+                        std::int64_t incx, float *a,
+                        const std::vector<cl::sycl::event> &dependencies = {}) {
+        spr_precondition(queue_, upper_lower, n, alpha, x, incx, a, dependencies);
+        auto done = detail::spr(backend_, queue_, upper_lower, n, alpha, x, incx, a, dependencies);
+        spr_postcondition(queue_, upper_lower, n, alpha, x, incx, a, dependencies);
+        return done;
+    }
+
+    cl::sycl::event spr(uplo upper_lower, std::int64_t n, double alpha, const double *x,
+                        std::int64_t incx, double *a,
+                        const std::vector<cl::sycl::event> &dependencies = {}) {
+        spr_precondition(queue_, upper_lower, n, alpha, x, incx, a, dependencies);
+        auto done = detail::spr(backend_, queue_, upper_lower, n, alpha, x, incx, a, dependencies);
+        spr_postcondition(queue_, upper_lower, n, alpha, x, incx, a, dependencies);
+        return done;
+    }
+
+    cl::sycl::event spr2(uplo upper_lower, std::int64_t n, float alpha, const float *x,
+                         std::int64_t incx, const float *y, std::int64_t incy, float *a,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        spr2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+        auto done = detail::spr2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a,
+                                 dependencies);
+        spr2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+        return done;
+    }
+
+    cl::sycl::event spr2(uplo upper_lower, std::int64_t n, double alpha, const double *x,
+                         std::int64_t incx, const double *y, std::int64_t incy, double *a,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        spr2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+        auto done = detail::spr2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a,
+                                 dependencies);
+        spr2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, dependencies);
+        return done;
+    }
+
+    cl::sycl::event swap(std::int64_t n, float *x, std::int64_t incx, float *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        swap_precondition(queue_, n, x, incx, y, incy, dependencies);
+        auto done = detail::swap(backend_, queue_, n, x, incx, y, incy, dependencies);
+        swap_postcondition(queue_, n, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event swap(std::int64_t n, double *x, std::int64_t incx, double *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        swap_precondition(queue_, n, x, incx, y, incy, dependencies);
+        auto done = detail::swap(backend_, queue_, n, x, incx, y, incy, dependencies);
+        swap_postcondition(queue_, n, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event swap(std::int64_t n, std::complex<float> *x, std::int64_t incx,
+                         std::complex<float> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        swap_precondition(queue_, n, x, incx, y, incy, dependencies);
+        auto done = detail::swap(backend_, queue_, n, x, incx, y, incy, dependencies);
+        swap_postcondition(queue_, n, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event swap(std::int64_t n, std::complex<double> *x, std::int64_t incx,
+                         std::complex<double> *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        swap_precondition(queue_, n, x, incx, y, incy, dependencies);
+        auto done = detail::swap(backend_, queue_, n, x, incx, y, incy, dependencies);
+        swap_postcondition(queue_, n, x, incx, y, incy, dependencies);
+        return done;
+    }
+
+    cl::sycl::event symm(side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+                         float alpha, const float *a, std::int64_t lda, const float *b,
+                         std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        symm_precondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                          ldc, dependencies);
+        auto done = detail::symm(backend_, queue_, left_right, upper_lower, m, n, alpha, a, lda, b,
+                                 ldb, beta, c, ldc, dependencies);
+        symm_postcondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                           ldc, dependencies);
+        return done;
+    }
+
+    cl::sycl::event symm(side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+                         double alpha, const double *a, std::int64_t lda, const double *b,
+                         std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        symm_precondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                          ldc, dependencies);
+        auto done = detail::symm(backend_, queue_, left_right, upper_lower, m, n, alpha, a, lda, b,
+                                 ldb, beta, c, ldc, dependencies);
+        symm_postcondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                           ldc, dependencies);
+        return done;
+    }
+
+    cl::sycl::event symm(side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+                         std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                         const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+                         std::complex<float> *c, std::int64_t ldc,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        symm_precondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                          ldc, dependencies);
+        auto done = detail::symm(backend_, queue_, left_right, upper_lower, m, n, alpha, a, lda, b,
+                                 ldb, beta, c, ldc, dependencies);
+        symm_postcondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                           ldc, dependencies);
+        return done;
+    }
+
+    cl::sycl::event symm(side left_right, uplo upper_lower, std::int64_t m, std::int64_t n,
+                         std::complex<double> alpha, const std::complex<double> *a,
+                         std::int64_t lda, const std::complex<double> *b, std::int64_t ldb,
+                         std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        symm_precondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                          ldc, dependencies);
+        auto done = detail::symm(backend_, queue_, left_right, upper_lower, m, n, alpha, a, lda, b,
+                                 ldb, beta, c, ldc, dependencies);
+        symm_postcondition(queue_, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta, c,
+                           ldc, dependencies);
+        return done;
+    }
+
+    cl::sycl::event symv(uplo upper_lower, std::int64_t n, float alpha, const float *a,
+                         std::int64_t lda, const float *x, std::int64_t incx, float beta, float *y,
+                         std::int64_t incy, const std::vector<cl::sycl::event> &dependencies = {}) {
+        symv_precondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                          dependencies);
+        auto done = detail::symv(backend_, queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y,
+                                 incy, dependencies);
+        symv_postcondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event symv(uplo upper_lower, std::int64_t n, double alpha, const double *a,
+                         std::int64_t lda, const double *x, std::int64_t incx, double beta,
+                         double *y, std::int64_t incy,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        symv_precondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                          dependencies);
+        auto done = detail::symv(backend_, queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y,
+                                 incy, dependencies);
+        symv_postcondition(queue_, upper_lower, n, alpha, a, lda, x, incx, beta, y, incy,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event syr(uplo upper_lower, std::int64_t n, float alpha, const float *x,
+                        std::int64_t incx, float *a, std::int64_t lda,
+                        const std::vector<cl::sycl::event> &dependencies = {}) {
+        syr_precondition(queue_, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+        auto done = detail::syr(backend_, queue_, upper_lower, n, alpha, x, incx, a, lda,
+                                dependencies);
+        syr_postcondition(queue_, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+        return done;
+    }
+
+    cl::sycl::event syr(uplo upper_lower, std::int64_t n, double alpha, const double *x,
+                        std::int64_t incx, double *a, std::int64_t lda,
+                        const std::vector<cl::sycl::event> &dependencies = {}) {
+        syr_precondition(queue_, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+        auto done = detail::syr(backend_, queue_, upper_lower, n, alpha, x, incx, a, lda,
+                                dependencies);
+        syr_postcondition(queue_, upper_lower, n, alpha, x, incx, a, lda, dependencies);
+        return done;
+    }
+
+    cl::sycl::event syr2(uplo upper_lower, std::int64_t n, float alpha, const float *x,
+                         std::int64_t incx, const float *y, std::int64_t incy, float *a,
+                         std::int64_t lda, const std::vector<cl::sycl::event> &dependencies = {}) {
+        syr2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        auto done = detail::syr2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda,
+                                 dependencies);
+        syr2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        return done;
+    }
+
+    cl::sycl::event syr2(uplo upper_lower, std::int64_t n, double alpha, const double *x,
+                         std::int64_t incx, const double *y, std::int64_t incy, double *a,
+                         std::int64_t lda, const std::vector<cl::sycl::event> &dependencies = {}) {
+        syr2_precondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        auto done = detail::syr2(backend_, queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda,
+                                 dependencies);
+        syr2_postcondition(queue_, upper_lower, n, alpha, x, incx, y, incy, a, lda, dependencies);
+        return done;
+    }
+
+    cl::sycl::event syr2k(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                          float alpha, const float *a, std::int64_t lda, const float *b,
+                          std::int64_t ldb, float beta, float *c, std::int64_t ldc,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        syr2k_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+        auto done = detail::syr2k(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
+                                  beta, c, ldc, dependencies);
+        syr2k_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            dependencies);
+        return done;
+    }
+
+    cl::sycl::event syr2k(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                          double alpha, const double *a, std::int64_t lda, const double *b,
+                          std::int64_t ldb, double beta, double *c, std::int64_t ldc,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        syr2k_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+        auto done = detail::syr2k(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
+                                  beta, c, ldc, dependencies);
+        syr2k_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            dependencies);
+        return done;
+    }
+
+    cl::sycl::event syr2k(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                          std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                          const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+                          std::complex<float> *c, std::int64_t ldc,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        syr2k_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+        auto done = detail::syr2k(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
+                                  beta, c, ldc, dependencies);
+        syr2k_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            dependencies);
+        return done;
+    }
+
+    cl::sycl::event syr2k(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                          std::complex<double> alpha, const std::complex<double> *a,
+                          std::int64_t lda, const std::complex<double> *b, std::int64_t ldb,
+                          std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+                          const std::vector<cl::sycl::event> &dependencies = {}) {
+        syr2k_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           dependencies);
+        auto done = detail::syr2k(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb,
+                                  beta, c, ldc, dependencies);
+        syr2k_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                            dependencies);
+        return done;
+    }
+
+    cl::sycl::event syrk(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                         float alpha, const float *a, std::int64_t lda, float beta, float *c,
+                         std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies = {}) {
+        syrk_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                          dependencies);
+        auto done = detail::syrk(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c,
+                                 ldc, dependencies);
+        syrk_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event syrk(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                         double alpha, const double *a, std::int64_t lda, double beta, double *c,
+                         std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies = {}) {
+        syrk_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                          dependencies);
+        auto done = detail::syrk(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c,
+                                 ldc, dependencies);
+        syrk_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event syrk(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                         std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+                         std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        syrk_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                          dependencies);
+        auto done = detail::syrk(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c,
+                                 ldc, dependencies);
+        syrk_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event syrk(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                         std::complex<double> alpha, const std::complex<double> *a,
+                         std::int64_t lda, std::complex<double> beta, std::complex<double> *c,
+                         std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies = {}) {
+        syrk_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                          dependencies);
+        auto done = detail::syrk(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c,
+                                 ldc, dependencies);
+        syrk_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event syrk_batch(uplo *upper_lower, transpose *trans, std::int64_t *n,
+                               std::int64_t *k, float *alpha, const float **a, std::int64_t *lda,
+                               float *beta, float **c, std::int64_t *ldc, std::int64_t group_count,
+                               std::int64_t *group_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        syrk_batch_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                group_count, group_size, dependencies);
+        auto done = detail::syrk_batch(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda,
+                                       beta, c, ldc, group_count, group_size, dependencies);
+        syrk_batch_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                 group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event syrk_batch(uplo *upper_lower, transpose *trans, std::int64_t *n,
+                               std::int64_t *k, double *alpha, const double **a, std::int64_t *lda,
+                               double *beta, double **c, std::int64_t *ldc,
+                               std::int64_t group_count, std::int64_t *group_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        syrk_batch_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                group_count, group_size, dependencies);
+        auto done = detail::syrk_batch(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda,
+                                       beta, c, ldc, group_count, group_size, dependencies);
+        syrk_batch_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                 group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event syrk_batch(
+        uplo *upper_lower, transpose *trans, std::int64_t *n, std::int64_t *k,
+        std::complex<float> *alpha, const std::complex<float> **a, std::int64_t *lda,
+        std::complex<float> *beta, std::complex<float> **c, std::int64_t *ldc,
+        std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<cl::sycl::event> &dependencies = {}) {
+        syrk_batch_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                group_count, group_size, dependencies);
+        auto done = detail::syrk_batch(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda,
+                                       beta, c, ldc, group_count, group_size, dependencies);
+        syrk_batch_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                 group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event syrk_batch(
+        uplo *upper_lower, transpose *trans, std::int64_t *n, std::int64_t *k,
+        std::complex<double> *alpha, const std::complex<double> **a, std::int64_t *lda,
+        std::complex<double> *beta, std::complex<double> **c, std::int64_t *ldc,
+        std::int64_t group_count, std::int64_t *group_size,
+        const std::vector<cl::sycl::event> &dependencies = {}) {
+        syrk_batch_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                group_count, group_size, dependencies);
+        auto done = detail::syrk_batch(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda,
+                                       beta, c, ldc, group_count, group_size, dependencies);
+        syrk_batch_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                                 group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event syrk_batch(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                               float alpha, const float *a, std::int64_t lda, std::int64_t stride_a,
+                               float beta, float *c, std::int64_t ldc, std::int64_t stride_c,
+                               std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        syrk_batch_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size, dependencies);
+        auto done = detail::syrk_batch(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda,
+                                       stride_a, beta, c, ldc, stride_c, batch_size, dependencies);
+        syrk_batch_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                 ldc, stride_c, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event syrk_batch(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                               double alpha, const double *a, std::int64_t lda,
+                               std::int64_t stride_a, double beta, double *c, std::int64_t ldc,
+                               std::int64_t stride_c, std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        syrk_batch_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size, dependencies);
+        auto done = detail::syrk_batch(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda,
+                                       stride_a, beta, c, ldc, stride_c, batch_size, dependencies);
+        syrk_batch_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                 ldc, stride_c, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event syrk_batch(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                               std::complex<float> alpha, const std::complex<float> *a,
+                               std::int64_t lda, std::int64_t stride_a, std::complex<float> beta,
+                               std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c,
+                               std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        syrk_batch_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size, dependencies);
+        auto done = detail::syrk_batch(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda,
+                                       stride_a, beta, c, ldc, stride_c, batch_size, dependencies);
+        syrk_batch_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                 ldc, stride_c, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event syrk_batch(uplo upper_lower, transpose trans, std::int64_t n, std::int64_t k,
+                               std::complex<double> alpha, const std::complex<double> *a,
+                               std::int64_t lda, std::int64_t stride_a, std::complex<double> beta,
+                               std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
+                               std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        syrk_batch_precondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                ldc, stride_c, batch_size, dependencies);
+        auto done = detail::syrk_batch(backend_, queue_, upper_lower, trans, n, k, alpha, a, lda,
+                                       stride_a, beta, c, ldc, stride_c, batch_size, dependencies);
+        syrk_batch_postcondition(queue_, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                                 ldc, stride_c, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event tbmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         std::int64_t k, const float *a, std::int64_t lda, float *x,
+                         std::int64_t incx, const std::vector<cl::sycl::event> &dependencies = {}) {
+        tbmv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                          dependencies);
+        auto done = detail::tbmv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                                 incx, dependencies);
+        tbmv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event tbmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         std::int64_t k, const double *a, std::int64_t lda, double *x,
+                         std::int64_t incx, const std::vector<cl::sycl::event> &dependencies = {}) {
+        tbmv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                          dependencies);
+        auto done = detail::tbmv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                                 incx, dependencies);
+        tbmv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event tbmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         std::int64_t k, const std::complex<float> *a, std::int64_t lda,
+                         std::complex<float> *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        tbmv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                          dependencies);
+        auto done = detail::tbmv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                                 incx, dependencies);
+        tbmv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event tbmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         std::int64_t k, const std::complex<double> *a, std::int64_t lda,
+                         std::complex<double> *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        tbmv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                          dependencies);
+        auto done = detail::tbmv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                                 incx, dependencies);
+        tbmv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event tbsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         std::int64_t k, const float *a, std::int64_t lda, float *x,
+                         std::int64_t incx, const std::vector<cl::sycl::event> &dependencies = {}) {
+        tbsv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                          dependencies);
+        auto done = detail::tbsv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                                 incx, dependencies);
+        tbsv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event tbsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         std::int64_t k, const double *a, std::int64_t lda, double *x,
+                         std::int64_t incx, const std::vector<cl::sycl::event> &dependencies = {}) {
+        tbsv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                          dependencies);
+        auto done = detail::tbsv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                                 incx, dependencies);
+        tbsv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event tbsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         std::int64_t k, const std::complex<float> *a, std::int64_t lda,
+                         std::complex<float> *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        tbsv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                          dependencies);
+        auto done = detail::tbsv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                                 incx, dependencies);
+        tbsv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event tbsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         std::int64_t k, const std::complex<double> *a, std::int64_t lda,
+                         std::complex<double> *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        tbsv_precondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                          dependencies);
+        auto done = detail::tbsv(backend_, queue_, upper_lower, trans, unit_diag, n, k, a, lda, x,
+                                 incx, dependencies);
+        tbsv_postcondition(queue_, upper_lower, trans, unit_diag, n, k, a, lda, x, incx,
+                           dependencies);
+        return done;
+    }
+
+    cl::sycl::event tpmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const float *a, float *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        tpmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        auto done = detail::tpmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx,
+                                 dependencies);
+        tpmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event tpmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const double *a, double *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        tpmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        auto done = detail::tpmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx,
+                                 dependencies);
+        tpmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event tpmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const std::complex<float> *a, std::complex<float> *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        tpmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        auto done = detail::tpmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx,
+                                 dependencies);
+        tpmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event tpmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const std::complex<double> *a, std::complex<double> *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        tpmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        auto done = detail::tpmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx,
+                                 dependencies);
+        tpmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event tpsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const float *a, float *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        tpsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        auto done = detail::tpsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx,
+                                 dependencies);
+        tpsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event tpsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const double *a, double *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        tpsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        auto done = detail::tpsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx,
+                                 dependencies);
+        tpsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event tpsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const std::complex<float> *a, std::complex<float> *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        tpsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        auto done = detail::tpsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx,
+                                 dependencies);
+        tpsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event tpsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const std::complex<double> *a, std::complex<double> *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        tpsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        auto done = detail::tpsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, x, incx,
+                                 dependencies);
+        tpsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trmm(side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+                         std::int64_t m, std::int64_t n, float alpha, const float *a,
+                         std::int64_t lda, float *b, std::int64_t ldb,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        trmm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb, dependencies);
+        auto done = detail::trmm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n,
+                                 alpha, a, lda, b, ldb, dependencies);
+        trmm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trmm(side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+                         std::int64_t m, std::int64_t n, double alpha, const double *a,
+                         std::int64_t lda, double *b, std::int64_t ldb,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        trmm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb, dependencies);
+        auto done = detail::trmm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n,
+                                 alpha, a, lda, b, ldb, dependencies);
+        trmm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trmm(side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+                         std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                         const std::complex<float> *a, std::int64_t lda, std::complex<float> *b,
+                         std::int64_t ldb, const std::vector<cl::sycl::event> &dependencies = {}) {
+        trmm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb, dependencies);
+        auto done = detail::trmm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n,
+                                 alpha, a, lda, b, ldb, dependencies);
+        trmm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trmm(side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+                         std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                         const std::complex<double> *a, std::int64_t lda, std::complex<double> *b,
+                         std::int64_t ldb, const std::vector<cl::sycl::event> &dependencies = {}) {
+        trmm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb, dependencies);
+        auto done = detail::trmm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n,
+                                 alpha, a, lda, b, ldb, dependencies);
+        trmm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const float *a, std::int64_t lda, float *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        trmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        auto done = detail::trmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x,
+                                 incx, dependencies);
+        trmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const double *a, std::int64_t lda, double *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        trmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        auto done = detail::trmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x,
+                                 incx, dependencies);
+        trmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const std::complex<float> *a, std::int64_t lda, std::complex<float> *x,
+                         std::int64_t incx, const std::vector<cl::sycl::event> &dependencies = {}) {
+        trmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        auto done = detail::trmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x,
+                                 incx, dependencies);
+        trmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trmv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const std::complex<double> *a, std::int64_t lda, std::complex<double> *x,
+                         std::int64_t incx, const std::vector<cl::sycl::event> &dependencies = {}) {
+        trmv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        auto done = detail::trmv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x,
+                                 incx, dependencies);
+        trmv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsm(side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+                         std::int64_t m, std::int64_t n, float alpha, const float *a,
+                         std::int64_t lda, float *b, std::int64_t ldb,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb, dependencies);
+        auto done = detail::trsm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n,
+                                 alpha, a, lda, b, ldb, dependencies);
+        trsm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsm(side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+                         std::int64_t m, std::int64_t n, double alpha, const double *a,
+                         std::int64_t lda, double *b, std::int64_t ldb,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb, dependencies);
+        auto done = detail::trsm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n,
+                                 alpha, a, lda, b, ldb, dependencies);
+        trsm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsm(side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+                         std::int64_t m, std::int64_t n, std::complex<float> alpha,
+                         const std::complex<float> *a, std::int64_t lda, std::complex<float> *b,
+                         std::int64_t ldb, const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb, dependencies);
+        auto done = detail::trsm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n,
+                                 alpha, a, lda, b, ldb, dependencies);
+        trsm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsm(side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+                         std::int64_t m, std::int64_t n, std::complex<double> alpha,
+                         const std::complex<double> *a, std::int64_t lda, std::complex<double> *b,
+                         std::int64_t ldb, const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsm_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda, b,
+                          ldb, dependencies);
+        auto done = detail::trsm(backend_, queue_, left_right, upper_lower, trans, unit_diag, m, n,
+                                 alpha, a, lda, b, ldb, dependencies);
+        trsm_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                           b, ldb, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsm_batch(side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+                               std::int64_t m, std::int64_t n, float alpha, const float *a,
+                               std::int64_t lda, std::int64_t stride_a, float *b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsm_batch_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+        auto done = detail::trsm_batch(backend_, queue_, left_right, upper_lower, trans, unit_diag,
+                                       m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                                       dependencies);
+        trsm_batch_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                 lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsm_batch(side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+                               std::int64_t m, std::int64_t n, double alpha, const double *a,
+                               std::int64_t lda, std::int64_t stride_a, double *b, std::int64_t ldb,
+                               std::int64_t stride_b, std::int64_t batch_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsm_batch_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+        auto done = detail::trsm_batch(backend_, queue_, left_right, upper_lower, trans, unit_diag,
+                                       m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                                       dependencies);
+        trsm_batch_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                 lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsm_batch(
+        side left_right, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
+        std::int64_t n, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+        std::int64_t stride_a, std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b,
+        std::int64_t batch_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsm_batch_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+        auto done = detail::trsm_batch(backend_, queue_, left_right, upper_lower, trans, unit_diag,
+                                       m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                                       dependencies);
+        trsm_batch_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                 lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsm_batch(
+        side left_right, uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
+        std::int64_t n, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+        std::int64_t stride_a, std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
+        std::int64_t batch_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsm_batch_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+        auto done = detail::trsm_batch(backend_, queue_, left_right, upper_lower, trans, unit_diag,
+                                       m, n, alpha, a, lda, stride_a, b, ldb, stride_b, batch_size,
+                                       dependencies);
+        trsm_batch_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                 lda, stride_a, b, ldb, stride_b, batch_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsm_batch(side *left_right, uplo *upper_lower, transpose *trans,
+                               diag *unit_diag, std::int64_t *m, std::int64_t *n, float *alpha,
+                               const float **a, std::int64_t *lda, float **b, std::int64_t *ldb,
+                               std::int64_t group_count, std::int64_t *group_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsm_batch_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, b, ldb, group_count, group_size, dependencies);
+        auto done = detail::trsm_batch(backend_, queue_, left_right, upper_lower, trans, unit_diag,
+                                       m, n, alpha, a, lda, b, ldb, group_count, group_size,
+                                       dependencies);
+        trsm_batch_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                 lda, b, ldb, group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsm_batch(side *left_right, uplo *upper_lower, transpose *trans,
+                               diag *unit_diag, std::int64_t *m, std::int64_t *n, double *alpha,
+                               const double **a, std::int64_t *lda, double **b, std::int64_t *ldb,
+                               std::int64_t group_count, std::int64_t *group_size,
+                               const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsm_batch_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, b, ldb, group_count, group_size, dependencies);
+        auto done = detail::trsm_batch(backend_, queue_, left_right, upper_lower, trans, unit_diag,
+                                       m, n, alpha, a, lda, b, ldb, group_count, group_size,
+                                       dependencies);
+        trsm_batch_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                 lda, b, ldb, group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsm_batch(
+        side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag, std::int64_t *m,
+        std::int64_t *n, std::complex<float> *alpha, const std::complex<float> **a,
+        std::int64_t *lda, std::complex<float> **b, std::int64_t *ldb, std::int64_t group_count,
+        std::int64_t *group_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsm_batch_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, b, ldb, group_count, group_size, dependencies);
+        auto done = detail::trsm_batch(backend_, queue_, left_right, upper_lower, trans, unit_diag,
+                                       m, n, alpha, a, lda, b, ldb, group_count, group_size,
+                                       dependencies);
+        trsm_batch_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                 lda, b, ldb, group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsm_batch(
+        side *left_right, uplo *upper_lower, transpose *trans, diag *unit_diag, std::int64_t *m,
+        std::int64_t *n, std::complex<double> *alpha, const std::complex<double> **a,
+        std::int64_t *lda, std::complex<double> **b, std::int64_t *ldb, std::int64_t group_count,
+        std::int64_t *group_size, const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsm_batch_precondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                lda, b, ldb, group_count, group_size, dependencies);
+        auto done = detail::trsm_batch(backend_, queue_, left_right, upper_lower, trans, unit_diag,
+                                       m, n, alpha, a, lda, b, ldb, group_count, group_size,
+                                       dependencies);
+        trsm_batch_postcondition(queue_, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                                 lda, b, ldb, group_count, group_size, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const float *a, std::int64_t lda, float *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        auto done = detail::trsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x,
+                                 incx, dependencies);
+        trsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const double *a, std::int64_t lda, double *x, std::int64_t incx,
+                         const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        auto done = detail::trsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x,
+                                 incx, dependencies);
+        trsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const std::complex<float> *a, std::int64_t lda, std::complex<float> *x,
+                         std::int64_t incx, const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        auto done = detail::trsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x,
+                                 incx, dependencies);
+        trsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        return done;
+    }
+
+    cl::sycl::event trsv(uplo upper_lower, transpose trans, diag unit_diag, std::int64_t n,
+                         const std::complex<double> *a, std::int64_t lda, std::complex<double> *x,
+                         std::int64_t incx, const std::vector<cl::sycl::event> &dependencies = {}) {
+        trsv_precondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        auto done = detail::trsv(backend_, queue_, upper_lower, trans, unit_diag, n, a, lda, x,
+                                 incx, dependencies);
+        trsv_postcondition(queue_, upper_lower, trans, unit_diag, n, a, lda, x, incx, dependencies);
+        return done;
+    }
+
+private:
+    cl::sycl::queue queue_;
+    oneapi::mkl::device device_id_;
+    detail::backend_ref backend_;
+};
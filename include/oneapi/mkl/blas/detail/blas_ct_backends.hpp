@@ -27,6 +27,8 @@
 #include "oneapi/mkl/types.hpp"
 #include "oneapi/mkl/detail/backend_selector.hpp"
 
+#include "oneapi/mkl/blas/detail/pointer_traits.hpp"
+
 namespace oneapi {
 namespace mkl {
 namespace blas {
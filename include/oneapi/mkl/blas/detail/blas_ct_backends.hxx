@@ -504,6 +504,47 @@ static inline void gemm_bias(backend_selector<backend::BACKEND> selector, transp
                              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
                              cl::sycl::buffer<int32_t, 1> &co);
 
+template <typename T>
+static inline std::int64_t gemm_pack_get_size(backend_selector<backend::BACKEND> selector,
+                                              identifier which, std::int64_t m, std::int64_t n,
+                                              std::int64_t k);
+
+static inline void gemm_pack(backend_selector<backend::BACKEND> selector, identifier which,
+                             transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                             float alpha, cl::sycl::buffer<float, 1> &src, std::int64_t ld,
+                             cl::sycl::buffer<float, 1> &dest);
+
+static inline void gemm_pack(backend_selector<backend::BACKEND> selector, identifier which,
+                             transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                             double alpha, cl::sycl::buffer<double, 1> &src, std::int64_t ld,
+                             cl::sycl::buffer<double, 1> &dest);
+
+static inline void gemm_compute(backend_selector<backend::BACKEND> selector, identifier which,
+                                transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                                cl::sycl::buffer<float, 1> &packed,
+                                cl::sycl::buffer<float, 1> &other, std::int64_t ld, float beta,
+                                cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+
+static inline void gemm_compute(backend_selector<backend::BACKEND> selector, identifier which,
+                                transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                                cl::sycl::buffer<double, 1> &packed,
+                                cl::sycl::buffer<double, 1> &other, std::int64_t ld, double beta,
+                                cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+
+static inline void gemm3m(backend_selector<backend::BACKEND> selector, transpose transa,
+                          transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                          std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                          std::int64_t ldb, std::complex<float> beta,
+                          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+
+static inline void gemm3m(backend_selector<backend::BACKEND> selector, transpose transa,
+                          transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                          std::int64_t ldb, std::complex<double> beta,
+                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+
 static inline void swap(backend_selector<backend::BACKEND> selector, std::int64_t n,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy);
@@ -1119,6 +1160,36 @@ static inline cl::sycl::event scal(backend_selector<backend::BACKEND> selector,
                                    double alpha, std::complex<double> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, float> = nullptr>
+static inline cl::sycl::event scal(backend_selector<backend::BACKEND> selector, std::int64_t n,
+                                   Ta alpha, float *x, std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, double> = nullptr>
+static inline cl::sycl::event scal(backend_selector<backend::BACKEND> selector, std::int64_t n,
+                                   Ta alpha, double *x, std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, std::complex<float>> = nullptr>
+static inline cl::sycl::event scal(backend_selector<backend::BACKEND> selector, std::int64_t n,
+                                   Ta alpha, std::complex<float> *x, std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, float> = nullptr>
+static inline cl::sycl::event scal(backend_selector<backend::BACKEND> selector, std::int64_t n,
+                                   Ta alpha, std::complex<float> *x, std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, std::complex<double>> = nullptr>
+static inline cl::sycl::event scal(backend_selector<backend::BACKEND> selector, std::int64_t n,
+                                   Ta alpha, std::complex<double> *x, std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, double> = nullptr>
+static inline cl::sycl::event scal(backend_selector<backend::BACKEND> selector, std::int64_t n,
+                                   Ta alpha, std::complex<double> *x, std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
 static inline cl::sycl::event trmv(backend_selector<backend::BACKEND> selector, uplo upper_lower,
                                    transpose trans, diag unit_diag, std::int64_t n, const float *a,
                                    std::int64_t lda, float *x, std::int64_t incx,
@@ -1348,6 +1419,30 @@ static inline cl::sycl::event axpy(backend_selector<backend::BACKEND> selector,
                                    std::int64_t incx, std::complex<double> *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, float> = nullptr>
+static inline cl::sycl::event axpy(backend_selector<backend::BACKEND> selector, std::int64_t n,
+                                   Ta alpha, const float *x, std::int64_t incx, float *y,
+                                   std::int64_t incy,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, double> = nullptr>
+static inline cl::sycl::event axpy(backend_selector<backend::BACKEND> selector, std::int64_t n,
+                                   Ta alpha, const double *x, std::int64_t incx, double *y,
+                                   std::int64_t incy,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, std::complex<float>> = nullptr>
+static inline cl::sycl::event axpy(backend_selector<backend::BACKEND> selector, std::int64_t n,
+                                   Ta alpha, const std::complex<float> *x, std::int64_t incx,
+                                   std::complex<float> *y, std::int64_t incy,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, std::complex<double>> = nullptr>
+static inline cl::sycl::event axpy(backend_selector<backend::BACKEND> selector, std::int64_t n,
+                                   Ta alpha, const std::complex<double> *x, std::int64_t incx,
+                                   std::complex<double> *y, std::int64_t incy,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
 static inline cl::sycl::event axpy_batch(backend_selector<backend::BACKEND> selector,
                                          std::int64_t *n, float *alpha, const float **x,
                                          std::int64_t *incx, float **y, std::int64_t *incy,
@@ -2328,6 +2423,41 @@ static inline cl::sycl::event gemm_bias(backend_selector<backend::BACKEND> selec
                                         const std::int32_t *co,
                                         const std::vector<cl::sycl::event> &dependencies = {});
 
+static inline cl::sycl::event gemm_pack(
+    backend_selector<backend::BACKEND> selector, identifier which, transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t k, float alpha, const float *src, std::int64_t ld, float *dest,
+    const std::vector<cl::sycl::event> &dependencies = {});
+
+static inline cl::sycl::event gemm_pack(
+    backend_selector<backend::BACKEND> selector, identifier which, transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t k, double alpha, const double *src, std::int64_t ld, double *dest,
+    const std::vector<cl::sycl::event> &dependencies = {});
+
+static inline cl::sycl::event gemm_compute(
+    backend_selector<backend::BACKEND> selector, identifier which, transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t k, const float *packed, const float *other, std::int64_t ld,
+    float beta, float *c, std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies = {});
+
+static inline cl::sycl::event gemm_compute(
+    backend_selector<backend::BACKEND> selector, identifier which, transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t k, const double *packed, const double *other, std::int64_t ld,
+    double beta, double *c, std::int64_t ldc,
+    const std::vector<cl::sycl::event> &dependencies = {});
+
+static inline cl::sycl::event gemm3m(
+    backend_selector<backend::BACKEND> selector, transpose transa, transpose transb, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::complex<float> alpha, const std::complex<float> *a,
+    std::int64_t lda, const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+    std::complex<float> *c, std::int64_t ldc,
+    const std::vector<cl::sycl::event> &dependencies = {});
+
+static inline cl::sycl::event gemm3m(
+    backend_selector<backend::BACKEND> selector, transpose transa, transpose transb, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+    std::int64_t lda, const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+    std::complex<double> *c, std::int64_t ldc,
+    const std::vector<cl::sycl::event> &dependencies = {});
+
 static inline cl::sycl::event sbmv(backend_selector<backend::BACKEND> selector, uplo upper_lower,
                                    std::int64_t n, std::int64_t k, float alpha, const float *a,
                                    std::int64_t lda, const float *x, std::int64_t incx, float beta,
@@ -26,26 +26,119 @@
 
 #include "oneapi/mkl/types.hpp"
 
+#include "oneapi/mkl/detail/config.hpp"
 #include "oneapi/mkl/detail/export.hpp"
 #include "oneapi/mkl/detail/get_device_id.hpp"
 
+#ifdef ENABLE_STATIC_DISPATCH
+#include "oneapi/mkl/exceptions.hpp"
+#include "oneapi/mkl/detail/exceptions.hpp"
+#include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
+#endif
+
 namespace oneapi {
 namespace mkl {
 namespace blas {
+namespace detail {
+
+// Backend a run-time API call is dispatched to. The free functions pass the device id of the
+// queue, and each call routes by size and looks up the function table of the device. A context
+// resolves it once with resolve_backend(), which also keeps the function table when no routing
+// is configured, so its calls use that table directly.
+struct backend_ref {
+    backend_ref(oneapi::mkl::device device) : device(device) {}
+    backend_ref(oneapi::mkl::device device, void *table) : device(device), table(table) {}
+
+    oneapi::mkl::device device;
+    void *table = nullptr; // function table of the loader, opaque to the callers
+};
+
+} //namespace detail
+#ifdef ENABLE_STATIC_DISPATCH
+namespace detail {
+
+// The mklcpu backend is linked directly and only serves CPU and host queues
+static inline void check_static_dispatch(backend_ref libkey, cl::sycl::queue &queue,
+                                         const char *function) {
+    if (libkey.device != oneapi::mkl::device::x86cpu)
+        throw oneapi::mkl::unsupported_device("blas", function, queue.get_device());
+}
+
+// The backend is linked, so there is nothing to load
+static inline const char *preload(oneapi::mkl::device libkey) {
+    if (libkey != oneapi::mkl::device::x86cpu)
+        throw oneapi::mkl::backend_not_found("BLAS static dispatch only supports x86 CPUs");
+    return "onemkl_blas_mklcpu";
+}
+
+} //namespace detail
 namespace column_major {
 namespace detail {
 
+using oneapi::mkl::blas::detail::backend_ref;
+using oneapi::mkl::blas::detail::check_static_dispatch;
+
+// The backend is linked, so there is nothing to resolve
+static inline backend_ref resolve_backend(oneapi::mkl::device libkey) {
+    return libkey;
+}
+
+// Generated at configure time from blas_loader.hxx, see scripts/generate_static_dispatch.py
+#define MAJOR column_major
+#include "oneapi/mkl/blas/detail/blas_static_dispatch.hxx"
+#undef MAJOR
+
+} //namespace detail
+} //namespace column_major
+namespace row_major {
+namespace detail {
+
+using oneapi::mkl::blas::detail::backend_ref;
+using oneapi::mkl::blas::detail::check_static_dispatch;
+
+// The backend is linked, so there is nothing to resolve
+static inline backend_ref resolve_backend(oneapi::mkl::device libkey) {
+    return libkey;
+}
+
+#define MAJOR row_major
+#include "oneapi/mkl/blas/detail/blas_static_dispatch.hxx"
+#undef MAJOR
+
+} //namespace detail
+} //namespace row_major
+#else
+namespace column_major {
+namespace detail {
+
+using oneapi::mkl::blas::detail::backend_ref;
+
 #include "blas_loader.hxx"
 
+// Loads the backend for libkey and returns the backend the calls of a context are made with
+ONEMKL_EXPORT backend_ref resolve_backend(oneapi::mkl::device libkey);
+
 } //namespace detail
 } //namespace column_major
 namespace row_major {
 namespace detail {
 
+using oneapi::mkl::blas::detail::backend_ref;
+
 #include "blas_loader.hxx"
 
+// Loads the backend for libkey and returns the backend the calls of a context are made with
+ONEMKL_EXPORT backend_ref resolve_backend(oneapi::mkl::device libkey);
+
 } //namespace detail
 } //namespace row_major
+namespace detail {
+
+// Loads the BLAS backend for libkey and returns the name of the selected library
+const char *preload(oneapi::mkl::device libkey);
+
+} //namespace detail
+#endif
 } //namespace blas
 } //namespace mkl
 } //namespace oneapi
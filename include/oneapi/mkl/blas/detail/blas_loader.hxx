@@ -19,88 +19,88 @@
 
 // Buffer APIs
 
-ONEMKL_EXPORT void herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void herk(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, std::int64_t n, std::int64_t k, float alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda, float beta,
                         cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void herk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void herk(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, std::int64_t n, std::int64_t k, double alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda, double beta,
                         cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
 
-ONEMKL_EXPORT void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void scal(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void scal(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void scal(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
                         std::int64_t incx);
-ONEMKL_EXPORT void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void scal(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
                         std::int64_t incx);
-ONEMKL_EXPORT void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void scal(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         float alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
                         std::int64_t incx);
-ONEMKL_EXPORT void scal(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void scal(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         double alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
                         std::int64_t incx);
 
-ONEMKL_EXPORT void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void trmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void trmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void trmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void trmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
 
-ONEMKL_EXPORT void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tpmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<float, 1> &x,
                         std::int64_t incx);
-ONEMKL_EXPORT void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tpmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<double, 1> &x,
                         std::int64_t incx);
-ONEMKL_EXPORT void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tpmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &a,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tpmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &a,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
 
-ONEMKL_EXPORT void spr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void spr(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                        std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
                        std::int64_t incx, cl::sycl::buffer<float, 1> &a);
-ONEMKL_EXPORT void spr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void spr(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                        std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
                        std::int64_t incx, cl::sycl::buffer<double, 1> &a);
 
-ONEMKL_EXPORT void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm_batch(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                               transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
                               float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                               std::int64_t stride_a, cl::sycl::buffer<float, 1> &b,
                               std::int64_t ldb, std::int64_t stride_b, float beta,
                               cl::sycl::buffer<float, 1> &c, std::int64_t ldc,
                               std::int64_t stride_c, std::int64_t batch_size);
-ONEMKL_EXPORT void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm_batch(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                               transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
                               double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                               std::int64_t stride_a, cl::sycl::buffer<double, 1> &b,
                               std::int64_t ldb, std::int64_t stride_b, double beta,
                               cl::sycl::buffer<double, 1> &c, std::int64_t ldc,
                               std::int64_t stride_c, std::int64_t batch_size);
-ONEMKL_EXPORT void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm_batch(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                               transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
                               std::complex<float> alpha,
                               cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
@@ -108,7 +108,7 @@ ONEMKL_EXPORT void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue
                               std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
                               cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
                               std::int64_t stride_c, std::int64_t batch_size);
-ONEMKL_EXPORT void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm_batch(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                               transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
                               std::complex<double> alpha,
                               cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
@@ -116,50 +116,50 @@ ONEMKL_EXPORT void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue
                               std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
                               cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
                               std::int64_t stride_c, std::int64_t batch_size);
-ONEMKL_EXPORT void gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm_batch(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                               transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
                               half alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
                               std::int64_t stride_a, cl::sycl::buffer<half, 1> &b, std::int64_t ldb,
                               std::int64_t stride_b, half beta, cl::sycl::buffer<half, 1> &c,
                               std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
 
-ONEMKL_EXPORT void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syrk(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, std::int64_t n, std::int64_t k, float alpha,
                         cl::sycl::buffer<float, 1> &a, std::int64_t lda, float beta,
                         cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syrk(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, std::int64_t n, std::int64_t k, double alpha,
                         cl::sycl::buffer<double, 1> &a, std::int64_t lda, double beta,
                         cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syrk(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, std::int64_t n, std::int64_t k, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
                         std::int64_t ldc);
-ONEMKL_EXPORT void syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syrk(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, std::int64_t n, std::int64_t k, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
                         std::int64_t ldc);
 
-ONEMKL_EXPORT void syrk_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syrk_batch(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                               transpose trans, std::int64_t n, std::int64_t k, float alpha,
                               cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                               std::int64_t stride_a, float beta, cl::sycl::buffer<float, 1> &c,
                               std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
-ONEMKL_EXPORT void syrk_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syrk_batch(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                               transpose trans, std::int64_t n, std::int64_t k, double alpha,
                               cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                               std::int64_t stride_a, double beta, cl::sycl::buffer<double, 1> &c,
                               std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size);
-ONEMKL_EXPORT void syrk_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syrk_batch(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                               transpose trans, std::int64_t n, std::int64_t k,
                               std::complex<float> alpha,
                               cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                               std::int64_t stride_a, std::complex<float> beta,
                               cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
                               std::int64_t stride_c, std::int64_t batch_size);
-ONEMKL_EXPORT void syrk_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syrk_batch(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                               transpose trans, std::int64_t n, std::int64_t k,
                               std::complex<double> alpha,
                               cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
@@ -167,158 +167,158 @@ ONEMKL_EXPORT void syrk_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue
                               cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
                               std::int64_t stride_c, std::int64_t batch_size);
 
-ONEMKL_EXPORT void her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void her2(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda);
-ONEMKL_EXPORT void her2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void her2(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda);
 
-ONEMKL_EXPORT void hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void hbmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, std::int64_t k, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
                         std::int64_t incy);
-ONEMKL_EXPORT void hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void hbmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, std::int64_t k, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
                         std::int64_t incy);
 
-ONEMKL_EXPORT void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void rot(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                        cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy, float c,
                        float s);
-ONEMKL_EXPORT void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void rot(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                        cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy, double c,
                        double s);
-ONEMKL_EXPORT void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void rot(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<float, 1> &y, std::int64_t incy, float c, float s);
-ONEMKL_EXPORT void rot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void rot(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<double, 1> &y, std::int64_t incy, double c, double s);
 
-ONEMKL_EXPORT void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void axpy(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void axpy(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void axpy(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &y,
                         std::int64_t incy);
-ONEMKL_EXPORT void axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void axpy(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &y,
                         std::int64_t incy);
 
-ONEMKL_EXPORT void axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void axpy_batch(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                               float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                               std::int64_t stridex, cl::sycl::buffer<float, 1> &y,
                               std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
-ONEMKL_EXPORT void axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void axpy_batch(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                               double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                               std::int64_t stridex, cl::sycl::buffer<double, 1> &y,
                               std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
-ONEMKL_EXPORT void axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void axpy_batch(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                               std::complex<float> alpha,
                               cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                               std::int64_t stridex, cl::sycl::buffer<std::complex<float>, 1> &y,
                               std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
-ONEMKL_EXPORT void axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void axpy_batch(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                               std::complex<double> alpha,
                               cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                               std::int64_t stridex, cl::sycl::buffer<std::complex<double>, 1> &y,
                               std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
 
-ONEMKL_EXPORT void axpby(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void axpby(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                          float alpha, cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
                          cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void axpby(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void axpby(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                          double alpha, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                          double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void axpby(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void axpby(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                          std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
                          std::int64_t incx, std::complex<float> beta,
                          cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void axpby(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void axpby(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
                          std::int64_t incx, std::complex<double> beta,
                          cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
 
-ONEMKL_EXPORT void gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
+ONEMKL_EXPORT void gerc(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t m,
                         std::int64_t n, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda);
-ONEMKL_EXPORT void gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
+ONEMKL_EXPORT void gerc(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t m,
                         std::int64_t n, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda);
 
-ONEMKL_EXPORT void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syr2k(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                          transpose trans, std::int64_t n, std::int64_t k, float alpha,
                          cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                          cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
                          cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syr2k(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                          transpose trans, std::int64_t n, std::int64_t k, double alpha,
                          cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                          cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
                          cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syr2k(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                          transpose trans, std::int64_t n, std::int64_t k, std::complex<float> alpha,
                          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
                          std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
                          std::int64_t ldc);
-ONEMKL_EXPORT void syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syr2k(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                          transpose trans, std::int64_t n, std::int64_t k,
                          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
                          std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
                          std::int64_t ldb, std::complex<double> beta,
                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
 
-ONEMKL_EXPORT void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+ONEMKL_EXPORT void gemv(detail::backend_ref libkey, cl::sycl::queue &queue, transpose trans,
                         std::int64_t m, std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+ONEMKL_EXPORT void gemv(detail::backend_ref libkey, cl::sycl::queue &queue, transpose trans,
                         std::int64_t m, std::int64_t n, double alpha,
                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+ONEMKL_EXPORT void gemv(detail::backend_ref libkey, cl::sycl::queue &queue, transpose trans,
                         std::int64_t m, std::int64_t n, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
                         std::int64_t incy);
-ONEMKL_EXPORT void gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+ONEMKL_EXPORT void gemv(detail::backend_ref libkey, cl::sycl::queue &queue, transpose trans,
                         std::int64_t m, std::int64_t n, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
                         std::int64_t incy);
 
-ONEMKL_EXPORT void gemv_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+ONEMKL_EXPORT void gemv_batch(detail::backend_ref libkey, cl::sycl::queue &queue, transpose trans,
                               std::int64_t m, std::int64_t n, float alpha,
                               cl::sycl::buffer<float, 1> &a, std::int64_t lda, std::int64_t stridea,
                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                               std::int64_t stridex, float beta, cl::sycl::buffer<float, 1> &y,
                               std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
 
-ONEMKL_EXPORT void gemv_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+ONEMKL_EXPORT void gemv_batch(detail::backend_ref libkey, cl::sycl::queue &queue, transpose trans,
                               std::int64_t m, std::int64_t n, double alpha,
                               cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                               std::int64_t stridea, cl::sycl::buffer<double, 1> &x,
@@ -326,7 +326,7 @@ ONEMKL_EXPORT void gemv_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue
                               cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                               std::int64_t stridey, std::int64_t batch_size);
 
-ONEMKL_EXPORT void gemv_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+ONEMKL_EXPORT void gemv_batch(detail::backend_ref libkey, cl::sycl::queue &queue, transpose trans,
                               std::int64_t m, std::int64_t n, std::complex<float> alpha,
                               cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                               std::int64_t stridea, cl::sycl::buffer<std::complex<float>, 1> &x,
@@ -334,7 +334,7 @@ ONEMKL_EXPORT void gemv_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue
                               cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
                               std::int64_t stridey, std::int64_t batch_size);
 
-ONEMKL_EXPORT void gemv_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+ONEMKL_EXPORT void gemv_batch(detail::backend_ref libkey, cl::sycl::queue &queue, transpose trans,
                               std::int64_t m, std::int64_t n, std::complex<double> alpha,
                               cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                               std::int64_t stridea, cl::sycl::buffer<std::complex<double>, 1> &x,
@@ -342,21 +342,21 @@ ONEMKL_EXPORT void gemv_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue
                               cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
                               std::int64_t stridey, std::int64_t batch_size);
 
-ONEMKL_EXPORT void dgmm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void dgmm_batch(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                               std::int64_t m, std::int64_t n, cl::sycl::buffer<float, 1> &a,
                               std::int64_t lda, std::int64_t stridea, cl::sycl::buffer<float, 1> &x,
                               std::int64_t incx, std::int64_t stridex,
                               cl::sycl::buffer<float, 1> &c, std::int64_t ldc, std::int64_t stridec,
                               std::int64_t batch_size);
 
-ONEMKL_EXPORT void dgmm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void dgmm_batch(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                               std::int64_t m, std::int64_t n, cl::sycl::buffer<double, 1> &a,
                               std::int64_t lda, std::int64_t stridea,
                               cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                               std::int64_t stridex, cl::sycl::buffer<double, 1> &c,
                               std::int64_t ldc, std::int64_t stridec, std::int64_t batch_size);
 
-ONEMKL_EXPORT void dgmm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void dgmm_batch(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                               std::int64_t m, std::int64_t n,
                               cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                               std::int64_t stridea, cl::sycl::buffer<std::complex<float>, 1> &x,
@@ -364,7 +364,7 @@ ONEMKL_EXPORT void dgmm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue
                               cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc,
                               std::int64_t stridec, std::int64_t batch_size);
 
-ONEMKL_EXPORT void dgmm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void dgmm_batch(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                               std::int64_t m, std::int64_t n,
                               cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                               std::int64_t stridea, cl::sycl::buffer<std::complex<double>, 1> &x,
@@ -372,44 +372,44 @@ ONEMKL_EXPORT void dgmm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue
                               cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc,
                               std::int64_t stridec, std::int64_t batch_size);
 
-ONEMKL_EXPORT void her(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void her(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                        std::int64_t n, float alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
                        std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &a,
                        std::int64_t lda);
-ONEMKL_EXPORT void her(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void her(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                        std::int64_t n, double alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
                        std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &a,
                        std::int64_t lda);
 
-ONEMKL_EXPORT void hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void hpr(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                        std::int64_t n, float alpha, cl::sycl::buffer<std::complex<float>, 1> &x,
                        std::int64_t incx, cl::sycl::buffer<std::complex<float>, 1> &a);
-ONEMKL_EXPORT void hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void hpr(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                        std::int64_t n, double alpha, cl::sycl::buffer<std::complex<double>, 1> &x,
                        std::int64_t incx, cl::sycl::buffer<std::complex<double>, 1> &a);
 
-ONEMKL_EXPORT void gemm_bias(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm_bias(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                              transpose transb, offset offsetc, std::int64_t m, std::int64_t n,
                              std::int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &a,
                              std::int64_t lda, int8_t ao, cl::sycl::buffer<uint8_t, 1> &b,
                              std::int64_t ldb, uint8_t bo, float beta,
                              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
                              cl::sycl::buffer<int32_t, 1> &co);
-ONEMKL_EXPORT void gemm_bias(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm_bias(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                              transpose transb, offset offsetc, std::int64_t m, std::int64_t n,
                              std::int64_t k, float alpha, cl::sycl::buffer<int8_t, 1> &a,
                              std::int64_t lda, int8_t ao, cl::sycl::buffer<int8_t, 1> &b,
                              std::int64_t ldb, int8_t bo, float beta,
                              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
                              cl::sycl::buffer<int32_t, 1> &co);
-ONEMKL_EXPORT void gemm_bias(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm_bias(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                              transpose transb, offset offsetc, std::int64_t m, std::int64_t n,
                              std::int64_t k, float alpha, cl::sycl::buffer<uint8_t, 1> &a,
                              std::int64_t lda, uint8_t ao, cl::sycl::buffer<int8_t, 1> &b,
                              std::int64_t ldb, int8_t bo, float beta,
                              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
                              cl::sycl::buffer<int32_t, 1> &co);
-ONEMKL_EXPORT void gemm_bias(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm_bias(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                              transpose transb, offset offsetc, std::int64_t m, std::int64_t n,
                              std::int64_t k, float alpha, cl::sycl::buffer<uint8_t, 1> &a,
                              std::int64_t lda, uint8_t ao, cl::sycl::buffer<uint8_t, 1> &b,
@@ -417,542 +417,585 @@ ONEMKL_EXPORT void gemm_bias(oneapi::mkl::device libkey, cl::sycl::queue &queue,
                              cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
                              cl::sycl::buffer<int32_t, 1> &co);
 
-ONEMKL_EXPORT void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+template <typename T>
+std::int64_t gemm_pack_get_size(detail::backend_ref libkey, cl::sycl::queue &queue,
+                                identifier which, std::int64_t m, std::int64_t n, std::int64_t k);
+template <>
+ONEMKL_EXPORT std::int64_t gemm_pack_get_size<float>(
+    detail::backend_ref libkey, cl::sycl::queue &queue, identifier which, std::int64_t m,
+    std::int64_t n, std::int64_t k);
+template <>
+ONEMKL_EXPORT std::int64_t gemm_pack_get_size<double>(
+    detail::backend_ref libkey, cl::sycl::queue &queue, identifier which, std::int64_t m,
+    std::int64_t n, std::int64_t k);
+ONEMKL_EXPORT void gemm_pack(detail::backend_ref libkey, cl::sycl::queue &queue, identifier which,
+                             transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                             float alpha, cl::sycl::buffer<float, 1> &src, std::int64_t ld,
+                             cl::sycl::buffer<float, 1> &dest);
+ONEMKL_EXPORT void gemm_pack(detail::backend_ref libkey, cl::sycl::queue &queue, identifier which,
+                             transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                             double alpha, cl::sycl::buffer<double, 1> &src, std::int64_t ld,
+                             cl::sycl::buffer<double, 1> &dest);
+ONEMKL_EXPORT void gemm_compute(detail::backend_ref libkey, cl::sycl::queue &queue,
+                                identifier which, transpose trans, std::int64_t m, std::int64_t n,
+                                std::int64_t k, cl::sycl::buffer<float, 1> &packed,
+                                cl::sycl::buffer<float, 1> &other, std::int64_t ld, float beta,
+                                cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void gemm_compute(detail::backend_ref libkey, cl::sycl::queue &queue,
+                                identifier which, transpose trans, std::int64_t m, std::int64_t n,
+                                std::int64_t k, cl::sycl::buffer<double, 1> &packed,
+                                cl::sycl::buffer<double, 1> &other, std::int64_t ld, double beta,
+                                cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+
+ONEMKL_EXPORT void gemm3m(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
+                          transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                          std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
+                          std::int64_t ldb, std::complex<float> beta,
+                          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+ONEMKL_EXPORT void gemm3m(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
+                          transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+                          std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
+                          std::int64_t ldb, std::complex<double> beta,
+                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+
+ONEMKL_EXPORT void iamin(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result);
-ONEMKL_EXPORT void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void iamin(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result);
-ONEMKL_EXPORT void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void iamin(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result);
-ONEMKL_EXPORT void iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void iamin(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result);
 
-ONEMKL_EXPORT void hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void hpmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &a,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
                         std::int64_t incy);
-ONEMKL_EXPORT void hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void hpmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &a,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
                         std::int64_t incy);
 
-ONEMKL_EXPORT void spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void spmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void spmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy);
 
-ONEMKL_EXPORT void rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT void rotmg(detail::backend_ref libkey, cl::sycl::queue &queue,
                          cl::sycl::buffer<float, 1> &d1, cl::sycl::buffer<float, 1> &d2,
                          cl::sycl::buffer<float, 1> &x1, float y1,
                          cl::sycl::buffer<float, 1> &param);
-ONEMKL_EXPORT void rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT void rotmg(detail::backend_ref libkey, cl::sycl::queue &queue,
                          cl::sycl::buffer<double, 1> &d1, cl::sycl::buffer<double, 1> &d2,
                          cl::sycl::buffer<double, 1> &x1, double y1,
                          cl::sycl::buffer<double, 1> &param);
 
-ONEMKL_EXPORT void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void swap(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void swap(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void swap(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void swap(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void swap(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
 
-ONEMKL_EXPORT void geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
+ONEMKL_EXPORT void geru(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t m,
                         std::int64_t n, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda);
-ONEMKL_EXPORT void geru(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
+ONEMKL_EXPORT void geru(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t m,
                         std::int64_t n, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda);
 
-ONEMKL_EXPORT void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void nrm2(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &result);
-ONEMKL_EXPORT void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void nrm2(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &result);
-ONEMKL_EXPORT void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void nrm2(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &result);
-ONEMKL_EXPORT void nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void nrm2(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &result);
 
-ONEMKL_EXPORT void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void gemmt(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                          transpose transa, transpose transb, std::int64_t n, std::int64_t k,
                          float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                          cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
                          cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void gemmt(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                          transpose transa, transpose transb, std::int64_t n, std::int64_t k,
                          double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                          cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
                          cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void gemmt(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                          transpose transa, transpose transb, std::int64_t n, std::int64_t k,
                          std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
                          std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
                          std::int64_t ldb, std::complex<float> beta,
                          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void gemmt(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                          transpose transa, transpose transb, std::int64_t n, std::int64_t k,
                          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
                          std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
                          std::int64_t ldb, std::complex<double> beta,
                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
 
-ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                         transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
                         float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
                         cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                         transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
                         double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
                         cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                         transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
                         std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b,
                         std::int64_t ldb, std::complex<float> beta,
                         cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                         transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
                         std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
                         std::int64_t ldb, std::complex<double> beta,
                         cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                         transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
                         half alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<half, 1> &b, std::int64_t ldb, half beta,
                         cl::sycl::buffer<half, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                         transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
                         float alpha, cl::sycl::buffer<half, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<half, 1> &b, std::int64_t ldb, float beta,
                         cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa,
+ONEMKL_EXPORT void gemm(detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa,
                         transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
                         float alpha, cl::sycl::buffer<bfloat16, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<bfloat16, 1> &b, std::int64_t ldb, float beta,
                         cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
 
-ONEMKL_EXPORT void syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syr2(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<float, 1> &a, std::int64_t lda);
-ONEMKL_EXPORT void syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syr2(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<double, 1> &a, std::int64_t lda);
 
-ONEMKL_EXPORT void ger(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
+ONEMKL_EXPORT void ger(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t m,
                        std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
                        std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<float, 1> &a, std::int64_t lda);
-ONEMKL_EXPORT void ger(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t m,
+ONEMKL_EXPORT void ger(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t m,
                        std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
                        std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<double, 1> &a, std::int64_t lda);
 
-ONEMKL_EXPORT void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void trsm(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                         uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
                         std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
-ONEMKL_EXPORT void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void trsm(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                         uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
                         std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb);
-ONEMKL_EXPORT void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void trsm(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                         uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
                         std::int64_t n, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb);
-ONEMKL_EXPORT void trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void trsm(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                         uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
                         std::int64_t n, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb);
 
-ONEMKL_EXPORT void dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void dotu(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<float>, 1> &result);
-ONEMKL_EXPORT void dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void dotu(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<double>, 1> &result);
 
-ONEMKL_EXPORT void hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void hemm(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                         uplo upper_lower, std::int64_t m, std::int64_t n, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
                         std::int64_t ldc);
-ONEMKL_EXPORT void hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void hemm(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                         uplo upper_lower, std::int64_t m, std::int64_t n,
                         std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
                         std::int64_t ldb, std::complex<double> beta,
                         cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
 
-ONEMKL_EXPORT void hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void hpr2(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<float>, 1> &a);
-ONEMKL_EXPORT void hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void hpr2(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<double>, 1> &a);
 
-ONEMKL_EXPORT void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+ONEMKL_EXPORT void gbmv(detail::backend_ref libkey, cl::sycl::queue &queue, transpose trans,
                         std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
                         float alpha, cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx, float beta,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+ONEMKL_EXPORT void gbmv(detail::backend_ref libkey, cl::sycl::queue &queue, transpose trans,
                         std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
                         double alpha, cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+ONEMKL_EXPORT void gbmv(detail::backend_ref libkey, cl::sycl::queue &queue, transpose trans,
                         std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
                         std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &x,
                         std::int64_t incx, std::complex<float> beta,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans,
+ONEMKL_EXPORT void gbmv(detail::backend_ref libkey, cl::sycl::queue &queue, transpose trans,
                         std::int64_t m, std::int64_t n, std::int64_t kl, std::int64_t ku,
                         std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &x,
                         std::int64_t incx, std::complex<double> beta,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
 
-ONEMKL_EXPORT void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tbmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                         cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tbmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tbmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tbmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
 
-ONEMKL_EXPORT void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void symm(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                         uplo upper_lower, std::int64_t m, std::int64_t n, float alpha,
                         cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &b, std::int64_t ldb, float beta,
                         cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void symm(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                         uplo upper_lower, std::int64_t m, std::int64_t n, double alpha,
                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &b, std::int64_t ldb, double beta,
                         cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void symm(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                         uplo upper_lower, std::int64_t m, std::int64_t n, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c,
                         std::int64_t ldc);
-ONEMKL_EXPORT void symm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void symm(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                         uplo upper_lower, std::int64_t m, std::int64_t n,
                         std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
                         std::int64_t ldb, std::complex<double> beta,
                         cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
 
-ONEMKL_EXPORT void dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void dotc(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<float>, 1> &result);
-ONEMKL_EXPORT void dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void dotc(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<std::complex<double>, 1> &result);
 
-ONEMKL_EXPORT void syr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syr(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                        std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
                        std::int64_t incx, cl::sycl::buffer<float, 1> &a, std::int64_t lda);
-ONEMKL_EXPORT void syr(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void syr(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                        std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
                        std::int64_t incx, cl::sycl::buffer<double, 1> &a, std::int64_t lda);
 
-ONEMKL_EXPORT void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void trmm(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                         uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
                         std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<float, 1> &b, std::int64_t ldb);
-ONEMKL_EXPORT void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void trmm(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                         uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
                         std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<double, 1> &b, std::int64_t ldb);
-ONEMKL_EXPORT void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void trmm(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                         uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
                         std::int64_t n, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb);
-ONEMKL_EXPORT void trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void trmm(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                         uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
                         std::int64_t n, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb);
 
-ONEMKL_EXPORT void symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void symv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void symv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void symv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                         double beta, cl::sycl::buffer<double, 1> &y, std::int64_t incy);
 
-ONEMKL_EXPORT void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tpsv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<float, 1> &x,
                         std::int64_t incx);
-ONEMKL_EXPORT void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tpsv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<double, 1> &x,
                         std::int64_t incx);
-ONEMKL_EXPORT void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tpsv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &a,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tpsv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &a,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
 
-ONEMKL_EXPORT void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void trsv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void trsv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void trsv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void trsv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
 
-ONEMKL_EXPORT void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void copy(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void copy(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void copy(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<float>, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void copy(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void copy(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<std::complex<double>, 1> &y, std::int64_t incy);
 
-ONEMKL_EXPORT void copy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void copy_batch(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                               cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                               std::int64_t stridex, cl::sycl::buffer<float, 1> &y,
                               std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
 
-ONEMKL_EXPORT void copy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void copy_batch(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                               cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                               std::int64_t stridex, cl::sycl::buffer<double, 1> &y,
                               std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
 
-ONEMKL_EXPORT void copy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void copy_batch(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                               cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                               std::int64_t stridex, cl::sycl::buffer<std::complex<float>, 1> &y,
                               std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
 
-ONEMKL_EXPORT void copy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void copy_batch(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                               cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                               std::int64_t stridex, cl::sycl::buffer<std::complex<double>, 1> &y,
                               std::int64_t incy, std::int64_t stridey, std::int64_t batch_size);
 
-ONEMKL_EXPORT void hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void hemv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, std::complex<float> alpha,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &y,
                         std::int64_t incy);
-ONEMKL_EXPORT void hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void hemv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, std::complex<double> alpha,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &y,
                         std::int64_t incy);
 
-ONEMKL_EXPORT void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void iamax(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result);
-ONEMKL_EXPORT void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void iamax(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result);
-ONEMKL_EXPORT void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void iamax(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result);
-ONEMKL_EXPORT void iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void iamax(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                          cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                          cl::sycl::buffer<std::int64_t, 1> &result);
 
-ONEMKL_EXPORT void sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void sbmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &a,
                         std::int64_t lda, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         float beta, cl::sycl::buffer<float, 1> &y, std::int64_t incy);
-ONEMKL_EXPORT void sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void sbmv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, std::int64_t k, double alpha,
                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx, double beta,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy);
 
-ONEMKL_EXPORT void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void asum(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &result);
-ONEMKL_EXPORT void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void asum(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &result);
-ONEMKL_EXPORT void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void asum(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &result);
-ONEMKL_EXPORT void asum(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void asum(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &result);
 
-ONEMKL_EXPORT void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tbsv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                         cl::sycl::buffer<float, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tbsv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                         cl::sycl::buffer<double, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tbsv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                         cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<float>, 1> &x, std::int64_t incx);
-ONEMKL_EXPORT void tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void tbsv(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         transpose trans, diag unit_diag, std::int64_t n, std::int64_t k,
                         cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                         cl::sycl::buffer<std::complex<double>, 1> &x, std::int64_t incx);
 
-ONEMKL_EXPORT void spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void spr2(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<float, 1> &a);
-ONEMKL_EXPORT void spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void spr2(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                         std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
                         std::int64_t incx, cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<double, 1> &a);
 
-ONEMKL_EXPORT void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void trsm_batch(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                               uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
                               std::int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
                               std::int64_t lda, std::int64_t stride_a,
                               cl::sycl::buffer<float, 1> &b, std::int64_t ldb,
                               std::int64_t stride_b, std::int64_t batch_size);
-ONEMKL_EXPORT void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void trsm_batch(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                               uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
                               std::int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
                               std::int64_t lda, std::int64_t stride_a,
                               cl::sycl::buffer<double, 1> &b, std::int64_t ldb,
                               std::int64_t stride_b, std::int64_t batch_size);
-ONEMKL_EXPORT void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void trsm_batch(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                               uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
                               std::int64_t n, std::complex<float> alpha,
                               cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                               std::int64_t stride_a, cl::sycl::buffer<std::complex<float>, 1> &b,
                               std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
-ONEMKL_EXPORT void trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue, side left_right,
+ONEMKL_EXPORT void trsm_batch(detail::backend_ref libkey, cl::sycl::queue &queue, side left_right,
                               uplo upper_lower, transpose trans, diag unit_diag, std::int64_t m,
                               std::int64_t n, std::complex<double> alpha,
                               cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
                               std::int64_t stride_a, cl::sycl::buffer<std::complex<double>, 1> &b,
                               std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size);
 
-ONEMKL_EXPORT void rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void rotm(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<float, 1> &param);
-ONEMKL_EXPORT void rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void rotm(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                         cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                         cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                         cl::sycl::buffer<double, 1> &param);
 
-ONEMKL_EXPORT void dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void dot(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<float, 1> &result);
-ONEMKL_EXPORT void dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void dot(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                        cl::sycl::buffer<double, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<double, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<double, 1> &result);
-ONEMKL_EXPORT void dot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void dot(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                        cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                        cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                        cl::sycl::buffer<double, 1> &result);
 
-ONEMKL_EXPORT void sdsdot(oneapi::mkl::device libkey, cl::sycl::queue &queue, std::int64_t n,
+ONEMKL_EXPORT void sdsdot(detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n,
                           float sb, cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                           cl::sycl::buffer<float, 1> &y, std::int64_t incy,
                           cl::sycl::buffer<float, 1> &result);
 
-ONEMKL_EXPORT void her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void her2k(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                          transpose trans, std::int64_t n, std::int64_t k, std::complex<float> alpha,
                          cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
                          cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, float beta,
                          cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
-ONEMKL_EXPORT void her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue, uplo upper_lower,
+ONEMKL_EXPORT void her2k(detail::backend_ref libkey, cl::sycl::queue &queue, uplo upper_lower,
                          transpose trans, std::int64_t n, std::int64_t k,
                          std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
                          std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b,
                          std::int64_t ldb, double beta,
                          cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
 
-ONEMKL_EXPORT void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT void rotg(detail::backend_ref libkey, cl::sycl::queue &queue,
                         cl::sycl::buffer<float, 1> &a, cl::sycl::buffer<float, 1> &b,
                         cl::sycl::buffer<float, 1> &c, cl::sycl::buffer<float, 1> &s);
-ONEMKL_EXPORT void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT void rotg(detail::backend_ref libkey, cl::sycl::queue &queue,
                         cl::sycl::buffer<double, 1> &a, cl::sycl::buffer<double, 1> &b,
                         cl::sycl::buffer<double, 1> &c, cl::sycl::buffer<double, 1> &s);
-ONEMKL_EXPORT void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT void rotg(detail::backend_ref libkey, cl::sycl::queue &queue,
                         cl::sycl::buffer<std::complex<float>, 1> &a,
                         cl::sycl::buffer<std::complex<float>, 1> &b, cl::sycl::buffer<float, 1> &c,
                         cl::sycl::buffer<std::complex<float>, 1> &s);
-ONEMKL_EXPORT void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT void rotg(detail::backend_ref libkey, cl::sycl::queue &queue,
                         cl::sycl::buffer<std::complex<double>, 1> &a,
                         cl::sycl::buffer<std::complex<double>, 1> &b,
                         cl::sycl::buffer<double, 1> &c,
@@ -960,92 +1003,115 @@ ONEMKL_EXPORT void rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue,
 
 // USM APIs
 
-ONEMKL_EXPORT cl::sycl::event herk(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event herk(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, std::int64_t n,
                                    std::int64_t k, float alpha, const std::complex<float> *a,
                                    std::int64_t lda, float beta, std::complex<float> *c,
                                    std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event herk(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event herk(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, std::int64_t n,
                                    std::int64_t k, double alpha, const std::complex<double> *a,
                                    std::int64_t lda, double beta, std::complex<double> *c,
                                    std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event scal(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, float alpha, float *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event scal(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, double alpha, double *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event scal(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, std::complex<float> alpha,
                                    std::complex<float> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event scal(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, std::complex<double> alpha,
                                    std::complex<double> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event scal(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, float alpha, std::complex<float> *x,
                                    std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event scal(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event scal(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, double alpha, std::complex<double> *x,
                                    std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event scal(detail::backend_ref libkey, cl::sycl::queue &queue,
+                                   std::int64_t n, const float *alpha, float *x, std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event scal(
+    detail::backend_ref libkey, cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+    double *x, std::int64_t incx, const std::vector<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event scal(detail::backend_ref libkey, cl::sycl::queue &queue,
+                                   std::int64_t n, const std::complex<float> *alpha,
+                                   std::complex<float> *x, std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event scal(detail::backend_ref libkey, cl::sycl::queue &queue,
+                                   std::int64_t n, const float *alpha, std::complex<float> *x,
+                                   std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event scal(detail::backend_ref libkey, cl::sycl::queue &queue,
+                                   std::int64_t n, const std::complex<double> *alpha,
+                                   std::complex<double> *x, std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event scal(detail::backend_ref libkey, cl::sycl::queue &queue,
+                                   std::int64_t n, const double *alpha, std::complex<double> *x,
+                                   std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event trmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const float *a, std::int64_t lda, float *x,
                                    std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const double *a, std::int64_t lda, double *x,
                                    std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const std::complex<float> *a, std::int64_t lda,
                                    std::complex<float> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const std::complex<double> *a, std::int64_t lda,
                                    std::complex<double> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tpmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const float *a, float *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tpmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const double *a, double *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tpmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const std::complex<float> *a,
                                    std::complex<float> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event tpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tpmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const std::complex<double> *a,
                                    std::complex<double> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event spr(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event spr(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   uplo upper_lower, std::int64_t n, float alpha, const float *x,
                                   std::int64_t incx, float *a,
                                   const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event spr(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event spr(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   uplo upper_lower, std::int64_t n, double alpha, const double *x,
                                   std::int64_t incx, double *a,
                                   const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          transpose *transa, transpose *transb, std::int64_t *m,
                                          std::int64_t *n, std::int64_t *k, float *alpha,
                                          const float **a, std::int64_t *lda, const float **b,
@@ -1053,7 +1119,7 @@ ONEMKL_EXPORT cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::int64_t *ldc, std::int64_t group_count,
                                          std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          transpose *transa, transpose *transb, std::int64_t *m,
                                          std::int64_t *n, std::int64_t *k, double *alpha,
                                          const double **a, std::int64_t *lda, const double **b,
@@ -1061,7 +1127,7 @@ ONEMKL_EXPORT cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::int64_t *ldc, std::int64_t group_count,
                                          std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          transpose *transa, transpose *transb, std::int64_t *m,
                                          std::int64_t *n, std::int64_t *k,
                                          std::complex<float> *alpha, const std::complex<float> **a,
@@ -1071,20 +1137,20 @@ ONEMKL_EXPORT cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::int64_t group_count, std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemm_batch(
-    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose *transa, transpose *transb,
+    detail::backend_ref libkey, cl::sycl::queue &queue, transpose *transa, transpose *transb,
     std::int64_t *m, std::int64_t *n, std::int64_t *k, std::complex<double> *alpha,
     const std::complex<double> **a, std::int64_t *lda, const std::complex<double> **b,
     std::int64_t *ldb, std::complex<double> *beta, std::complex<double> **c, std::int64_t *ldc,
     std::int64_t group_count, std::int64_t *group_size,
     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          transpose *transa, transpose *transb, std::int64_t *m,
                                          std::int64_t *n, std::int64_t *k, half *alpha,
                                          const half **a, std::int64_t *lda, const half **b,
                                          std::int64_t *ldb, half *beta, half **c, std::int64_t *ldc,
                                          std::int64_t group_count, std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          transpose transa, transpose transb, std::int64_t m,
                                          std::int64_t n, std::int64_t k, float alpha,
                                          const float *a, std::int64_t lda, std::int64_t stride_a,
@@ -1092,7 +1158,7 @@ ONEMKL_EXPORT cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          float beta, float *c, std::int64_t ldc,
                                          std::int64_t stride_c, std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          transpose transa, transpose transb, std::int64_t m,
                                          std::int64_t n, std::int64_t k, double alpha,
                                          const double *a, std::int64_t lda, std::int64_t stride_a,
@@ -1101,20 +1167,20 @@ ONEMKL_EXPORT cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::int64_t stride_c, std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemm_batch(
-    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
     std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
     const std::complex<float> *a, std::int64_t lda, std::int64_t stride_a,
     const std::complex<float> *b, std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
     std::complex<float> *c, std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size,
     const std::vector<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemm_batch(
-    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
     std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
     const std::complex<double> *a, std::int64_t lda, std::int64_t stride_a,
     const std::complex<double> *b, std::int64_t ldb, std::int64_t stride_b,
     std::complex<double> beta, std::complex<double> *c, std::int64_t ldc, std::int64_t stride_c,
     std::int64_t batch_size, const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          transpose transa, transpose transb, std::int64_t m,
                                          std::int64_t n, std::int64_t k, half alpha, const half *a,
                                          std::int64_t lda, std::int64_t stride_a, const half *b,
@@ -1123,24 +1189,24 @@ ONEMKL_EXPORT cl::sycl::event gemm_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syrk(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, std::int64_t n,
                                    std::int64_t k, float alpha, const float *a, std::int64_t lda,
                                    float beta, float *c, std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syrk(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, std::int64_t n,
                                    std::int64_t k, double alpha, const double *a, std::int64_t lda,
                                    double beta, double *c, std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syrk(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, std::int64_t n,
                                    std::int64_t k, std::complex<float> alpha,
                                    const std::complex<float> *a, std::int64_t lda,
                                    std::complex<float> beta, std::complex<float> *c,
                                    std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syrk(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, std::int64_t n,
                                    std::int64_t k, std::complex<double> alpha,
                                    const std::complex<double> *a, std::int64_t lda,
@@ -1148,21 +1214,21 @@ ONEMKL_EXPORT cl::sycl::event syrk(oneapi::mkl::device libkey, cl::sycl::queue &
                                    std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event syrk_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syrk_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          uplo *upper_lower, transpose *trans, std::int64_t *n,
                                          std::int64_t *k, float *alpha, const float **a,
                                          std::int64_t *lda, float *beta, float **c,
                                          std::int64_t *ldc, std::int64_t group_count,
                                          std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event syrk_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syrk_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          uplo *upper_lower, transpose *trans, std::int64_t *n,
                                          std::int64_t *k, double *alpha, const double **a,
                                          std::int64_t *lda, double *beta, double **c,
                                          std::int64_t *ldc, std::int64_t group_count,
                                          std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event syrk_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syrk_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          uplo *upper_lower, transpose *trans, std::int64_t *n,
                                          std::int64_t *k, std::complex<float> *alpha,
                                          const std::complex<float> **a, std::int64_t *lda,
@@ -1170,7 +1236,7 @@ ONEMKL_EXPORT cl::sycl::event syrk_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::int64_t *ldc, std::int64_t group_count,
                                          std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event syrk_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syrk_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          uplo *upper_lower, transpose *trans, std::int64_t *n,
                                          std::int64_t *k, std::complex<double> *alpha,
                                          const std::complex<double> **a, std::int64_t *lda,
@@ -1179,21 +1245,21 @@ ONEMKL_EXPORT cl::sycl::event syrk_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event syrk_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syrk_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          uplo upper_lower, transpose trans, std::int64_t n,
                                          std::int64_t k, float alpha, const float *a,
                                          std::int64_t lda, std::int64_t stride_a, float beta,
                                          float *c, std::int64_t ldc, std::int64_t stride_c,
                                          std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event syrk_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syrk_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          uplo upper_lower, transpose trans, std::int64_t n,
                                          std::int64_t k, double alpha, const double *a,
                                          std::int64_t lda, std::int64_t stride_a, double beta,
                                          double *c, std::int64_t ldc, std::int64_t stride_c,
                                          std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event syrk_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syrk_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          uplo upper_lower, transpose trans, std::int64_t n,
                                          std::int64_t k, std::complex<float> alpha,
                                          const std::complex<float> *a, std::int64_t lda,
@@ -1201,7 +1267,7 @@ ONEMKL_EXPORT cl::sycl::event syrk_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::complex<float> *c, std::int64_t ldc,
                                          std::int64_t stride_c, std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event syrk_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syrk_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          uplo upper_lower, transpose trans, std::int64_t n,
                                          std::int64_t k, std::complex<double> alpha,
                                          const std::complex<double> *a, std::int64_t lda,
@@ -1210,27 +1276,27 @@ ONEMKL_EXPORT cl::sycl::event syrk_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::int64_t stride_c, std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event her2(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event her2(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, std::complex<float> alpha,
                                    const std::complex<float> *x, std::int64_t incx,
                                    const std::complex<float> *y, std::int64_t incy,
                                    std::complex<float> *a, std::int64_t lda,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event her2(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event her2(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, std::complex<double> alpha,
                                    const std::complex<double> *x, std::int64_t incx,
                                    const std::complex<double> *y, std::int64_t incy,
                                    std::complex<double> *a, std::int64_t lda,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event hbmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, std::int64_t k,
                                    std::complex<float> alpha, const std::complex<float> *a,
                                    std::int64_t lda, const std::complex<float> *x,
                                    std::int64_t incx, std::complex<float> beta,
                                    std::complex<float> *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event hbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event hbmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, std::int64_t k,
                                    std::complex<double> alpha, const std::complex<double> *a,
                                    std::int64_t lda, const std::complex<double> *x,
@@ -1238,84 +1304,103 @@ ONEMKL_EXPORT cl::sycl::event hbmv(oneapi::mkl::device libkey, cl::sycl::queue &
                                    std::complex<double> *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event rot(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   std::int64_t n, std::complex<float> *x, std::int64_t incx,
                                   std::complex<float> *y, std::int64_t incy, float c, float s,
                                   const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event rot(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   std::int64_t n, std::complex<double> *x, std::int64_t incx,
                                   std::complex<double> *y, std::int64_t incy, double c, double s,
                                   const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event rot(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   std::int64_t n, float *x, std::int64_t incx, float *y,
                                   std::int64_t incy, float c, float s,
                                   const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event rot(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event rot(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   std::int64_t n, double *x, std::int64_t incx, double *y,
                                   std::int64_t incy, double c, double s,
                                   const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpy(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, float alpha, const float *x, std::int64_t incx,
                                    float *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpy(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, double alpha, const double *x, std::int64_t incx,
                                    double *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpy(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, std::complex<float> alpha,
                                    const std::complex<float> *x, std::int64_t incx,
                                    std::complex<float> *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event axpy(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpy(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, std::complex<double> alpha,
                                    const std::complex<double> *x, std::int64_t incx,
                                    std::complex<double> *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpy(detail::backend_ref libkey, cl::sycl::queue &queue,
+                                   std::int64_t n, const float *alpha, const float *x,
+                                   std::int64_t incx, float *y, std::int64_t incy,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event axpy(detail::backend_ref libkey, cl::sycl::queue &queue,
+                                   std::int64_t n, const double *alpha, const double *x,
+                                   std::int64_t incx, double *y, std::int64_t incy,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event axpy(detail::backend_ref libkey, cl::sycl::queue &queue,
+                                   std::int64_t n, const std::complex<float> *alpha,
+                                   const std::complex<float> *x, std::int64_t incx,
+                                   std::complex<float> *y, std::int64_t incy,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event axpy(detail::backend_ref libkey, cl::sycl::queue &queue,
+                                   std::int64_t n, const std::complex<double> *alpha,
+                                   const std::complex<double> *x, std::int64_t incx,
+                                   std::complex<double> *y, std::int64_t incy,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event axpy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t *n, float *alpha, const float **x,
                                          std::int64_t *incx, float **y, std::int64_t *incy,
                                          std::int64_t group_count, std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t *n, double *alpha, const double **x,
                                          std::int64_t *incx, double **y, std::int64_t *incy,
                                          std::int64_t group_count, std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t *n, std::complex<float> *alpha,
                                          const std::complex<float> **x, std::int64_t *incx,
                                          std::complex<float> **y, std::int64_t *incy,
                                          std::int64_t group_count, std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t *n, std::complex<double> *alpha,
                                          const std::complex<double> **x, std::int64_t *incx,
                                          std::complex<double> **y, std::int64_t *incy,
                                          std::int64_t group_count, std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t n, float alpha, const float *x,
                                          std::int64_t incx, std::int64_t stridex, float *y,
                                          std::int64_t incy, std::int64_t stridey,
                                          std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t n, double alpha, const double *x,
                                          std::int64_t incx, std::int64_t stridex, double *y,
                                          std::int64_t incy, std::int64_t stridey,
                                          std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t n, std::complex<float> alpha,
                                          const std::complex<float> *x, std::int64_t incx,
                                          std::int64_t stridex, std::complex<float> *y,
                                          std::int64_t incy, std::int64_t stridey,
                                          std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t n, std::complex<double> alpha,
                                          const std::complex<double> *x, std::int64_t incx,
                                          std::int64_t stridex, std::complex<double> *y,
@@ -1323,54 +1408,54 @@ ONEMKL_EXPORT cl::sycl::event axpy_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event axpby(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpby(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     std::int64_t n, float alpha, const float *x, std::int64_t incx,
                                     const float beta, float *y, std::int64_t incy,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event axpby(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpby(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     std::int64_t n, double alpha, const double *x,
                                     std::int64_t incx, const double beta, double *y,
                                     std::int64_t incy,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event axpby(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpby(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     std::int64_t n, std::complex<float> alpha,
                                     const std::complex<float> *x, std::int64_t incx,
                                     const std::complex<float> beta, std::complex<float> *y,
                                     std::int64_t incy,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event axpby(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event axpby(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     std::int64_t n, std::complex<double> alpha,
                                     const std::complex<double> *x, std::int64_t incx,
                                     const std::complex<double> beta, std::complex<double> *y,
                                     std::int64_t incy,
                                     const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gerc(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t m, std::int64_t n, std::complex<float> alpha,
                                    const std::complex<float> *x, std::int64_t incx,
                                    const std::complex<float> *y, std::int64_t incy,
                                    std::complex<float> *a, std::int64_t lda,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gerc(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gerc(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t m, std::int64_t n, std::complex<double> alpha,
                                    const std::complex<double> *x, std::int64_t incx,
                                    const std::complex<double> *y, std::int64_t incy,
                                    std::complex<double> *a, std::int64_t lda,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syr2k(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     uplo upper_lower, transpose trans, std::int64_t n,
                                     std::int64_t k, float alpha, const float *a, std::int64_t lda,
                                     const float *b, std::int64_t ldb, float beta, float *c,
                                     std::int64_t ldc,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syr2k(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     uplo upper_lower, transpose trans, std::int64_t n,
                                     std::int64_t k, double alpha, const double *a, std::int64_t lda,
                                     const double *b, std::int64_t ldb, double beta, double *c,
                                     std::int64_t ldc,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syr2k(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     uplo upper_lower, transpose trans, std::int64_t n,
                                     std::int64_t k, std::complex<float> alpha,
                                     const std::complex<float> *a, std::int64_t lda,
@@ -1378,7 +1463,7 @@ ONEMKL_EXPORT cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue
                                     std::complex<float> beta, std::complex<float> *c,
                                     std::int64_t ldc,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syr2k(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     uplo upper_lower, transpose trans, std::int64_t n,
                                     std::int64_t k, std::complex<double> alpha,
                                     const std::complex<double> *a, std::int64_t lda,
@@ -1387,24 +1472,24 @@ ONEMKL_EXPORT cl::sycl::event syr2k(oneapi::mkl::device libkey, cl::sycl::queue
                                     std::int64_t ldc,
                                     const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    transpose trans, std::int64_t m, std::int64_t n, float alpha,
                                    const float *a, std::int64_t lda, const float *x,
                                    std::int64_t incx, float beta, float *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    transpose trans, std::int64_t m, std::int64_t n, double alpha,
                                    const double *a, std::int64_t lda, const double *x,
                                    std::int64_t incx, double beta, double *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    transpose trans, std::int64_t m, std::int64_t n,
                                    std::complex<float> alpha, const std::complex<float> *a,
                                    std::int64_t lda, const std::complex<float> *x,
                                    std::int64_t incx, std::complex<float> beta,
                                    std::complex<float> *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    transpose trans, std::int64_t m, std::int64_t n,
                                    std::complex<double> alpha, const std::complex<double> *a,
                                    std::int64_t lda, const std::complex<double> *x,
@@ -1412,7 +1497,7 @@ ONEMKL_EXPORT cl::sycl::event gemv(oneapi::mkl::device libkey, cl::sycl::queue &
                                    std::complex<double> *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event gemv_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemv_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          transpose trans, std::int64_t m, std::int64_t n,
                                          float alpha, const float *a, std::int64_t lda,
                                          std::int64_t stridea, const float *x, std::int64_t incx,
@@ -1420,7 +1505,7 @@ ONEMKL_EXPORT cl::sycl::event gemv_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::int64_t incy, std::int64_t stridey,
                                          std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemv_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemv_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          transpose trans, std::int64_t m, std::int64_t n,
                                          double alpha, const double *a, std::int64_t lda,
                                          std::int64_t stridea, const double *x, std::int64_t incx,
@@ -1429,32 +1514,32 @@ ONEMKL_EXPORT cl::sycl::event gemv_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemv_batch(
-    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    detail::backend_ref libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
     std::int64_t n, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
     std::int64_t stridea, const std::complex<float> *x, std::int64_t incx, std::int64_t stridex,
     std::complex<float> beta, std::complex<float> *y, std::int64_t incy, std::int64_t stridey,
     std::int64_t batch_size, const std::vector<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemv_batch(
-    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
+    detail::backend_ref libkey, cl::sycl::queue &queue, transpose trans, std::int64_t m,
     std::int64_t n, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
     std::int64_t stridea, const std::complex<double> *x, std::int64_t incx, std::int64_t stridex,
     std::complex<double> beta, std::complex<double> *y, std::int64_t incy, std::int64_t stridey,
     std::int64_t batch_size, const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemv_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemv_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          transpose *trans, std::int64_t *m, std::int64_t *n,
                                          float *alpha, const float **a, std::int64_t *lda,
                                          const float **x, std::int64_t *incx, float *beta,
                                          float **y, std::int64_t *incy, std::int64_t group_count,
                                          std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemv_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemv_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          transpose *trans, std::int64_t *m, std::int64_t *n,
                                          double *alpha, const double **a, std::int64_t *lda,
                                          const double **x, std::int64_t *incx, double *beta,
                                          double **y, std::int64_t *incy, std::int64_t group_count,
                                          std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemv_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemv_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          transpose *trans, std::int64_t *m, std::int64_t *n,
                                          std::complex<float> *alpha, const std::complex<float> **a,
                                          std::int64_t *lda, const std::complex<float> **x,
@@ -1463,27 +1548,27 @@ ONEMKL_EXPORT cl::sycl::event gemv_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::int64_t group_count, std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemv_batch(
-    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose *trans, std::int64_t *m,
+    detail::backend_ref libkey, cl::sycl::queue &queue, transpose *trans, std::int64_t *m,
     std::int64_t *n, std::complex<double> *alpha, const std::complex<double> **a, std::int64_t *lda,
     const std::complex<double> **x, std::int64_t *incx, std::complex<double> *beta,
     std::complex<double> **y, std::int64_t *incy, std::int64_t group_count,
     std::int64_t *group_size, const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event dgmm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event dgmm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side left_right, std::int64_t m, std::int64_t n,
                                          const float *a, std::int64_t lda, std::int64_t stridea,
                                          const float *x, std::int64_t incx, std::int64_t stridex,
                                          float *c, std::int64_t ldc, std::int64_t stridec,
                                          std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event dgmm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event dgmm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side left_right, std::int64_t m, std::int64_t n,
                                          const double *a, std::int64_t lda, std::int64_t stridea,
                                          const double *x, std::int64_t incx, std::int64_t stridex,
                                          double *c, std::int64_t ldc, std::int64_t stridec,
                                          std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event dgmm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event dgmm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side left_right, std::int64_t m, std::int64_t n,
                                          const std::complex<float> *a, std::int64_t lda,
                                          std::int64_t stridea, const std::complex<float> *x,
@@ -1491,7 +1576,7 @@ ONEMKL_EXPORT cl::sycl::event dgmm_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::complex<float> *c, std::int64_t ldc,
                                          std::int64_t stridec, std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event dgmm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event dgmm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side left_right, std::int64_t m, std::int64_t n,
                                          const std::complex<double> *a, std::int64_t lda,
                                          std::int64_t stridea, const std::complex<double> *x,
@@ -1499,26 +1584,26 @@ ONEMKL_EXPORT cl::sycl::event dgmm_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::complex<double> *c, std::int64_t ldc,
                                          std::int64_t stridec, std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event dgmm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event dgmm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side *left_right, std::int64_t *m, std::int64_t *n,
                                          const float **a, std::int64_t *lda, const float **x,
                                          std::int64_t *incx, float **c, std::int64_t *ldc,
                                          std::int64_t group_count, std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event dgmm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event dgmm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side *left_right, std::int64_t *m, std::int64_t *n,
                                          const double **a, std::int64_t *lda, const double **x,
                                          std::int64_t *incx, double **c, std::int64_t *ldc,
                                          std::int64_t group_count, std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event dgmm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event dgmm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side *left_right, std::int64_t *m, std::int64_t *n,
                                          const std::complex<float> **a, std::int64_t *lda,
                                          const std::complex<float> **x, std::int64_t *incx,
                                          std::complex<float> **c, std::int64_t *ldc,
                                          std::int64_t group_count, std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event dgmm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event dgmm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side *left_right, std::int64_t *m, std::int64_t *n,
                                          const std::complex<double> **a, std::int64_t *lda,
                                          const std::complex<double> **x, std::int64_t *incx,
@@ -1526,135 +1611,135 @@ ONEMKL_EXPORT cl::sycl::event dgmm_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          std::int64_t group_count, std::int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event her(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event her(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   uplo upper_lower, std::int64_t n, float alpha,
                                   const std::complex<float> *x, std::int64_t incx,
                                   std::complex<float> *a, std::int64_t lda,
                                   const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event her(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event her(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   uplo upper_lower, std::int64_t n, double alpha,
                                   const std::complex<double> *x, std::int64_t incx,
                                   std::complex<double> *a, std::int64_t lda,
                                   const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event hpr(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   uplo upper_lower, std::int64_t n, float alpha,
                                   const std::complex<float> *x, std::int64_t incx,
                                   std::complex<float> *a,
                                   const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event hpr(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event hpr(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   uplo upper_lower, std::int64_t n, double alpha,
                                   const std::complex<double> *x, std::int64_t incx,
                                   std::complex<double> *a,
                                   const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event iamin(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     std::int64_t n, const float *x, std::int64_t incx,
                                     std::int64_t *result,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event iamin(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     std::int64_t n, const double *x, std::int64_t incx,
                                     std::int64_t *result,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event iamin(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     std::int64_t n, const std::complex<float> *x, std::int64_t incx,
                                     std::int64_t *result,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event iamin(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event iamin(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     std::int64_t n, const std::complex<double> *x,
                                     std::int64_t incx, std::int64_t *result,
                                     const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event hpmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, std::complex<float> alpha,
                                    const std::complex<float> *a, const std::complex<float> *x,
                                    std::int64_t incx, std::complex<float> beta,
                                    std::complex<float> *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event hpmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event hpmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, std::complex<double> alpha,
                                    const std::complex<double> *a, const std::complex<double> *x,
                                    std::int64_t incx, std::complex<double> beta,
                                    std::complex<double> *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event spmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, float alpha, const float *a,
                                    const float *x, std::int64_t incx, float beta, float *y,
                                    std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event spmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event spmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, double alpha, const double *a,
                                    const double *x, std::int64_t incx, double beta, double *y,
                                    std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue, float *d1,
+ONEMKL_EXPORT cl::sycl::event rotmg(detail::backend_ref libkey, cl::sycl::queue &queue, float *d1,
                                     float *d2, float *x1, float y1, float *param,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event rotmg(oneapi::mkl::device libkey, cl::sycl::queue &queue, double *d1,
+ONEMKL_EXPORT cl::sycl::event rotmg(detail::backend_ref libkey, cl::sycl::queue &queue, double *d1,
                                     double *d2, double *x1, double y1, double *param,
                                     const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event swap(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, float *x, std::int64_t incx, float *y,
                                    std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event swap(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, double *x, std::int64_t incx, double *y,
                                    std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event swap(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, std::complex<float> *x, std::int64_t incx,
                                    std::complex<float> *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event swap(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event swap(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, std::complex<double> *x, std::int64_t incx,
                                    std::complex<double> *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event geru(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event geru(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t m, std::int64_t n, std::complex<float> alpha,
                                    const std::complex<float> *x, std::int64_t incx,
                                    const std::complex<float> *y, std::int64_t incy,
                                    std::complex<float> *a, std::int64_t lda,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event geru(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event geru(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t m, std::int64_t n, std::complex<double> alpha,
                                    const std::complex<double> *x, std::int64_t incx,
                                    const std::complex<double> *y, std::int64_t incy,
                                    std::complex<double> *a, std::int64_t lda,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event nrm2(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const std::complex<float> *x, std::int64_t incx,
                                    float *result,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event nrm2(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const std::complex<double> *x, std::int64_t incx,
                                    double *result,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event nrm2(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const float *x, std::int64_t incx, float *result,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event nrm2(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event nrm2(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const double *x, std::int64_t incx,
                                    double *result,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemmt(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     uplo upper_lower, transpose transa, transpose transb,
                                     std::int64_t n, std::int64_t k, float alpha, const float *a,
                                     std::int64_t lda, const float *b, std::int64_t ldb, float beta,
                                     float *c, std::int64_t ldc,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemmt(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     uplo upper_lower, transpose transa, transpose transb,
                                     std::int64_t n, std::int64_t k, double alpha, const double *a,
                                     std::int64_t lda, const double *b, std::int64_t ldb,
                                     double beta, double *c, std::int64_t ldc,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemmt(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     uplo upper_lower, transpose transa, transpose transb,
                                     std::int64_t n, std::int64_t k, std::complex<float> alpha,
                                     const std::complex<float> *a, std::int64_t lda,
@@ -1662,7 +1747,7 @@ ONEMKL_EXPORT cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue
                                     std::complex<float> beta, std::complex<float> *c,
                                     std::int64_t ldc,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemmt(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     uplo upper_lower, transpose transa, transpose transb,
                                     std::int64_t n, std::int64_t k, std::complex<double> alpha,
                                     const std::complex<double> *a, std::int64_t lda,
@@ -1671,19 +1756,19 @@ ONEMKL_EXPORT cl::sycl::event gemmt(oneapi::mkl::device libkey, cl::sycl::queue
                                     std::int64_t ldc,
                                     const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    transpose transa, transpose transb, std::int64_t m,
                                    std::int64_t n, std::int64_t k, float alpha, const float *a,
                                    std::int64_t lda, const float *b, std::int64_t ldb, float beta,
                                    float *c, std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    transpose transa, transpose transb, std::int64_t m,
                                    std::int64_t n, std::int64_t k, double alpha, const double *a,
                                    std::int64_t lda, const double *b, std::int64_t ldb, double beta,
                                    double *c, std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    transpose transa, transpose transb, std::int64_t m,
                                    std::int64_t n, std::int64_t k, std::complex<float> alpha,
                                    const std::complex<float> *a, std::int64_t lda,
@@ -1691,7 +1776,7 @@ ONEMKL_EXPORT cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &
                                    std::complex<float> beta, std::complex<float> *c,
                                    std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    transpose transa, transpose transb, std::int64_t m,
                                    std::int64_t n, std::int64_t k, std::complex<double> alpha,
                                    const std::complex<double> *a, std::int64_t lda,
@@ -1699,26 +1784,26 @@ ONEMKL_EXPORT cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &
                                    std::complex<double> beta, std::complex<double> *c,
                                    std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    transpose transa, transpose transb, std::int64_t m,
                                    std::int64_t n, std::int64_t k, half alpha, const half *a,
                                    std::int64_t lda, const half *b, std::int64_t ldb, half beta,
                                    half *c, std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    transpose transa, transpose transb, std::int64_t m,
                                    std::int64_t n, std::int64_t k, float alpha, const half *a,
                                    std::int64_t lda, const half *b, std::int64_t ldb, float beta,
                                    float *c, std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    transpose transa, transpose transb, std::int64_t m,
                                    std::int64_t n, std::int64_t k, float alpha, const bfloat16 *a,
                                    std::int64_t lda, const bfloat16 *b, std::int64_t ldb,
                                    float beta, float *c, std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event gemm_bias(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm_bias(detail::backend_ref libkey, cl::sycl::queue &queue,
                                         transpose transa, transpose transb, offset offsetc,
                                         int64_t m, int64_t n, int64_t k, float alpha,
                                         const std::int8_t *a, int64_t lda, std::int8_t ao,
@@ -1727,11 +1812,11 @@ ONEMKL_EXPORT cl::sycl::event gemm_bias(oneapi::mkl::device libkey, cl::sycl::qu
                                         const std::int32_t *co,
                                         const std::vector<cl::sycl::event> &dependencies = {});
 ONEMKL_EXPORT cl::sycl::event gemm_bias(
-    oneapi::mkl::device libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
     offset offsetc, int64_t m, int64_t n, int64_t k, float alpha, const std::int8_t *a, int64_t lda,
     std::int8_t ao, const std::int8_t *b, int64_t ldb, std::int8_t bo, float beta, std::int32_t *c,
     int64_t ldc, const std::int32_t *co, const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemm_bias(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm_bias(detail::backend_ref libkey, cl::sycl::queue &queue,
                                         transpose transa, transpose transb, offset offsetc,
                                         int64_t m, int64_t n, int64_t k, float alpha,
                                         const std::uint8_t *a, int64_t lda, std::uint8_t ao,
@@ -1739,7 +1824,7 @@ ONEMKL_EXPORT cl::sycl::event gemm_bias(oneapi::mkl::device libkey, cl::sycl::qu
                                         float beta, std::int32_t *c, int64_t ldc,
                                         const std::int32_t *co,
                                         const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gemm_bias(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm_bias(detail::backend_ref libkey, cl::sycl::queue &queue,
                                         transpose transa, transpose transb, offset offsetc,
                                         int64_t m, int64_t n, int64_t k, float alpha,
                                         const std::uint8_t *a, int64_t lda, std::uint8_t ao,
@@ -1748,97 +1833,129 @@ ONEMKL_EXPORT cl::sycl::event gemm_bias(oneapi::mkl::device libkey, cl::sycl::qu
                                         const std::int32_t *co,
                                         const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gemm_pack(
+    detail::backend_ref libkey, cl::sycl::queue &queue, identifier which, transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *src, std::int64_t ld,
+    float *dest, const std::vector<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm_pack(
+    detail::backend_ref libkey, cl::sycl::queue &queue, identifier which, transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *src,
+    std::int64_t ld, double *dest, const std::vector<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm_compute(
+    detail::backend_ref libkey, cl::sycl::queue &queue, identifier which, transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, const float *packed, const float *other,
+    std::int64_t ld, float beta, float *c, std::int64_t ldc,
+    const std::vector<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm_compute(
+    detail::backend_ref libkey, cl::sycl::queue &queue, identifier which, transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, const double *packed, const double *other,
+    std::int64_t ld, double beta, double *c, std::int64_t ldc,
+    const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event gemm3m(
+    detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+    std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+    const std::vector<cl::sycl::event> &dependencies = {});
+ONEMKL_EXPORT cl::sycl::event gemm3m(
+    detail::backend_ref libkey, cl::sycl::queue &queue, transpose transa, transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+    std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+    const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event syr2(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, float alpha, const float *x,
                                    std::int64_t incx, const float *y, std::int64_t incy, float *a,
                                    std::int64_t lda,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event syr2(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syr2(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, double alpha, const double *x,
                                    std::int64_t incx, const double *y, std::int64_t incy, double *a,
                                    std::int64_t lda,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event ger(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event ger(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   std::int64_t m, std::int64_t n, float alpha, const float *x,
                                   std::int64_t incx, const float *y, std::int64_t incy, float *a,
                                   std::int64_t lda,
                                   const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event ger(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event ger(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   std::int64_t m, std::int64_t n, double alpha, const double *x,
                                   std::int64_t incx, const double *y, std::int64_t incy, double *a,
                                   std::int64_t lda,
                                   const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    side left_right, uplo upper_lower, transpose trans,
                                    diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
                                    const float *a, std::int64_t lda, float *b, std::int64_t ldb,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    side left_right, uplo upper_lower, transpose trans,
                                    diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
                                    const double *a, std::int64_t lda, double *b, std::int64_t ldb,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    side left_right, uplo upper_lower, transpose trans,
                                    diag unit_diag, std::int64_t m, std::int64_t n,
                                    std::complex<float> alpha, const std::complex<float> *a,
                                    std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trsm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    side left_right, uplo upper_lower, transpose trans,
                                    diag unit_diag, std::int64_t m, std::int64_t n,
                                    std::complex<double> alpha, const std::complex<double> *a,
                                    std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side left_right, uplo upper_lower, transpose trans,
                                          diag unit_diag, int64_t m, int64_t n, float alpha,
                                          const float *a, int64_t lda, int64_t stride_a, float *b,
                                          int64_t ldb, int64_t stride_b, int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side left_right, uplo upper_lower, transpose trans,
                                          diag unit_diag, int64_t m, int64_t n, double alpha,
                                          const double *a, int64_t lda, int64_t stride_a, double *b,
                                          int64_t ldb, int64_t stride_b, int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side left_right, uplo upper_lower, transpose trans,
                                          diag unit_diag, int64_t m, int64_t n,
                                          std::complex<float> alpha, const std::complex<float> *a,
                                          int64_t lda, int64_t stride_a, std::complex<float> *b,
                                          int64_t ldb, int64_t stride_b, int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side left_right, uplo upper_lower, transpose trans,
                                          diag unit_diag, int64_t m, int64_t n,
                                          std::complex<double> alpha, const std::complex<double> *a,
                                          int64_t lda, int64_t stride_a, std::complex<double> *b,
                                          int64_t ldb, int64_t stride_b, int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side *left_right, uplo *upper_lower, transpose *trans,
                                          diag *unit_diag, int64_t *m, int64_t *n, float *alpha,
                                          const float **a, int64_t *lda, float **b, int64_t *ldb,
                                          int64_t group_count, int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side *left_right, uplo *upper_lower, transpose *trans,
                                          diag *unit_diag, int64_t *m, int64_t *n, double *alpha,
                                          const double **a, int64_t *lda, double **b, int64_t *ldb,
                                          int64_t group_count, int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side *left_right, uplo *upper_lower, transpose *trans,
                                          diag *unit_diag, int64_t *m, int64_t *n,
                                          std::complex<float> *alpha, const std::complex<float> **a,
                                          int64_t *lda, std::complex<float> **b, int64_t *ldb,
                                          int64_t group_count, int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trsm_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsm_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          side *left_right, uplo *upper_lower, transpose *trans,
                                          diag *unit_diag, int64_t *m, int64_t *n,
                                          std::complex<double> *alpha,
@@ -1847,18 +1964,18 @@ ONEMKL_EXPORT cl::sycl::event trsm_batch(oneapi::mkl::device libkey, cl::sycl::q
                                          int64_t group_count, int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event dotu(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const std::complex<float> *x, std::int64_t incx,
                                    const std::complex<float> *y, std::int64_t incy,
                                    std::complex<float> *result,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event dotu(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event dotu(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const std::complex<double> *x, std::int64_t incx,
                                    const std::complex<double> *y, std::int64_t incy,
                                    std::complex<double> *result,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event hemm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    side left_right, uplo upper_lower, std::int64_t m,
                                    std::int64_t n, std::complex<float> alpha,
                                    const std::complex<float> *a, std::int64_t lda,
@@ -1866,7 +1983,7 @@ ONEMKL_EXPORT cl::sycl::event hemm(oneapi::mkl::device libkey, cl::sycl::queue &
                                    std::complex<float> beta, std::complex<float> *c,
                                    std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event hemm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event hemm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    side left_right, uplo upper_lower, std::int64_t m,
                                    std::int64_t n, std::complex<double> alpha,
                                    const std::complex<double> *a, std::int64_t lda,
@@ -1875,32 +1992,32 @@ ONEMKL_EXPORT cl::sycl::event hemm(oneapi::mkl::device libkey, cl::sycl::queue &
                                    std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event hpr2(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, std::complex<float> alpha,
                                    const std::complex<float> *x, std::int64_t incx,
                                    const std::complex<float> *y, std::int64_t incy,
                                    std::complex<float> *a,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event hpr2(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event hpr2(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, std::complex<double> alpha,
                                    const std::complex<double> *x, std::int64_t incx,
                                    const std::complex<double> *y, std::int64_t incy,
                                    std::complex<double> *a,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gbmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl,
                                    std::int64_t ku, float alpha, const float *a, std::int64_t lda,
                                    const float *x, std::int64_t incx, float beta, float *y,
                                    std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gbmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl,
                                    std::int64_t ku, double alpha, const double *a, std::int64_t lda,
                                    const double *x, std::int64_t incx, double beta, double *y,
                                    std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gbmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl,
                                    std::int64_t ku, std::complex<float> alpha,
                                    const std::complex<float> *a, std::int64_t lda,
@@ -1908,7 +2025,7 @@ ONEMKL_EXPORT cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &
                                    std::complex<float> beta, std::complex<float> *y,
                                    std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event gbmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    transpose trans, std::int64_t m, std::int64_t n, std::int64_t kl,
                                    std::int64_t ku, std::complex<double> alpha,
                                    const std::complex<double> *a, std::int64_t lda,
@@ -1917,40 +2034,40 @@ ONEMKL_EXPORT cl::sycl::event gbmv(oneapi::mkl::device libkey, cl::sycl::queue &
                                    std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tbmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, std::int64_t k, const float *a, std::int64_t lda,
                                    float *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tbmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, std::int64_t k, const double *a,
                                    std::int64_t lda, double *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tbmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, std::int64_t k, const std::complex<float> *a,
                                    std::int64_t lda, std::complex<float> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event tbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tbmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, std::int64_t k, const std::complex<double> *a,
                                    std::int64_t lda, std::complex<double> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event symm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    side left_right, uplo upper_lower, std::int64_t m,
                                    std::int64_t n, float alpha, const float *a, std::int64_t lda,
                                    const float *b, std::int64_t ldb, float beta, float *c,
                                    std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event symm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    side left_right, uplo upper_lower, std::int64_t m,
                                    std::int64_t n, double alpha, const double *a, std::int64_t lda,
                                    const double *b, std::int64_t ldb, double beta, double *c,
                                    std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event symm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    side left_right, uplo upper_lower, std::int64_t m,
                                    std::int64_t n, std::complex<float> alpha,
                                    const std::complex<float> *a, std::int64_t lda,
@@ -1958,7 +2075,7 @@ ONEMKL_EXPORT cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &
                                    std::complex<float> beta, std::complex<float> *c,
                                    std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event symm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    side left_right, uplo upper_lower, std::int64_t m,
                                    std::int64_t n, std::complex<double> alpha,
                                    const std::complex<double> *a, std::int64_t lda,
@@ -1967,171 +2084,171 @@ ONEMKL_EXPORT cl::sycl::event symm(oneapi::mkl::device libkey, cl::sycl::queue &
                                    std::int64_t ldc,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event dotc(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const std::complex<float> *x, std::int64_t incx,
                                    const std::complex<float> *y, std::int64_t incy,
                                    std::complex<float> *result,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event dotc(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event dotc(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const std::complex<double> *x, std::int64_t incx,
                                    const std::complex<double> *y, std::int64_t incy,
                                    std::complex<double> *result,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event syr(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syr(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   uplo upper_lower, std::int64_t n, float alpha, const float *x,
                                   std::int64_t incx, float *a, std::int64_t lda,
                                   const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event syr(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event syr(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   uplo upper_lower, std::int64_t n, double alpha, const double *x,
                                   std::int64_t incx, double *a, std::int64_t lda,
                                   const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trmm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    side left_right, uplo upper_lower, transpose trans,
                                    diag unit_diag, std::int64_t m, std::int64_t n, float alpha,
                                    const float *a, std::int64_t lda, float *b, std::int64_t ldb,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trmm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    side left_right, uplo upper_lower, transpose trans,
                                    diag unit_diag, std::int64_t m, std::int64_t n, double alpha,
                                    const double *a, std::int64_t lda, double *b, std::int64_t ldb,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trmm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    side left_right, uplo upper_lower, transpose trans,
                                    diag unit_diag, std::int64_t m, std::int64_t n,
                                    std::complex<float> alpha, const std::complex<float> *a,
                                    std::int64_t lda, std::complex<float> *b, std::int64_t ldb,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trmm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trmm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    side left_right, uplo upper_lower, transpose trans,
                                    diag unit_diag, std::int64_t m, std::int64_t n,
                                    std::complex<double> alpha, const std::complex<double> *a,
                                    std::int64_t lda, std::complex<double> *b, std::int64_t ldb,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event symv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event symv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, float alpha, const float *a,
                                    std::int64_t lda, const float *x, std::int64_t incx, float beta,
                                    float *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event symv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event symv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, double alpha, const double *a,
                                    std::int64_t lda, const double *x, std::int64_t incx,
                                    double beta, double *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tpsv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const float *a, float *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tpsv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const double *a, double *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tpsv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const std::complex<float> *a,
                                    std::complex<float> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event tpsv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tpsv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const std::complex<double> *a,
                                    std::complex<double> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const float *a, std::int64_t lda, float *x,
                                    std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const double *a, std::int64_t lda, double *x,
                                    std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const std::complex<float> *a, std::int64_t lda,
                                    std::complex<float> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event trsv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event trsv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, const std::complex<double> *a, std::int64_t lda,
                                    std::complex<double> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event copy(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const float *x, std::int64_t incx, float *y,
                                    std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event copy(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const double *x, std::int64_t incx, double *y,
                                    std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event copy(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const std::complex<float> *x, std::int64_t incx,
                                    std::complex<float> *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event copy(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event copy(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const std::complex<double> *x, std::int64_t incx,
                                    std::complex<double> *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event copy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event copy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t *n, const float **x, std::int64_t *incx,
                                          float **y, std::int64_t *incy, int64_t group_count,
                                          int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event copy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event copy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t *n, const double **x, std::int64_t *incx,
                                          double **y, std::int64_t *incy, int64_t group_count,
                                          int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event copy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event copy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t *n, const std::complex<float> **x,
                                          std::int64_t *incx, std::complex<float> **y,
                                          std::int64_t *incy, int64_t group_count,
                                          int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event copy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event copy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t *n, const std::complex<double> **x,
                                          std::int64_t *incx, std::complex<double> **y,
                                          std::int64_t *incy, int64_t group_count,
                                          int64_t *group_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event copy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event copy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t n, const float *x, std::int64_t incx,
                                          std::int64_t stridex, float *y, std::int64_t incy,
                                          std::int64_t stridey, std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event copy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event copy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t n, const double *x, std::int64_t incx,
                                          std::int64_t stridex, double *y, std::int64_t incy,
                                          std::int64_t stridey, std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event copy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event copy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t n, const std::complex<float> *x,
                                          std::int64_t incx, std::int64_t stridex,
                                          std::complex<float> *y, std::int64_t incy,
                                          std::int64_t stridey, std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event copy_batch(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event copy_batch(detail::backend_ref libkey, cl::sycl::queue &queue,
                                          std::int64_t n, const std::complex<double> *x,
                                          std::int64_t incx, std::int64_t stridex,
                                          std::complex<double> *y, std::int64_t incy,
                                          std::int64_t stridey, std::int64_t batch_size,
                                          const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event hemv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, std::complex<float> alpha,
                                    const std::complex<float> *a, std::int64_t lda,
                                    const std::complex<float> *x, std::int64_t incx,
                                    std::complex<float> beta, std::complex<float> *y,
                                    std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event hemv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event hemv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, std::complex<double> alpha,
                                    const std::complex<double> *a, std::int64_t lda,
                                    const std::complex<double> *x, std::int64_t incx,
@@ -2139,115 +2256,115 @@ ONEMKL_EXPORT cl::sycl::event hemv(oneapi::mkl::device libkey, cl::sycl::queue &
                                    std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event iamax(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     std::int64_t n, const float *x, std::int64_t incx,
                                     std::int64_t *result,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event iamax(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     std::int64_t n, const double *x, std::int64_t incx,
                                     std::int64_t *result,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event iamax(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     std::int64_t n, const std::complex<float> *x, std::int64_t incx,
                                     std::int64_t *result,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event iamax(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event iamax(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     std::int64_t n, const std::complex<double> *x,
                                     std::int64_t incx, std::int64_t *result,
                                     const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event sbmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, std::int64_t k, float alpha,
                                    const float *a, std::int64_t lda, const float *x,
                                    std::int64_t incx, float beta, float *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event sbmv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event sbmv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, std::int64_t k, double alpha,
                                    const double *a, std::int64_t lda, const double *x,
                                    std::int64_t incx, double beta, double *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event asum(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const std::complex<float> *x, std::int64_t incx,
                                    float *result,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event asum(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const std::complex<double> *x, std::int64_t incx,
                                    double *result,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event asum(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const float *x, std::int64_t incx, float *result,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event asum(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event asum(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, const double *x, std::int64_t incx,
                                    double *result,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tbsv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, std::int64_t k, const float *a, std::int64_t lda,
                                    float *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tbsv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, std::int64_t k, const double *a,
                                    std::int64_t lda, double *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tbsv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, std::int64_t k, const std::complex<float> *a,
                                    std::int64_t lda, std::complex<float> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event tbsv(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event tbsv(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, transpose trans, diag unit_diag,
                                    std::int64_t n, std::int64_t k, const std::complex<double> *a,
                                    std::int64_t lda, std::complex<double> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event spr2(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, float alpha, const float *x,
                                    std::int64_t incx, const float *y, std::int64_t incy, float *a,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event spr2(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event spr2(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    uplo upper_lower, std::int64_t n, double alpha, const double *x,
                                    std::int64_t incx, const double *y, std::int64_t incy, double *a,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event rotm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, float *x, std::int64_t incx, float *y,
                                    std::int64_t incy, float *param,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event rotm(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event rotm(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::int64_t n, double *x, std::int64_t incx, double *y,
                                    std::int64_t incy, double *param,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event dot(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event dot(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   std::int64_t n, const float *x, std::int64_t incx, const float *y,
                                   std::int64_t incy, float *result,
                                   const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event dot(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event dot(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   std::int64_t n, const double *x, std::int64_t incx,
                                   const double *y, std::int64_t incy, double *result,
                                   const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event dot(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event dot(detail::backend_ref libkey, cl::sycl::queue &queue,
                                   std::int64_t n, const float *x, std::int64_t incx, const float *y,
                                   std::int64_t incy, double *result,
                                   const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event sdsdot(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event sdsdot(detail::backend_ref libkey, cl::sycl::queue &queue,
                                      std::int64_t n, float sb, const float *x, std::int64_t incx,
                                      const float *y, std::int64_t incy, float *result,
                                      const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event her2k(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     uplo upper_lower, transpose trans, std::int64_t n,
                                     std::int64_t k, std::complex<float> alpha,
                                     const std::complex<float> *a, std::int64_t lda,
                                     const std::complex<float> *b, std::int64_t ldb, float beta,
                                     std::complex<float> *c, std::int64_t ldc,
                                     const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event her2k(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event her2k(detail::backend_ref libkey, cl::sycl::queue &queue,
                                     uplo upper_lower, transpose trans, std::int64_t n,
                                     std::int64_t k, std::complex<double> alpha,
                                     const std::complex<double> *a, std::int64_t lda,
@@ -2255,17 +2372,17 @@ ONEMKL_EXPORT cl::sycl::event her2k(oneapi::mkl::device libkey, cl::sycl::queue
                                     std::complex<double> *c, std::int64_t ldc,
                                     const std::vector<cl::sycl::event> &dependencies = {});
 
-ONEMKL_EXPORT cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, float *a,
+ONEMKL_EXPORT cl::sycl::event rotg(detail::backend_ref libkey, cl::sycl::queue &queue, float *a,
                                    float *b, float *c, float *s,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue, double *a,
+ONEMKL_EXPORT cl::sycl::event rotg(detail::backend_ref libkey, cl::sycl::queue &queue, double *a,
                                    double *b, double *c, double *s,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event rotg(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::complex<float> *a, std::complex<float> *b, float *c,
                                    std::complex<float> *s,
                                    const std::vector<cl::sycl::event> &dependencies = {});
-ONEMKL_EXPORT cl::sycl::event rotg(oneapi::mkl::device libkey, cl::sycl::queue &queue,
+ONEMKL_EXPORT cl::sycl::event rotg(detail::backend_ref libkey, cl::sycl::queue &queue,
                                    std::complex<double> *a, std::complex<double> *b, double *c,
                                    std::complex<double> *s,
                                    const std::vector<cl::sycl::event> &dependencies = {});
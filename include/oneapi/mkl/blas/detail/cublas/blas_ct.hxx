@@ -928,6 +928,83 @@ void gemm_bias(backend_selector<backend::cublas> selector, transpose transa, tra
                             ao, b, ldb, bo, beta, c, ldc, co);
 }
 
+template <typename T>
+std::int64_t gemm_pack_get_size(backend_selector<backend::cublas> selector, identifier which,
+                                std::int64_t m, std::int64_t n, std::int64_t k) {
+    return oneapi::mkl::blas::cublas::MAJOR::gemm_pack_get_size<T>(selector.get_queue(), which, m,
+                                                                   n, k);
+}
+
+void gemm_pack(backend_selector<backend::cublas> selector, identifier which, transpose trans,
+               std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+               cl::sycl::buffer<float, 1> &src, std::int64_t ld, cl::sycl::buffer<float, 1> &dest) {
+    gemm_pack_precondition(selector.get_queue(), which, trans, m, n, k, alpha, src, ld, dest);
+    oneapi::mkl::blas::cublas::MAJOR::gemm_pack(selector.get_queue(), which, trans, m, n, k, alpha,
+                                                src, ld, dest);
+    gemm_pack_postcondition(selector.get_queue(), which, trans, m, n, k, alpha, src, ld, dest);
+}
+
+void gemm_pack(backend_selector<backend::cublas> selector, identifier which, transpose trans,
+               std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+               cl::sycl::buffer<double, 1> &src, std::int64_t ld,
+               cl::sycl::buffer<double, 1> &dest) {
+    gemm_pack_precondition(selector.get_queue(), which, trans, m, n, k, alpha, src, ld, dest);
+    oneapi::mkl::blas::cublas::MAJOR::gemm_pack(selector.get_queue(), which, trans, m, n, k, alpha,
+                                                src, ld, dest);
+    gemm_pack_postcondition(selector.get_queue(), which, trans, m, n, k, alpha, src, ld, dest);
+}
+
+void gemm_compute(backend_selector<backend::cublas> selector, identifier which, transpose trans,
+                  std::int64_t m, std::int64_t n, std::int64_t k,
+                  cl::sycl::buffer<float, 1> &packed, cl::sycl::buffer<float, 1> &other,
+                  std::int64_t ld, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+    gemm_compute_precondition(selector.get_queue(), which, trans, m, n, k, packed, other, ld, beta,
+                              c, ldc);
+    oneapi::mkl::blas::cublas::MAJOR::gemm_compute(selector.get_queue(), which, trans, m, n, k,
+                                                   packed, other, ld, beta, c, ldc);
+    gemm_compute_postcondition(selector.get_queue(), which, trans, m, n, k, packed, other, ld, beta,
+                               c, ldc);
+}
+
+void gemm_compute(backend_selector<backend::cublas> selector, identifier which, transpose trans,
+                  std::int64_t m, std::int64_t n, std::int64_t k,
+                  cl::sycl::buffer<double, 1> &packed, cl::sycl::buffer<double, 1> &other,
+                  std::int64_t ld, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+    gemm_compute_precondition(selector.get_queue(), which, trans, m, n, k, packed, other, ld, beta,
+                              c, ldc);
+    oneapi::mkl::blas::cublas::MAJOR::gemm_compute(selector.get_queue(), which, trans, m, n, k,
+                                                   packed, other, ld, beta, c, ldc);
+    gemm_compute_postcondition(selector.get_queue(), which, trans, m, n, k, packed, other, ld, beta,
+                               c, ldc);
+}
+
+void gemm3m(backend_selector<backend::cublas> selector, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+    gemm3m_precondition(selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                        c, ldc);
+    oneapi::mkl::blas::cublas::MAJOR::gemm3m(selector.get_queue(), transa, transb, m, n, k, alpha,
+                                             a, lda, b, ldb, beta, c, ldc);
+    gemm3m_postcondition(selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                         c, ldc);
+}
+
+void gemm3m(backend_selector<backend::cublas> selector, transpose transa, transpose transb,
+            std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+            cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c,
+            std::int64_t ldc) {
+    gemm3m_precondition(selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                        c, ldc);
+    oneapi::mkl::blas::cublas::MAJOR::gemm3m(selector.get_queue(), transa, transb, m, n, k, alpha,
+                                             a, lda, b, ldb, beta, c, ldc);
+    gemm3m_postcondition(selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                         c, ldc);
+}
+
 void swap(backend_selector<backend::cublas> selector, std::int64_t n, cl::sycl::buffer<float, 1> &x,
           std::int64_t incx, cl::sycl::buffer<float, 1> &y, std::int64_t incy) {
     swap_precondition(selector.get_queue(), n, x, incx, y, incy);
@@ -2111,6 +2188,71 @@ cl::sycl::event scal(backend_selector<backend::cublas> selector, std::int64_t n,
     return done;
 }
 
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, float>>
+cl::sycl::event scal(backend_selector<backend::cublas> selector, std::int64_t n, Ta alpha, float *x,
+                     std::int64_t incx, const std::vector<cl::sycl::event> &dependencies) {
+    scal_precondition(selector.get_queue(), n, alpha, x, incx, dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::scal(selector.get_queue(), n, alpha, x, incx,
+                                                       dependencies);
+    scal_postcondition(selector.get_queue(), n, alpha, x, incx, dependencies);
+    return done;
+}
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, double>>
+cl::sycl::event scal(backend_selector<backend::cublas> selector, std::int64_t n, Ta alpha,
+                     double *x, std::int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    scal_precondition(selector.get_queue(), n, alpha, x, incx, dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::scal(selector.get_queue(), n, alpha, x, incx,
+                                                       dependencies);
+    scal_postcondition(selector.get_queue(), n, alpha, x, incx, dependencies);
+    return done;
+}
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, std::complex<float>>>
+cl::sycl::event scal(backend_selector<backend::cublas> selector, std::int64_t n, Ta alpha,
+                     std::complex<float> *x, std::int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    scal_precondition(selector.get_queue(), n, alpha, x, incx, dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::scal(selector.get_queue(), n, alpha, x, incx,
+                                                       dependencies);
+    scal_postcondition(selector.get_queue(), n, alpha, x, incx, dependencies);
+    return done;
+}
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, float>>
+cl::sycl::event scal(backend_selector<backend::cublas> selector, std::int64_t n, Ta alpha,
+                     std::complex<float> *x, std::int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    scal_precondition(selector.get_queue(), n, alpha, x, incx, dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::scal(selector.get_queue(), n, alpha, x, incx,
+                                                       dependencies);
+    scal_postcondition(selector.get_queue(), n, alpha, x, incx, dependencies);
+    return done;
+}
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, std::complex<double>>>
+cl::sycl::event scal(backend_selector<backend::cublas> selector, std::int64_t n, Ta alpha,
+                     std::complex<double> *x, std::int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    scal_precondition(selector.get_queue(), n, alpha, x, incx, dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::scal(selector.get_queue(), n, alpha, x, incx,
+                                                       dependencies);
+    scal_postcondition(selector.get_queue(), n, alpha, x, incx, dependencies);
+    return done;
+}
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, double>>
+cl::sycl::event scal(backend_selector<backend::cublas> selector, std::int64_t n, Ta alpha,
+                     std::complex<double> *x, std::int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    scal_precondition(selector.get_queue(), n, alpha, x, incx, dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::scal(selector.get_queue(), n, alpha, x, incx,
+                                                       dependencies);
+    scal_postcondition(selector.get_queue(), n, alpha, x, incx, dependencies);
+    return done;
+}
+
 cl::sycl::event trmv(backend_selector<backend::cublas> selector, uplo upper_lower, transpose trans,
                      diag unit_diag, std::int64_t n, const float *a, std::int64_t lda, float *x,
                      std::int64_t incx, const std::vector<cl::sycl::event> &dependencies) {
@@ -2581,6 +2723,50 @@ cl::sycl::event axpy(backend_selector<backend::cublas> selector, std::int64_t n,
     return done;
 }
 
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, float>>
+cl::sycl::event axpy(backend_selector<backend::cublas> selector, std::int64_t n, Ta alpha,
+                     const float *x, std::int64_t incx, float *y, std::int64_t incy,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    axpy_precondition(selector.get_queue(), n, alpha, x, incx, y, incy, dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::axpy(selector.get_queue(), n, alpha, x, incx, y,
+                                                       incy, dependencies);
+    axpy_postcondition(selector.get_queue(), n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, double>>
+cl::sycl::event axpy(backend_selector<backend::cublas> selector, std::int64_t n, Ta alpha,
+                     const double *x, std::int64_t incx, double *y, std::int64_t incy,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    axpy_precondition(selector.get_queue(), n, alpha, x, incx, y, incy, dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::axpy(selector.get_queue(), n, alpha, x, incx, y,
+                                                       incy, dependencies);
+    axpy_postcondition(selector.get_queue(), n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, std::complex<float>>>
+cl::sycl::event axpy(backend_selector<backend::cublas> selector, std::int64_t n, Ta alpha,
+                     const std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
+                     std::int64_t incy, const std::vector<cl::sycl::event> &dependencies) {
+    axpy_precondition(selector.get_queue(), n, alpha, x, incx, y, incy, dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::axpy(selector.get_queue(), n, alpha, x, incx, y,
+                                                       incy, dependencies);
+    axpy_postcondition(selector.get_queue(), n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
+template <typename Ta, oneapi::mkl::blas::detail::is_pointer_to<Ta, std::complex<double>>>
+cl::sycl::event axpy(backend_selector<backend::cublas> selector, std::int64_t n, Ta alpha,
+                     const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
+                     std::int64_t incy, const std::vector<cl::sycl::event> &dependencies) {
+    axpy_precondition(selector.get_queue(), n, alpha, x, incx, y, incy, dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::axpy(selector.get_queue(), n, alpha, x, incx, y,
+                                                       incy, dependencies);
+    axpy_postcondition(selector.get_queue(), n, alpha, x, incx, y, incy, dependencies);
+    return done;
+}
+
 cl::sycl::event axpy_batch(backend_selector<backend::cublas> selector, std::int64_t *n,
                            float *alpha, const float **x, std::int64_t *incx, float **y,
                            std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
@@ -3671,6 +3857,88 @@ cl::sycl::event gemm_bias(backend_selector<backend::cublas> selector, transpose
     return done;
 }
 
+cl::sycl::event gemm_pack(backend_selector<backend::cublas> selector, identifier which,
+                          transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                          float alpha, const float *src, std::int64_t ld, float *dest,
+                          const std::vector<cl::sycl::event> &dependencies) {
+    gemm_pack_precondition(selector.get_queue(), which, trans, m, n, k, alpha, src, ld, dest,
+                           dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::gemm_pack(
+        selector.get_queue(), which, trans, m, n, k, alpha, src, ld, dest, dependencies);
+    gemm_pack_postcondition(selector.get_queue(), which, trans, m, n, k, alpha, src, ld, dest,
+                            dependencies);
+    return done;
+}
+
+cl::sycl::event gemm_pack(backend_selector<backend::cublas> selector, identifier which,
+                          transpose trans, std::int64_t m, std::int64_t n, std::int64_t k,
+                          double alpha, const double *src, std::int64_t ld, double *dest,
+                          const std::vector<cl::sycl::event> &dependencies) {
+    gemm_pack_precondition(selector.get_queue(), which, trans, m, n, k, alpha, src, ld, dest,
+                           dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::gemm_pack(
+        selector.get_queue(), which, trans, m, n, k, alpha, src, ld, dest, dependencies);
+    gemm_pack_postcondition(selector.get_queue(), which, trans, m, n, k, alpha, src, ld, dest,
+                            dependencies);
+    return done;
+}
+
+cl::sycl::event gemm_compute(
+    backend_selector<backend::cublas> selector, identifier which, transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t k, const float *packed, const float *other, std::int64_t ld,
+    float beta, float *c, std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+    gemm_compute_precondition(selector.get_queue(), which, trans, m, n, k, packed, other, ld, beta,
+                              c, ldc, dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::gemm_compute(
+        selector.get_queue(), which, trans, m, n, k, packed, other, ld, beta, c, ldc, dependencies);
+    gemm_compute_postcondition(selector.get_queue(), which, trans, m, n, k, packed, other, ld, beta,
+                               c, ldc, dependencies);
+    return done;
+}
+
+cl::sycl::event gemm_compute(
+    backend_selector<backend::cublas> selector, identifier which, transpose trans, std::int64_t m,
+    std::int64_t n, std::int64_t k, const double *packed, const double *other, std::int64_t ld,
+    double beta, double *c, std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+    gemm_compute_precondition(selector.get_queue(), which, trans, m, n, k, packed, other, ld, beta,
+                              c, ldc, dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::gemm_compute(
+        selector.get_queue(), which, trans, m, n, k, packed, other, ld, beta, c, ldc, dependencies);
+    gemm_compute_postcondition(selector.get_queue(), which, trans, m, n, k, packed, other, ld, beta,
+                               c, ldc, dependencies);
+    return done;
+}
+
+cl::sycl::event gemm3m(
+    backend_selector<backend::cublas> selector, transpose transa, transpose transb, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::complex<float> alpha, const std::complex<float> *a,
+    std::int64_t lda, const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+    std::complex<float> *c, std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+    gemm3m_precondition(selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                        c, ldc, dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::gemm3m(selector.get_queue(), transa, transb, m, n,
+                                                         k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                                         dependencies);
+    gemm3m_postcondition(selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                         c, ldc, dependencies);
+    return done;
+}
+
+cl::sycl::event gemm3m(
+    backend_selector<backend::cublas> selector, transpose transa, transpose transb, std::int64_t m,
+    std::int64_t n, std::int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+    std::int64_t lda, const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+    std::complex<double> *c, std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+    gemm3m_precondition(selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                        c, ldc, dependencies);
+    auto done = oneapi::mkl::blas::cublas::MAJOR::gemm3m(selector.get_queue(), transa, transb, m, n,
+                                                         k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                                         dependencies);
+    gemm3m_postcondition(selector.get_queue(), transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                         c, ldc, dependencies);
+    return done;
+}
+
 cl::sycl::event herk(backend_selector<backend::cublas> selector, uplo upper_lower, transpose trans,
                      std::int64_t n, std::int64_t k, float alpha, const std::complex<float> *a,
                      std::int64_t lda, float beta, std::complex<float> *c, std::int64_t ldc,
@@ -874,6 +874,48 @@ void gemm_bias(cl::sycl::queue &queue, transpose transa, transpose transb, offse
                cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo, float beta,
                cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co);
 
+template <typename T>
+std::int64_t gemm_pack_get_size(cl::sycl::queue &queue, identifier which, std::int64_t m,
+                                std::int64_t n, std::int64_t k);
+
+template <>
+std::int64_t gemm_pack_get_size<float>(cl::sycl::queue &queue, identifier which, std::int64_t m,
+                                       std::int64_t n, std::int64_t k);
+
+template <>
+std::int64_t gemm_pack_get_size<double>(cl::sycl::queue &queue, identifier which, std::int64_t m,
+                                        std::int64_t n, std::int64_t k);
+
+void gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m,
+               std::int64_t n, std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &src,
+               std::int64_t ld, cl::sycl::buffer<float, 1> &dest);
+
+void gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m,
+               std::int64_t n, std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &src,
+               std::int64_t ld, cl::sycl::buffer<double, 1> &dest);
+
+void gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m,
+                  std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &packed,
+                  cl::sycl::buffer<float, 1> &other, std::int64_t ld, float beta,
+                  cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+
+void gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m,
+                  std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &packed,
+                  cl::sycl::buffer<double, 1> &other, std::int64_t ld, double beta,
+                  cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+
+void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+            std::int64_t n, std::int64_t k, std::complex<float> alpha,
+            cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+            cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+            cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+
+void gemm3m(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+    std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+
 // USM APIs
 
 cl::sycl::event asum(cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *x,
@@ -906,6 +948,22 @@ cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<double
                      const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
                      std::int64_t incy, const std::vector<cl::sycl::event> &dependencies = {});
 
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const float *alpha, const float *x,
+                     std::int64_t incx, float *y, std::int64_t incy,
+                     const std::vector<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const double *alpha, const double *x,
+                     std::int64_t incx, double *y, std::int64_t incy,
+                     const std::vector<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+                     const std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
+                     std::int64_t incy, const std::vector<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+                     const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
+                     std::int64_t incy, const std::vector<cl::sycl::event> &dependencies = {});
+
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, std::int64_t *n, float *alpha, const float **x,
                            std::int64_t *incx, float **y, std::int64_t *incy,
                            std::int64_t group_count, std::int64_t *group_size,
@@ -1162,6 +1220,28 @@ cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, float alpha, std::c
 cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, double alpha, std::complex<double> *x,
                      std::int64_t incx, const std::vector<cl::sycl::event> &dependencies = {});
 
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const float *alpha, float *x,
+                     std::int64_t incx, const std::vector<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const double *alpha, double *x,
+                     std::int64_t incx, const std::vector<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+                     std::complex<float> *x, std::int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+                     std::complex<float> *x, std::int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+                     std::complex<double> *x, std::int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                     std::complex<double> *x, std::int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies = {});
+
 cl::sycl::event sdsdot(cl::sycl::queue &queue, std::int64_t n, float sb, const float *x,
                        std::int64_t incx, const float *y, std::int64_t incy, float *result,
                        const std::vector<cl::sycl::event> &dependencies = {});
@@ -2009,3 +2089,36 @@ cl::sycl::event gemm_bias(cl::sycl::queue &queue, transpose transa, transpose tr
                           const std::uint8_t *b, std::int64_t ldb, std::uint8_t bo, float beta,
                           std::int32_t *c, std::int64_t ldc, const std::int32_t *co,
                           const std::vector<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m,
+                          std::int64_t n, std::int64_t k, float alpha, const float *src,
+                          std::int64_t ld, float *dest,
+                          const std::vector<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m,
+                          std::int64_t n, std::int64_t k, double alpha, const double *src,
+                          std::int64_t ld, double *dest,
+                          const std::vector<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemm_compute(
+    cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, const float *packed, const float *other, std::int64_t ld, float beta, float *c,
+    std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemm_compute(
+    cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, const double *packed, const double *other, std::int64_t ld, double beta,
+    double *c, std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                       std::int64_t n, std::int64_t k, std::complex<float> alpha,
+                       const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+                       std::int64_t ldb, std::complex<float> beta, std::complex<float> *c,
+                       std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies = {});
+
+cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m,
+                       std::int64_t n, std::int64_t k, std::complex<double> alpha,
+                       const std::complex<double> *a, std::int64_t lda,
+                       const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+                       std::complex<double> *c, std::int64_t ldc,
+                       const std::vector<cl::sycl::event> &dependencies = {});
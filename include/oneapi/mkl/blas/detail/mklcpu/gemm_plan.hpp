@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_MKLCPU_GEMM_PLAN_HPP_
+#define _ONEMKL_BLAS_MKLCPU_GEMM_PLAN_HPP_
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "oneapi/mkl/detail/export.hpp"
+#include "oneapi/mkl/types.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace mklcpu {
+
+template <typename T>
+struct gemm_plan_kernels;
+
+// A gemm of one fixed shape, C = alpha * op(A) * op(B) + beta * C, prepared once and then run on
+// any number of matrices of that shape. Intended for small matrices, where the argument checking
+// and blocking of a regular gemm call cost more than the multiplication itself.
+//
+// The plan uses a kernel generated by the MKL JIT (mkl_jit_create_?gemm). When MKL cannot
+// generate one, shapes with m, n, k <= 32 use a compiled kernel specialized on the transposes
+// (and on m for multiples of 8), larger ones call cblas_?gemm. Running a plan only takes the three
+// matrix pointers and calls the kernel on the calling thread; the pointers must be accessible on
+// the host (host memory, or USM host or shared allocations). A plan can be run from several
+// threads at once. T is float or double.
+template <typename T>
+class gemm_plan : public std::enable_shared_from_this<gemm_plan<T>> {
+public:
+    // With jit false the plan does not try the MKL JIT and uses the compiled kernels directly.
+    gemm_plan(layout layout, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+              std::int64_t k, T alpha, std::int64_t lda, std::int64_t ldb, T beta,
+              std::int64_t ldc, bool jit = true);
+    ~gemm_plan();
+    gemm_plan(const gemm_plan &) = delete;
+    gemm_plan &operator=(const gemm_plan &) = delete;
+
+    // Largest number of plans kept by cached().
+    static constexpr std::size_t cache_capacity = 256;
+
+    // Returns a plan for the shape from a process-wide cache, creating it on first use. The cache
+    // keeps the cache_capacity most recently requested shapes and drops the least recently used
+    // plan beyond that; a dropped plan lives on while callers hold it. The lookup takes a lock;
+    // keep the pointer for repeated calls.
+    static std::shared_ptr<const gemm_plan> cached(layout layout, transpose transa,
+                                                   transpose transb, std::int64_t m,
+                                                   std::int64_t n, std::int64_t k, T alpha,
+                                                   std::int64_t lda, std::int64_t ldb, T beta,
+                                                   std::int64_t ldc);
+
+    void operator()(const T *a, const T *b, T *c) const {
+        if (jit_kernel_)
+            jit_kernel_(jitter_, const_cast<T *>(a), const_cast<T *>(b), c);
+        else
+            kernel_(shape_, a, b, c);
+    }
+
+    // Runs the plan in a host task of a CPU queue after dependencies. The host task holds a
+    // reference to a plan owned by a std::shared_ptr, such as those returned by cached(); any
+    // other plan must outlive the returned event.
+    cl::sycl::event operator()(cl::sycl::queue &queue, const T *a, const T *b, T *c,
+                               const std::vector<cl::sycl::event> &dependencies = {}) const;
+
+    // True if the plan runs a kernel generated by the MKL JIT.
+    bool is_jit() const {
+        return jit_kernel_ != nullptr;
+    }
+
+private:
+    friend struct gemm_plan_kernels<T>;
+
+    // Column major form of the product. Row major plans compute C^T = op(B)^T * op(A)^T, with the
+    // operands exchanged (swap_ab).
+    struct shape {
+        bool trans_a, trans_b, swap_ab;
+        std::int64_t m, n, k, lda, ldb, ldc;
+        T alpha, beta;
+    };
+
+    using jit_kernel_type = void (*)(void *, T *, T *, T *);
+    using kernel_type = void (*)(const shape &, const T *, const T *, T *);
+
+    void *jitter_ = nullptr;
+    jit_kernel_type jit_kernel_ = nullptr;
+    kernel_type kernel_ = nullptr;
+    shape shape_;
+};
+
+extern template class ONEMKL_EXPORT gemm_plan<float>;
+extern template class ONEMKL_EXPORT gemm_plan<double>;
+
+} // namespace mklcpu
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_MKLCPU_GEMM_PLAN_HPP_
@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_MKLCPU_LEVEL1_FUSION_HPP_
+#define _ONEMKL_BLAS_MKLCPU_LEVEL1_FUSION_HPP_
+
+#include <CL/sycl.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace mklcpu {
+
+// Defers USM level 1 calls on a CPU queue and runs them as one streaming pass over the vectors.
+//
+// Calls are only recorded. flush() submits everything recorded so far as a single host task that
+// walks the vectors in cache-sized chunks and applies each call to the chunk in recorded order, so
+// vectors shared by several calls are read from memory once. Reduction results are written when
+// the pass ends; wait on the event returned by flush() before reading them.
+//
+// A call that overlaps the vectors of a recorded call in a way that a chunked pass cannot
+// preserve (same memory at a different offset or stride, or a pending reduction result) flushes
+// the recorded calls first. Calls with non-positive increments are submitted directly to the
+// mklcpu backend after a flush. The destructor flushes and waits.
+class ONEMKL_EXPORT level1_fusion {
+public:
+    explicit level1_fusion(cl::sycl::queue &queue);
+    ~level1_fusion();
+    level1_fusion(const level1_fusion &) = delete;
+    level1_fusion &operator=(const level1_fusion &) = delete;
+
+    void axpy(std::int64_t n, float alpha, const float *x, std::int64_t incx, float *y,
+              std::int64_t incy);
+    void axpy(std::int64_t n, double alpha, const double *x, std::int64_t incx, double *y,
+              std::int64_t incy);
+
+    void axpby(std::int64_t n, float alpha, const float *x, std::int64_t incx, float beta,
+               float *y, std::int64_t incy);
+    void axpby(std::int64_t n, double alpha, const double *x, std::int64_t incx, double beta,
+               double *y, std::int64_t incy);
+
+    void scal(std::int64_t n, float alpha, float *x, std::int64_t incx);
+    void scal(std::int64_t n, double alpha, double *x, std::int64_t incx);
+
+    void copy(std::int64_t n, const float *x, std::int64_t incx, float *y, std::int64_t incy);
+    void copy(std::int64_t n, const double *x, std::int64_t incx, double *y, std::int64_t incy);
+
+    void dot(std::int64_t n, const float *x, std::int64_t incx, const float *y,
+             std::int64_t incy, float *result);
+    void dot(std::int64_t n, const double *x, std::int64_t incx, const double *y,
+             std::int64_t incy, double *result);
+
+    void nrm2(std::int64_t n, const float *x, std::int64_t incx, float *result);
+    void nrm2(std::int64_t n, const double *x, std::int64_t incx, double *result);
+
+    void asum(std::int64_t n, const float *x, std::int64_t incx, float *result);
+    void asum(std::int64_t n, const double *x, std::int64_t incx, double *result);
+
+    // Makes the next submission, explicit or caused by an overlapping call, wait for events.
+    // Submissions of this object are always ordered after the previous one.
+    void depends_on(const std::vector<cl::sycl::event> &events);
+
+    // Submits the recorded calls after dependencies and returns the event of the submission.
+    cl::sycl::event flush(const std::vector<cl::sycl::event> &dependencies = {});
+
+    // Number of calls recorded since the last flush.
+    std::size_t pending() const;
+
+private:
+    struct impl;
+    std::unique_ptr<impl> impl_;
+};
+
+} // namespace mklcpu
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_MKLCPU_LEVEL1_FUSION_HPP_
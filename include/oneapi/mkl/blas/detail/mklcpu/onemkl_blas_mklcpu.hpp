@@ -22,7 +22,9 @@
 #include <CL/sycl.hpp>
 #include <complex>
 #include <cstdint>
+#include <functional>
 #include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/detail/backend_selector.hpp"
 #include "oneapi/mkl/detail/export.hpp"
 
 namespace oneapi {
@@ -34,6 +36,42 @@ using oneapi::mkl::diag;
 using oneapi::mkl::offset;
 namespace blas {
 namespace mklcpu {
+
+// How concurrent host tasks of the backend share the threads of the MKL threading layer.
+enum class thread_policy : char {
+    // Every call may use all threads.
+    unrestricted = 0,
+    // The threads are divided evenly among the host tasks that run at the same time.
+    shared = 1,
+};
+
+// Exchanges the policy of the queue whose std::hash is queue_key and returns the previous one.
+// Queues without a policy use the one given by ONEMKL_MKLCPU_THREAD_POLICY (unrestricted or
+// shared), unrestricted by default.
+ONEMKL_EXPORT thread_policy exchange_thread_policy(std::size_t queue_key, thread_policy policy);
+ONEMKL_EXPORT thread_policy get_thread_policy(const cl::sycl::queue &queue);
+
+// Applies a policy to the calls submitted to a queue while the scope lives, and restores the
+// previous one when it ends. The queue is not kept alive by the scope, so it must outlive it. The
+// policy only has an effect when the backend is built with ENABLE_MKLCPU_THREAD_TBB.
+class thread_policy_scope {
+public:
+    thread_policy_scope(cl::sycl::queue &queue, thread_policy policy)
+            : queue_key_(std::hash<cl::sycl::queue>{}(queue)),
+              previous_(exchange_thread_policy(queue_key_, policy)) {}
+    thread_policy_scope(backend_selector<backend::mklcpu> selector, thread_policy policy)
+            : thread_policy_scope(selector.get_queue(), policy) {}
+    ~thread_policy_scope() {
+        exchange_thread_policy(queue_key_, previous_);
+    }
+    thread_policy_scope(const thread_policy_scope &) = delete;
+    thread_policy_scope &operator=(const thread_policy_scope &) = delete;
+
+private:
+    std::size_t queue_key_;
+    thread_policy previous_;
+};
+
 namespace column_major {
 
 #include "oneapi/mkl/blas/detail/onemkl_blas_backends.hxx"
@@ -24,9 +24,11 @@
 
 #include <complex>
 #include <cstdint>
+#include <functional>
 
 #include "oneapi/mkl/types.hpp"
 
+#include "oneapi/mkl/detail/backend_selector.hpp"
 #include "oneapi/mkl/detail/export.hpp"
 
 namespace oneapi {
@@ -40,6 +42,37 @@ using oneapi::mkl::offset;
 
 namespace blas {
 namespace netlib {
+
+// Exchanges the number of host threads that the level 3 routines (gemm, symm, hemm, syrk, herk,
+// trmm and trsm) of the queue whose std::hash is queue_key may use, and returns the previous one.
+// Queues without a setting use ONEMKL_NETLIB_LEVEL3_THREADS, or 1 when it is not set, which keeps
+// one cblas call per routine. Throws invalid_argument if threads is less than 1.
+ONEMKL_EXPORT int exchange_level3_threads(std::size_t queue_key, int threads);
+ONEMKL_EXPORT int get_level3_threads(const cl::sycl::queue &queue);
+
+// Lets the level 3 calls submitted to a queue use up to threads host threads while the scope
+// lives, and restores the previous setting when it ends. With more than one thread, large problems
+// are split into tiles of C (of B for trmm and trsm) that are computed by separate cblas calls on
+// the thread pool of the backend, whose size caps the value. The queue is not kept alive by the
+// scope, so it must outlive it.
+class level3_threads_scope {
+public:
+    level3_threads_scope(cl::sycl::queue &queue, int threads)
+            : queue_key_(std::hash<cl::sycl::queue>{}(queue)),
+              previous_(exchange_level3_threads(queue_key_, threads)) {}
+    level3_threads_scope(backend_selector<backend::netlib> selector, int threads)
+            : level3_threads_scope(selector.get_queue(), threads) {}
+    ~level3_threads_scope() {
+        exchange_level3_threads(queue_key_, previous_);
+    }
+    level3_threads_scope(const level3_threads_scope &) = delete;
+    level3_threads_scope &operator=(const level3_threads_scope &) = delete;
+
+private:
+    std::size_t queue_key_;
+    int previous_;
+};
+
 namespace column_major {
 
 #include "oneapi/mkl/blas/detail/onemkl_blas_backends.hxx"
@@ -1063,6 +1063,56 @@ ONEMKL_EXPORT void gemm_bias(cl::sycl::queue &queue, oneapi::mkl::transpose tran
                              float beta, cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc,
                              cl::sycl::buffer<int32_t, 1> &co);
 
+template <typename T>
+std::int64_t gemm_pack_get_size(cl::sycl::queue &queue, oneapi::mkl::identifier which,
+                                std::int64_t m, std::int64_t n, std::int64_t k);
+
+template <>
+ONEMKL_EXPORT std::int64_t gemm_pack_get_size<float>(cl::sycl::queue &queue,
+                                                     oneapi::mkl::identifier which, std::int64_t m,
+                                                     std::int64_t n, std::int64_t k);
+
+template <>
+ONEMKL_EXPORT std::int64_t gemm_pack_get_size<double>(cl::sycl::queue &queue,
+                                                      oneapi::mkl::identifier which, std::int64_t m,
+                                                      std::int64_t n, std::int64_t k);
+
+ONEMKL_EXPORT void gemm_pack(cl::sycl::queue &queue, oneapi::mkl::identifier which,
+                             oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &src,
+                             std::int64_t ld, cl::sycl::buffer<float, 1> &dest);
+
+ONEMKL_EXPORT void gemm_pack(cl::sycl::queue &queue, oneapi::mkl::identifier which,
+                             oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, double alpha, cl::sycl::buffer<double, 1> &src,
+                             std::int64_t ld, cl::sycl::buffer<double, 1> &dest);
+
+ONEMKL_EXPORT void gemm_compute(cl::sycl::queue &queue, oneapi::mkl::identifier which,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                std::int64_t k, cl::sycl::buffer<float, 1> &packed,
+                                cl::sycl::buffer<float, 1> &other, std::int64_t ld, float beta,
+                                cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+
+ONEMKL_EXPORT void gemm_compute(cl::sycl::queue &queue, oneapi::mkl::identifier which,
+                                oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                std::int64_t k, cl::sycl::buffer<double, 1> &packed,
+                                cl::sycl::buffer<double, 1> &other, std::int64_t ld, double beta,
+                                cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+
+ONEMKL_EXPORT void gemm3m(
+    cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+    cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+    cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+
+ONEMKL_EXPORT void gemm3m(
+    cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+    cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+    cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
+
 // USM APIs
 
 ONEMKL_EXPORT cl::sycl::event gemm(cl::sycl::queue &queue, oneapi::mkl::transpose transa,
@@ -1154,6 +1204,42 @@ ONEMKL_EXPORT cl::sycl::event gemm_bias(cl::sycl::queue &queue, oneapi::mkl::tra
                                         const std::int32_t *co,
                                         const std::vector<cl::sycl::event> &dependencies = {});
 
+ONEMKL_EXPORT cl::sycl::event gemm_pack(
+    cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *src, std::int64_t ld,
+    float *dest, const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event gemm_pack(
+    cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *src,
+    std::int64_t ld, double *dest, const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event gemm_compute(
+    cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, const float *packed, const float *other,
+    std::int64_t ld, float beta, float *c, std::int64_t ldc,
+    const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event gemm_compute(
+    cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+    std::int64_t m, std::int64_t n, std::int64_t k, const double *packed, const double *other,
+    std::int64_t ld, double beta, double *c, std::int64_t ldc,
+    const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event gemm3m(
+    cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+    const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b, std::int64_t ldb,
+    std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+    const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event gemm3m(
+    cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+    std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+    const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+    std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+    const std::vector<cl::sycl::event> &dependencies = {});
+
 ONEMKL_EXPORT cl::sycl::event symm(cl::sycl::queue &queue, oneapi::mkl::side left_right,
                                    oneapi::mkl::uplo upper_lower, std::int64_t m, std::int64_t n,
                                    float alpha, const float *a, std::int64_t lda, const float *b,
@@ -2085,6 +2171,24 @@ ONEMKL_EXPORT cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n,
                                    std::int64_t incx, std::complex<double> *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
+ONEMKL_EXPORT cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+                                   const float *x, std::int64_t incx, float *y, std::int64_t incy,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                                   const double *x, std::int64_t incx, double *y, std::int64_t incy,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n,
+                                   const std::complex<float> *alpha, const std::complex<float> *x,
+                                   std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n,
+                                   const std::complex<double> *alpha, const std::complex<double> *x,
+                                   std::int64_t incx, std::complex<double> *y, std::int64_t incy,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
 ONEMKL_EXPORT cl::sycl::event axpy_batch(cl::sycl::queue &queue, std::int64_t *n, float *alpha,
                                          const float **x, std::int64_t *incx, float **y,
                                          std::int64_t *incy, std::int64_t group_count,
@@ -2336,6 +2440,32 @@ ONEMKL_EXPORT cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, doubl
                                    std::complex<double> *x, std::int64_t incx,
                                    const std::vector<cl::sycl::event> &dependencies = {});
 
+ONEMKL_EXPORT cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+                                   float *x, std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                                   double *x, std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n,
+                                   const std::complex<float> *alpha, std::complex<float> *x,
+                                   std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+                                   std::complex<float> *x, std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n,
+                                   const std::complex<double> *alpha, std::complex<double> *x,
+                                   std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
+ONEMKL_EXPORT cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                                   std::complex<double> *x, std::int64_t incx,
+                                   const std::vector<cl::sycl::event> &dependencies = {});
+
 ONEMKL_EXPORT cl::sycl::event swap(cl::sycl::queue &queue, std::int64_t n, float *x,
                                    std::int64_t incx, float *y, std::int64_t incy,
                                    const std::vector<cl::sycl::event> &dependencies = {});
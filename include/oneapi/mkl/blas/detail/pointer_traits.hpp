@@ -0,0 +1,42 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_POINTER_TRAITS_HPP_
+#define _ONEMKL_BLAS_POINTER_TRAITS_HPP_
+
+#include <type_traits>
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace detail {
+
+// Enables the axpy and scal overloads taking alpha by pointer only for pointers to T. A literal 0
+// passed as alpha converts to a null pointer as well as to T, so without the constraint it would
+// make the calls with alpha by value ambiguous.
+template <typename Ta, typename T>
+using is_pointer_to = typename std::enable_if<std::is_same<Ta, const T *>::value ||
+                                              std::is_same<Ta, T *>::value>::type *;
+
+} // namespace detail
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BLAS_POINTER_TRAITS_HPP_
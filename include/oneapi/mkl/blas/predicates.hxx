@@ -1524,6 +1524,118 @@ inline void gemm_bias_postcondition(cl::sycl::queue &queue, transpose transa, tr
 #endif
 }
 
+inline void gemm_pack_precondition(cl::sycl::queue &queue, identifier which, transpose trans,
+                                   std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                   cl::sycl::buffer<float, 1> &src, std::int64_t ld,
+                                   cl::sycl::buffer<float, 1> &dest) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_pack_postcondition(cl::sycl::queue &queue, identifier which, transpose trans,
+                                    std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                    cl::sycl::buffer<float, 1> &src, std::int64_t ld,
+                                    cl::sycl::buffer<float, 1> &dest) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_pack_precondition(cl::sycl::queue &queue, identifier which, transpose trans,
+                                   std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                                   cl::sycl::buffer<double, 1> &src, std::int64_t ld,
+                                   cl::sycl::buffer<double, 1> &dest) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_pack_postcondition(cl::sycl::queue &queue, identifier which, transpose trans,
+                                    std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                                    cl::sycl::buffer<double, 1> &src, std::int64_t ld,
+                                    cl::sycl::buffer<double, 1> &dest) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compute_precondition(
+    cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, cl::sycl::buffer<float, 1> &packed, cl::sycl::buffer<float, 1> &other,
+    std::int64_t ld, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compute_postcondition(
+    cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, cl::sycl::buffer<float, 1> &packed, cl::sycl::buffer<float, 1> &other,
+    std::int64_t ld, float beta, cl::sycl::buffer<float, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compute_precondition(
+    cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, cl::sycl::buffer<double, 1> &packed, cl::sycl::buffer<double, 1> &other,
+    std::int64_t ld, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compute_postcondition(
+    cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, cl::sycl::buffer<double, 1> &packed, cl::sycl::buffer<double, 1> &other,
+    std::int64_t ld, double beta, cl::sycl::buffer<double, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_precondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+    std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_postcondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+    std::int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb,
+    std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_precondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+    std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_postcondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+    std::int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb,
+    std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
 inline void iamin_precondition(cl::sycl::queue &queue, std::int64_t n,
                                cl::sycl::buffer<float, 1> &x, std::int64_t incx,
                                cl::sycl::buffer<std::int64_t, 1> &result) {
@@ -3832,6 +3944,101 @@ inline void scal_postcondition(cl::sycl::queue &queue, std::int64_t n, double al
 #endif
 }
 
+inline void scal_precondition(cl::sycl::queue &queue, std::int64_t n, const float *alpha, float *x,
+                              std::int64_t incx, const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_postcondition(cl::sycl::queue &queue, std::int64_t n, const float *alpha, float *x,
+                               std::int64_t incx,
+                               const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_precondition(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                              double *x, std::int64_t incx,
+                              const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_postcondition(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                               double *x, std::int64_t incx,
+                               const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              const std::complex<float> *alpha, std::complex<float> *x,
+                              std::int64_t incx, const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_postcondition(
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+    std::complex<float> *x, std::int64_t incx, const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_precondition(cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+                              std::complex<float> *x, std::int64_t incx,
+                              const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_postcondition(cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+                               std::complex<float> *x, std::int64_t incx,
+                               const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              const std::complex<double> *alpha, std::complex<double> *x,
+                              std::int64_t incx, const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_postcondition(
+    cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+    std::complex<double> *x, std::int64_t incx, const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_precondition(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                              std::complex<double> *x, std::int64_t incx,
+                              const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void scal_postcondition(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                               std::complex<double> *x, std::int64_t incx,
+                               const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
 inline void trmv_precondition(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                               diag unit_diag, std::int64_t n, const float *a, std::int64_t lda,
                               float *x, std::int64_t incx,
@@ -4720,6 +4927,74 @@ inline void axpy_postcondition(cl::sycl::queue &queue, std::int64_t n, std::comp
 #endif
 }
 
+inline void axpy_precondition(cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+                              const float *x, std::int64_t incx, float *y, std::int64_t incy,
+                              const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_postcondition(cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+                               const float *x, std::int64_t incx, float *y, std::int64_t incy,
+                               const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_precondition(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                              const double *x, std::int64_t incx, double *y, std::int64_t incy,
+                              const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_postcondition(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                               const double *x, std::int64_t incx, double *y, std::int64_t incy,
+                               const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              const std::complex<float> *alpha, const std::complex<float> *x,
+                              std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+                              const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               const std::complex<float> *alpha, const std::complex<float> *x,
+                               std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+                               const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_precondition(cl::sycl::queue &queue, std::int64_t n,
+                              const std::complex<double> *alpha, const std::complex<double> *x,
+                              std::int64_t incx, std::complex<double> *y, std::int64_t incy,
+                              const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void axpy_postcondition(cl::sycl::queue &queue, std::int64_t n,
+                               const std::complex<double> *alpha, const std::complex<double> *x,
+                               std::int64_t incx, std::complex<double> *y, std::int64_t incy,
+                               const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
 inline void axpy_batch_precondition(cl::sycl::queue &queue, std::int64_t *n, float *alpha,
                                     const float **x, std::int64_t *incx, float **y,
                                     std::int64_t *incy, std::int64_t group_count,
@@ -6274,6 +6549,118 @@ inline void gemm_bias_postcondition(cl::sycl::queue &queue, transpose transa, tr
 #endif
 }
 
+inline void gemm_pack_precondition(cl::sycl::queue &queue, identifier which, transpose trans,
+                                   std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                   const float *src, std::int64_t ld, float *dest,
+                                   const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_pack_postcondition(cl::sycl::queue &queue, identifier which, transpose trans,
+                                    std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+                                    const float *src, std::int64_t ld, float *dest,
+                                    const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_pack_precondition(cl::sycl::queue &queue, identifier which, transpose trans,
+                                   std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                                   const double *src, std::int64_t ld, double *dest,
+                                   const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_pack_postcondition(cl::sycl::queue &queue, identifier which, transpose trans,
+                                    std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+                                    const double *src, std::int64_t ld, double *dest,
+                                    const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compute_precondition(
+    cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, const float *packed, const float *other, std::int64_t ld, float beta, float *c,
+    std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compute_postcondition(
+    cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, const float *packed, const float *other, std::int64_t ld, float beta, float *c,
+    std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compute_precondition(
+    cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, const double *packed, const double *other, std::int64_t ld, double beta,
+    double *c, std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm_compute_postcondition(
+    cl::sycl::queue &queue, identifier which, transpose trans, std::int64_t m, std::int64_t n,
+    std::int64_t k, const double *packed, const double *other, std::int64_t ld, double beta,
+    double *c, std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_precondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+    std::complex<float> *c, std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_postcondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<float> alpha, const std::complex<float> *a, std::int64_t lda,
+    const std::complex<float> *b, std::int64_t ldb, std::complex<float> beta,
+    std::complex<float> *c, std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_precondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+    std::complex<double> *c, std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add prechecks to queue here for input args.  */
+#endif
+}
+
+inline void gemm3m_postcondition(
+    cl::sycl::queue &queue, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k, std::complex<double> alpha, const std::complex<double> *a, std::int64_t lda,
+    const std::complex<double> *b, std::int64_t ldb, std::complex<double> beta,
+    std::complex<double> *c, std::int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+#ifndef ONEMKL_DISABLE_PREDICATES
+    /* add postchecks to queue here for input args.  */
+#endif
+}
+
 inline void syr2_precondition(cl::sycl::queue &queue, uplo upper_lower, std::int64_t n, float alpha,
                               const float *x, std::int64_t incx, const float *y, std::int64_t incy,
                               float *a, std::int64_t lda,
@@ -20,6 +20,8 @@
 #ifndef _ONEMKL_GET_DEVICE_ID_HPP_
 #define _ONEMKL_GET_DEVICE_ID_HPP_
 
+#include <utility>
+#include <vector>
 #include <CL/sycl.hpp>
 
 #include "oneapi/mkl/detail/backends_table.hpp"
@@ -30,31 +32,54 @@
 
 namespace oneapi {
 namespace mkl {
+namespace detail {
 
-inline oneapi::mkl::device get_device_id(cl::sycl::queue &queue) {
+inline oneapi::mkl::device classify_device(const cl::sycl::device &dev) {
     oneapi::mkl::device device_id;
-    if (queue.is_host())
+    if (dev.is_host())
         device_id = device::x86cpu;
-    else if (queue.get_device().is_cpu())
+    else if (dev.is_cpu())
         device_id = device::x86cpu;
-    else if (queue.get_device().is_gpu()) {
-        unsigned int vendor_id = static_cast<unsigned int>(
-            queue.get_device().get_info<cl::sycl::info::device::vendor_id>());
+    else if (dev.is_gpu()) {
+        unsigned int vendor_id =
+            static_cast<unsigned int>(dev.get_info<cl::sycl::info::device::vendor_id>());
 
         if (vendor_id == INTEL_ID)
             device_id = device::intelgpu;
         else if (vendor_id == NVIDIA_ID)
             device_id = device::nvidiagpu;
         else {
-            throw unsupported_device("", "", queue.get_device());
+            throw unsupported_device("", "", dev);
         }
     }
     else {
-        throw unsupported_device("", "", queue.get_device());
+        throw unsupported_device("", "", dev);
     }
     return device_id;
 }
 
+} //namespace detail
+
+// Resolved ids are cached per thread: a process only sees a handful of devices, so the
+// linear search below is cheaper than the is_cpu/is_gpu/vendor_id queries it replaces and
+// needs no synchronization. Unsupported devices are not cached and keep throwing.
+inline oneapi::mkl::device get_device_id(const cl::sycl::device &dev) {
+    static thread_local std::vector<std::pair<cl::sycl::device, oneapi::mkl::device>> cache;
+    for (const auto &entry : cache) {
+        if (entry.first == dev)
+            return entry.second;
+    }
+    oneapi::mkl::device device_id = detail::classify_device(dev);
+    cache.emplace_back(dev, device_id);
+    return device_id;
+}
+
+inline oneapi::mkl::device get_device_id(cl::sycl::queue &queue) {
+    if (queue.is_host())
+        return device::x86cpu;
+    return get_device_id(queue.get_device());
+}
+
 } //namespace mkl
 } //namespace oneapi
 
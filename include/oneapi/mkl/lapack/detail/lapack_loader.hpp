@@ -2372,6 +2372,9 @@ template <>
 ONEMKL_EXPORT std::int64_t ungqr_batch_scratchpad_size<std::complex<double>>(
     oneapi::mkl::device libkey, sycl::queue &queue, std::int64_t *m, std::int64_t *n,
     std::int64_t *k, std::int64_t *lda, std::int64_t group_count, std::int64_t *group_sizes);
+
+// Loads the LAPACK backend for libkey and returns the name of the selected library
+const char *preload(oneapi::mkl::device libkey);
 } //namespace detail
 } //namespace lapack
 } //namespace mkl
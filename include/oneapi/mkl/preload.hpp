@@ -0,0 +1,53 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_PRELOAD_HPP_
+#define _ONEMKL_PRELOAD_HPP_
+
+#include <map>
+#include <string>
+
+#include "oneapi/mkl/detail/backends_table.hpp"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+
+#if defined(BUILD_SHARED_LIBS) || defined(ENABLE_STATIC_DISPATCH)
+
+// Loads and validates the run-time dispatch backend of the given domain for the device,
+// so that the library loading cost is not paid by the first call to a routine.
+// Returns the file name of the selected backend library.
+// Throws oneapi::mkl::backend_not_found if the domain is not built or no backend library
+// could be loaded, and oneapi::mkl::function_not_found/specification_mismatch if the loaded
+// library does not provide a valid function table.
+ONEMKL_EXPORT std::string preload(oneapi::mkl::domain domain_id, oneapi::mkl::device device_id);
+
+// Preloads every built domain that has backends configured for the device.
+// Returns the selected backend library for each preloaded domain.
+ONEMKL_EXPORT std::map<oneapi::mkl::domain, std::string> preload_all(
+    oneapi::mkl::device device_id);
+
+#endif
+
+} //namespace mkl
+} //namespace oneapi
+
+#endif //_ONEMKL_PRELOAD_HPP_
@@ -45,6 +45,9 @@ ONEMKL_EXPORT engine_impl* create_mrg32k3a(oneapi::mkl::device libkey, cl::sycl:
 ONEMKL_EXPORT engine_impl* create_mrg32k3a(oneapi::mkl::device libkey, cl::sycl::queue queue,
                                            std::initializer_list<std::uint32_t> seed);
 
+// Loads the RNG backend for libkey and returns the name of the selected library
+const char* preload(oneapi::mkl::device libkey);
+
 } // namespace detail
 } // namespace rng
 } // namespace mkl
@@ -0,0 +1,63 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_STATS_HPP_
+#define _ONEMKL_STATS_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "oneapi/mkl/detail/backends_table.hpp"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl/detail/export.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace stats {
+
+// Aggregated counters of one routine called through the run-time dispatch API.
+// Buffer and USM variants and both layouts of a routine are counted together.
+struct routine_stats {
+    oneapi::mkl::domain domain;
+    std::string name; // routine with precision prefix, e.g. "sgemm" or "dgetrf_batch"
+    std::uint64_t calls = 0;
+    double flops = 0.0; // estimated from the problem sizes, 0 for routines without a cost model
+    double bytes = 0.0; // estimated size of the matrices and vectors read or written
+    double time = 0.0; // seconds spent in the calls on the host, including submission, or from
+                       // submission to completion of the calls when ONEMKL_STATS is set
+};
+
+#if defined(BUILD_SHARED_LIBS) || defined(ENABLE_STATIC_DISPATCH)
+
+// Returns the counters of every routine called since the start of the program or the last
+// reset(). Counting is enabled by default and can be disabled with ONEMKL_STATS=0. With
+// ONEMKL_STATS set to another value, the time of a call is added once it completes.
+ONEMKL_EXPORT std::vector<routine_stats> snapshot();
+
+// Restarts counting from zero for subsequent snapshots
+ONEMKL_EXPORT void reset();
+
+#endif
+
+} //namespace stats
+} //namespace mkl
+} //namespace oneapi
+
+#endif //_ONEMKL_STATS_HPP_
@@ -38,6 +38,8 @@ enum class offset : char { row = 0, column = 1, fix = 2, R = 0, C = 1, F = 2 };
 
 enum class layout : char { column_major = 0, row_major = 1, C = 0, R = 1 };
 
+enum class identifier : char { A = 0, B = 1 };
+
 enum class index_base : char {
     zero = 0,
     one = 1,
@@ -0,0 +1,194 @@
+#!/usr/bin/env python
+#===============================================================================
+# Copyright 2020-2021 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions
+# and limitations under the License.
+#
+#
+# SPDX-License-Identifier: Apache-2.0
+#===============================================================================
+
+
+from sys import argv, exit
+import re
+
+def usage(err = None):
+    if err:
+        print('error: %s' % err)
+    print('''\
+Script to generate the BLAS execution context from the run-time API.
+Each function of blas.hxx becomes a member function of the context, which calls the
+loader with the backend resolved when the context was created.
+Usage:
+
+    {script} <path/to/blas.hxx> <path/to/out_context.hxx>
+
+Example:
+
+    {script} include/oneapi/mkl/blas.hxx include/oneapi/mkl/blas/context.hxx
+'''.format(script = argv[0]))
+
+if len(argv) <= 2:
+    usage()
+    exit(0)
+
+if re.search(r'[-]*\b[h]([e][l][p])?\b' ,argv[1]):
+    usage()
+    exit(0)
+
+in_filename = argv[1]
+out_filename = argv[2]
+
+LIMIT = 100
+
+def split_args(text):
+    """Splits a parameter list on the commas outside of brackets"""
+    args, depth, cur = [], 0, ''
+    for ch in ' '.join(text.split()):
+        if ch in '(<{[':
+            depth += 1
+        elif ch in ')>}]':
+            depth -= 1
+        if ch == ',' and depth == 0:
+            args.append(cur.strip())
+            cur = ''
+        else:
+            cur += ch
+    if cur.strip():
+        args.append(cur.strip())
+    return args
+
+def pack(args, first, cont, tail):
+    lines, cur = [], first
+    for i, arg in enumerate(args):
+        token = arg + (tail if i == len(args) - 1 else ',')
+        if i == 0:
+            cur += token
+        elif len(cur) + 1 + len(token) > LIMIT:
+            lines.append(cur)
+            cur = cont + token
+        else:
+            cur += ' ' + token
+    return lines + [cur]
+
+def format_call(indent, head, args, tail = ');', open_bracket = '('):
+    """Formats head(args)tail as clang-format does with the repository style"""
+    start = ' ' * indent + head + open_bracket
+    if len(start + ', '.join(args) + tail) <= LIMIT:
+        return start + ', '.join(args) + tail
+    aligned = pack(args, start, ' ' * len(start), tail)
+    broken = [start] + pack(args, ' ' * (indent + 4), ' ' * (indent + 4), tail)
+    if all(len(line) <= LIMIT for line in aligned) and len(aligned) <= len(broken):
+        return '\n'.join(aligned)
+    return '\n'.join(broken)
+
+def parse_call(statement):
+    """Splits 'auto done = detail::f(a, b)' into ('auto done = ', 'detail::f', ['a', 'b'])"""
+    match = re.match(r'((?:auto done = |return )?)([\w:<>]+)\((.*)\)$', statement)
+    if not match:
+        raise ValueError('unexpected statement: ' + statement)
+    return match.group(1), match.group(2), split_args(match.group(3))
+
+def context_args(args):
+    """Arguments of a call made by the context instead of a free function taking queue"""
+    args = ['backend_' if a == 'get_device_id(queue)' else a for a in args]
+    return ['queue_' if a == 'queue' else a for a in args]
+
+def member(template, declaration, body):
+    """Returns the context member function of one run-time API function"""
+    lines = []
+    if template:
+        params = split_args(template[len('template <'):-1])
+        lines.append(format_call(4, 'template ', params, '>', '<'))
+    head, params = declaration[len('static inline '):].split('(', 1)
+    params = split_args(params[:-len(') {')])
+    if params[0] != 'cl::sycl::queue &queue':
+        raise ValueError('first parameter is not the queue: ' + declaration)
+    lines.append(format_call(4, head, params[1:], ') {'))
+    statements = [' '.join(s.split()) for s in body.split(';') if s.strip()]
+    for statement in statements:
+        if statement == 'return done':
+            lines.append('        return done;')
+            continue
+        prefix, callee, args = parse_call(statement)
+        lines.append(format_call(8, prefix + callee, context_args(args)))
+    lines.append('    }')
+    return '\n'.join(lines)
+
+def indent_comments(lines):
+    """Indents the comments between functions as members, rewrapping those that get too long"""
+    out, comment = '', []
+    for line in lines + ['']:
+        if line.startswith('//'):
+            comment.append(line)
+            continue
+        if any(len('    ' + c) > LIMIT for c in comment):
+            words = ' '.join(c[2:] for c in comment).split()
+            comment, cur = [], '//'
+            for word in words:
+                if len('    ' + cur + ' ' + word) > LIMIT:
+                    comment.append(cur)
+                    cur = '//'
+                cur += ' ' + word
+            comment.append(cur)
+        out += ''.join('    ' + c + '\n' for c in comment)
+        comment = []
+        out += ('    ' + line if line else '') + '\n'
+    return out[:-1]
+
+with open(in_filename, 'r') as f:
+    text = f.read()
+
+license_end = text.index('*/') + 3
+definition = re.compile(r'(template <.*?>\n)?(static inline .*?\) \{)\n(.*?)\n\}\n', re.S)
+members = ''
+pos = license_end
+for match in definition.finditer(text):
+    members += indent_comments(text[pos:match.start()].split('\n')[:-1])
+    template = ' '.join(match.group(1).split()) if match.group(1) else None
+    members += member(template, ' '.join(match.group(2).split()), match.group(3)) + '\n'
+    pos = match.end()
+if text[pos:].strip():
+    raise ValueError('unexpected text after the last function: ' + text[pos:].strip()[:80])
+
+with open(out_filename, 'w') as out_file:
+    out_file.write(text[:license_end])
+    out_file.write('''
+// Generated by scripts/generate_context.py from blas.hxx, do not edit.
+//
+// Execution context of the run-time API bound to one queue. The device id is resolved, the
+// backend is loaded and, unless size-based routing is configured, its function table is looked
+// up once on construction, so calls skip device classification, routing and the table lookup.
+class context {
+public:
+    explicit context(cl::sycl::queue queue)
+            : queue_(queue),
+              device_id_(get_device_id(queue_)),
+              backend_(detail::resolve_backend(device_id_)) {}
+
+    cl::sycl::queue &get_queue() {
+        return queue_;
+    }
+
+    oneapi::mkl::device get_device() const {
+        return device_id_;
+    }
+''')
+    out_file.write('\n' + members.strip('\n') + '\n')
+    out_file.write('''
+private:
+    cl::sycl::queue queue_;
+    oneapi::mkl::device device_id_;
+    detail::backend_ref backend_;
+};
+''')
@@ -0,0 +1,146 @@
+#!/usr/bin/env python
+#===============================================================================
+# Copyright 2020-2021 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions
+# and limitations under the License.
+#
+#
+# SPDX-License-Identifier: Apache-2.0
+#===============================================================================
+
+
+from sys import argv, exit
+import errno
+import os
+import re
+
+def usage(err = None):
+    if err:
+        print('error: %s' % err)
+    print('''\
+Script to generate the BLAS static dispatch wrappers from the run-time API declarations.
+Each declaration of blas_loader.hxx becomes an inline function calling the mklcpu backend.
+Usage:
+
+    {script} <path/to/blas_loader.hxx> <path/to/out_static_dispatch.hxx>
+
+Example:
+
+    {script} include/oneapi/mkl/blas/detail/blas_loader.hxx build/bin/oneapi/mkl/blas/detail/blas_static_dispatch.hxx
+'''.format(script = argv[0]))
+
+if len(argv) <= 2:
+    usage()
+    exit(0)
+
+if re.search(r'[-]*\b[h]([e][l][p])?\b' ,argv[1]):
+    usage()
+    exit(0)
+
+in_filename = argv[1]
+out_filename = argv[2]
+
+LIMIT = 100
+
+def split_args(text):
+    """Splits a parameter list on the commas outside of brackets"""
+    args, depth, cur = [], 0, ''
+    for ch in ' '.join(text.split()):
+        if ch in '(<{':
+            depth += 1
+        elif ch in ')>}':
+            depth -= 1
+        if ch == ',' and depth == 0:
+            args.append(cur.strip())
+            cur = ''
+        else:
+            cur += ch
+    if cur.strip():
+        args.append(cur.strip())
+    return args
+
+def pack(args, first, cont, tail):
+    lines, cur = [], first
+    for i, arg in enumerate(args):
+        token = arg + (tail if i == len(args) - 1 else ',')
+        if i == 0:
+            cur += token
+        elif len(cur) + 1 + len(token) > LIMIT:
+            lines.append(cur)
+            cur = cont + token
+        else:
+            cur += ' ' + token
+    return lines + [cur]
+
+def format_call(indent, head, args, tail):
+    """Formats head(args)tail as clang-format does with the repository style"""
+    start = ' ' * indent + head + '('
+    if len(start + ', '.join(args) + tail) <= LIMIT:
+        return start + ', '.join(args) + tail
+    aligned = pack(args, start, ' ' * len(start), tail)
+    if all(len(line) <= LIMIT for line in aligned):
+        return '\n'.join(aligned)
+    return '\n'.join([start] + pack(args, ' ' * (indent + 4), ' ' * (indent + 4), tail))
+
+def wrapper(declaration):
+    """Returns the static dispatch definition of one declaration, None for specializations"""
+    template = ''
+    if declaration.startswith('template <>'):
+        return None
+    if declaration.startswith('template'):
+        template, declaration = declaration.split('>', 1)
+        template += '>\n'
+    declaration = declaration.replace('ONEMKL_EXPORT', '').strip()
+    head, params = declaration.split('(', 1)
+    ret_type, name = head.strip().rsplit(' ', 1)
+    params = split_args(params.rstrip(';').strip()[:-1])
+    call_args = [re.sub(r'\s*=.*$', '', p).rsplit(' ', 1)[1].strip('*&') for p in params[1:]]
+    callee = 'oneapi::mkl::blas::mklcpu::MAJOR::' + name
+    if template:
+        callee += '<' + re.findall(r'typename (\w+)', template)[0] + '>'
+    return (template +
+            format_call(0, 'static inline ' + ret_type + ' ' + name, params, ') {') + '\n' +
+            '    check_static_dispatch(libkey, queue, "' + name + '");\n' +
+            format_call(4, ('' if ret_type == 'void' else 'return ') + callee, call_args, ');') +
+            '\n}\n')
+
+with open(in_filename, 'r') as f:
+    text = f.read()
+
+license_end = text.index('*/') + 3
+code = ''
+statement = ''
+for line in text[license_end:].splitlines():
+    if statement or not (line.startswith('//') or line.strip() == ''):
+        statement += line.strip() + ' '
+        if line.rstrip().endswith(';'):
+            definition = wrapper(' '.join(statement.split()))
+            if definition:
+                code += '\n' + definition
+            statement = ''
+    elif line.startswith('//'):
+        code += '\n' + line + '\n'
+
+try:
+    os.makedirs(os.path.dirname(out_filename))
+except OSError as exc:
+    if exc.errno != errno.EEXIST:
+        raise
+
+with open(out_filename, 'w') as out_file:
+    out_file.write(text[:license_end])
+    out_file.write('''
+// Generated by scripts/generate_static_dispatch.py from blas_loader.hxx, do not edit.
+// Included once per layout by blas_loader.hpp with ENABLE_STATIC_DISPATCH.
+''')
+    out_file.write(code)
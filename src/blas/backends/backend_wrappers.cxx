@@ -212,6 +212,14 @@ oneapi::mkl::blas::BACKEND::MAJOR::gemm_bias,
 oneapi::mkl::blas::BACKEND::MAJOR::gemm_bias,
 oneapi::mkl::blas::BACKEND::MAJOR::gemm_bias,
 oneapi::mkl::blas::BACKEND::MAJOR::gemm_bias,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack_get_size<float>,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack_get_size<double>,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm3m,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm3m,
 oneapi::mkl::blas::BACKEND::MAJOR::asum,
 oneapi::mkl::blas::BACKEND::MAJOR::asum,
 oneapi::mkl::blas::BACKEND::MAJOR::asum,
@@ -220,6 +228,10 @@ oneapi::mkl::blas::BACKEND::MAJOR::axpy,
 oneapi::mkl::blas::BACKEND::MAJOR::axpy,
 oneapi::mkl::blas::BACKEND::MAJOR::axpy,
 oneapi::mkl::blas::BACKEND::MAJOR::axpy,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy,
+oneapi::mkl::blas::BACKEND::MAJOR::axpy,
 oneapi::mkl::blas::BACKEND::MAJOR::axpy_batch,
 oneapi::mkl::blas::BACKEND::MAJOR::axpy_batch,
 oneapi::mkl::blas::BACKEND::MAJOR::axpy_batch,
@@ -281,6 +293,12 @@ oneapi::mkl::blas::BACKEND::MAJOR::scal,
 oneapi::mkl::blas::BACKEND::MAJOR::scal,
 oneapi::mkl::blas::BACKEND::MAJOR::scal,
 oneapi::mkl::blas::BACKEND::MAJOR::scal,
+oneapi::mkl::blas::BACKEND::MAJOR::scal,
+oneapi::mkl::blas::BACKEND::MAJOR::scal,
+oneapi::mkl::blas::BACKEND::MAJOR::scal,
+oneapi::mkl::blas::BACKEND::MAJOR::scal,
+oneapi::mkl::blas::BACKEND::MAJOR::scal,
+oneapi::mkl::blas::BACKEND::MAJOR::scal,
 oneapi::mkl::blas::BACKEND::MAJOR::sdsdot,
 oneapi::mkl::blas::BACKEND::MAJOR::swap,
 oneapi::mkl::blas::BACKEND::MAJOR::swap,
@@ -435,4 +453,10 @@ oneapi::mkl::blas::BACKEND::MAJOR::gemm_bias,
 oneapi::mkl::blas::BACKEND::MAJOR::gemm_bias,
 oneapi::mkl::blas::BACKEND::MAJOR::gemm_bias,
 oneapi::mkl::blas::BACKEND::MAJOR::gemm_bias,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_pack,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm_compute,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm3m,
+oneapi::mkl::blas::BACKEND::MAJOR::gemm3m,
     // clang-format on
@@ -89,6 +89,43 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
     throw unimplemented("blas", "gemmt", "for column_major layout");
 }
 
+template <>
+std::int64_t gemm_pack_get_size<float>(cl::sycl::queue &queue, identifier which, int64_t m,
+                                       int64_t n, int64_t k) {
+    throw unimplemented("blas", "gemm_pack_get_size", "for column_major layout");
+}
+
+template <>
+std::int64_t gemm_pack_get_size<double>(cl::sycl::queue &queue, identifier which, int64_t m,
+                                        int64_t n, int64_t k) {
+    throw unimplemented("blas", "gemm_pack_get_size", "for column_major layout");
+}
+
+void gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+               int64_t k, float alpha, cl::sycl::buffer<float, 1> &src, int64_t ld,
+               cl::sycl::buffer<float, 1> &dest) {
+    throw unimplemented("blas", "gemm_pack", "for column_major layout");
+}
+
+void gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+               int64_t k, double alpha, cl::sycl::buffer<double, 1> &src, int64_t ld,
+               cl::sycl::buffer<double, 1> &dest) {
+    throw unimplemented("blas", "gemm_pack", "for column_major layout");
+}
+
+void gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, cl::sycl::buffer<float, 1> &packed, cl::sycl::buffer<float, 1> &other,
+                  int64_t ld, float beta, cl::sycl::buffer<float, 1> &c, int64_t ldc) {
+    throw unimplemented("blas", "gemm_compute", "for column_major layout");
+}
+
+void gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, cl::sycl::buffer<double, 1> &packed,
+                  cl::sycl::buffer<double, 1> &other, int64_t ld, double beta,
+                  cl::sycl::buffer<double, 1> &c, int64_t ldc) {
+    throw unimplemented("blas", "gemm_compute", "for column_major layout");
+}
+
 // USM APIs
 
 cl::sycl::event gemm_bias(cl::sycl::queue &queue, transpose transa, transpose transb,
@@ -153,6 +190,32 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
     throw unimplemented("blas", "gemmt", "for column_major layout");
 }
 
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *src, int64_t ld,
+                          float *dest, const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_pack", "for column_major layout");
+}
+
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                          int64_t n, int64_t k, double alpha, const double *src, int64_t ld,
+                          double *dest, const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_pack", "for column_major layout");
+}
+
+cl::sycl::event gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                             int64_t n, int64_t k, const float *packed, const float *other,
+                             int64_t ld, float beta, float *c, int64_t ldc,
+                             const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_compute", "for column_major layout");
+}
+
+cl::sycl::event gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                             int64_t n, int64_t k, const double *packed, const double *other,
+                             int64_t ld, double beta, double *c, int64_t ldc,
+                             const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_compute", "for column_major layout");
+}
+
 } // namespace column_major
 namespace row_major {
 
@@ -218,6 +281,43 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
     throw unimplemented("blas", "gemmt", "for row_major layout");
 }
 
+template <>
+std::int64_t gemm_pack_get_size<float>(cl::sycl::queue &queue, identifier which, int64_t m,
+                                       int64_t n, int64_t k) {
+    throw unimplemented("blas", "gemm_pack_get_size", "for row_major layout");
+}
+
+template <>
+std::int64_t gemm_pack_get_size<double>(cl::sycl::queue &queue, identifier which, int64_t m,
+                                        int64_t n, int64_t k) {
+    throw unimplemented("blas", "gemm_pack_get_size", "for row_major layout");
+}
+
+void gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+               int64_t k, float alpha, cl::sycl::buffer<float, 1> &src, int64_t ld,
+               cl::sycl::buffer<float, 1> &dest) {
+    throw unimplemented("blas", "gemm_pack", "for row_major layout");
+}
+
+void gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+               int64_t k, double alpha, cl::sycl::buffer<double, 1> &src, int64_t ld,
+               cl::sycl::buffer<double, 1> &dest) {
+    throw unimplemented("blas", "gemm_pack", "for row_major layout");
+}
+
+void gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, cl::sycl::buffer<float, 1> &packed, cl::sycl::buffer<float, 1> &other,
+                  int64_t ld, float beta, cl::sycl::buffer<float, 1> &c, int64_t ldc) {
+    throw unimplemented("blas", "gemm_compute", "for row_major layout");
+}
+
+void gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, cl::sycl::buffer<double, 1> &packed,
+                  cl::sycl::buffer<double, 1> &other, int64_t ld, double beta,
+                  cl::sycl::buffer<double, 1> &c, int64_t ldc) {
+    throw unimplemented("blas", "gemm_compute", "for row_major layout");
+}
+
 // USM APIs
 
 cl::sycl::event gemm_bias(cl::sycl::queue &queue, transpose transa, transpose transb,
@@ -282,6 +382,32 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
     throw unimplemented("blas", "gemmt", "for row_major layout");
 }
 
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *src, int64_t ld,
+                          float *dest, const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_pack", "for row_major layout");
+}
+
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                          int64_t n, int64_t k, double alpha, const double *src, int64_t ld,
+                          double *dest, const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_pack", "for row_major layout");
+}
+
+cl::sycl::event gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                             int64_t n, int64_t k, const float *packed, const float *other,
+                             int64_t ld, float beta, float *c, int64_t ldc,
+                             const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_compute", "for row_major layout");
+}
+
+cl::sycl::event gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                             int64_t n, int64_t k, const double *packed, const double *other,
+                             int64_t ld, double beta, double *c, int64_t ldc,
+                             const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_compute", "for row_major layout");
+}
+
 } // namespace row_major
 } // namespace cublas
 } // namespace blas
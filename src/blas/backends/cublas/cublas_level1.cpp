@@ -693,6 +693,46 @@ SCAL_LAUNCHER_USM(float, std::complex<float>, cublasCsscal)
 SCAL_LAUNCHER_USM(double, std::complex<double>, cublasZdscal)
 #undef SCAL_LAUNCHER_USM
 
+template <typename Func, typename T1, typename T2>
+inline cl::sycl::event scal(Func func, cl::sycl::queue &queue, int64_t n, const T1 *a, T2 *x,
+                            int64_t incx, const std::vector<cl::sycl::event> &dependencies) {
+    using cuDataType1 = typename CudaEquivalentType<T1>::Type;
+    using cuDataType2 = typename CudaEquivalentType<T2>::Type;
+    overflow_check(n, incx);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        onemkl_cublas_host_task(cgh, queue, [=](CublasScopedContextHandler &sc) {
+            auto handle = sc.get_handle(queue);
+            auto a_ = reinterpret_cast<const cuDataType1 *>(a);
+            auto x_ = reinterpret_cast<cuDataType2 *>(x);
+            cublasStatus_t err;
+            // alpha is read on the device when the routine runs, after the dependencies.
+            cublasSetPointerMode(handle, CUBLAS_POINTER_MODE_DEVICE);
+            // SCAL does not support negative incx
+            CUBLAS_ERROR_FUNC(func, err, handle, n, a_, x_, std::abs(incx));
+            // Reset the default pointer mode, which the other routines expect.
+            cublasSetPointerMode(handle, CUBLAS_POINTER_MODE_HOST);
+        });
+    });
+    return done;
+}
+
+#define SCAL_PTR_LAUNCHER_USM(TYPE1, TYPE2, CUBLAS_ROUTINE)                                \
+    cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const TYPE1 *a, TYPE2 *x,      \
+                         int64_t incx, const std::vector<cl::sycl::event> &dependencies) { \
+        return scal(CUBLAS_ROUTINE, queue, n, a, x, incx, dependencies);                   \
+    }
+SCAL_PTR_LAUNCHER_USM(float, float, cublasSscal)
+SCAL_PTR_LAUNCHER_USM(double, double, cublasDscal)
+SCAL_PTR_LAUNCHER_USM(std::complex<float>, std::complex<float>, cublasCscal)
+SCAL_PTR_LAUNCHER_USM(std::complex<double>, std::complex<double>, cublasZscal)
+SCAL_PTR_LAUNCHER_USM(float, std::complex<float>, cublasCsscal)
+SCAL_PTR_LAUNCHER_USM(double, std::complex<double>, cublasZdscal)
+#undef SCAL_PTR_LAUNCHER_USM
+
 template <typename Func, typename T>
 inline cl::sycl::event axpy(Func func, cl::sycl::queue &queue, int64_t n, T alpha, const T *x,
                             int64_t incx, T *y, int64_t incy,
@@ -728,6 +768,46 @@ AXPY_LAUNCHER_USM(std::complex<float>, cublasCaxpy)
 AXPY_LAUNCHER_USM(std::complex<double>, cublasZaxpy)
 #undef AXPY_LAUNCHER_USM
 
+template <typename Func, typename T>
+inline cl::sycl::event axpy(Func func, cl::sycl::queue &queue, int64_t n, const T *alpha,
+                            const T *x, int64_t incx, T *y, int64_t incy,
+                            const std::vector<cl::sycl::event> &dependencies) {
+    using cuDataType = typename CudaEquivalentType<T>::Type;
+    overflow_check(n, incx, incy);
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        onemkl_cublas_host_task(cgh, queue, [=](CublasScopedContextHandler &sc) {
+            auto handle = sc.get_handle(queue);
+            auto alpha_ = reinterpret_cast<const cuDataType *>(alpha);
+            auto x_ = reinterpret_cast<const cuDataType *>(x);
+            auto y_ = reinterpret_cast<cuDataType *>(y);
+            cublasStatus_t err;
+            // alpha is read on the device when the routine runs, after the dependencies.
+            cublasSetPointerMode(handle, CUBLAS_POINTER_MODE_DEVICE);
+            CUBLAS_ERROR_FUNC(func, err, handle, n, alpha_, x_, incx, y_, incy);
+            // Reset the default pointer mode, which the other routines expect.
+            cublasSetPointerMode(handle, CUBLAS_POINTER_MODE_HOST);
+        });
+    });
+    return done;
+}
+
+#define AXPY_PTR_LAUNCHER_USM(TYPE, CUBLAS_ROUTINE)                                           \
+    cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const TYPE *alpha, const TYPE *x, \
+                         int64_t incx, TYPE *y, int64_t incy,                                 \
+                         const std::vector<cl::sycl::event> &dependencies) {                  \
+        return axpy(CUBLAS_ROUTINE, queue, n, alpha, x, incx, y, incy, dependencies);         \
+    }
+
+AXPY_PTR_LAUNCHER_USM(float, cublasSaxpy)
+AXPY_PTR_LAUNCHER_USM(double, cublasDaxpy)
+AXPY_PTR_LAUNCHER_USM(std::complex<float>, cublasCaxpy)
+AXPY_PTR_LAUNCHER_USM(std::complex<double>, cublasZaxpy)
+#undef AXPY_PTR_LAUNCHER_USM
+
 cl::sycl::event axpby(cl::sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
                       float beta, float *y, int64_t incy,
                       const std::vector<cl::sycl::event> &dependencies) {
@@ -1462,6 +1542,25 @@ SCAL_LAUNCHER_USM(float, std::complex<float>, cublasCsscal)
 SCAL_LAUNCHER_USM(double, std::complex<double>, cublasZdscal)
 #undef SCAL_LAUNCHER_USM
 
+template <typename Func, typename T1, typename T2>
+inline cl::sycl::event scal(Func func, cl::sycl::queue &queue, int64_t n, const T1 *a, T2 *x,
+                            int64_t incx, const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "for row_major layout");
+}
+
+#define SCAL_PTR_LAUNCHER_USM(TYPE1, TYPE2, CUBLAS_ROUTINE)                                \
+    cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const TYPE1 *a, TYPE2 *x,      \
+                         int64_t incx, const std::vector<cl::sycl::event> &dependencies) { \
+        return scal(CUBLAS_ROUTINE, queue, n, a, x, incx, dependencies);                   \
+    }
+SCAL_PTR_LAUNCHER_USM(float, float, cublasSscal)
+SCAL_PTR_LAUNCHER_USM(double, double, cublasDscal)
+SCAL_PTR_LAUNCHER_USM(std::complex<float>, std::complex<float>, cublasCscal)
+SCAL_PTR_LAUNCHER_USM(std::complex<double>, std::complex<double>, cublasZscal)
+SCAL_PTR_LAUNCHER_USM(float, std::complex<float>, cublasCsscal)
+SCAL_PTR_LAUNCHER_USM(double, std::complex<double>, cublasZdscal)
+#undef SCAL_PTR_LAUNCHER_USM
+
 template <typename Func, typename T>
 inline cl::sycl::event axpy(Func func, cl::sycl::queue &queue, int64_t n, T alpha, const T *x,
                             int64_t incx, T *y, int64_t incy,
@@ -1482,6 +1581,26 @@ AXPY_LAUNCHER_USM(std::complex<float>, cublasCaxpy)
 AXPY_LAUNCHER_USM(std::complex<double>, cublasZaxpy)
 #undef AXPY_LAUNCHER_USM
 
+template <typename Func, typename T>
+inline cl::sycl::event axpy(Func func, cl::sycl::queue &queue, int64_t n, const T *alpha,
+                            const T *x, int64_t incx, T *y, int64_t incy,
+                            const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "for row_major layout");
+}
+
+#define AXPY_PTR_LAUNCHER_USM(TYPE, CUBLAS_ROUTINE)                                           \
+    cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const TYPE *alpha, const TYPE *x, \
+                         int64_t incx, TYPE *y, int64_t incy,                                 \
+                         const std::vector<cl::sycl::event> &dependencies) {                  \
+        return axpy(CUBLAS_ROUTINE, queue, n, alpha, x, incx, y, incy, dependencies);         \
+    }
+
+AXPY_PTR_LAUNCHER_USM(float, cublasSaxpy)
+AXPY_PTR_LAUNCHER_USM(double, cublasDaxpy)
+AXPY_PTR_LAUNCHER_USM(std::complex<float>, cublasCaxpy)
+AXPY_PTR_LAUNCHER_USM(std::complex<double>, cublasZaxpy)
+#undef AXPY_PTR_LAUNCHER_USM
+
 cl::sycl::event axpby(cl::sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
                       float beta, float *y, int64_t incy,
                       const std::vector<cl::sycl::event> &dependencies) {
@@ -69,6 +69,19 @@ GEMM_LAUNCHER(std::complex<double>, cublasZgemm)
 
 #undef GEMM_LAUNCHER
 
+#define GEMM3M_LAUNCHER(TYPE, CUBLAS_ROUTINE)                                                      \
+    void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,  \
+                int64_t k, TYPE alpha, cl::sycl::buffer<TYPE, 1> &a, int64_t lda,                  \
+                cl::sycl::buffer<TYPE, 1> &b, int64_t ldb, TYPE beta,                              \
+                cl::sycl::buffer<TYPE, 1> &c, int64_t ldc) {                                       \
+        gemm(CUBLAS_ROUTINE, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc); \
+    }
+
+GEMM3M_LAUNCHER(std::complex<float>, cublasCgemm3m)
+GEMM3M_LAUNCHER(std::complex<double>, cublasZgemm3m)
+
+#undef GEMM3M_LAUNCHER
+
 template <typename T_A, typename T_B, typename T_C, typename DATATYPE_A, typename DATATYPE_B,
           typename DATATYPE_C>
 inline void gemm_ex(DATATYPE_A DT_A, DATATYPE_B DT_B, DATATYPE_C DT_C, cl::sycl::queue &queue,
@@ -465,6 +478,20 @@ GEMM_LAUNCHER_USM(std::complex<double>, cublasZgemm)
 
 #undef GEMM_LAUNCHER_USM
 
+#define GEMM3M_LAUNCHER_USM(TYPE, CUBLAS_ROUTINE)                                                 \
+    cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, \
+                           int64_t n, int64_t k, TYPE alpha, const TYPE *a, int64_t lda,          \
+                           const TYPE *b, int64_t ldb, TYPE beta, TYPE *c, int64_t ldc,           \
+                           const std::vector<cl::sycl::event> &dependencies) {                    \
+        return gemm(CUBLAS_ROUTINE, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,  \
+                    c, ldc, dependencies);                                                        \
+    }
+
+GEMM3M_LAUNCHER_USM(std::complex<float>, cublasCgemm3m)
+GEMM3M_LAUNCHER_USM(std::complex<double>, cublasZgemm3m)
+
+#undef GEMM3M_LAUNCHER_USM
+
 template <typename T_A, typename T_B, typename T_C, typename DATATYPE_A, typename DATATYPE_B,
           typename DATATYPE_C>
 inline cl::sycl::event gemm_ex_usm(DATATYPE_A DT_A, DATATYPE_B DT_B, DATATYPE_C DT_C,
@@ -875,6 +902,19 @@ GEMM_LAUNCHER(std::complex<double>, cublasZgemm)
 
 #undef GEMM_LAUNCHER
 
+#define GEMM3M_LAUNCHER(TYPE)                                                                     \
+    void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n, \
+                int64_t k, TYPE alpha, cl::sycl::buffer<TYPE, 1> &a, int64_t lda,                 \
+                cl::sycl::buffer<TYPE, 1> &b, int64_t ldb, TYPE beta,                             \
+                cl::sycl::buffer<TYPE, 1> &c, int64_t ldc) {                                      \
+        throw unimplemented("blas", "gemm3m", "for row_major layout");                            \
+    }
+
+GEMM3M_LAUNCHER(std::complex<float>)
+GEMM3M_LAUNCHER(std::complex<double>)
+
+#undef GEMM3M_LAUNCHER
+
 template <typename T_A, typename T_B, typename T_C, typename DATATYPE_A, typename DATATYPE_B,
           typename DATATYPE_C>
 inline void gemm_ex(DATATYPE_A DT_A, DATATYPE_B DT_B, DATATYPE_C DT_C, cl::sycl::queue &queue,
@@ -1105,6 +1145,19 @@ GEMM_LAUNCHER_USM(std::complex<double>, cublasZgemm)
 
 #undef GEMM_LAUNCHER_USM
 
+#define GEMM3M_LAUNCHER_USM(TYPE)                                                                 \
+    cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, \
+                           int64_t n, int64_t k, TYPE alpha, const TYPE *a, int64_t lda,          \
+                           const TYPE *b, int64_t ldb, TYPE beta, TYPE *c, int64_t ldc,           \
+                           const std::vector<cl::sycl::event> &dependencies) {                    \
+        throw unimplemented("blas", "gemm3m", "for row_major layout");                            \
+    }
+
+GEMM3M_LAUNCHER_USM(std::complex<float>)
+GEMM3M_LAUNCHER_USM(std::complex<double>)
+
+#undef GEMM3M_LAUNCHER_USM
+
 template <typename T_A, typename T_B, typename T_C, typename DATATYPE_A, typename DATATYPE_B,
           typename DATATYPE_C>
 inline cl::sycl::event gemm_ex_usm(DATATYPE_A DT_A, DATATYPE_B DT_B, DATATYPE_C DT_C,
@@ -217,6 +217,14 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::cublas::column_major::gemm_bias,
     oneapi::mkl::blas::cublas::column_major::gemm_bias,
     oneapi::mkl::blas::cublas::column_major::gemm_bias,
+    oneapi::mkl::blas::cublas::column_major::gemm_pack_get_size<float>,
+    oneapi::mkl::blas::cublas::column_major::gemm_pack_get_size<double>,
+    oneapi::mkl::blas::cublas::column_major::gemm_pack,
+    oneapi::mkl::blas::cublas::column_major::gemm_pack,
+    oneapi::mkl::blas::cublas::column_major::gemm_compute,
+    oneapi::mkl::blas::cublas::column_major::gemm_compute,
+    oneapi::mkl::blas::cublas::column_major::gemm3m,
+    oneapi::mkl::blas::cublas::column_major::gemm3m,
     oneapi::mkl::blas::cublas::column_major::asum,
     oneapi::mkl::blas::cublas::column_major::asum,
     oneapi::mkl::blas::cublas::column_major::asum,
@@ -225,6 +233,10 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::cublas::column_major::axpy,
     oneapi::mkl::blas::cublas::column_major::axpy,
     oneapi::mkl::blas::cublas::column_major::axpy,
+    oneapi::mkl::blas::cublas::column_major::axpy,
+    oneapi::mkl::blas::cublas::column_major::axpy,
+    oneapi::mkl::blas::cublas::column_major::axpy,
+    oneapi::mkl::blas::cublas::column_major::axpy,
     oneapi::mkl::blas::cublas::column_major::axpy_batch,
     oneapi::mkl::blas::cublas::column_major::axpy_batch,
     oneapi::mkl::blas::cublas::column_major::axpy_batch,
@@ -286,6 +298,12 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::cublas::column_major::scal,
     oneapi::mkl::blas::cublas::column_major::scal,
     oneapi::mkl::blas::cublas::column_major::scal,
+    oneapi::mkl::blas::cublas::column_major::scal,
+    oneapi::mkl::blas::cublas::column_major::scal,
+    oneapi::mkl::blas::cublas::column_major::scal,
+    oneapi::mkl::blas::cublas::column_major::scal,
+    oneapi::mkl::blas::cublas::column_major::scal,
+    oneapi::mkl::blas::cublas::column_major::scal,
     oneapi::mkl::blas::cublas::column_major::sdsdot,
     oneapi::mkl::blas::cublas::column_major::swap,
     oneapi::mkl::blas::cublas::column_major::swap,
@@ -440,6 +458,12 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::cublas::column_major::gemm_bias,
     oneapi::mkl::blas::cublas::column_major::gemm_bias,
     oneapi::mkl::blas::cublas::column_major::gemm_bias,
+    oneapi::mkl::blas::cublas::column_major::gemm_pack,
+    oneapi::mkl::blas::cublas::column_major::gemm_pack,
+    oneapi::mkl::blas::cublas::column_major::gemm_compute,
+    oneapi::mkl::blas::cublas::column_major::gemm_compute,
+    oneapi::mkl::blas::cublas::column_major::gemm3m,
+    oneapi::mkl::blas::cublas::column_major::gemm3m,
     oneapi::mkl::blas::cublas::row_major::asum,
     oneapi::mkl::blas::cublas::row_major::asum,
     oneapi::mkl::blas::cublas::row_major::asum,
@@ -634,6 +658,14 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::cublas::row_major::gemm_bias,
     oneapi::mkl::blas::cublas::row_major::gemm_bias,
     oneapi::mkl::blas::cublas::row_major::gemm_bias,
+    oneapi::mkl::blas::cublas::row_major::gemm_pack_get_size<float>,
+    oneapi::mkl::blas::cublas::row_major::gemm_pack_get_size<double>,
+    oneapi::mkl::blas::cublas::row_major::gemm_pack,
+    oneapi::mkl::blas::cublas::row_major::gemm_pack,
+    oneapi::mkl::blas::cublas::row_major::gemm_compute,
+    oneapi::mkl::blas::cublas::row_major::gemm_compute,
+    oneapi::mkl::blas::cublas::row_major::gemm3m,
+    oneapi::mkl::blas::cublas::row_major::gemm3m,
     oneapi::mkl::blas::cublas::row_major::asum,
     oneapi::mkl::blas::cublas::row_major::asum,
     oneapi::mkl::blas::cublas::row_major::asum,
@@ -642,6 +674,10 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::cublas::row_major::axpy,
     oneapi::mkl::blas::cublas::row_major::axpy,
     oneapi::mkl::blas::cublas::row_major::axpy,
+    oneapi::mkl::blas::cublas::row_major::axpy,
+    oneapi::mkl::blas::cublas::row_major::axpy,
+    oneapi::mkl::blas::cublas::row_major::axpy,
+    oneapi::mkl::blas::cublas::row_major::axpy,
     oneapi::mkl::blas::cublas::row_major::axpy_batch,
     oneapi::mkl::blas::cublas::row_major::axpy_batch,
     oneapi::mkl::blas::cublas::row_major::axpy_batch,
@@ -703,6 +739,12 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::cublas::row_major::scal,
     oneapi::mkl::blas::cublas::row_major::scal,
     oneapi::mkl::blas::cublas::row_major::scal,
+    oneapi::mkl::blas::cublas::row_major::scal,
+    oneapi::mkl::blas::cublas::row_major::scal,
+    oneapi::mkl::blas::cublas::row_major::scal,
+    oneapi::mkl::blas::cublas::row_major::scal,
+    oneapi::mkl::blas::cublas::row_major::scal,
+    oneapi::mkl::blas::cublas::row_major::scal,
     oneapi::mkl::blas::cublas::row_major::sdsdot,
     oneapi::mkl::blas::cublas::row_major::swap,
     oneapi::mkl::blas::cublas::row_major::swap,
@@ -857,4 +899,10 @@ extern "C" blas_function_table_t mkl_blas_table = {
     oneapi::mkl::blas::cublas::row_major::gemm_bias,
     oneapi::mkl::blas::cublas::row_major::gemm_bias,
     oneapi::mkl::blas::cublas::row_major::gemm_bias,
+    oneapi::mkl::blas::cublas::row_major::gemm_pack,
+    oneapi::mkl::blas::cublas::row_major::gemm_pack,
+    oneapi::mkl::blas::cublas::row_major::gemm_compute,
+    oneapi::mkl::blas::cublas::row_major::gemm_compute,
+    oneapi::mkl::blas::cublas::row_major::gemm3m,
+    oneapi::mkl::blas::cublas::row_major::gemm3m,
 };
@@ -21,6 +21,7 @@
 
 #include "oneapi/mkl/exceptions.hpp"
 #include "mklcpu_common.hpp"
+#include "scratch_arena.hpp"
 #include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 
 namespace oneapi {
@@ -25,7 +25,7 @@ void copy_batch(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_scopy_batch_strided>(cgh, [=]() {
+        host_task<class mkl_kernel_scopy_batch_strided>(queue, cgh, [=]() {
             int64_t i;
             for (i = 0; i < batch_size; i++) {
                 ::cblas_scopy(n, accessor_x.get_pointer() + i * stridex, incx,
@@ -41,7 +41,7 @@ void copy_batch(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dcopy_batch_strided>(cgh, [=]() {
+        host_task<class mkl_kernel_dcopy_batch_strided>(queue, cgh, [=]() {
             int64_t i;
             for (i = 0; i < batch_size; i++) {
                 ::cblas_dcopy(n, accessor_x.get_pointer() + i * stridex, incx,
@@ -57,7 +57,7 @@ void copy_batch(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ccopy_batch_strided>(cgh, [=]() {
+        host_task<class mkl_kernel_ccopy_batch_strided>(queue, cgh, [=]() {
             int64_t i;
             for (i = 0; i < batch_size; i++) {
                 ::cblas_ccopy(n, accessor_x.get_pointer() + i * stridex, incx,
@@ -73,7 +73,7 @@ void copy_batch(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zcopy_batch_strided>(cgh, [=]() {
+        host_task<class mkl_kernel_zcopy_batch_strided>(queue, cgh, [=]() {
             int64_t i;
             for (i = 0; i < batch_size; i++) {
                 ::cblas_zcopy(n, accessor_x.get_pointer() + i * stridex, incx,
@@ -89,7 +89,7 @@ void axpy_batch(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_saxpy_batch_strided>(cgh, [=]() {
+        host_task<class mkl_kernel_saxpy_batch_strided>(queue, cgh, [=]() {
             ::cblas_saxpy_batch_strided(n, alpha, accessor_x.get_pointer(), incx, stridex,
                                         accessor_y.get_pointer(), incy, stridey, batch_size);
         });
@@ -102,7 +102,7 @@ void axpy_batch(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffe
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_daxpy_batch_strided>(cgh, [=]() {
+        host_task<class mkl_kernel_daxpy_batch_strided>(queue, cgh, [=]() {
             ::cblas_daxpy_batch_strided(n, alpha, accessor_x.get_pointer(), incx, stridex,
                                         accessor_y.get_pointer(), incy, stridey, batch_size);
         });
@@ -116,7 +116,7 @@ void axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_caxpy_batch_strided>(cgh, [=]() {
+        host_task<class mkl_kernel_caxpy_batch_strided>(queue, cgh, [=]() {
             ::cblas_caxpy_batch_strided(n, (const void *)&alpha, accessor_x.get_pointer(), incx,
                                         stridex, accessor_y.get_pointer(), incy, stridey,
                                         batch_size);
@@ -131,7 +131,7 @@ void axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zaxpy_batch_strided>(cgh, [=]() {
+        host_task<class mkl_kernel_zaxpy_batch_strided>(queue, cgh, [=]() {
             ::cblas_zaxpy_batch_strided(n, (const void *)&alpha, accessor_x.get_pointer(), incx,
                                         stridex, accessor_y.get_pointer(), incy, stridey,
                                         batch_size);
@@ -149,17 +149,11 @@ void gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
         auto y_acc = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_sgemv_batch_strided>(cgh, [=]() {
-            float **a_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **x_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **y_array = (float **)::malloc(sizeof(float *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (y_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(y_array);
-                return;
-            }
+        host_task<class mkl_kernel_sgemv_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemv_batch");
+            float **a_array = scratch.allocate<float *>(batch_size);
+            float **x_array = scratch.allocate<float *>(batch_size);
+            float **y_array = scratch.allocate<float *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 x_array[i] = x_acc.get_pointer() + i * stride_x;
@@ -170,10 +164,6 @@ void gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
                                 (const float **)x_array, (const MKL_INT *)&incx, &beta,
                                 (float **)y_array, (const MKL_INT *)&incy, one,
                                 (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(y_array);
         });
     });
 }
@@ -189,17 +179,11 @@ void gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
         auto y_acc = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_dgemv_batch_strided>(cgh, [=]() {
-            double **a_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **x_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **y_array = (double **)::malloc(sizeof(double *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (y_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(y_array);
-                return;
-            }
+        host_task<class mkl_kernel_dgemv_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemv_batch");
+            double **a_array = scratch.allocate<double *>(batch_size);
+            double **x_array = scratch.allocate<double *>(batch_size);
+            double **y_array = scratch.allocate<double *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 x_array[i] = x_acc.get_pointer() + i * stride_x;
@@ -210,10 +194,6 @@ void gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
                                 (const double **)x_array, (const MKL_INT *)&incx, &beta,
                                 (double **)y_array, (const MKL_INT *)&incy, one,
                                 (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(y_array);
         });
     });
 }
@@ -230,17 +210,11 @@ void gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
         auto y_acc = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_cgemv_batch_strided>(cgh, [=]() {
-            MKL_Complex8 **a_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            MKL_Complex8 **x_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            MKL_Complex8 **y_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (y_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(y_array);
-                return;
-            }
+        host_task<class mkl_kernel_cgemv_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemv_batch");
+            MKL_Complex8 **a_array = scratch.allocate<MKL_Complex8 *>(batch_size);
+            MKL_Complex8 **x_array = scratch.allocate<MKL_Complex8 *>(batch_size);
+            MKL_Complex8 **y_array = scratch.allocate<MKL_Complex8 *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 x_array[i] = x_acc.get_pointer() + i * stride_x;
@@ -251,10 +225,6 @@ void gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
                                 (const void **)x_array, (const MKL_INT *)&incx, &beta,
                                 (void **)y_array, (const MKL_INT *)&incy, one,
                                 (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(y_array);
         });
     });
 }
@@ -271,20 +241,11 @@ void gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
         auto y_acc = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_zgemv_batch_strided>(cgh, [=]() {
-            MKL_Complex16 **a_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            MKL_Complex16 **x_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            MKL_Complex16 **y_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (y_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(y_array);
-                return;
-            }
+        host_task<class mkl_kernel_zgemv_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemv_batch");
+            MKL_Complex16 **a_array = scratch.allocate<MKL_Complex16 *>(batch_size);
+            MKL_Complex16 **x_array = scratch.allocate<MKL_Complex16 *>(batch_size);
+            MKL_Complex16 **y_array = scratch.allocate<MKL_Complex16 *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 x_array[i] = x_acc.get_pointer() + i * stride_x;
@@ -295,10 +256,6 @@ void gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
                                 (const void **)x_array, (const MKL_INT *)&incx, &beta,
                                 (void **)y_array, (const MKL_INT *)&incy, one,
                                 (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(y_array);
         });
     });
 }
@@ -313,17 +270,11 @@ void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
         auto c_acc = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
         CBLAS_SIDE left_right_ = cblas_convert(left_right);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_sdgmm_batch_strided>(cgh, [=]() {
-            float **a_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **x_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **c_array = (float **)::malloc(sizeof(float *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_sdgmm_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "dgmm_batch");
+            float **a_array = scratch.allocate<float *>(batch_size);
+            float **x_array = scratch.allocate<float *>(batch_size);
+            float **c_array = scratch.allocate<float *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 x_array[i] = x_acc.get_pointer() + i * stride_x;
@@ -333,10 +284,6 @@ void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
                                 (const float **)a_array, (const MKL_INT *)&lda,
                                 (const float **)x_array, (const MKL_INT *)&incx, (float **)c_array,
                                 (const MKL_INT *)&ldc, one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(c_array);
         });
     });
 }
@@ -351,17 +298,11 @@ void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
         auto c_acc = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
         CBLAS_SIDE left_right_ = cblas_convert(left_right);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_ddgmm_batch_strided>(cgh, [=]() {
-            double **a_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **x_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **c_array = (double **)::malloc(sizeof(double *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_ddgmm_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "dgmm_batch");
+            double **a_array = scratch.allocate<double *>(batch_size);
+            double **x_array = scratch.allocate<double *>(batch_size);
+            double **c_array = scratch.allocate<double *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 x_array[i] = x_acc.get_pointer() + i * stride_x;
@@ -372,10 +313,6 @@ void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
                                 (const double **)x_array, (const MKL_INT *)&incx,
                                 (double **)c_array, (const MKL_INT *)&ldc, one,
                                 (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(c_array);
         });
     });
 }
@@ -391,17 +328,11 @@ void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
         auto c_acc = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
         CBLAS_SIDE left_right_ = cblas_convert(left_right);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_cdgmm_batch_strided>(cgh, [=]() {
-            MKL_Complex8 **a_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            MKL_Complex8 **x_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            MKL_Complex8 **c_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_cdgmm_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "dgmm_batch");
+            MKL_Complex8 **a_array = scratch.allocate<MKL_Complex8 *>(batch_size);
+            MKL_Complex8 **x_array = scratch.allocate<MKL_Complex8 *>(batch_size);
+            MKL_Complex8 **c_array = scratch.allocate<MKL_Complex8 *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 x_array[i] = x_acc.get_pointer() + i * stride_x;
@@ -411,10 +342,6 @@ void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
                                 (const void **)a_array, (const MKL_INT *)&lda,
                                 (const void **)x_array, (const MKL_INT *)&incx, (void **)c_array,
                                 (const MKL_INT *)&ldc, one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(c_array);
         });
     });
 }
@@ -430,20 +357,11 @@ void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
         auto c_acc = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
         CBLAS_SIDE left_right_ = cblas_convert(left_right);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_zdgmm_batch_strided>(cgh, [=]() {
-            MKL_Complex16 **a_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            MKL_Complex16 **x_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            MKL_Complex16 **c_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_zdgmm_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "dgmm_batch");
+            MKL_Complex16 **a_array = scratch.allocate<MKL_Complex16 *>(batch_size);
+            MKL_Complex16 **x_array = scratch.allocate<MKL_Complex16 *>(batch_size);
+            MKL_Complex16 **c_array = scratch.allocate<MKL_Complex16 *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 x_array[i] = x_acc.get_pointer() + i * stride_x;
@@ -454,10 +372,6 @@ void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
                                 (const void **)a_array, (const MKL_INT *)&lda,
                                 (const void **)x_array, (const MKL_INT *)&incx, (void **)c_array,
                                 (const MKL_INT *)&ldc, one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(c_array);
         });
     });
 }
@@ -474,17 +388,11 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_sgemm_batch_strided>(cgh, [=]() {
-            float **a_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **b_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **c_array = (float **)::malloc(sizeof(float *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_sgemm_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_batch");
+            float **a_array = scratch.allocate<float *>(batch_size);
+            float **b_array = scratch.allocate<float *>(batch_size);
+            float **c_array = scratch.allocate<float *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 b_array[i] = b_acc.get_pointer() + i * stride_b;
@@ -495,10 +403,6 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 (const MKL_INT *)&k, &alpha, (const float **)a_array, (const MKL_INT *)&lda,
                 (const float **)b_array, (const MKL_INT *)&ldb, &beta, (float **)c_array,
                 (const MKL_INT *)&ldc, one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
         });
     });
 }
@@ -515,17 +419,11 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_dgemm_batch_strided>(cgh, [=]() {
-            double **a_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **b_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **c_array = (double **)::malloc(sizeof(double *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_dgemm_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_batch");
+            double **a_array = scratch.allocate<double *>(batch_size);
+            double **b_array = scratch.allocate<double *>(batch_size);
+            double **c_array = scratch.allocate<double *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 b_array[i] = b_acc.get_pointer() + i * stride_b;
@@ -536,10 +434,6 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 (const MKL_INT *)&k, &alpha, (const double **)a_array, (const MKL_INT *)&lda,
                 (const double **)b_array, (const MKL_INT *)&ldb, &beta, (double **)c_array,
                 (const MKL_INT *)&ldc, one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
         });
     });
 }
@@ -557,17 +451,11 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_cgemm_batch_strided>(cgh, [=]() {
-            MKL_Complex8 **a_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            MKL_Complex8 **b_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            MKL_Complex8 **c_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_cgemm_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_batch");
+            MKL_Complex8 **a_array = scratch.allocate<MKL_Complex8 *>(batch_size);
+            MKL_Complex8 **b_array = scratch.allocate<MKL_Complex8 *>(batch_size);
+            MKL_Complex8 **c_array = scratch.allocate<MKL_Complex8 *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 b_array[i] = b_acc.get_pointer() + i * stride_b;
@@ -578,10 +466,6 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 (const MKL_INT *)&k, &alpha, (const void **)a_array, (const MKL_INT *)&lda,
                 (const void **)b_array, (const MKL_INT *)&ldb, &beta, (void **)c_array,
                 (const MKL_INT *)&ldc, one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
         });
     });
 }
@@ -599,20 +483,11 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_zgemm_batch_strided>(cgh, [=]() {
-            MKL_Complex16 **a_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            MKL_Complex16 **b_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            MKL_Complex16 **c_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_zgemm_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_batch");
+            MKL_Complex16 **a_array = scratch.allocate<MKL_Complex16 *>(batch_size);
+            MKL_Complex16 **b_array = scratch.allocate<MKL_Complex16 *>(batch_size);
+            MKL_Complex16 **c_array = scratch.allocate<MKL_Complex16 *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 b_array[i] = b_acc.get_pointer() + i * stride_b;
@@ -623,10 +498,6 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 (const MKL_INT *)&k, &alpha, (const void **)a_array, (const MKL_INT *)&lda,
                 (const void **)b_array, (const MKL_INT *)&ldb, &beta, (void **)c_array,
                 (const MKL_INT *)&ldc, one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
         });
     });
 }
@@ -647,7 +518,8 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_hgemm_batch_strided>(cgh, [=]() {
+        host_task<class mkl_kernel_hgemm_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_batch");
             int64_t totalsize_a, totalsize_b, totalsize_c;
             int64_t size_a, size_b, size_c;
 #ifdef COLUMN_MAJOR
@@ -664,12 +536,12 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
             totalsize_b = (batch_size - 1) * stride_b + size_b;
             totalsize_c = (batch_size - 1) * stride_c + size_c;
 
-            float *f32_a = (float *)::malloc(sizeof(float) * totalsize_a);
-            float *f32_b = (float *)::malloc(sizeof(float) * totalsize_b);
-            float *f32_c = (float *)::malloc(sizeof(float) * totalsize_c);
-            float **a_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **b_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **c_array = (float **)::malloc(sizeof(float *) * batch_size);
+            float *f32_a = scratch.allocate<float>(totalsize_a);
+            float *f32_b = scratch.allocate<float>(totalsize_b);
+            float *f32_c = scratch.allocate<float>(totalsize_c);
+            float **a_array = scratch.allocate<float *>(batch_size);
+            float **b_array = scratch.allocate<float *>(batch_size);
+            float **c_array = scratch.allocate<float *>(batch_size);
             // copy A, B and C to float
             copy_mat(a_acc, MKL_COL_MAJOR, transpose::N, totalsize_a, 1, totalsize_a, 0.0f, f32_a);
             copy_mat(b_acc, MKL_COL_MAJOR, transpose::N, totalsize_b, 1, totalsize_b, 0.0f, f32_b);
@@ -689,12 +561,6 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
             half co = 0.0f;
             copy_mat(f32_c, MKL_COL_MAJOR, totalsize_c, 1, totalsize_c, offset::F, &co,
                      (half *)c_acc.get_pointer());
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
-            ::free(f32_a);
-            ::free(f32_b);
-            ::free(f32_c);
         });
     });
 }
@@ -711,15 +577,10 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
         CBLAS_UPLO uplo_ = cblas_convert(upper_lower);
         CBLAS_DIAG diag_ = cblas_convert(unit_diag);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_strsm_batch_strided>(cgh, [=]() {
-            float **a_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **b_array = (float **)::malloc(sizeof(float *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                return;
-            }
+        host_task<class mkl_kernel_strsm_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "trsm_batch");
+            float **a_array = scratch.allocate<float *>(batch_size);
+            float **b_array = scratch.allocate<float *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 b_array[i] = b_acc.get_pointer() + i * stride_b;
@@ -728,9 +589,6 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
                                 (const MKL_INT *)&n, &alpha, (const float **)a_array,
                                 (const MKL_INT *)&lda, (float **)b_array, (const MKL_INT *)&ldb,
                                 one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
         });
     });
 }
@@ -747,15 +605,10 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
         CBLAS_UPLO uplo_ = cblas_convert(upper_lower);
         CBLAS_DIAG diag_ = cblas_convert(unit_diag);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_dtrsm_batch_strided>(cgh, [=]() {
-            double **a_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **b_array = (double **)::malloc(sizeof(double *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                return;
-            }
+        host_task<class mkl_kernel_dtrsm_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "trsm_batch");
+            double **a_array = scratch.allocate<double *>(batch_size);
+            double **b_array = scratch.allocate<double *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 b_array[i] = b_acc.get_pointer() + i * stride_b;
@@ -765,9 +618,6 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
                                 (const MKL_INT *)&n, &alpha, (const double **)a_array,
                                 (const MKL_INT *)&lda, (double **)b_array, (const MKL_INT *)&ldb,
                                 one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
         });
     });
 }
@@ -786,15 +636,10 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
         CBLAS_DIAG diag_ = cblas_convert(unit_diag);
         MKL_INT one = 1;
 
-        host_task<class mkl_kernel_ctrsm_batch_strided>(cgh, [=]() {
-            MKL_Complex8 **a_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            MKL_Complex8 **b_array = (MKL_Complex8 **)::malloc(sizeof(MKL_Complex8 *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                return;
-            }
+        host_task<class mkl_kernel_ctrsm_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "trsm_batch");
+            MKL_Complex8 **a_array = scratch.allocate<MKL_Complex8 *>(batch_size);
+            MKL_Complex8 **b_array = scratch.allocate<MKL_Complex8 *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 b_array[i] = b_acc.get_pointer() + i * stride_b;
@@ -803,9 +648,6 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
                                 (const MKL_INT *)&n, &alpha, (const void **)a_array,
                                 (const MKL_INT *)&lda, (void **)b_array, (const MKL_INT *)&ldb, one,
                                 (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
         });
     });
 }
@@ -823,17 +665,10 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
         CBLAS_UPLO uplo_ = cblas_convert(upper_lower);
         CBLAS_DIAG diag_ = cblas_convert(unit_diag);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_ztrsm_batch_strided>(cgh, [=]() {
-            MKL_Complex16 **a_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            MKL_Complex16 **b_array =
-                (MKL_Complex16 **)::malloc(sizeof(MKL_Complex16 *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                return;
-            }
+        host_task<class mkl_kernel_ztrsm_batch_strided>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "trsm_batch");
+            MKL_Complex16 **a_array = scratch.allocate<MKL_Complex16 *>(batch_size);
+            MKL_Complex16 **b_array = scratch.allocate<MKL_Complex16 *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = a_acc.get_pointer() + i * stride_a;
                 b_array[i] = b_acc.get_pointer() + i * stride_b;
@@ -842,9 +677,6 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
                                 (const MKL_INT *)&n, &alpha, (const void **)a_array,
                                 (const MKL_INT *)&lda, (void **)b_array, (const MKL_INT *)&ldb, one,
                                 (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
         });
     });
 }
@@ -858,7 +690,7 @@ void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64
         auto c_acc = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_UPLO uplo_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_ssyrk_batch_strided>(cgh, [=]() {
+        host_task<class mkl_kernel_ssyrk_batch_strided>(queue, cgh, [=]() {
             ::cblas_ssyrk_batch_strided(CBLASMAJOR, uplo_, trans_, n, k, alpha, a_acc.get_pointer(),
                                         lda, stride_a, beta, c_acc.get_pointer(), ldc, stride_c,
                                         batch_size);
@@ -875,7 +707,7 @@ void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64
         auto c_acc = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_UPLO uplo_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_dsyrk_batch_strided>(cgh, [=]() {
+        host_task<class mkl_kernel_dsyrk_batch_strided>(queue, cgh, [=]() {
             ::cblas_dsyrk_batch_strided(CBLASMAJOR, uplo_, trans_, n, k, alpha, a_acc.get_pointer(),
                                         lda, stride_a, beta, c_acc.get_pointer(), ldc, stride_c,
                                         batch_size);
@@ -895,7 +727,7 @@ void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64
         CBLAS_UPLO uplo_ = cblas_convert(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_csyrk_batch_strided>(cgh, [=]() {
+        host_task<class mkl_kernel_csyrk_batch_strided>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_csyrk_batch_strided(CBLASMAJOR, uplo_, trans_, n, k, (const void *)&alpha_,
@@ -917,7 +749,7 @@ void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64
         CBLAS_UPLO uplo_ = cblas_convert(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zsyrk_batch_strided>(cgh, [=]() {
+        host_task<class mkl_kernel_zsyrk_batch_strided>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zsyrk_batch_strided(CBLASMAJOR, uplo_, trans_, n, k, (const void *)&alpha_,
@@ -937,7 +769,7 @@ cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t *n, const float **x,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_scopy_batch_group_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_scopy_batch_group_usm>(queue, cgh, [=]() {
             int64_t i, j, offset = 0;
             for (i = 0; i < group_count; i++) {
                 for (j = 0; j < group_size[i]; j++) {
@@ -958,7 +790,7 @@ cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t *n, const double **x,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_dcopy_batch_group_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dcopy_batch_group_usm>(queue, cgh, [=]() {
             int64_t i, j, offset = 0;
             for (i = 0; i < group_count; i++) {
                 for (j = 0; j < group_size[i]; j++) {
@@ -980,7 +812,7 @@ cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t *n, const std::comple
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_ccopy_batch_group_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ccopy_batch_group_usm>(queue, cgh, [=]() {
             int64_t i, j, offset = 0;
             for (i = 0; i < group_count; i++) {
                 for (j = 0; j < group_size[i]; j++) {
@@ -1002,7 +834,7 @@ cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t *n, const std::comple
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_zcopy_batch_group_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zcopy_batch_group_usm>(queue, cgh, [=]() {
             int64_t i, j, offset = 0;
             for (i = 0; i < group_count; i++) {
                 for (j = 0; j < group_size[i]; j++) {
@@ -1024,7 +856,7 @@ cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t n, const float *x, in
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_scopy_batch_strided_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_scopy_batch_strided_usm>(queue, cgh, [=]() {
             std::int64_t i;
             for (i = 0; i < batch_size; i++) {
                 ::cblas_scopy(n, x + i * stridex, incx, y + i * stridey, incy);
@@ -1043,7 +875,7 @@ cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t n, const double *x, i
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_dcopy_batch_strided_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dcopy_batch_strided_usm>(queue, cgh, [=]() {
             std::int64_t i;
             for (i = 0; i < batch_size; i++) {
                 ::cblas_dcopy(n, x + i * stridex, incx, y + i * stridey, incy);
@@ -1062,7 +894,7 @@ cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t n, const std::complex
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_ccopy_batch_strided_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ccopy_batch_strided_usm>(queue, cgh, [=]() {
             std::int64_t i;
             for (i = 0; i < batch_size; i++) {
                 ::cblas_ccopy(n, x + i * stridex, incx, y + i * stridey, incy);
@@ -1081,7 +913,7 @@ cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t n, const std::complex
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_zcopy_batch_strided_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zcopy_batch_strided_usm>(queue, cgh, [=]() {
             std::int64_t i;
             for (i = 0; i < batch_size; i++) {
                 ::cblas_zcopy(n, x + i * stridex, incx, y + i * stridey, incy);
@@ -1099,7 +931,7 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, float *alpha, con
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_saxpy_batch_group_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_saxpy_batch_group_usm>(queue, cgh, [=]() {
             ::cblas_saxpy_batch((const MKL_INT *)n, (const float *)alpha, x, (const MKL_INT *)incx,
                                 y, (const MKL_INT *)incy, group_count, (const MKL_INT *)group_size);
         });
@@ -1115,7 +947,7 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, double *alpha, co
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_daxpy_batch_group_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_daxpy_batch_group_usm>(queue, cgh, [=]() {
             ::cblas_daxpy_batch((const MKL_INT *)n, (const double *)alpha, x, (const MKL_INT *)incx,
                                 y, (const MKL_INT *)incy, group_count, (const MKL_INT *)group_size);
         });
@@ -1132,7 +964,7 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, std::complex<floa
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_caxpy_batch_group_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_caxpy_batch_group_usm>(queue, cgh, [=]() {
             ::cblas_caxpy_batch((const MKL_INT *)n, (const void *)alpha, (const void **)x,
                                 (const MKL_INT *)incx, (void **)y, (const MKL_INT *)incy,
                                 group_count, (const MKL_INT *)group_size);
@@ -1150,7 +982,7 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, std::complex<doub
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_zaxpy_batch_group_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zaxpy_batch_group_usm>(queue, cgh, [=]() {
             ::cblas_zaxpy_batch((const MKL_INT *)n, (const void *)alpha, (const void **)x,
                                 (const MKL_INT *)incx, (void **)y, (const MKL_INT *)incy,
                                 group_count, (const MKL_INT *)group_size);
@@ -1167,7 +999,7 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, float alpha, const
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_saxpy_batch_strided_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_saxpy_batch_strided_usm>(queue, cgh, [=]() {
             ::cblas_saxpy_batch_strided(n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
         });
     });
@@ -1182,7 +1014,7 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, double alpha, cons
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_daxpy_batch_strided_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_daxpy_batch_strided_usm>(queue, cgh, [=]() {
             ::cblas_daxpy_batch_strided(n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
         });
     });
@@ -1198,7 +1030,7 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<float
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_caxpy_batch_strided_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_caxpy_batch_strided_usm>(queue, cgh, [=]() {
             ::cblas_caxpy_batch_strided(n, (const void *)&alpha, x, incx, stridex, y, incy, stridey,
                                         batch_size);
         });
@@ -1215,7 +1047,7 @@ cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<doubl
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_zaxpy_batch_strided_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zaxpy_batch_strided_usm>(queue, cgh, [=]() {
             ::cblas_zaxpy_batch_strided(n, (const void *)&alpha, x, incx, stridex, y, incy, stridey,
                                         batch_size);
         });
@@ -1235,17 +1067,11 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m,
         }
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_sgemv_batch_strided_usm>(cgh, [=]() {
-            float **a_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **x_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **y_array = (float **)::malloc(sizeof(float *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (y_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(y_array);
-                return;
-            }
+        host_task<class mkl_kernel_sgemv_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemv_batch");
+            float **a_array = scratch.allocate<float *>(batch_size);
+            float **x_array = scratch.allocate<float *>(batch_size);
+            float **y_array = scratch.allocate<float *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (float *)a + i * stride_a;
                 x_array[i] = (float *)x + i * stride_x;
@@ -1256,10 +1082,6 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m,
                                 (const float **)x_array, (const MKL_INT *)&incx, &beta,
                                 (float **)y_array, (const MKL_INT *)&incy, one,
                                 (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(y_array);
         });
     });
     return done;
@@ -1277,17 +1099,11 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m,
         }
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_dgemv_batch_strided_usm>(cgh, [=]() {
-            double **a_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **x_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **y_array = (double **)::malloc(sizeof(double *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (y_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(y_array);
-                return;
-            }
+        host_task<class mkl_kernel_dgemv_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemv_batch");
+            double **a_array = scratch.allocate<double *>(batch_size);
+            double **x_array = scratch.allocate<double *>(batch_size);
+            double **y_array = scratch.allocate<double *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (double *)a + i * stride_a;
                 x_array[i] = (double *)x + i * stride_x;
@@ -1298,10 +1114,6 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m,
                                 (const double **)x_array, (const MKL_INT *)&incx, &beta,
                                 (double **)y_array, (const MKL_INT *)&incy, one,
                                 (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(y_array);
         });
     });
     return done;
@@ -1320,20 +1132,11 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m,
         }
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_cgemv_batch_strided_usm>(cgh, [=]() {
-            std::complex<float> **a_array =
-                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
-            std::complex<float> **x_array =
-                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
-            std::complex<float> **y_array =
-                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (y_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(y_array);
-                return;
-            }
+        host_task<class mkl_kernel_cgemv_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemv_batch");
+            std::complex<float> **a_array = scratch.allocate<std::complex<float> *>(batch_size);
+            std::complex<float> **x_array = scratch.allocate<std::complex<float> *>(batch_size);
+            std::complex<float> **y_array = scratch.allocate<std::complex<float> *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (std::complex<float> *)a + i * stride_a;
                 x_array[i] = (std::complex<float> *)x + i * stride_x;
@@ -1344,10 +1147,6 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m,
                                 (const void **)x_array, (const MKL_INT *)&incx, &beta,
                                 (void **)y_array, (const MKL_INT *)&incy, one,
                                 (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(y_array);
         });
     });
     return done;
@@ -1366,20 +1165,11 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m,
         }
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_zgemv_batch_strided_usm>(cgh, [=]() {
-            std::complex<double> **a_array =
-                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
-            std::complex<double> **x_array =
-                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
-            std::complex<double> **y_array =
-                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (y_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(y_array);
-                return;
-            }
+        host_task<class mkl_kernel_zgemv_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemv_batch");
+            std::complex<double> **a_array = scratch.allocate<std::complex<double> *>(batch_size);
+            std::complex<double> **x_array = scratch.allocate<std::complex<double> *>(batch_size);
+            std::complex<double> **y_array = scratch.allocate<std::complex<double> *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (std::complex<double> *)a + i * stride_a;
                 x_array[i] = (std::complex<double> *)x + i * stride_x;
@@ -1390,10 +1180,6 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m,
                                 (const void **)x_array, (const MKL_INT *)&incx, &beta,
                                 (void **)y_array, (const MKL_INT *)&incy, one,
                                 (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(y_array);
         });
     });
     return done;
@@ -1409,14 +1195,9 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_sgemv_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *transa_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            if (transa_ == NULL) {
-                std::cout << "Error cannot allocate trans arrays\n";
-                ::free(transa_);
-                return;
-            }
+        host_task<class mkl_kernel_sgemv_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemv_batch");
+            CBLAS_TRANSPOSE *transa_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 transa_[i] = cblas_convert(transa[i]);
             }
@@ -1424,7 +1205,6 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m
                                 (const float **)a, (const MKL_INT *)lda, (const float **)x,
                                 (const MKL_INT *)incx, beta, y, (const MKL_INT *)incy, group_count,
                                 (const MKL_INT *)groupsize);
-            ::free(transa_);
         });
     });
     return done;
@@ -1440,14 +1220,9 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_dgemv_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *transa_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            if (transa_ == NULL) {
-                std::cout << "Error cannot allocate trans arrays\n";
-                ::free(transa_);
-                return;
-            }
+        host_task<class mkl_kernel_dgemv_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemv_batch");
+            CBLAS_TRANSPOSE *transa_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 transa_[i] = cblas_convert(transa[i]);
             }
@@ -1455,7 +1230,6 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m
                                 (const double **)a, (const MKL_INT *)lda, (const double **)x,
                                 (const MKL_INT *)incx, beta, y, (const MKL_INT *)incy, group_count,
                                 (const MKL_INT *)groupsize);
-            ::free(transa_);
         });
     });
     return done;
@@ -1471,14 +1245,9 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_cgemv_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *transa_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            if (transa_ == NULL) {
-                std::cout << "Error cannot allocate trans arrays\n";
-                ::free(transa_);
-                return;
-            }
+        host_task<class mkl_kernel_cgemv_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemv_batch");
+            CBLAS_TRANSPOSE *transa_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 transa_[i] = cblas_convert(transa[i]);
             }
@@ -1486,7 +1255,6 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m
                                 (const void **)a, (const MKL_INT *)lda, (const void **)x,
                                 (const MKL_INT *)incx, beta, (void **)y, (const MKL_INT *)incy,
                                 group_count, (const MKL_INT *)groupsize);
-            ::free(transa_);
         });
     });
     return done;
@@ -1503,14 +1271,9 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_zgemv_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *transa_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            if (transa_ == NULL) {
-                std::cout << "Error cannot allocate trans arrays\n";
-                ::free(transa_);
-                return;
-            }
+        host_task<class mkl_kernel_zgemv_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemv_batch");
+            CBLAS_TRANSPOSE *transa_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 transa_[i] = cblas_convert(transa[i]);
             }
@@ -1518,7 +1281,6 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m
                                 (const void **)a, (const MKL_INT *)lda, (const void **)x,
                                 (const MKL_INT *)incx, beta, (void **)y, (const MKL_INT *)incy,
                                 group_count, (const MKL_INT *)groupsize);
-            ::free(transa_);
         });
     });
     return done;
@@ -1535,17 +1297,11 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, i
         }
         CBLAS_SIDE left_right_ = cblas_convert(left_right);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_sdgmm_batch_strided_usm>(cgh, [=]() {
-            float **a_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **x_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **c_array = (float **)::malloc(sizeof(float *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_sdgmm_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "dgmm_batch");
+            float **a_array = scratch.allocate<float *>(batch_size);
+            float **x_array = scratch.allocate<float *>(batch_size);
+            float **c_array = scratch.allocate<float *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (float *)a + i * stride_a;
                 x_array[i] = (float *)x + i * stride_x;
@@ -1555,10 +1311,6 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, i
                                 (const float **)a_array, (const MKL_INT *)&lda,
                                 (const float **)x_array, (const MKL_INT *)&incx, (float **)c_array,
                                 (const MKL_INT *)&ldc, one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(c_array);
         });
     });
     return done;
@@ -1575,17 +1327,11 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, i
         }
         CBLAS_SIDE left_right_ = cblas_convert(left_right);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_ddgmm_batch_strided_usm>(cgh, [=]() {
-            double **a_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **x_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **c_array = (double **)::malloc(sizeof(double *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_ddgmm_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "dgmm_batch");
+            double **a_array = scratch.allocate<double *>(batch_size);
+            double **x_array = scratch.allocate<double *>(batch_size);
+            double **c_array = scratch.allocate<double *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (double *)a + i * stride_a;
                 x_array[i] = (double *)x + i * stride_x;
@@ -1596,10 +1342,6 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, i
                                 (const double **)x_array, (const MKL_INT *)&incx,
                                 (double **)c_array, (const MKL_INT *)&ldc, one,
                                 (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(c_array);
         });
     });
     return done;
@@ -1617,20 +1359,11 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, i
         }
         CBLAS_SIDE left_right_ = cblas_convert(left_right);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_cdgmm_batch_strided_usm>(cgh, [=]() {
-            std::complex<float> **a_array =
-                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
-            std::complex<float> **x_array =
-                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
-            std::complex<float> **c_array =
-                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_cdgmm_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "dgmm_batch");
+            std::complex<float> **a_array = scratch.allocate<std::complex<float> *>(batch_size);
+            std::complex<float> **x_array = scratch.allocate<std::complex<float> *>(batch_size);
+            std::complex<float> **c_array = scratch.allocate<std::complex<float> *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (std::complex<float> *)a + i * stride_a;
                 x_array[i] = (std::complex<float> *)x + i * stride_x;
@@ -1640,10 +1373,6 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, i
                                 (const void **)a_array, (const MKL_INT *)&lda,
                                 (const void **)x_array, (const MKL_INT *)&incx, (void **)c_array,
                                 (const MKL_INT *)&ldc, one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(c_array);
         });
     });
     return done;
@@ -1661,20 +1390,11 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, i
         }
         CBLAS_SIDE left_right_ = cblas_convert(left_right);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_zdgmm_batch_strided_usm>(cgh, [=]() {
-            std::complex<double> **a_array =
-                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
-            std::complex<double> **x_array =
-                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
-            std::complex<double> **c_array =
-                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
-            if ((a_array == NULL) || (x_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(x_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_zdgmm_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "dgmm_batch");
+            std::complex<double> **a_array = scratch.allocate<std::complex<double> *>(batch_size);
+            std::complex<double> **x_array = scratch.allocate<std::complex<double> *>(batch_size);
+            std::complex<double> **c_array = scratch.allocate<std::complex<double> *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (std::complex<double> *)a + i * stride_a;
                 x_array[i] = (std::complex<double> *)x + i * stride_x;
@@ -1684,10 +1404,6 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, i
                                 (const void **)a_array, (const MKL_INT *)&lda,
                                 (const void **)x_array, (const MKL_INT *)&incx, (void **)c_array,
                                 (const MKL_INT *)&ldc, one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(x_array);
-            ::free(c_array);
         });
     });
     return done;
@@ -1702,13 +1418,9 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side *left_right, int64_t *m,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_sdgmm_batch_group_usm>(cgh, [=]() {
-            CBLAS_SIDE *left_right_ = (CBLAS_SIDE *)::malloc(sizeof(CBLAS_SIDE) * group_count);
-            if (left_right_ == NULL) {
-                std::cout << "Error cannot allocate side arrays\n";
-                ::free(left_right_);
-                return;
-            }
+        host_task<class mkl_kernel_sdgmm_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "dgmm_batch");
+            CBLAS_SIDE *left_right_ = scratch.allocate<CBLAS_SIDE>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 left_right_[i] = cblas_convert(left_right[i]);
             }
@@ -1716,7 +1428,6 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side *left_right, int64_t *m,
                                 (const float **)a, (const MKL_INT *)lda, (const float **)x,
                                 (const MKL_INT *)incx, c, (const MKL_INT *)ldc, group_count,
                                 (const MKL_INT *)groupsize);
-            ::free(left_right_);
         });
     });
     return done;
@@ -1731,13 +1442,9 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side *left_right, int64_t *m,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_ddgmm_batch_group_usm>(cgh, [=]() {
-            CBLAS_SIDE *left_right_ = (CBLAS_SIDE *)::malloc(sizeof(CBLAS_SIDE) * group_count);
-            if (left_right_ == NULL) {
-                std::cout << "Error cannot allocate side arrays\n";
-                ::free(left_right_);
-                return;
-            }
+        host_task<class mkl_kernel_ddgmm_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "dgmm_batch");
+            CBLAS_SIDE *left_right_ = scratch.allocate<CBLAS_SIDE>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 left_right_[i] = cblas_convert(left_right[i]);
             }
@@ -1745,7 +1452,6 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side *left_right, int64_t *m,
                                 (const double **)a, (const MKL_INT *)lda, (const double **)x,
                                 (const MKL_INT *)incx, c, (const MKL_INT *)ldc, group_count,
                                 (const MKL_INT *)groupsize);
-            ::free(left_right_);
         });
     });
     return done;
@@ -1761,13 +1467,9 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side *left_right, int64_t *m,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_cdgmm_batch_group_usm>(cgh, [=]() {
-            CBLAS_SIDE *left_right_ = (CBLAS_SIDE *)::malloc(sizeof(CBLAS_SIDE) * group_count);
-            if (left_right_ == NULL) {
-                std::cout << "Error cannot allocate side arrays\n";
-                ::free(left_right_);
-                return;
-            }
+        host_task<class mkl_kernel_cdgmm_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "dgmm_batch");
+            CBLAS_SIDE *left_right_ = scratch.allocate<CBLAS_SIDE>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 left_right_[i] = cblas_convert(left_right[i]);
             }
@@ -1775,7 +1477,6 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side *left_right, int64_t *m,
                                 (const void **)a, (const MKL_INT *)lda, (const void **)x,
                                 (const MKL_INT *)incx, (void **)c, (const MKL_INT *)ldc,
                                 group_count, (const MKL_INT *)groupsize);
-            ::free(left_right_);
         });
     });
     return done;
@@ -1791,13 +1492,9 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side *left_right, int64_t *m,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_zdgmm_batch_group_usm>(cgh, [=]() {
-            CBLAS_SIDE *left_right_ = (CBLAS_SIDE *)::malloc(sizeof(CBLAS_SIDE) * group_count);
-            if (left_right_ == NULL) {
-                std::cout << "Error cannot allocate side arrays\n";
-                ::free(left_right_);
-                return;
-            }
+        host_task<class mkl_kernel_zdgmm_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "dgmm_batch");
+            CBLAS_SIDE *left_right_ = scratch.allocate<CBLAS_SIDE>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 left_right_[i] = cblas_convert(left_right[i]);
             }
@@ -1805,7 +1502,6 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side *left_right, int64_t *m,
                                 (const void **)a, (const MKL_INT *)lda, (const void **)x,
                                 (const MKL_INT *)incx, (void **)c, (const MKL_INT *)ldc,
                                 group_count, (const MKL_INT *)groupsize);
-            ::free(left_right_);
         });
     });
     return done;
@@ -1821,17 +1517,10 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_sgemm_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *transa_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            CBLAS_TRANSPOSE *transb_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            if ((transa_ == NULL) || (transb_ == NULL)) {
-                std::cout << "Error cannot allocate trans arrays\n";
-                ::free(transa_);
-                ::free(transb_);
-                return;
-            }
+        host_task<class mkl_kernel_sgemm_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_batch");
+            CBLAS_TRANSPOSE *transa_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
+            CBLAS_TRANSPOSE *transb_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 transa_[i] = cblas_convert(transa[i]);
                 transb_[i] = cblas_convert(transb[i]);
@@ -1840,8 +1529,6 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                                 (const MKL_INT *)n, (const MKL_INT *)k, alpha, (const float **)a,
                                 (const MKL_INT *)lda, (const float **)b, (const MKL_INT *)ldb, beta,
                                 c, (const MKL_INT *)ldc, group_count, (const MKL_INT *)group_size);
-            ::free(transa_);
-            ::free(transb_);
         });
     });
     return done;
@@ -1857,17 +1544,10 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_dgemm_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *transa_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            CBLAS_TRANSPOSE *transb_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            if ((transa_ == NULL) || (transb_ == NULL)) {
-                std::cout << "Error cannot allocate trans arrays\n";
-                ::free(transa_);
-                ::free(transb_);
-                return;
-            }
+        host_task<class mkl_kernel_dgemm_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_batch");
+            CBLAS_TRANSPOSE *transa_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
+            CBLAS_TRANSPOSE *transb_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 transa_[i] = cblas_convert(transa[i]);
                 transb_[i] = cblas_convert(transb[i]);
@@ -1877,8 +1557,6 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                                 (const MKL_INT *)lda, (const double **)b, (const MKL_INT *)ldb,
                                 beta, c, (const MKL_INT *)ldc, group_count,
                                 (const MKL_INT *)group_size);
-            ::free(transa_);
-            ::free(transb_);
         });
     });
     return done;
@@ -1895,17 +1573,10 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_cgemm_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *transa_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            CBLAS_TRANSPOSE *transb_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            if ((transa_ == NULL) || (transb_ == NULL)) {
-                std::cout << "Error cannot allocate trans arrays\n";
-                ::free(transa_);
-                ::free(transb_);
-                return;
-            }
+        host_task<class mkl_kernel_cgemm_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_batch");
+            CBLAS_TRANSPOSE *transa_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
+            CBLAS_TRANSPOSE *transb_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 transa_[i] = cblas_convert(transa[i]);
                 transb_[i] = cblas_convert(transb[i]);
@@ -1915,8 +1586,6 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                                 (const MKL_INT *)lda, (const void **)b, (const MKL_INT *)ldb, beta,
                                 (void **)c, (const MKL_INT *)ldc, group_count,
                                 (const MKL_INT *)group_size);
-            ::free(transa_);
-            ::free(transb_);
         });
     });
     return done;
@@ -1933,17 +1602,10 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_zgemm_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *transa_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            CBLAS_TRANSPOSE *transb_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            if ((transa_ == NULL) || (transb_ == NULL)) {
-                std::cout << "Error cannot allocate trans arrays\n";
-                ::free(transa_);
-                ::free(transb_);
-                return;
-            }
+        host_task<class mkl_kernel_zgemm_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_batch");
+            CBLAS_TRANSPOSE *transa_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
+            CBLAS_TRANSPOSE *transb_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 transa_[i] = cblas_convert(transa[i]);
                 transb_[i] = cblas_convert(transb[i]);
@@ -1953,8 +1615,6 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                                 (const MKL_INT *)lda, (const void **)b, (const MKL_INT *)ldb, beta,
                                 (void **)c, (const MKL_INT *)ldc, group_count,
                                 (const MKL_INT *)group_size);
-            ::free(transa_);
-            ::free(transb_);
         });
     });
     return done;
@@ -1975,21 +1635,12 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_hgemm_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *transa_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            CBLAS_TRANSPOSE *transb_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            float *alphaf = (float *)::malloc(sizeof(float) * group_count);
-            float *betaf = (float *)::malloc(sizeof(float) * group_count);
-            if ((transa_ == NULL) || (transb_ == NULL) || (alphaf == NULL) || (betaf == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(transa_);
-                ::free(transb_);
-                ::free(alphaf);
-                ::free(betaf);
-                return;
-            }
+        host_task<class mkl_kernel_hgemm_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_batch");
+            CBLAS_TRANSPOSE *transa_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
+            CBLAS_TRANSPOSE *transb_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
+            float *alphaf = scratch.allocate<float>(group_count);
+            float *betaf = scratch.allocate<float>(group_count);
             int64_t totalbatch_size = 0;
             for (int64_t i = 0; i < group_count; i++) {
                 transa_[i] = cblas_convert(transa[i]);
@@ -1998,16 +1649,9 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                 betaf[i] = (float)beta[i];
                 totalbatch_size += groupsize[i];
             }
-            float **a_array = (float **)::malloc(sizeof(float *) * totalbatch_size);
-            float **b_array = (float **)::malloc(sizeof(float *) * totalbatch_size);
-            float **c_array = (float **)::malloc(sizeof(float *) * totalbatch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
+            float **a_array = scratch.allocate<float *>(totalbatch_size);
+            float **b_array = scratch.allocate<float *>(totalbatch_size);
+            float **c_array = scratch.allocate<float *>(totalbatch_size);
             int64_t sizea, sizeb, sizec, idx;
             half co = 0.0f;
             for (int64_t i = 0, idx = 0; i < group_count; i++) {
@@ -2022,9 +1666,9 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                 sizec = ldc[i] * m[i];
 #endif
                 for (int64_t j = 0; j < groupsize[i]; j++, idx++) {
-                    a_array[idx] = (float *)::malloc(sizeof(float) * sizea);
-                    b_array[idx] = (float *)::malloc(sizeof(float) * sizeb);
-                    c_array[idx] = (float *)::malloc(sizeof(float) * sizec);
+                    a_array[idx] = scratch.allocate<float>(sizea);
+                    b_array[idx] = scratch.allocate<float>(sizeb);
+                    c_array[idx] = scratch.allocate<float>(sizec);
                     copy_mat(a[idx], MKLMAJOR, transa[i], m[i], k[i], lda[i], 0.0f, a_array[idx]);
                     copy_mat(b[idx], MKLMAJOR, transb[i], k[i], n[i], ldb[i], 0.0f, b_array[idx]);
                     copy_mat(c[idx], MKLMAJOR, transpose::N, m[i], n[i], ldc[i], 0.0f,
@@ -2040,18 +1684,8 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                 sizec = ldc[i] * n[i];
                 for (int64_t j = 0; j < groupsize[i]; j++, idx++) {
                     copy_mat(c_array[idx], MKLMAJOR, m[i], n[i], ldc[i], offset::F, &co, c[idx]);
-                    ::free(a_array[idx]);
-                    ::free(b_array[idx]);
-                    ::free(c_array[idx]);
                 }
             }
-            ::free(alphaf);
-            ::free(betaf);
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
-            ::free(transa_);
-            ::free(transb_);
         });
     });
     return done;
@@ -2070,17 +1704,11 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_sgemm_batch_strided_usm>(cgh, [=]() {
-            float **a_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **b_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **c_array = (float **)::malloc(sizeof(float *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_sgemm_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_batch");
+            float **a_array = scratch.allocate<float *>(batch_size);
+            float **b_array = scratch.allocate<float *>(batch_size);
+            float **c_array = scratch.allocate<float *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (float *)a + i * stride_a;
                 b_array[i] = (float *)b + i * stride_b;
@@ -2091,10 +1719,6 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                 (const MKL_INT *)&k, &alpha, (const float **)a_array, (const MKL_INT *)&lda,
                 (const float **)b_array, (const MKL_INT *)&ldb, &beta, (float **)c_array,
                 (const MKL_INT *)&ldc, one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
         });
     });
     return done;
@@ -2113,17 +1737,11 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_dgemm_batch_strided_usm>(cgh, [=]() {
-            double **a_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **b_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **c_array = (double **)::malloc(sizeof(double *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_dgemm_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_batch");
+            double **a_array = scratch.allocate<double *>(batch_size);
+            double **b_array = scratch.allocate<double *>(batch_size);
+            double **c_array = scratch.allocate<double *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (double *)a + i * stride_a;
                 b_array[i] = (double *)b + i * stride_b;
@@ -2134,10 +1752,6 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                 (const MKL_INT *)&k, &alpha, (const double **)a_array, (const MKL_INT *)&lda,
                 (const double **)b_array, (const MKL_INT *)&ldb, &beta, (double **)c_array,
                 (const MKL_INT *)&ldc, one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
         });
     });
     return done;
@@ -2158,20 +1772,11 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_cgemm_batch_strided_usm>(cgh, [=]() {
-            std::complex<float> **a_array =
-                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
-            std::complex<float> **b_array =
-                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
-            std::complex<float> **c_array =
-                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_cgemm_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_batch");
+            std::complex<float> **a_array = scratch.allocate<std::complex<float> *>(batch_size);
+            std::complex<float> **b_array = scratch.allocate<std::complex<float> *>(batch_size);
+            std::complex<float> **c_array = scratch.allocate<std::complex<float> *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (std::complex<float> *)a + i * stride_a;
                 b_array[i] = (std::complex<float> *)b + i * stride_b;
@@ -2182,10 +1787,6 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                 (const MKL_INT *)&k, &alpha, (const void **)a_array, (const MKL_INT *)&lda,
                 (const void **)b_array, (const MKL_INT *)&ldb, &beta, (void **)c_array,
                 (const MKL_INT *)&ldc, one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
         });
     });
     return done;
@@ -2206,20 +1807,11 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_zgemm_batch_strided_usm>(cgh, [=]() {
-            std::complex<double> **a_array =
-                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
-            std::complex<double> **b_array =
-                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
-            std::complex<double> **c_array =
-                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
+        host_task<class mkl_kernel_zgemm_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_batch");
+            std::complex<double> **a_array = scratch.allocate<std::complex<double> *>(batch_size);
+            std::complex<double> **b_array = scratch.allocate<std::complex<double> *>(batch_size);
+            std::complex<double> **c_array = scratch.allocate<std::complex<double> *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (std::complex<double> *)a + i * stride_a;
                 b_array[i] = (std::complex<double> *)b + i * stride_b;
@@ -2230,10 +1822,6 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                 (const MKL_INT *)&k, &alpha, (const void **)a_array, (const MKL_INT *)&lda,
                 (const void **)b_array, (const MKL_INT *)&ldb, &beta, (void **)c_array,
                 (const MKL_INT *)&ldc, one, (const MKL_INT *)&batch_size);
-
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
         });
     });
     return done;
@@ -2257,7 +1845,8 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_hgemm_batch_strided_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_hgemm_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_batch");
             int64_t totalsize_a, totalsize_b, totalsize_c;
             int64_t size_a, size_b, size_c;
 #ifdef COLUMN_MAJOR
@@ -2275,31 +1864,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
             totalsize_c = (batch_size - 1) * stride_c + size_c;
 
             // copy A, B and C to float
-            float *f32_a = (float *)::malloc(sizeof(float) * totalsize_a);
-            float *f32_b = (float *)::malloc(sizeof(float) * totalsize_b);
-            float *f32_c = (float *)::malloc(sizeof(float) * totalsize_c);
-            if ((f32_a == NULL) || (f32_b == NULL) || (f32_c == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(f32_a);
-                ::free(f32_b);
-                ::free(f32_c);
-                return;
-            }
+            float *f32_a = scratch.allocate<float>(totalsize_a);
+            float *f32_b = scratch.allocate<float>(totalsize_b);
+            float *f32_c = scratch.allocate<float>(totalsize_c);
             copy_mat(a, MKL_COL_MAJOR, transpose::N, totalsize_a, 1, totalsize_a, 0.0f, f32_a);
             copy_mat(b, MKL_COL_MAJOR, transpose::N, totalsize_b, 1, totalsize_b, 0.0f, f32_b);
             copy_mat(c, MKL_COL_MAJOR, transpose::N, totalsize_c, 1, totalsize_c, 0.0f, f32_c);
 
             float alphaf = (float)alpha, betaf = (float)beta;
-            float **a_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **b_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **c_array = (float **)::malloc(sizeof(float *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL) || (c_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                ::free(c_array);
-                return;
-            }
+            float **a_array = scratch.allocate<float *>(batch_size);
+            float **b_array = scratch.allocate<float *>(batch_size);
+            float **c_array = scratch.allocate<float *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (float *)f32_a + i * stride_a;
                 b_array[i] = (float *)f32_b + i * stride_b;
@@ -2313,12 +1888,6 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
 
             half co = 0.0f;
             copy_mat(f32_c, MKL_COL_MAJOR, totalsize_c, 1, totalsize_c, offset::F, &co, c);
-            ::free(a_array);
-            ::free(b_array);
-            ::free(c_array);
-            ::free(f32_a);
-            ::free(f32_b);
-            ::free(f32_c);
         });
     });
     return done;
@@ -2339,15 +1908,10 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_l
         CBLAS_UPLO uplo_ = cblas_convert(upper_lower);
         CBLAS_DIAG diag_ = cblas_convert(unit_diag);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_strsm_batch_strided_usm>(cgh, [=]() {
-            float **a_array = (float **)::malloc(sizeof(float *) * batch_size);
-            float **b_array = (float **)::malloc(sizeof(float *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                return;
-            }
+        host_task<class mkl_kernel_strsm_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "trsm_batch");
+            float **a_array = scratch.allocate<float *>(batch_size);
+            float **b_array = scratch.allocate<float *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (float *)a + i * stride_a;
                 b_array[i] = (float *)b + i * stride_b;
@@ -2356,8 +1920,6 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_l
                                 (const MKL_INT *)&n, &alpha, (const float **)a_array,
                                 (const MKL_INT *)&lda, (float **)b_array, (const MKL_INT *)&ldb,
                                 one, (const MKL_INT *)&batch_size);
-            ::free(a_array);
-            ::free(b_array);
         });
     });
     return done;
@@ -2378,15 +1940,10 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_l
         CBLAS_UPLO uplo_ = cblas_convert(upper_lower);
         CBLAS_DIAG diag_ = cblas_convert(unit_diag);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_dtrsm_batch_strided_usm>(cgh, [=]() {
-            double **a_array = (double **)::malloc(sizeof(double *) * batch_size);
-            double **b_array = (double **)::malloc(sizeof(double *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                return;
-            }
+        host_task<class mkl_kernel_dtrsm_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "trsm_batch");
+            double **a_array = scratch.allocate<double *>(batch_size);
+            double **b_array = scratch.allocate<double *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (double *)a + i * stride_a;
                 b_array[i] = (double *)b + i * stride_b;
@@ -2395,8 +1952,6 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_l
                                 (const MKL_INT *)&n, &alpha, (const double **)a_array,
                                 (const MKL_INT *)&lda, (double **)b_array, (const MKL_INT *)&ldb,
                                 one, (const MKL_INT *)&batch_size);
-            ::free(a_array);
-            ::free(b_array);
         });
     });
     return done;
@@ -2417,17 +1972,10 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_l
         CBLAS_UPLO uplo_ = cblas_convert(upper_lower);
         CBLAS_DIAG diag_ = cblas_convert(unit_diag);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_ctrsm_batch_strided_usm>(cgh, [=]() {
-            std::complex<float> **a_array =
-                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
-            std::complex<float> **b_array =
-                (std::complex<float> **)::malloc(sizeof(std::complex<float> *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                return;
-            }
+        host_task<class mkl_kernel_ctrsm_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "trsm_batch");
+            std::complex<float> **a_array = scratch.allocate<std::complex<float> *>(batch_size);
+            std::complex<float> **b_array = scratch.allocate<std::complex<float> *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (std::complex<float> *)a + i * stride_a;
                 b_array[i] = (std::complex<float> *)b + i * stride_b;
@@ -2436,8 +1984,6 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_l
                                 (const MKL_INT *)&n, &alpha, (const void **)a_array,
                                 (const MKL_INT *)&lda, (void **)b_array, (const MKL_INT *)&ldb, one,
                                 (const MKL_INT *)&batch_size);
-            ::free(a_array);
-            ::free(b_array);
         });
     });
     return done;
@@ -2458,17 +2004,10 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_l
         CBLAS_UPLO uplo_ = cblas_convert(upper_lower);
         CBLAS_DIAG diag_ = cblas_convert(unit_diag);
         MKL_INT one = 1;
-        host_task<class mkl_kernel_ztrsm_batch_strided_usm>(cgh, [=]() {
-            std::complex<double> **a_array =
-                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
-            std::complex<double> **b_array =
-                (std::complex<double> **)::malloc(sizeof(std::complex<double> *) * batch_size);
-            if ((a_array == NULL) || (b_array == NULL)) {
-                std::cout << "Error cannot allocate input arrays\n";
-                ::free(a_array);
-                ::free(b_array);
-                return;
-            }
+        host_task<class mkl_kernel_ztrsm_batch_strided_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "trsm_batch");
+            std::complex<double> **a_array = scratch.allocate<std::complex<double> *>(batch_size);
+            std::complex<double> **b_array = scratch.allocate<std::complex<double> *>(batch_size);
             for (int64_t i = 0; i < batch_size; i++) {
                 a_array[i] = (std::complex<double> *)a + i * stride_a;
                 b_array[i] = (std::complex<double> *)b + i * stride_b;
@@ -2477,8 +2016,6 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_l
                                 (const MKL_INT *)&n, &alpha, (const void **)a_array,
                                 (const MKL_INT *)&lda, (void **)b_array, (const MKL_INT *)&ldb, one,
                                 (const MKL_INT *)&batch_size);
-            ::free(a_array);
-            ::free(b_array);
         });
     });
     return done;
@@ -2495,20 +2032,12 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper
             cgh.depends_on(dependencies[i]);
         }
         MKL_INT one = 1;
-        host_task<class mkl_kernel_strsm_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *trans_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            CBLAS_SIDE *side_ = (CBLAS_SIDE *)::malloc(sizeof(CBLAS_SIDE) * group_count);
-            CBLAS_UPLO *uplo_ = (CBLAS_UPLO *)::malloc(sizeof(CBLAS_UPLO) * group_count);
-            CBLAS_DIAG *diag_ = (CBLAS_DIAG *)::malloc(sizeof(CBLAS_DIAG) * group_count);
-            if ((trans_ == NULL) || (side_ == NULL) || (uplo_ == NULL) || (diag_ == NULL)) {
-                std::cout << "Error cannot allocate parameter arrays\n";
-                ::free(trans_);
-                ::free(side_);
-                ::free(uplo_);
-                ::free(diag_);
-                return;
-            }
+        host_task<class mkl_kernel_strsm_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "trsm_batch");
+            CBLAS_TRANSPOSE *trans_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
+            CBLAS_SIDE *side_ = scratch.allocate<CBLAS_SIDE>(group_count);
+            CBLAS_UPLO *uplo_ = scratch.allocate<CBLAS_UPLO>(group_count);
+            CBLAS_DIAG *diag_ = scratch.allocate<CBLAS_DIAG>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 trans_[i] = (CBLAS_TRANSPOSE)cblas_convert(trans[i]);
                 side_[i] = (CBLAS_SIDE)cblas_convert(left_right[i]);
@@ -2539,20 +2068,12 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper
             cgh.depends_on(dependencies[i]);
         }
         MKL_INT one = 1;
-        host_task<class mkl_kernel_dtrsm_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *trans_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            CBLAS_SIDE *side_ = (CBLAS_SIDE *)::malloc(sizeof(CBLAS_SIDE) * group_count);
-            CBLAS_UPLO *uplo_ = (CBLAS_UPLO *)::malloc(sizeof(CBLAS_UPLO) * group_count);
-            CBLAS_DIAG *diag_ = (CBLAS_DIAG *)::malloc(sizeof(CBLAS_DIAG) * group_count);
-            if ((trans_ == NULL) || (side_ == NULL) || (uplo_ == NULL) || (diag_ == NULL)) {
-                std::cout << "Error cannot allocate parameter arrays\n";
-                ::free(trans_);
-                ::free(side_);
-                ::free(uplo_);
-                ::free(diag_);
-                return;
-            }
+        host_task<class mkl_kernel_dtrsm_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "trsm_batch");
+            CBLAS_TRANSPOSE *trans_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
+            CBLAS_SIDE *side_ = scratch.allocate<CBLAS_SIDE>(group_count);
+            CBLAS_UPLO *uplo_ = scratch.allocate<CBLAS_UPLO>(group_count);
+            CBLAS_DIAG *diag_ = scratch.allocate<CBLAS_DIAG>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 trans_[i] = cblas_convert(trans[i]);
                 side_[i] = cblas_convert(left_right[i]);
@@ -2583,20 +2104,12 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper
             cgh.depends_on(dependencies[i]);
         }
         MKL_INT one = 1;
-        host_task<class mkl_kernel_ctrsm_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *trans_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            CBLAS_SIDE *side_ = (CBLAS_SIDE *)::malloc(sizeof(CBLAS_SIDE) * group_count);
-            CBLAS_UPLO *uplo_ = (CBLAS_UPLO *)::malloc(sizeof(CBLAS_UPLO) * group_count);
-            CBLAS_DIAG *diag_ = (CBLAS_DIAG *)::malloc(sizeof(CBLAS_DIAG) * group_count);
-            if ((trans_ == NULL) || (side_ == NULL) || (uplo_ == NULL) || (diag_ == NULL)) {
-                std::cout << "Error cannot allocate parameter arrays\n";
-                ::free(trans_);
-                ::free(side_);
-                ::free(uplo_);
-                ::free(diag_);
-                return;
-            }
+        host_task<class mkl_kernel_ctrsm_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "trsm_batch");
+            CBLAS_TRANSPOSE *trans_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
+            CBLAS_SIDE *side_ = scratch.allocate<CBLAS_SIDE>(group_count);
+            CBLAS_UPLO *uplo_ = scratch.allocate<CBLAS_UPLO>(group_count);
+            CBLAS_DIAG *diag_ = scratch.allocate<CBLAS_DIAG>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 trans_[i] = cblas_convert(trans[i]);
                 side_[i] = cblas_convert(left_right[i]);
@@ -2628,20 +2141,12 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper
             cgh.depends_on(dependencies[i]);
         }
         MKL_INT one = 1;
-        host_task<class mkl_kernel_ztrsm_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *trans_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            CBLAS_SIDE *side_ = (CBLAS_SIDE *)::malloc(sizeof(CBLAS_SIDE) * group_count);
-            CBLAS_UPLO *uplo_ = (CBLAS_UPLO *)::malloc(sizeof(CBLAS_UPLO) * group_count);
-            CBLAS_DIAG *diag_ = (CBLAS_DIAG *)::malloc(sizeof(CBLAS_DIAG) * group_count);
-            if ((trans_ == NULL) || (side_ == NULL) || (uplo_ == NULL) || (diag_ == NULL)) {
-                std::cout << "Error cannot allocate parameter arrays\n";
-                ::free(trans_);
-                ::free(side_);
-                ::free(uplo_);
-                ::free(diag_);
-                return;
-            }
+        host_task<class mkl_kernel_ztrsm_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "trsm_batch");
+            CBLAS_TRANSPOSE *trans_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
+            CBLAS_SIDE *side_ = scratch.allocate<CBLAS_SIDE>(group_count);
+            CBLAS_UPLO *uplo_ = scratch.allocate<CBLAS_UPLO>(group_count);
+            CBLAS_DIAG *diag_ = scratch.allocate<CBLAS_DIAG>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 trans_[i] = cblas_convert(trans[i]);
                 side_[i] = cblas_convert(left_right[i]);
@@ -2670,10 +2175,10 @@ cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo *upper_lower, transpose
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_ssyrk_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *trans_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            CBLAS_UPLO *uplo_ = (CBLAS_UPLO *)::malloc(sizeof(CBLAS_UPLO) * group_count);
+        host_task<class mkl_kernel_ssyrk_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "syrk_batch");
+            CBLAS_TRANSPOSE *trans_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
+            CBLAS_UPLO *uplo_ = scratch.allocate<CBLAS_UPLO>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 trans_[i] = cblas_convert(trans[i]);
                 uplo_[i] = cblas_convert(upper_lower[i]);
@@ -2697,10 +2202,10 @@ cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo *upper_lower, transpose
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_dsyrk_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *trans_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            CBLAS_UPLO *uplo_ = (CBLAS_UPLO *)::malloc(sizeof(CBLAS_UPLO) * group_count);
+        host_task<class mkl_kernel_dsyrk_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "syrk_batch");
+            CBLAS_TRANSPOSE *trans_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
+            CBLAS_UPLO *uplo_ = scratch.allocate<CBLAS_UPLO>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 trans_[i] = cblas_convert(trans[i]);
                 uplo_[i] = cblas_convert(upper_lower[i]);
@@ -2725,10 +2230,10 @@ cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo *upper_lower, transpose
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_csyrk_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *trans_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            CBLAS_UPLO *uplo_ = (CBLAS_UPLO *)::malloc(sizeof(CBLAS_UPLO) * group_count);
+        host_task<class mkl_kernel_csyrk_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "syrk_batch");
+            CBLAS_TRANSPOSE *trans_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
+            CBLAS_UPLO *uplo_ = scratch.allocate<CBLAS_UPLO>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 trans_[i] = cblas_convert(trans[i]);
                 uplo_[i] = cblas_convert(upper_lower[i]);
@@ -2754,10 +2259,10 @@ cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo *upper_lower, transpose
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_zsyrk_batch_group_usm>(cgh, [=]() {
-            CBLAS_TRANSPOSE *trans_ =
-                (CBLAS_TRANSPOSE *)::malloc(sizeof(CBLAS_TRANSPOSE) * group_count);
-            CBLAS_UPLO *uplo_ = (CBLAS_UPLO *)::malloc(sizeof(CBLAS_UPLO) * group_count);
+        host_task<class mkl_kernel_zsyrk_batch_group_usm>(queue, cgh, [=]() {
+            oneapi::mkl::detail::scratch_arena::scope scratch("blas", "syrk_batch");
+            CBLAS_TRANSPOSE *trans_ = scratch.allocate<CBLAS_TRANSPOSE>(group_count);
+            CBLAS_UPLO *uplo_ = scratch.allocate<CBLAS_UPLO>(group_count);
             for (int64_t i = 0; i < group_count; i++) {
                 trans_[i] = cblas_convert(trans[i]);
                 uplo_[i] = cblas_convert(upper_lower[i]);
@@ -2784,7 +2289,7 @@ cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose t
         }
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_UPLO uplo_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_ssyrk_batch_strided_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ssyrk_batch_strided_usm>(queue, cgh, [=]() {
             ::cblas_ssyrk_batch_strided(CBLASMAJOR, uplo_, trans_, n, k, alpha, a, lda, stride_a,
                                         beta, c, ldc, stride_c, batch_size);
         });
@@ -2803,7 +2308,7 @@ cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose t
         }
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_UPLO uplo_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_dsyrk_batch_strided_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dsyrk_batch_strided_usm>(queue, cgh, [=]() {
             ::cblas_dsyrk_batch_strided(CBLASMAJOR, uplo_, trans_, n, k, alpha, a, lda, stride_a,
                                         beta, c, ldc, stride_c, batch_size);
         });
@@ -2825,7 +2330,7 @@ cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose t
         CBLAS_UPLO uplo_ = cblas_convert(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_csyrk_batch_strided_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_csyrk_batch_strided_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_csyrk_batch_strided(CBLASMAJOR, uplo_, trans_, n, k, (const void *)&alpha_, a,
@@ -2850,7 +2355,7 @@ cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose t
         CBLAS_UPLO uplo_ = cblas_convert(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zsyrk_batch_strided_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zsyrk_batch_strided_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zsyrk_batch_strided(CBLASMAJOR, uplo_, trans_, n, k, (const void *)&alpha_, a,
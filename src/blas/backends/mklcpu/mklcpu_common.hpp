@@ -30,9 +30,14 @@
 #include "mkl_cblas.h"
 
 #include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
+#include "oneapi/mkl/detail/config.hpp"
 #include "oneapi/mkl/types.hpp"
 #include "runtime_support_helper.hpp"
 
+#ifdef ENABLE_MKLCPU_THREAD_TBB
+#include <tbb/task_arena.h>
+#endif
+
 namespace oneapi {
 namespace mkl {
 namespace blas {
@@ -55,6 +60,40 @@ static inline void host_task(H &cgh, F f) {
     (void)host_task_internal<K>(cgh, f, 0);
 }
 
+// Host tasks of queues with the shared thread policy run MKL in a task arena limited to an even
+// share of its threads among the host tasks running at the same time, capped by the threads that
+// the running tasks have not taken. The share is taken when the task starts and given back when
+// it ends.
+int thread_governor_enter();
+void thread_governor_exit(int threads);
+
+template <typename K, typename H, typename F>
+static inline void host_task(cl::sycl::queue &queue, H &cgh, F f) {
+#ifdef ENABLE_MKLCPU_THREAD_TBB
+    bool shared = get_thread_policy(queue) == thread_policy::shared;
+    host_task<K>(cgh, [=]() {
+        if (!shared) {
+            f();
+            return;
+        }
+        struct governor_guard {
+            int threads = thread_governor_enter();
+            ~governor_guard() {
+                thread_governor_exit(threads);
+            }
+        } guard;
+        tbb::task_arena arena(guard.threads);
+        arena.execute(f);
+    });
+#else
+    host_task<K>(cgh, f);
+#endif
+}
+
+// bfloat16 data is handed to MKL in place, without conversion.
+static_assert(sizeof(bfloat16) == sizeof(MKL_BF16) && alignof(bfloat16) == alignof(MKL_BF16),
+              "bfloat16 must have the layout of MKL_BF16");
+
 // Conversion functions to traditional Fortran characters.
 inline const char *fortran_char(transpose t) {
     if (t == transpose::nontrans)
@@ -143,6 +182,12 @@ inline CBLAS_OFFSET cblas_convert(oneapi::mkl::offset o) {
     return CblasRowOffset;
 }
 
+inline CBLAS_IDENTIFIER cblas_convert(identifier i) {
+    if (i == identifier::B)
+        return CblasBMatrix;
+    return CblasAMatrix;
+}
+
 template <typename transpose_type>
 inline bool isNonTranspose(transpose_type trans) {
     return true;
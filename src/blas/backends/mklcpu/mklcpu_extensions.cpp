@@ -20,6 +20,7 @@
 #include <CL/sycl.hpp>
 
 #include "mklcpu_common.hpp"
+#include "mklcpu_gemm_bias.hpp"
 #include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 
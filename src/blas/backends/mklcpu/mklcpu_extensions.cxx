@@ -27,43 +27,17 @@ void gemm_bias_fallback(cl::sycl::queue &queue, MKL_LAYOUT layout, transpose tra
                         cl::sycl::buffer<int32_t, 1> &c, int64_t ldc,
                         cl::sycl::buffer<int32_t, 1> &co) {
     queue.submit([&](cl::sycl::handler &cgh) {
-        auto transa_ = cblas_convert(transa);
-        auto transb_ = cblas_convert(transb);
-        auto offsetc_ = cblas_convert(offsetc);
-        int64_t sizea, sizeb, sizec;
-#ifdef COLUMN_MAJOR
-        sizea = (transa == transpose::nontrans) ? lda * k : lda * m;
-        sizeb = (transb == transpose::nontrans) ? ldb * n : ldb * k;
-        sizec = ldc * n;
-#endif
-#ifdef ROW_MAJOR
-        sizea = (transa == transpose::nontrans) ? lda * m : lda * k;
-        sizeb = (transb == transpose::nontrans) ? ldb * k : ldb * n;
-        sizec = ldc * m;
-#endif
         auto accessor_a = a.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_co = co.template get_access<cl::sycl::access::mode::read>(cgh);
-        host_task<class mkl_kernel_gemm_bias_fallback>(cgh, [=]() {
-            auto a_mat = (Ta *)static_cast<void *>(accessor_a.get_pointer());
-            auto b_mat = (Tb *)static_cast<void *>(accessor_b.get_pointer());
+        host_task<class mkl_kernel_gemm_bias_fallback>(queue, cgh, [=]() {
+            auto a_mat = (const Ta *)static_cast<void *>(accessor_a.get_pointer());
+            auto b_mat = (const Tb *)static_cast<void *>(accessor_b.get_pointer());
             auto c_mat = (int32_t *)static_cast<void *>(accessor_c.get_pointer());
-            auto co_vec = (int32_t *)static_cast<void *>(accessor_co.get_pointer());
-            auto ad = (double *)malloc(sizeof(double) * sizea);
-            auto bd = (double *)malloc(sizeof(double) * sizeb);
-            auto cd = (double *)malloc(sizeof(double) * sizec);
-            double alphad = alpha, betad = beta;
-            double aod = ao, bod = bo;
-            copy_mat(a_mat, layout, transa, m, k, lda, aod, ad);
-            copy_mat(b_mat, layout, transb, k, n, ldb, bod, bd);
-            copy_mat(c_mat, layout, MKL_NOTRANS, m, n, ldc, 0.0, cd);
-            ::cblas_dgemm((CBLAS_LAYOUT)layout, transa_, transb_, m, n, k, alphad, ad, lda, bd, ldb,
-                          betad, cd, ldc);
-            copy_mat(cd, layout, m, n, ldc, offsetc_, co_vec, c_mat);
-            free(ad);
-            free(bd);
-            free(cd);
+            auto co_vec = (const int32_t *)static_cast<void *>(accessor_co.get_pointer());
+            int8_gemm_bias(layout, transa, transb, offsetc, m, n, k, alpha, a_mat, lda, ao, b_mat,
+                           ldb, bo, beta, c_mat, ldc, co_vec);
         });
     });
 }
@@ -92,7 +66,7 @@ void gemm_bias(cl::sycl::queue &queue, transpose transa, transpose transb, offse
             auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
             auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
             auto accessor_co = co.get_access<cl::sycl::access::mode::read>(cgh);
-            host_task<class mkl_kernel_gemm_s8u8s32>(cgh, [=]() {
+            host_task<class mkl_kernel_gemm_s8u8s32>(queue, cgh, [=]() {
                 MKL_INT8 *a_mat =
                     static_cast<MKL_INT8 *>(static_cast<void *>(accessor_a.get_pointer()));
                 MKL_UINT8 *b_mat =
@@ -137,7 +111,7 @@ void gemm_bias(cl::sycl::queue &queue, transpose transa, transpose transb, offse
             auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
             auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
             auto accessor_co = co.get_access<cl::sycl::access::mode::read>(cgh);
-            host_task<class mkl_kernel_gemm_u8s8s32>(cgh, [=]() {
+            host_task<class mkl_kernel_gemm_u8s8s32>(queue, cgh, [=]() {
                 MKL_UINT8 *a_mat =
                     static_cast<MKL_UINT8 *>(static_cast<void *>(accessor_a.get_pointer()));
                 MKL_INT8 *b_mat =
@@ -177,7 +151,7 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sgemmt>(cgh, [=]() {
+        host_task<class mkl_kernel_sgemmt>(queue, cgh, [=]() {
             ::cblas_sgemmt(CBLASMAJOR, upper_lower_, transa_, transb_, n, k, alpha,
                            accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb, beta,
                            accessor_c.get_pointer(), ldc);
@@ -196,7 +170,7 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dgemmt>(cgh, [=]() {
+        host_task<class mkl_kernel_dgemmt>(queue, cgh, [=]() {
             ::cblas_dgemmt(CBLASMAJOR, upper_lower_, transa_, transb_, n, k, alpha,
                            accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb, beta,
                            accessor_c.get_pointer(), ldc);
@@ -217,7 +191,7 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cgemmt>(cgh, [=]() {
+        host_task<class mkl_kernel_cgemmt>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_cgemmt(CBLASMAJOR, upper_lower_, transa_, transb_, n, k, (const void *)&alpha_,
@@ -240,7 +214,7 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zgemmt>(cgh, [=]() {
+        host_task<class mkl_kernel_zgemmt>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zgemmt(CBLASMAJOR, upper_lower_, transa_, transb_, n, k, (const void *)&alpha_,
@@ -250,6 +224,138 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
     });
 }
 
+template <>
+std::int64_t gemm_pack_get_size<float>(cl::sycl::queue &queue, identifier which, int64_t m,
+                                       int64_t n, int64_t k) {
+    // cblas reports the size of the packed format in bytes
+    std::size_t bytes = ::cblas_sgemm_pack_get_size(cblas_convert(which), m, n, k);
+    return (bytes + sizeof(float) - 1) / sizeof(float);
+}
+
+template <>
+std::int64_t gemm_pack_get_size<double>(cl::sycl::queue &queue, identifier which, int64_t m,
+                                        int64_t n, int64_t k) {
+    std::size_t bytes = ::cblas_dgemm_pack_get_size(cblas_convert(which), m, n, k);
+    return (bytes + sizeof(double) - 1) / sizeof(double);
+}
+
+void gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+               int64_t k, float alpha, cl::sycl::buffer<float, 1> &src, int64_t ld,
+               cl::sycl::buffer<float, 1> &dest) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        CBLAS_IDENTIFIER which_ = cblas_convert(which);
+        CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
+        auto accessor_src = src.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_dest = dest.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_sgemm_pack>(queue, cgh, [=]() {
+            ::cblas_sgemm_pack(CBLASMAJOR, which_, trans_, m, n, k, alpha,
+                               accessor_src.get_pointer(), ld, accessor_dest.get_pointer());
+        });
+    });
+}
+
+void gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+               int64_t k, double alpha, cl::sycl::buffer<double, 1> &src, int64_t ld,
+               cl::sycl::buffer<double, 1> &dest) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        CBLAS_IDENTIFIER which_ = cblas_convert(which);
+        CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
+        auto accessor_src = src.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_dest = dest.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class mkl_kernel_dgemm_pack>(queue, cgh, [=]() {
+            ::cblas_dgemm_pack(CBLASMAJOR, which_, trans_, m, n, k, alpha,
+                               accessor_src.get_pointer(), ld, accessor_dest.get_pointer());
+        });
+    });
+}
+
+void gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, cl::sycl::buffer<float, 1> &packed, cl::sycl::buffer<float, 1> &other,
+                  int64_t ld, float beta, cl::sycl::buffer<float, 1> &c, int64_t ldc) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        // CblasPacked marks the operand stored by cblas_sgemm_pack, its leading dimension is
+        // ignored
+        bool packed_a = which == identifier::A;
+        MKL_INT transa_ = packed_a ? CblasPacked : cblas_convert(trans);
+        MKL_INT transb_ = packed_a ? cblas_convert(trans) : CblasPacked;
+        auto accessor_packed = packed.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_other = other.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_sgemm_compute>(queue, cgh, [=]() {
+            const float *packed_ = accessor_packed.get_pointer();
+            const float *other_ = accessor_other.get_pointer();
+            ::cblas_sgemm_compute(CBLASMAJOR, transa_, transb_, m, n, k,
+                                  packed_a ? packed_ : other_, ld, packed_a ? other_ : packed_, ld,
+                                  beta, accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
+void gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, cl::sycl::buffer<double, 1> &packed,
+                  cl::sycl::buffer<double, 1> &other, int64_t ld, double beta,
+                  cl::sycl::buffer<double, 1> &c, int64_t ldc) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        bool packed_a = which == identifier::A;
+        MKL_INT transa_ = packed_a ? CblasPacked : cblas_convert(trans);
+        MKL_INT transb_ = packed_a ? cblas_convert(trans) : CblasPacked;
+        auto accessor_packed = packed.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_other = other.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_dgemm_compute>(queue, cgh, [=]() {
+            const double *packed_ = accessor_packed.get_pointer();
+            const double *other_ = accessor_other.get_pointer();
+            ::cblas_dgemm_compute(CBLASMAJOR, transa_, transb_, m, n, k,
+                                  packed_a ? packed_ : other_, ld, packed_a ? other_ : packed_, ld,
+                                  beta, accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
+void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+            int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+            int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb,
+            std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
+        CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        float beta_real = beta.real(), beta_imag = beta.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_cgemm3m>(queue, cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex8 beta_ = { beta_real, beta_imag };
+            ::cblas_cgemm3m(CBLASMAJOR, transa_, transb_, m, n, k, (const void *)&alpha_,
+                            accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb,
+                            (const void *)&beta_, accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
+void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+            int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+            int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
+            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
+        CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        double beta_real = beta.real(), beta_imag = beta.imag();
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class mkl_kernel_zgemm3m>(queue, cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex16 beta_ = { beta_real, beta_imag };
+            ::cblas_zgemm3m(CBLASMAJOR, transa_, transb_, m, n, k, (const void *)&alpha_,
+                            accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb,
+                            (const void *)&beta_, accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
 // USM APIs
 
 template <typename Ta, typename Tb>
@@ -264,35 +370,9 @@ cl::sycl::event gemm_bias_fallback(cl::sycl::queue &queue, MKL_LAYOUT layout, tr
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        auto transa_ = cblas_convert(transa);
-        auto transb_ = cblas_convert(transb);
-        auto offsetc_ = cblas_convert(offsetc);
-        int64_t sizea, sizeb, sizec;
-#ifdef COLUMN_MAJOR
-        sizea = (transa == transpose::nontrans) ? lda * k : lda * m;
-        sizeb = (transb == transpose::nontrans) ? ldb * n : ldb * k;
-        sizec = ldc * n;
-#endif
-#ifdef ROW_MAJOR
-        sizea = (transa == transpose::nontrans) ? lda * m : lda * k;
-        sizeb = (transb == transpose::nontrans) ? ldb * k : ldb * n;
-        sizec = ldc * m;
-#endif
-        host_task<class mkl_kernel_gemm_bias_fallback_usm>(cgh, [=]() {
-            double *ad = (double *)malloc(sizeof(double) * sizea);
-            double *bd = (double *)malloc(sizeof(double) * sizeb);
-            double *cd = (double *)malloc(sizeof(double) * sizec);
-            double alphad = alpha, betad = beta;
-            double aod = ao, bod = bo;
-            copy_mat(a, layout, transa, m, k, lda, aod, ad);
-            copy_mat(b, layout, transb, k, n, ldb, bod, bd);
-            copy_mat(c, layout, MKL_NOTRANS, m, n, ldc, 0.0, cd);
-            ::cblas_dgemm((CBLAS_LAYOUT)layout, transa_, transb_, m, n, k, alphad, ad, lda, bd, ldb,
-                          betad, cd, ldc);
-            copy_mat(cd, layout, m, n, ldc, offsetc_, co, c);
-            free(ad);
-            free(bd);
-            free(cd);
+        host_task<class mkl_kernel_gemm_bias_fallback_usm>(queue, cgh, [=]() {
+            int8_gemm_bias(layout, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb, bo,
+                           beta, c, ldc, co);
         });
     });
     return done;
@@ -322,7 +402,7 @@ cl::sycl::event gemm_bias(cl::sycl::queue &queue, transpose transa, transpose tr
             CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
             CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
             CBLAS_OFFSET offsetc_ = cblas_convert(offsetc);
-            host_task<class mkl_kernel_gemm_s8u8s32_usm>(cgh, [=]() {
+            host_task<class mkl_kernel_gemm_s8u8s32_usm>(queue, cgh, [=]() {
                 MKL_INT8 bo_internal = -bo;
                 MKL_INT8 ao_internal = -ao;
                 ::cblas_gemm_s8u8s32(CBLASMAJOR, transa_, transb_, offsetc_, m, n, k, alpha,
@@ -362,7 +442,7 @@ cl::sycl::event gemm_bias(cl::sycl::queue &queue, transpose transa, transpose tr
             CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
             CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
             CBLAS_OFFSET offsetc_ = cblas_convert(column_to_row(offsetc));
-            host_task<class mkl_kernel_gemm_u8s8s32_usm>(cgh, [=]() {
+            host_task<class mkl_kernel_gemm_u8s8s32_usm>(queue, cgh, [=]() {
                 MKL_INT8 bo_internal = -bo;
                 MKL_INT8 ao_internal = -ao;
                 ::cblas_gemm_s8u8s32(CblasColMajor, transb_, transa_, offsetc_, n, m, k, alpha,
@@ -400,7 +480,7 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
-        host_task<class mkl_kernel_sgemmt_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_sgemmt_usm>(queue, cgh, [=]() {
             ::cblas_sgemmt(CBLASMAJOR, upper_lower_, transa_, transb_, n, k, alpha, a, lda, b, ldb,
                            beta, c, ldc);
         });
@@ -420,7 +500,7 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
-        host_task<class mkl_kernel_dgemmt_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dgemmt_usm>(queue, cgh, [=]() {
             ::cblas_dgemmt(CBLASMAJOR, upper_lower_, transa_, transb_, n, k, alpha, a, lda, b, ldb,
                            beta, c, ldc);
         });
@@ -443,7 +523,7 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_cgemmt_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_cgemmt_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_cgemmt(CBLASMAJOR, upper_lower_, transa_, transb_, n, k, (const void *)&alpha_,
@@ -468,7 +548,7 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zgemmt_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zgemmt_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zgemmt(CBLASMAJOR, upper_lower_, transa_, transb_, n, k, (const void *)&alpha_,
@@ -477,3 +557,129 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
     });
     return done;
 }
+
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *src, int64_t ld,
+                          float *dest, const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        CBLAS_IDENTIFIER which_ = cblas_convert(which);
+        CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
+        host_task<class mkl_kernel_sgemm_pack_usm>(queue, cgh, [=]() {
+            ::cblas_sgemm_pack(CBLASMAJOR, which_, trans_, m, n, k, alpha, src, ld, dest);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                          int64_t n, int64_t k, double alpha, const double *src, int64_t ld,
+                          double *dest, const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        CBLAS_IDENTIFIER which_ = cblas_convert(which);
+        CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
+        host_task<class mkl_kernel_dgemm_pack_usm>(queue, cgh, [=]() {
+            ::cblas_dgemm_pack(CBLASMAJOR, which_, trans_, m, n, k, alpha, src, ld, dest);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                             int64_t n, int64_t k, const float *packed, const float *other,
+                             int64_t ld, float beta, float *c, int64_t ldc,
+                             const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        bool packed_a = which == identifier::A;
+        MKL_INT transa_ = packed_a ? CblasPacked : cblas_convert(trans);
+        MKL_INT transb_ = packed_a ? cblas_convert(trans) : CblasPacked;
+        const float *a = packed_a ? packed : other;
+        const float *b = packed_a ? other : packed;
+        host_task<class mkl_kernel_sgemm_compute_usm>(queue, cgh, [=]() {
+            ::cblas_sgemm_compute(CBLASMAJOR, transa_, transb_, m, n, k, a, ld, b, ld, beta, c,
+                                  ldc);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                             int64_t n, int64_t k, const double *packed, const double *other,
+                             int64_t ld, double beta, double *c, int64_t ldc,
+                             const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        bool packed_a = which == identifier::A;
+        MKL_INT transa_ = packed_a ? CblasPacked : cblas_convert(trans);
+        MKL_INT transb_ = packed_a ? cblas_convert(trans) : CblasPacked;
+        const double *a = packed_a ? packed : other;
+        const double *b = packed_a ? other : packed;
+        host_task<class mkl_kernel_dgemm_compute_usm>(queue, cgh, [=]() {
+            ::cblas_dgemm_compute(CBLASMAJOR, transa_, transb_, m, n, k, a, ld, b, ld, beta, c,
+                                  ldc);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, std::complex<float> alpha,
+                       const std::complex<float> *a, int64_t lda, const std::complex<float> *b,
+                       int64_t ldb, std::complex<float> beta, std::complex<float> *c, int64_t ldc,
+                       const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
+        CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
+        float alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        float beta_real = beta.real(), beta_imag = beta.imag();
+        host_task<class mkl_kernel_cgemm3m_usm>(queue, cgh, [=]() {
+            MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex8 beta_ = { beta_real, beta_imag };
+            ::cblas_cgemm3m(CBLASMAJOR, transa_, transb_, m, n, k, (const void *)&alpha_, a, lda,
+                            b, ldb, (const void *)&beta_, c, ldc);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, std::complex<double> alpha,
+                       const std::complex<double> *a, int64_t lda, const std::complex<double> *b,
+                       int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+                       int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
+        CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
+        double alpha_real = alpha.real(), alpha_imag = alpha.imag();
+        double beta_real = beta.real(), beta_imag = beta.imag();
+        host_task<class mkl_kernel_zgemm3m_usm>(queue, cgh, [=]() {
+            MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
+            MKL_Complex16 beta_ = { beta_real, beta_imag };
+            ::cblas_zgemm3m(CBLASMAJOR, transa_, transb_, m, n, k, (const void *)&alpha_, a, lda,
+                            b, ldb, (const void *)&beta_, c, ldc);
+        });
+    });
+    return done;
+}
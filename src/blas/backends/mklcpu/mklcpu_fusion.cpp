@@ -0,0 +1,461 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "mkl_service.h"
+#include "mklcpu_common.hpp"
+#include "oneapi/mkl/blas/detail/mklcpu/level1_fusion.hpp"
+#include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
+
+#ifdef ENABLE_MKLCPU_THREAD_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace mklcpu {
+
+namespace {
+
+// Elements of each vector processed by one chunk of the fused pass. With the handful of vectors
+// of a typical sequence the chunks of all of them stay in the L2 cache between the calls.
+constexpr int64_t fusion_chunk = 4096;
+// Smallest number of elements given to each thread of the fused pass.
+constexpr int64_t fusion_min_part = 16 * fusion_chunk;
+
+// Memory touched by a recorded call. Elementwise vectors can be shared by several calls if they
+// start at the same address with the same stride; scalar results cannot.
+struct operand {
+    const char *begin;
+    const char *end;
+    int64_t stride;
+    bool written;
+    bool scalar;
+};
+
+enum class reduction { none, sum, norm };
+
+struct fused_call {
+    int64_t n = 0;
+    std::vector<operand> operands;
+    reduction kind = reduction::none;
+    // Applies the call to elements [begin, end) and returns the partial result of reductions.
+    std::function<double(int64_t begin, int64_t end)> chunk;
+    std::function<void(double value)> store;
+};
+
+template <typename T>
+void add_vector(fused_call &call, const T *x, int64_t inc, bool written) {
+    if (call.n <= 0)
+        return;
+    const char *begin = reinterpret_cast<const char *>(x);
+    const char *end = begin + ((call.n - 1) * inc + 1) * sizeof(T);
+    call.operands.push_back({ begin, end, inc * int64_t(sizeof(T)), written, false });
+}
+
+template <typename T>
+void add_result(fused_call &call, T *result, reduction kind) {
+    const char *begin = reinterpret_cast<const char *>(result);
+    call.operands.push_back({ begin, begin + sizeof(T), 0, true, true });
+    call.kind = kind;
+    call.store = [=](double value) { *result = static_cast<T>(value); };
+}
+
+bool conflicts(const fused_call &first, const fused_call &second) {
+    for (auto &a : first.operands) {
+        for (auto &b : second.operands) {
+            if (!(a.written || b.written) || a.end <= b.begin || b.end <= a.begin)
+                continue;
+            if (a.scalar || b.scalar || a.begin != b.begin || a.stride != b.stride)
+                return true;
+        }
+    }
+    return false;
+}
+
+// The parts of the pass run on the TBB threads used by MKL, in an arena no larger than the MKL
+// thread count of the calling host task. With sequential MKL the pass runs on that task alone.
+void run_fused(const std::vector<fused_call> &calls) {
+    int64_t n = 0;
+    for (auto &call : calls)
+        n = std::max(n, call.n);
+#ifdef ENABLE_MKLCPU_THREAD_TBB
+    int parts =
+        static_cast<int>(std::max<int64_t>(1, std::min<int64_t>(::mkl_get_max_threads(),
+                                                                n / fusion_min_part)));
+#else
+    int parts = 1;
+#endif
+    std::vector<std::vector<double>> partials(parts, std::vector<double>(calls.size(), 0.0));
+
+    auto run_part = [&](int part) {
+        int64_t begin = n * part / parts, end = n * (part + 1) / parts;
+        auto &partial = partials[part];
+        int previous = ::mkl_set_num_threads_local(1);
+        for (int64_t chunk = begin; chunk < end; chunk += fusion_chunk) {
+            int64_t chunk_end = std::min(end, chunk + fusion_chunk);
+            for (std::size_t i = 0; i < calls.size(); i++) {
+                auto &call = calls[i];
+                if (chunk >= call.n)
+                    continue;
+                double value = call.chunk(chunk, std::min(chunk_end, call.n));
+                if (call.kind == reduction::sum)
+                    partial[i] += value;
+                else if (call.kind == reduction::norm)
+                    partial[i] = std::hypot(partial[i], value);
+            }
+        }
+        ::mkl_set_num_threads_local(previous);
+    };
+#ifdef ENABLE_MKLCPU_THREAD_TBB
+    if (parts > 1) {
+        tbb::task_arena arena(parts);
+        arena.execute([&] { tbb::parallel_for(0, parts, run_part); });
+    }
+    else
+        run_part(0);
+#else
+    run_part(0);
+#endif
+
+    for (std::size_t i = 0; i < calls.size(); i++) {
+        if (calls[i].kind == reduction::none)
+            continue;
+        double value = 0.0;
+        for (auto &partial : partials)
+            value = (calls[i].kind == reduction::sum) ? value + partial[i]
+                                                      : std::hypot(value, partial[i]);
+        calls[i].store(value);
+    }
+}
+
+// CBLAS level 1 routines by data type
+inline void fused_axpy(int64_t n, float alpha, const float *x, int64_t incx, float *y,
+                       int64_t incy) {
+    ::cblas_saxpy(n, alpha, x, incx, y, incy);
+}
+inline void fused_axpy(int64_t n, double alpha, const double *x, int64_t incx, double *y,
+                       int64_t incy) {
+    ::cblas_daxpy(n, alpha, x, incx, y, incy);
+}
+inline void fused_axpby(int64_t n, float alpha, const float *x, int64_t incx, float beta,
+                        float *y, int64_t incy) {
+    ::cblas_saxpby(n, alpha, x, incx, beta, y, incy);
+}
+inline void fused_axpby(int64_t n, double alpha, const double *x, int64_t incx, double beta,
+                        double *y, int64_t incy) {
+    ::cblas_daxpby(n, alpha, x, incx, beta, y, incy);
+}
+inline void fused_scal(int64_t n, float alpha, float *x, int64_t incx) {
+    ::cblas_sscal(n, alpha, x, incx);
+}
+inline void fused_scal(int64_t n, double alpha, double *x, int64_t incx) {
+    ::cblas_dscal(n, alpha, x, incx);
+}
+inline void fused_copy(int64_t n, const float *x, int64_t incx, float *y, int64_t incy) {
+    ::cblas_scopy(n, x, incx, y, incy);
+}
+inline void fused_copy(int64_t n, const double *x, int64_t incx, double *y, int64_t incy) {
+    ::cblas_dcopy(n, x, incx, y, incy);
+}
+inline double fused_dot(int64_t n, const float *x, int64_t incx, const float *y, int64_t incy) {
+    return ::cblas_sdot(n, x, incx, y, incy);
+}
+inline double fused_dot(int64_t n, const double *x, int64_t incx, const double *y,
+                        int64_t incy) {
+    return ::cblas_ddot(n, x, incx, y, incy);
+}
+inline double fused_nrm2(int64_t n, const float *x, int64_t incx) {
+    return ::cblas_snrm2(n, x, incx);
+}
+inline double fused_nrm2(int64_t n, const double *x, int64_t incx) {
+    return ::cblas_dnrm2(n, x, incx);
+}
+inline double fused_asum(int64_t n, const float *x, int64_t incx) {
+    return ::cblas_sasum(n, x, incx);
+}
+inline double fused_asum(int64_t n, const double *x, int64_t incx) {
+    return ::cblas_dasum(n, x, incx);
+}
+
+} // namespace
+
+struct level1_fusion::impl {
+    cl::sycl::queue queue;
+    std::vector<fused_call> calls;
+    // Events the next submission waits for, starting with the previous submission.
+    std::vector<cl::sycl::event> dependencies;
+
+    void record(fused_call call) {
+        for (auto &recorded : calls) {
+            if (conflicts(recorded, call)) {
+                submit();
+                break;
+            }
+        }
+        calls.push_back(std::move(call));
+    }
+
+    // Calls with non-positive increments are not chunked and go to the backend after a flush.
+    template <typename F>
+    void direct(F f) {
+        if (!calls.empty())
+            submit();
+        dependencies = { f(queue, dependencies) };
+    }
+
+    cl::sycl::event submit() {
+        auto recorded = std::make_shared<std::vector<fused_call>>(std::move(calls));
+        calls.clear();
+        auto done = queue.submit([&](cl::sycl::handler &cgh) {
+            for (auto &e : dependencies)
+                cgh.depends_on(e);
+            host_task<class mkl_kernel_level1_fusion>(queue, cgh,
+                                                      [=]() { run_fused(*recorded); });
+        });
+        dependencies = { done };
+        return done;
+    }
+
+    template <typename T>
+    void axpy(int64_t n, T alpha, const T *x, int64_t incx, T *y, int64_t incy) {
+        if (incx <= 0 || incy <= 0) {
+            direct([=](cl::sycl::queue &queue, const std::vector<cl::sycl::event> &deps) {
+                return column_major::axpy(queue, n, alpha, x, incx, y, incy, deps);
+            });
+            return;
+        }
+        fused_call call;
+        call.n = n;
+        add_vector(call, x, incx, false);
+        add_vector(call, y, incy, true);
+        call.chunk = [=](int64_t begin, int64_t end) {
+            fused_axpy(end - begin, alpha, x + begin * incx, incx, y + begin * incy, incy);
+            return 0.0;
+        };
+        record(std::move(call));
+    }
+
+    template <typename T>
+    void axpby(int64_t n, T alpha, const T *x, int64_t incx, T beta, T *y, int64_t incy) {
+        if (incx <= 0 || incy <= 0) {
+            direct([=](cl::sycl::queue &queue, const std::vector<cl::sycl::event> &deps) {
+                return column_major::axpby(queue, n, alpha, x, incx, beta, y, incy, deps);
+            });
+            return;
+        }
+        fused_call call;
+        call.n = n;
+        add_vector(call, x, incx, false);
+        add_vector(call, y, incy, true);
+        call.chunk = [=](int64_t begin, int64_t end) {
+            fused_axpby(end - begin, alpha, x + begin * incx, incx, beta, y + begin * incy, incy);
+            return 0.0;
+        };
+        record(std::move(call));
+    }
+
+    template <typename T>
+    void scal(int64_t n, T alpha, T *x, int64_t incx) {
+        if (incx <= 0) {
+            direct([=](cl::sycl::queue &queue, const std::vector<cl::sycl::event> &deps) {
+                return column_major::scal(queue, n, alpha, x, incx, deps);
+            });
+            return;
+        }
+        fused_call call;
+        call.n = n;
+        add_vector(call, x, incx, true);
+        call.chunk = [=](int64_t begin, int64_t end) {
+            fused_scal(end - begin, alpha, x + begin * incx, incx);
+            return 0.0;
+        };
+        record(std::move(call));
+    }
+
+    template <typename T>
+    void copy(int64_t n, const T *x, int64_t incx, T *y, int64_t incy) {
+        if (incx <= 0 || incy <= 0) {
+            direct([=](cl::sycl::queue &queue, const std::vector<cl::sycl::event> &deps) {
+                return column_major::copy(queue, n, x, incx, y, incy, deps);
+            });
+            return;
+        }
+        fused_call call;
+        call.n = n;
+        add_vector(call, x, incx, false);
+        add_vector(call, y, incy, true);
+        call.chunk = [=](int64_t begin, int64_t end) {
+            fused_copy(end - begin, x + begin * incx, incx, y + begin * incy, incy);
+            return 0.0;
+        };
+        record(std::move(call));
+    }
+
+    template <typename T>
+    void dot(int64_t n, const T *x, int64_t incx, const T *y, int64_t incy, T *result) {
+        if (incx <= 0 || incy <= 0) {
+            direct([=](cl::sycl::queue &queue, const std::vector<cl::sycl::event> &deps) {
+                return column_major::dot(queue, n, x, incx, y, incy, result, deps);
+            });
+            return;
+        }
+        fused_call call;
+        call.n = n;
+        add_vector(call, x, incx, false);
+        add_vector(call, y, incy, false);
+        add_result(call, result, reduction::sum);
+        call.chunk = [=](int64_t begin, int64_t end) {
+            return fused_dot(end - begin, x + begin * incx, incx, y + begin * incy, incy);
+        };
+        record(std::move(call));
+    }
+
+    template <typename T>
+    void nrm2(int64_t n, const T *x, int64_t incx, T *result) {
+        if (incx <= 0) {
+            direct([=](cl::sycl::queue &queue, const std::vector<cl::sycl::event> &deps) {
+                return column_major::nrm2(queue, n, x, incx, result, deps);
+            });
+            return;
+        }
+        fused_call call;
+        call.n = n;
+        add_vector(call, x, incx, false);
+        add_result(call, result, reduction::norm);
+        call.chunk = [=](int64_t begin, int64_t end) {
+            return fused_nrm2(end - begin, x + begin * incx, incx);
+        };
+        record(std::move(call));
+    }
+
+    template <typename T>
+    void asum(int64_t n, const T *x, int64_t incx, T *result) {
+        if (incx <= 0) {
+            direct([=](cl::sycl::queue &queue, const std::vector<cl::sycl::event> &deps) {
+                return column_major::asum(queue, n, x, incx, result, deps);
+            });
+            return;
+        }
+        fused_call call;
+        call.n = n;
+        add_vector(call, x, incx, false);
+        add_result(call, result, reduction::sum);
+        call.chunk = [=](int64_t begin, int64_t end) {
+            return fused_asum(end - begin, x + begin * incx, incx);
+        };
+        record(std::move(call));
+    }
+};
+
+level1_fusion::level1_fusion(cl::sycl::queue &queue) : impl_(new impl{ queue, {}, {} }) {}
+
+level1_fusion::~level1_fusion() {
+    if (!impl_->calls.empty())
+        impl_->submit();
+    cl::sycl::event::wait(impl_->dependencies);
+}
+
+void level1_fusion::axpy(int64_t n, float alpha, const float *x, int64_t incx, float *y,
+                         int64_t incy) {
+    impl_->axpy(n, alpha, x, incx, y, incy);
+}
+
+void level1_fusion::axpy(int64_t n, double alpha, const double *x, int64_t incx, double *y,
+                         int64_t incy) {
+    impl_->axpy(n, alpha, x, incx, y, incy);
+}
+
+void level1_fusion::axpby(int64_t n, float alpha, const float *x, int64_t incx, float beta,
+                          float *y, int64_t incy) {
+    impl_->axpby(n, alpha, x, incx, beta, y, incy);
+}
+
+void level1_fusion::axpby(int64_t n, double alpha, const double *x, int64_t incx, double beta,
+                          double *y, int64_t incy) {
+    impl_->axpby(n, alpha, x, incx, beta, y, incy);
+}
+
+void level1_fusion::scal(int64_t n, float alpha, float *x, int64_t incx) {
+    impl_->scal(n, alpha, x, incx);
+}
+
+void level1_fusion::scal(int64_t n, double alpha, double *x, int64_t incx) {
+    impl_->scal(n, alpha, x, incx);
+}
+
+void level1_fusion::copy(int64_t n, const float *x, int64_t incx, float *y, int64_t incy) {
+    impl_->copy(n, x, incx, y, incy);
+}
+
+void level1_fusion::copy(int64_t n, const double *x, int64_t incx, double *y, int64_t incy) {
+    impl_->copy(n, x, incx, y, incy);
+}
+
+void level1_fusion::dot(int64_t n, const float *x, int64_t incx, const float *y, int64_t incy,
+                        float *result) {
+    impl_->dot(n, x, incx, y, incy, result);
+}
+
+void level1_fusion::dot(int64_t n, const double *x, int64_t incx, const double *y, int64_t incy,
+                        double *result) {
+    impl_->dot(n, x, incx, y, incy, result);
+}
+
+void level1_fusion::nrm2(int64_t n, const float *x, int64_t incx, float *result) {
+    impl_->nrm2(n, x, incx, result);
+}
+
+void level1_fusion::nrm2(int64_t n, const double *x, int64_t incx, double *result) {
+    impl_->nrm2(n, x, incx, result);
+}
+
+void level1_fusion::asum(int64_t n, const float *x, int64_t incx, float *result) {
+    impl_->asum(n, x, incx, result);
+}
+
+void level1_fusion::asum(int64_t n, const double *x, int64_t incx, double *result) {
+    impl_->asum(n, x, incx, result);
+}
+
+void level1_fusion::depends_on(const std::vector<cl::sycl::event> &events) {
+    impl_->dependencies.insert(impl_->dependencies.end(), events.begin(), events.end());
+}
+
+cl::sycl::event level1_fusion::flush(const std::vector<cl::sycl::event> &dependencies) {
+    depends_on(dependencies);
+    return impl_->submit();
+}
+
+std::size_t level1_fusion::pending() const {
+    return impl_->calls.size();
+}
+
+} // namespace mklcpu
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKLCPU_GEMM_BIAS_HPP_
+#define _MKLCPU_GEMM_BIAS_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "mklcpu_common.hpp"
+#include "scratch_arena.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace mklcpu {
+
+// Dot products of packed rows are accumulated in int32 over at most this many products of two
+// 8-bit values, which cannot overflow, and then summed in int64.
+constexpr int64_t gemm_bias_k_block = 1 << 15;
+// Columns of op(B) whose packed rows are reused for every row of op(A) while they are in cache.
+constexpr int64_t gemm_bias_n_block = 64;
+
+// The loop is written so that compilers turn it into pmaddwd, or vpdpwssd when VNNI is enabled.
+static inline int32_t gemm_bias_dot(const int16_t *x, const int16_t *y, int64_t k) {
+    int32_t sum = 0;
+    for (int64_t p = 0; p < k; p++)
+        sum += int32_t(x[p]) * int32_t(y[p]);
+    return sum;
+}
+
+// Copies row i of the rows x k matrix x[i * row_stride + p * col_stride] to dest[i * k + p] and
+// stores the sum of each row in sums.
+template <typename T>
+static inline void gemm_bias_pack(const T *x, int64_t row_stride, int64_t col_stride,
+                                  int64_t rows, int64_t k, int16_t *dest, int64_t *sums) {
+    for (int64_t i = 0; i < rows; i++) {
+        int64_t sum = 0;
+        for (int64_t p = 0; p < k; p++) {
+            int16_t v = x[i * row_stride + p * col_stride];
+            dest[i * k + p] = v;
+            sum += v;
+        }
+        sums[i] = sum;
+    }
+}
+
+// C = alpha * (op(A) - ao) * (op(B) - bo) + beta * C + co for any combination of int8 and uint8 A
+// and B. op(A) and op(B) are packed once as int16 rows along k. The offsets are applied through
+// the row sums of op(A) and the column sums of op(B):
+//   sum_p (a_ip - ao)(b_pj - bo) = sum_p a_ip b_pj - bo sum_p a_ip - ao sum_p b_pj + k ao bo
+// so the product itself is exact integer arithmetic. Only the final scaling by alpha and beta is
+// done in double. As in the double precision fallback this kernel replaced, the scaled value is
+// truncated toward zero before the C offset is added. Values outside the int32 range saturate.
+template <typename Ta, typename Tb>
+void int8_gemm_bias(MKL_LAYOUT layout, transpose transa, transpose transb, offset offsetc,
+                    int64_t m, int64_t n, int64_t k, float alpha, const Ta *a, int64_t lda, Ta ao,
+                    const Tb *b, int64_t ldb, Tb bo, float beta, int32_t *c, int64_t ldc,
+                    const int32_t *co) {
+    if (m <= 0 || n <= 0)
+        return;
+    const bool col_major = (layout == MKL_COL_MAJOR);
+    // op(A)(i, p) = a[i * a_rs + p * a_cs] and op(B)^T(j, p) = b[j * b_rs + p * b_cs].
+    const bool a_rows = col_major == isNonTranspose(transa);
+    const bool b_rows = col_major != isNonTranspose(transb);
+    const int64_t a_rs = a_rows ? 1 : lda, a_cs = a_rows ? lda : 1;
+    const int64_t b_rs = b_rows ? 1 : ldb, b_cs = b_rows ? ldb : 1;
+
+    oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm_bias");
+    int16_t *a_pack = scratch.allocate<int16_t>(m * k);
+    int16_t *b_pack = scratch.allocate<int16_t>(n * k);
+    int64_t *a_sums = scratch.allocate<int64_t>(m);
+    int64_t *b_sums = scratch.allocate<int64_t>(n);
+    gemm_bias_pack(a, a_rs, a_cs, m, k, a_pack, a_sums);
+    gemm_bias_pack(b, b_rs, b_cs, n, k, b_pack, b_sums);
+
+    const int64_t aod = ao, bod = bo;
+    const double alphad = alpha, betad = beta;
+    const double int32_min = std::numeric_limits<int32_t>::min();
+    const double int32_max = std::numeric_limits<int32_t>::max();
+    for (int64_t jc = 0; jc < n; jc += gemm_bias_n_block) {
+        const int64_t jend = std::min(n, jc + gemm_bias_n_block);
+        for (int64_t i = 0; i < m; i++) {
+            const int16_t *a_row = a_pack + i * k;
+            for (int64_t j = jc; j < jend; j++) {
+                const int16_t *b_row = b_pack + j * k;
+                int64_t sum = 0;
+                for (int64_t p = 0; p < k; p += gemm_bias_k_block)
+                    sum += gemm_bias_dot(a_row + p, b_row + p,
+                                         std::min(k - p, gemm_bias_k_block));
+                sum += k * aod * bod - bod * a_sums[i] - aod * b_sums[j];
+
+                int32_t &c_ij = col_major ? c[i + j * ldc] : c[i * ldc + j];
+                double value = alphad * sum;
+                if (betad != 0.0)
+                    value += betad * c_ij;
+                int64_t result = (int64_t)std::min(std::max(value, int32_min), int32_max);
+                if (offsetc == offset::fix)
+                    result += co[0];
+                else if (offsetc == offset::column)
+                    result += co[i];
+                else
+                    result += co[j];
+                c_ij = (int32_t)std::min(std::max(result, int64_t(INT32_MIN)), int64_t(INT32_MAX));
+            }
+        }
+    }
+}
+
+} // namespace mklcpu
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_MKLCPU_GEMM_BIAS_HPP_
@@ -0,0 +1,273 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+#include "mklcpu_common.hpp"
+#include "oneapi/mkl/blas/detail/mklcpu/gemm_plan.hpp"
+#include "oneapi/mkl/exceptions.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace mklcpu {
+
+namespace {
+
+// Largest m, n and k handled by the compiled small kernels.
+constexpr std::int64_t small_dim = 32;
+
+mkl_jit_status_t jit_create(void **jitter, MKL_LAYOUT layout, MKL_TRANSPOSE transa,
+                            MKL_TRANSPOSE transb, MKL_INT m, MKL_INT n, MKL_INT k, float alpha,
+                            MKL_INT lda, MKL_INT ldb, float beta, MKL_INT ldc) {
+    return mkl_jit_create_sgemm(jitter, layout, transa, transb, m, n, k, alpha, lda, ldb, beta,
+                                ldc);
+}
+
+mkl_jit_status_t jit_create(void **jitter, MKL_LAYOUT layout, MKL_TRANSPOSE transa,
+                            MKL_TRANSPOSE transb, MKL_INT m, MKL_INT n, MKL_INT k, double alpha,
+                            MKL_INT lda, MKL_INT ldb, double beta, MKL_INT ldc) {
+    return mkl_jit_create_dgemm(jitter, layout, transa, transb, m, n, k, alpha, lda, ldb, beta,
+                                ldc);
+}
+
+void jit_get_kernel(void *jitter, void (*&kernel)(void *, float *, float *, float *)) {
+    kernel = mkl_jit_get_sgemm_ptr(jitter);
+}
+
+void jit_get_kernel(void *jitter, void (*&kernel)(void *, double *, double *, double *)) {
+    kernel = mkl_jit_get_dgemm_ptr(jitter);
+}
+
+void cblas_gemm(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m, int64_t n, int64_t k,
+                float alpha, const float *a, int64_t lda, const float *b, int64_t ldb, float beta,
+                float *c, int64_t ldc) {
+    ::cblas_sgemm(CblasColMajor, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void cblas_gemm(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m, int64_t n, int64_t k,
+                double alpha, const double *a, int64_t lda, const double *b, int64_t ldb,
+                double beta, double *c, int64_t ldc) {
+    ::cblas_dgemm(CblasColMajor, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+template <typename T>
+std::uint64_t bits(T value) {
+    std::uint64_t result = 0;
+    std::memcpy(&result, &value, sizeof(T));
+    return result;
+}
+
+} // namespace
+
+template <typename T>
+class mkl_kernel_gemm_plan;
+
+template <typename T>
+struct gemm_plan_kernels {
+    using shape = typename gemm_plan<T>::shape;
+    using kernel_type = typename gemm_plan<T>::kernel_type;
+
+    // Column major C = alpha * op(A) * op(B) + beta * C with m, n, k <= small_dim. M is m when it
+    // is fixed at compile time and 0 otherwise. Each column of C is accumulated in registers; with
+    // A transposed the rows of op(A) are contiguous, so the column of op(B) is gathered and the
+    // entries are computed as dot products.
+    template <int M, bool trans_a, bool trans_b>
+    static void small(const shape &s, const T *a, const T *b, T *c) {
+        if (s.swap_ab)
+            std::swap(a, b);
+        // Local copies, since stores to C could otherwise alias alpha and beta.
+        const int64_t m = M ? M : s.m, n = s.n, k = s.k;
+        const int64_t lda = s.lda, ldb = s.ldb, ldc = s.ldc;
+        const T alpha = s.alpha, beta = s.beta;
+        T acc[M ? M : small_dim];
+        T b_j[small_dim];
+        for (int64_t j = 0; j < n; j++) {
+            if (trans_a) {
+                for (int64_t p = 0; p < k; p++)
+                    b_j[p] = trans_b ? b[j + p * ldb] : b[p + j * ldb];
+                for (int64_t i = 0; i < m; i++) {
+                    const T *a_i = a + i * lda;
+                    T sum = T(0);
+                    for (int64_t p = 0; p < k; p++)
+                        sum += a_i[p] * b_j[p];
+                    acc[i] = sum;
+                }
+            }
+            else {
+                for (int64_t i = 0; i < m; i++)
+                    acc[i] = T(0);
+                for (int64_t p = 0; p < k; p++) {
+                    const T b_pj = trans_b ? b[j + p * ldb] : b[p + j * ldb];
+                    const T *a_p = a + p * lda;
+                    for (int64_t i = 0; i < m; i++)
+                        acc[i] += a_p[i] * b_pj;
+                }
+            }
+            T *c_j = c + j * ldc;
+            // As in BLAS, C is not read when beta is zero.
+            if (beta == T(0)) {
+                for (int64_t i = 0; i < m; i++)
+                    c_j[i] = alpha * acc[i];
+            }
+            else {
+                for (int64_t i = 0; i < m; i++)
+                    c_j[i] = alpha * acc[i] + beta * c_j[i];
+            }
+        }
+    }
+
+    static void blas(const shape &s, const T *a, const T *b, T *c) {
+        if (s.swap_ab)
+            std::swap(a, b);
+        cblas_gemm(s.trans_a ? CblasTrans : CblasNoTrans, s.trans_b ? CblasTrans : CblasNoTrans,
+                   s.m, s.n, s.k, s.alpha, a, s.lda, b, s.ldb, s.beta, c, s.ldc);
+    }
+
+    template <int M>
+    static kernel_type select(const shape &s) {
+        if (s.trans_a)
+            return s.trans_b ? &small<M, true, true> : &small<M, true, false>;
+        return s.trans_b ? &small<M, false, true> : &small<M, false, false>;
+    }
+
+    static kernel_type select(const shape &s) {
+        if (s.m > small_dim || s.n > small_dim || s.k > small_dim)
+            return &blas;
+        switch (s.m) {
+            case 8: return select<8>(s);
+            case 16: return select<16>(s);
+            case 24: return select<24>(s);
+            case 32: return select<32>(s);
+            default: return select<0>(s);
+        }
+    }
+};
+
+template <typename T>
+gemm_plan<T>::gemm_plan(layout layout, transpose transa, transpose transb, std::int64_t m,
+                        std::int64_t n, std::int64_t k, T alpha, std::int64_t lda,
+                        std::int64_t ldb, T beta, std::int64_t ldc, bool jit) {
+    const bool row_major = layout == oneapi::mkl::layout::row_major;
+    // Conjugation does not change real matrices.
+    const bool trans_a = transa != transpose::nontrans;
+    const bool trans_b = transb != transpose::nontrans;
+    if (m < 0 || n < 0 || k < 0)
+        throw invalid_argument("blas", "gemm_plan", "m, n and k must not be negative");
+    if (lda < std::max<std::int64_t>(1, trans_a != row_major ? k : m))
+        throw invalid_argument("blas", "gemm_plan", "lda is too small");
+    if (ldb < std::max<std::int64_t>(1, trans_b != row_major ? n : k))
+        throw invalid_argument("blas", "gemm_plan", "ldb is too small");
+    if (ldc < std::max<std::int64_t>(1, row_major ? n : m))
+        throw invalid_argument("blas", "gemm_plan", "ldc is too small");
+
+    if (row_major)
+        shape_ = { trans_b, trans_a, true, n, m, k, ldb, lda, ldc, alpha, beta };
+    else
+        shape_ = { trans_a, trans_b, false, m, n, k, lda, ldb, ldc, alpha, beta };
+
+    mkl_jit_status_t status = MKL_JIT_ERROR;
+    if (jit && m > 0 && n > 0 && k > 0)
+        status = jit_create(&jitter_, row_major ? MKL_ROW_MAJOR : MKL_COL_MAJOR,
+                            trans_a ? MKL_TRANS : MKL_NOTRANS, trans_b ? MKL_TRANS : MKL_NOTRANS,
+                            m, n, k, alpha, lda, ldb, beta, ldc);
+    if (status == MKL_JIT_SUCCESS) {
+        jit_get_kernel(jitter_, jit_kernel_);
+        return;
+    }
+    // MKL_NO_JIT still creates a jitter, whose kernel is a regular gemm call. The compiled small
+    // kernels are faster for the shapes they cover, and cblas_?gemm is the same for the others.
+    if (status == MKL_NO_JIT)
+        mkl_jit_destroy(jitter_);
+    jitter_ = nullptr;
+    kernel_ = gemm_plan_kernels<T>::select(shape_);
+}
+
+template <typename T>
+gemm_plan<T>::~gemm_plan() {
+    if (jitter_)
+        mkl_jit_destroy(jitter_);
+}
+
+template <typename T>
+std::shared_ptr<const gemm_plan<T>> gemm_plan<T>::cached(layout layout, transpose transa,
+                                                         transpose transb, std::int64_t m,
+                                                         std::int64_t n, std::int64_t k, T alpha,
+                                                         std::int64_t lda, std::int64_t ldb,
+                                                         T beta, std::int64_t ldc) {
+    // alpha and beta are compared by bits, which gives NaN values a well-defined key.
+    using key_type = std::tuple<oneapi::mkl::layout, transpose, transpose, std::int64_t,
+                                std::int64_t, std::int64_t, std::uint64_t, std::int64_t,
+                                std::int64_t, std::uint64_t, std::int64_t>;
+    using entry = std::pair<key_type, std::shared_ptr<const gemm_plan>>;
+    static std::mutex mutex;
+    // Plans from the most to the least recently used, and their positions by shape.
+    static std::list<entry> plans;
+    static std::map<key_type, typename std::list<entry>::iterator> index;
+
+    key_type key(layout, transa, transb, m, n, k, bits(alpha), lda, ldb, bits(beta), ldc);
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key);
+    if (it != index.end()) {
+        plans.splice(plans.begin(), plans, it->second);
+        return it->second->second;
+    }
+    auto plan = std::make_shared<const gemm_plan>(layout, transa, transb, m, n, k, alpha, lda,
+                                                  ldb, beta, ldc);
+    plans.emplace_front(key, plan);
+    index.emplace(key, plans.begin());
+    if (plans.size() > cache_capacity) {
+        index.erase(plans.back().first);
+        plans.pop_back();
+    }
+    return plan;
+}
+
+template <typename T>
+cl::sycl::event gemm_plan<T>::operator()(cl::sycl::queue &queue, const T *a, const T *b, T *c,
+                                         const std::vector<cl::sycl::event> &dependencies) const {
+    // Empty when the plan is not owned by a shared_ptr
+    std::shared_ptr<const gemm_plan> owner = this->weak_from_this().lock();
+    const gemm_plan *plan = this;
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<mkl_kernel_gemm_plan<T>>(queue, cgh,
+                                           [owner, plan, a, b, c]() { (*plan)(a, b, c); });
+    });
+}
+
+template class ONEMKL_EXPORT gemm_plan<float>;
+template class ONEMKL_EXPORT gemm_plan<double>;
+
+} // namespace mklcpu
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
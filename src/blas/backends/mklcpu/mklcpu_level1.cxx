@@ -24,7 +24,7 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_sasum>(cgh, [=]() {
+        host_task<class mkl_kernel_sasum>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::sasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -36,7 +36,7 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_dasum>(cgh, [=]() {
+        host_task<class mkl_kernel_dasum>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::dasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -48,7 +48,7 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_scasum>(cgh, [=]() {
+        host_task<class mkl_kernel_scasum>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::scasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -60,7 +60,7 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_dzasum>(cgh, [=]() {
+        host_task<class mkl_kernel_dzasum>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::dzasum((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -72,7 +72,7 @@ void axpy(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_saxpy>(cgh, [=]() {
+        host_task<class mkl_kernel_saxpy>(queue, cgh, [=]() {
             ::cblas_saxpy(n, alpha, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy);
         });
     });
@@ -83,7 +83,7 @@ void axpy(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<doub
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_daxpy>(cgh, [=]() {
+        host_task<class mkl_kernel_daxpy>(queue, cgh, [=]() {
             ::cblas_daxpy(n, alpha, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy);
         });
     });
@@ -96,7 +96,7 @@ void axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_caxpy>(cgh, [=]() {
+        host_task<class mkl_kernel_caxpy>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_caxpy(n, (const void *)&alpha_, accessor_x.get_pointer(), incx,
                           accessor_y.get_pointer(), incy);
@@ -111,7 +111,7 @@ void axpy(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zaxpy>(cgh, [=]() {
+        host_task<class mkl_kernel_zaxpy>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_zaxpy(n, (const void *)&alpha_, accessor_x.get_pointer(), incx,
                           accessor_y.get_pointer(), incy);
@@ -124,7 +124,7 @@ void axpby(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<floa
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_saxpby>(cgh, [=]() {
+        host_task<class mkl_kernel_saxpby>(queue, cgh, [=]() {
             ::cblas_saxpby(n, alpha, accessor_x.get_pointer(), incx, beta, accessor_y.get_pointer(),
                            incy);
         });
@@ -136,7 +136,7 @@ void axpby(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<dou
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_daxpby>(cgh, [=]() {
+        host_task<class mkl_kernel_daxpby>(queue, cgh, [=]() {
             ::cblas_daxpby(n, alpha, accessor_x.get_pointer(), incx, beta, accessor_y.get_pointer(),
                            incy);
         });
@@ -151,7 +151,7 @@ void axpby(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
         auto accessor_y = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_caxpby>(cgh, [=]() {
+        host_task<class mkl_kernel_caxpby>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_caxpby(n, (const void *)&alpha_, accessor_x.get_pointer(), incx,
@@ -168,7 +168,7 @@ void axpby(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
         auto accessor_y = y.template get_access<cl::sycl::access::mode::read_write>(cgh);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zaxpby>(cgh, [=]() {
+        host_task<class mkl_kernel_zaxpby>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zaxpby(n, (const void *)&alpha_, accessor_x.get_pointer(), incx,
@@ -182,7 +182,7 @@ void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_scopy>(cgh, [=]() {
+        host_task<class mkl_kernel_scopy>(queue, cgh, [=]() {
             ::cblas_scopy(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy);
         });
     });
@@ -193,7 +193,7 @@ void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dcopy>(cgh, [=]() {
+        host_task<class mkl_kernel_dcopy>(queue, cgh, [=]() {
             ::cblas_dcopy(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy);
         });
     });
@@ -204,7 +204,7 @@ void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ccopy>(cgh, [=]() {
+        host_task<class mkl_kernel_ccopy>(queue, cgh, [=]() {
             ::cblas_ccopy(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy);
         });
     });
@@ -215,7 +215,7 @@ void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zcopy>(cgh, [=]() {
+        host_task<class mkl_kernel_zcopy>(queue, cgh, [=]() {
             ::cblas_zcopy(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy);
         });
     });
@@ -227,7 +227,7 @@ void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_sdot>(cgh, [=]() {
+        host_task<class mkl_kernel_sdot>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::cblas_sdot(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy);
         });
@@ -240,7 +240,7 @@ void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int6
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_ddot>(cgh, [=]() {
+        host_task<class mkl_kernel_ddot>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::cblas_ddot(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy);
         });
@@ -253,7 +253,7 @@ void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_dsdot>(cgh, [=]() {
+        host_task<class mkl_kernel_dsdot>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::cblas_dsdot(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy);
         });
@@ -267,7 +267,7 @@ void dotc(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cdotc>(cgh, [=]() {
+        host_task<class mkl_kernel_cdotc>(queue, cgh, [=]() {
             ::cblas_cdotc_sub(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
                               accessor_result.get_pointer());
         });
@@ -281,7 +281,7 @@ void dotc(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zdotc>(cgh, [=]() {
+        host_task<class mkl_kernel_zdotc>(queue, cgh, [=]() {
             ::cblas_zdotc_sub(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
                               accessor_result.get_pointer());
         });
@@ -295,7 +295,7 @@ void dotu(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cdotu>(cgh, [=]() {
+        host_task<class mkl_kernel_cdotu>(queue, cgh, [=]() {
             ::cblas_cdotu_sub(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
                               accessor_result.get_pointer());
         });
@@ -309,7 +309,7 @@ void dotu(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zdotu>(cgh, [=]() {
+        host_task<class mkl_kernel_zdotu>(queue, cgh, [=]() {
             ::cblas_zdotu_sub(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
                               accessor_result.get_pointer());
         });
@@ -321,7 +321,7 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_isamin>(cgh, [=]() {
+        host_task<class mkl_kernel_isamin>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::cblas_isamin((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
         });
@@ -333,7 +333,7 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, in
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.template get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_idamin>(cgh, [=]() {
+        host_task<class mkl_kernel_idamin>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::cblas_idamin((const MKL_INT)n, accessor_x.get_pointer(), (const MKL_INT)incx);
         });
@@ -345,7 +345,7 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<floa
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_icamin>(cgh, [=]() {
+        host_task<class mkl_kernel_icamin>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::cblas_icamin((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
         });
@@ -357,7 +357,7 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doub
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_izamin>(cgh, [=]() {
+        host_task<class mkl_kernel_izamin>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::cblas_izamin((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
         });
@@ -369,7 +369,7 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_isamax>(cgh, [=]() {
+        host_task<class mkl_kernel_isamax>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::cblas_isamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
         });
@@ -381,7 +381,7 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, in
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_idamax>(cgh, [=]() {
+        host_task<class mkl_kernel_idamax>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::cblas_idamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
         });
@@ -393,7 +393,7 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<floa
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_icamax>(cgh, [=]() {
+        host_task<class mkl_kernel_icamax>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::cblas_icamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
         });
@@ -405,7 +405,7 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doub
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_izamax>(cgh, [=]() {
+        host_task<class mkl_kernel_izamax>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::cblas_izamax((MKL_INT)n, accessor_x.get_pointer(), (MKL_INT)incx);
         });
@@ -417,7 +417,7 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.template get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_snrm2>(cgh, [=]() {
+        host_task<class mkl_kernel_snrm2>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::snrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -429,7 +429,7 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_dnrm2>(cgh, [=]() {
+        host_task<class mkl_kernel_dnrm2>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::dnrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -441,7 +441,7 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_scnrm2>(cgh, [=]() {
+        host_task<class mkl_kernel_scnrm2>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::scnrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -453,7 +453,7 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_dznrm2>(cgh, [=]() {
+        host_task<class mkl_kernel_dznrm2>(queue, cgh, [=]() {
             accessor_result[0] =
                 ::dznrm2((const MKL_INT *)&n, accessor_x.get_pointer(), (const MKL_INT *)&incx);
         });
@@ -465,7 +465,7 @@ void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_srot>(cgh, [=]() {
+        host_task<class mkl_kernel_srot>(queue, cgh, [=]() {
             ::cblas_srot(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy, c, s);
         });
     });
@@ -476,7 +476,7 @@ void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int6
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_drot>(cgh, [=]() {
+        host_task<class mkl_kernel_drot>(queue, cgh, [=]() {
             ::cblas_drot(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy, c, s);
         });
     });
@@ -488,7 +488,7 @@ void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_csrot>(cgh, [=]() {
+        host_task<class mkl_kernel_csrot>(queue, cgh, [=]() {
             ::cblas_csrot(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy, c, s);
         });
     });
@@ -500,7 +500,7 @@ void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zdrot>(cgh, [=]() {
+        host_task<class mkl_kernel_zdrot>(queue, cgh, [=]() {
             ::cblas_zdrot(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy, c, s);
         });
     });
@@ -513,7 +513,7 @@ void rotg(cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &a, cl::sycl::buffe
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_s = s.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_srotg>(cgh, [=]() {
+        host_task<class mkl_kernel_srotg>(queue, cgh, [=]() {
             ::cblas_srotg(accessor_a.get_pointer(), accessor_b.get_pointer(),
                           accessor_c.get_pointer(), accessor_s.get_pointer());
         });
@@ -527,7 +527,7 @@ void rotg(cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &a, cl::sycl::buff
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_s = s.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_drotg>(cgh, [=]() {
+        host_task<class mkl_kernel_drotg>(queue, cgh, [=]() {
             ::cblas_drotg(accessor_a.get_pointer(), accessor_b.get_pointer(),
                           accessor_c.get_pointer(), accessor_s.get_pointer());
         });
@@ -542,7 +542,7 @@ void rotg(cl::sycl::queue &queue, cl::sycl::buffer<std::complex<float>, 1> &a,
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_s = s.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_crotg>(cgh, [=]() {
+        host_task<class mkl_kernel_crotg>(queue, cgh, [=]() {
             ::cblas_crotg(accessor_a.get_pointer(), accessor_b.get_pointer(),
                           accessor_c.get_pointer(), accessor_s.get_pointer());
         });
@@ -557,7 +557,7 @@ void rotg(cl::sycl::queue &queue, cl::sycl::buffer<std::complex<double>, 1> &a,
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_s = s.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zrotg>(cgh, [=]() {
+        host_task<class mkl_kernel_zrotg>(queue, cgh, [=]() {
             ::cblas_zrotg(accessor_a.get_pointer(), accessor_b.get_pointer(),
                           accessor_c.get_pointer(), accessor_s.get_pointer());
         });
@@ -570,7 +570,7 @@ void rotm(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_param = param.get_access<cl::sycl::access::mode::read>(cgh);
-        host_task<class mkl_kernel_srotm>(cgh, [=]() {
+        host_task<class mkl_kernel_srotm>(queue, cgh, [=]() {
             ::cblas_srotm(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
                           accessor_param.get_pointer());
         });
@@ -583,7 +583,7 @@ void rotm(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_param = param.get_access<cl::sycl::access::mode::read>(cgh);
-        host_task<class mkl_kernel_drotm>(cgh, [=]() {
+        host_task<class mkl_kernel_drotm>(queue, cgh, [=]() {
             ::cblas_drotm(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
                           accessor_param.get_pointer());
         });
@@ -597,7 +597,7 @@ void rotmg(cl::sycl::queue &queue, cl::sycl::buffer<float, 1> &d1, cl::sycl::buf
         auto accessor_d2 = d2.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_x1 = x1.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_param = param.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_srotmg>(cgh, [=]() {
+        host_task<class mkl_kernel_srotmg>(queue, cgh, [=]() {
             ::cblas_srotmg(accessor_d1.get_pointer(), accessor_d2.get_pointer(),
                            accessor_x1.get_pointer(), y1, accessor_param.get_pointer());
         });
@@ -611,7 +611,7 @@ void rotmg(cl::sycl::queue &queue, cl::sycl::buffer<double, 1> &d1, cl::sycl::bu
         auto accessor_d2 = d2.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_x1 = x1.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_param = param.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_drotmg>(cgh, [=]() {
+        host_task<class mkl_kernel_drotmg>(queue, cgh, [=]() {
             ::cblas_drotmg(accessor_d1.get_pointer(), accessor_d2.get_pointer(),
                            accessor_x1.get_pointer(), y1, accessor_param.get_pointer());
         });
@@ -622,7 +622,7 @@ void scal(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float
           int64_t incx) {
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sscal>(cgh, [=]() {
+        host_task<class mkl_kernel_sscal>(queue, cgh, [=]() {
             ::sscal((const MKL_INT *)&n, (const float *)&alpha, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
         });
@@ -633,7 +633,7 @@ void scal(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<doub
           int64_t incx) {
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dscal>(cgh, [=]() {
+        host_task<class mkl_kernel_dscal>(queue, cgh, [=]() {
             ::dscal((const MKL_INT *)&n, (const double *)&alpha, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
         });
@@ -645,7 +645,7 @@ void scal(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
     queue.submit([&](cl::sycl::handler &cgh) {
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cscal>(cgh, [=]() {
+        host_task<class mkl_kernel_cscal>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cscal((const MKL_INT *)&n, (const MKL_Complex8 *)&alpha, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
@@ -657,7 +657,7 @@ void scal(cl::sycl::queue &queue, int64_t n, float alpha,
           cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx) {
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_csscal>(cgh, [=]() {
+        host_task<class mkl_kernel_csscal>(queue, cgh, [=]() {
             ::csscal((const MKL_INT *)&n, (const float *)&alpha, accessor_x.get_pointer(),
                      (const MKL_INT *)&incx);
         });
@@ -669,7 +669,7 @@ void scal(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
     queue.submit([&](cl::sycl::handler &cgh) {
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zscal>(cgh, [=]() {
+        host_task<class mkl_kernel_zscal>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::zscal((const MKL_INT *)&n, (const MKL_Complex16 *)&alpha, accessor_x.get_pointer(),
                     (const MKL_INT *)&incx);
@@ -681,7 +681,7 @@ void scal(cl::sycl::queue &queue, int64_t n, double alpha,
           cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx) {
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zdscal>(cgh, [=]() {
+        host_task<class mkl_kernel_zdscal>(queue, cgh, [=]() {
             ::zdscal((const MKL_INT *)&n, (const double *)&alpha, accessor_x.get_pointer(),
                      (const MKL_INT *)&incx);
         });
@@ -695,7 +695,7 @@ void sdsdot(cl::sycl::queue &queue, int64_t n, float sb, cl::sycl::buffer<float,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
-        host_task<class mkl_kernel_sdsdot>(cgh, [=]() {
+        host_task<class mkl_kernel_sdsdot>(queue, cgh, [=]() {
             accessor_result[0] = ::cblas_sdsdot(n, sb, accessor_x.get_pointer(), incx,
                                                 accessor_y.get_pointer(), incy);
         });
@@ -707,7 +707,7 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sswap>(cgh, [=]() {
+        host_task<class mkl_kernel_sswap>(queue, cgh, [=]() {
             ::cblas_sswap(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy);
         });
     });
@@ -718,7 +718,7 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dswap>(cgh, [=]() {
+        host_task<class mkl_kernel_dswap>(queue, cgh, [=]() {
             ::cblas_dswap(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy);
         });
     });
@@ -729,7 +729,7 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cswap>(cgh, [=]() {
+        host_task<class mkl_kernel_cswap>(queue, cgh, [=]() {
             ::cblas_cswap(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy);
         });
     });
@@ -740,7 +740,7 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zswap>(cgh, [=]() {
+        host_task<class mkl_kernel_zswap>(queue, cgh, [=]() {
             ::cblas_zswap(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy);
         });
     });
@@ -755,8 +755,9 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_sasum_usm>(
-            cgh, [=]() { result[0] = ::sasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+        host_task<class mkl_kernel_sasum_usm>(queue, cgh, [=]() {
+            result[0] = ::sasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
+        });
     });
     return done;
 }
@@ -768,8 +769,9 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_dasum_usm>(
-            cgh, [=]() { result[0] = ::dasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+        host_task<class mkl_kernel_dasum_usm>(queue, cgh, [=]() {
+            result[0] = ::dasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
+        });
     });
     return done;
 }
@@ -781,8 +783,9 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<float
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_scasum_usm>(
-            cgh, [=]() { result[0] = ::scasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+        host_task<class mkl_kernel_scasum_usm>(queue, cgh, [=]() {
+            result[0] = ::scasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
+        });
     });
     return done;
 }
@@ -794,8 +797,9 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_dzasum_usm>(
-            cgh, [=]() { result[0] = ::dzasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+        host_task<class mkl_kernel_dzasum_usm>(queue, cgh, [=]() {
+            result[0] = ::dzasum((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
+        });
     });
     return done;
 }
@@ -807,7 +811,7 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, float alpha, const float
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_saxpy_usm>(cgh,
+        host_task<class mkl_kernel_saxpy_usm>(queue, cgh,
                                               [=]() { ::cblas_saxpy(n, alpha, x, incx, y, incy); });
     });
     return done;
@@ -820,7 +824,7 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, double alpha, const doub
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_daxpy_usm>(cgh,
+        host_task<class mkl_kernel_daxpy_usm>(queue, cgh,
                                               [=]() { ::cblas_daxpy(n, alpha, x, incx, y, incy); });
     });
     return done;
@@ -835,7 +839,7 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alph
             cgh.depends_on(dependencies[i]);
         }
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_caxpy_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_caxpy_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_caxpy(n, (const void *)&alpha_, x, incx, y, incy);
         });
@@ -852,7 +856,7 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<double> alp
             cgh.depends_on(dependencies[i]);
         }
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_zaxpy_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zaxpy_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_zaxpy(n, (const void *)&alpha_, x, incx, y, incy);
         });
@@ -860,6 +864,66 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<double> alp
     return done;
 }
 
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const float *alpha, const float *x,
+                     int64_t incx, float *y, int64_t incy,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_saxpy_ptr_usm>(queue, cgh, [=]() {
+            ::cblas_saxpy(n, *alpha, x, incx, y, incy);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const double *alpha, const double *x,
+                     int64_t incx, double *y, int64_t incy,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_daxpy_ptr_usm>(queue, cgh, [=]() {
+            ::cblas_daxpy(n, *alpha, x, incx, y, incy);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                     const std::complex<float> *x, int64_t incx, std::complex<float> *y,
+                     int64_t incy, const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_caxpy_ptr_usm>(queue, cgh, [=]() {
+            ::cblas_caxpy(n, (const void *)alpha, x, incx, y, incy);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                     const std::complex<double> *x, int64_t incx, std::complex<double> *y,
+                     int64_t incy, const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_zaxpy_ptr_usm>(queue, cgh, [=]() {
+            ::cblas_zaxpy(n, (const void *)alpha, x, incx, y, incy);
+        });
+    });
+    return done;
+}
+
 cl::sycl::event axpby(cl::sycl::queue &queue, int64_t n, float alpha, const float *x, int64_t incx,
                       float beta, float *y, int64_t incy,
                       const std::vector<cl::sycl::event> &dependencies) {
@@ -869,7 +933,7 @@ cl::sycl::event axpby(cl::sycl::queue &queue, int64_t n, float alpha, const floa
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_saxpby_usm>(
-            cgh, [=]() { ::cblas_saxpby(n, alpha, x, incx, beta, y, incy); });
+            queue, cgh, [=]() { ::cblas_saxpby(n, alpha, x, incx, beta, y, incy); });
     });
     return done;
 }
@@ -882,7 +946,7 @@ cl::sycl::event axpby(cl::sycl::queue &queue, int64_t n, double alpha, const dou
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_daxpby_usm>(
-            cgh, [=]() { ::cblas_daxpby(n, alpha, x, incx, beta, y, incy); });
+            queue, cgh, [=]() { ::cblas_daxpby(n, alpha, x, incx, beta, y, incy); });
     });
     return done;
 }
@@ -897,7 +961,7 @@ cl::sycl::event axpby(cl::sycl::queue &queue, int64_t n, std::complex<float> alp
         }
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_caxpby_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_caxpby_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_caxpby(n, (const void *)&alpha_, x, incx, (const void *)&beta_, y, incy);
@@ -916,7 +980,7 @@ cl::sycl::event axpby(cl::sycl::queue &queue, int64_t n, std::complex<double> al
         }
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zaxpby_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zaxpby_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zaxpby(n, (const void *)&alpha_, x, incx, (const void *)&beta_, y, incy);
@@ -932,7 +996,9 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_scopy_usm>(cgh, [=]() { ::cblas_scopy(n, x, incx, y, incy); });
+        host_task<class mkl_kernel_scopy_usm>(queue, cgh, [=]() {
+            ::cblas_scopy(n, x, incx, y, incy);
+        });
     });
     return done;
 }
@@ -944,7 +1010,9 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_dcopy_usm>(cgh, [=]() { ::cblas_dcopy(n, x, incx, y, incy); });
+        host_task<class mkl_kernel_dcopy_usm>(queue, cgh, [=]() {
+            ::cblas_dcopy(n, x, incx, y, incy);
+        });
     });
     return done;
 }
@@ -957,7 +1025,9 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<float
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_ccopy_usm>(cgh, [=]() { ::cblas_ccopy(n, x, incx, y, incy); });
+        host_task<class mkl_kernel_ccopy_usm>(queue, cgh, [=]() {
+            ::cblas_ccopy(n, x, incx, y, incy);
+        });
     });
     return done;
 }
@@ -970,7 +1040,9 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_zcopy_usm>(cgh, [=]() { ::cblas_zcopy(n, x, incx, y, incy); });
+        host_task<class mkl_kernel_zcopy_usm>(queue, cgh, [=]() {
+            ::cblas_zcopy(n, x, incx, y, incy);
+        });
     });
     return done;
 }
@@ -983,7 +1055,7 @@ cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t i
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_sdot_usm>(
-            cgh, [=]() { result[0] = ::cblas_sdot(n, x, incx, y, incy); });
+            queue, cgh, [=]() { result[0] = ::cblas_sdot(n, x, incx, y, incy); });
     });
     return done;
 }
@@ -997,7 +1069,7 @@ cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_ddot_usm>(
-            cgh, [=]() { result[0] = ::cblas_ddot(n, x, incx, y, incy); });
+            queue, cgh, [=]() { result[0] = ::cblas_ddot(n, x, incx, y, incy); });
     });
     return done;
 }
@@ -1011,7 +1083,7 @@ cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t i
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_dsdot_usm>(
-            cgh, [=]() { result[0] = ::cblas_dsdot(n, x, incx, y, incy); });
+            queue, cgh, [=]() { result[0] = ::cblas_dsdot(n, x, incx, y, incy); });
     });
     return done;
 }
@@ -1025,7 +1097,7 @@ cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<float
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_cdotc_usm>(
-            cgh, [=]() { ::cblas_cdotc_sub(n, x, incx, y, incy, result); });
+            queue, cgh, [=]() { ::cblas_cdotc_sub(n, x, incx, y, incy, result); });
     });
     return done;
 }
@@ -1039,7 +1111,7 @@ cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_zdotc_usm>(
-            cgh, [=]() { ::cblas_zdotc_sub(n, x, incx, y, incy, result); });
+            queue, cgh, [=]() { ::cblas_zdotc_sub(n, x, incx, y, incy, result); });
     });
     return done;
 }
@@ -1053,7 +1125,7 @@ cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<float
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_cdotu_usm>(
-            cgh, [=]() { ::cblas_cdotu_sub(n, x, incx, y, incy, result); });
+            queue, cgh, [=]() { ::cblas_cdotu_sub(n, x, incx, y, incy, result); });
     });
     return done;
 }
@@ -1067,7 +1139,7 @@ cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_zdotu_usm>(
-            cgh, [=]() { ::cblas_zdotu_sub(n, x, incx, y, incy, result); });
+            queue, cgh, [=]() { ::cblas_zdotu_sub(n, x, incx, y, incy, result); });
     });
     return done;
 }
@@ -1080,7 +1152,7 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_isamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_isamin((MKL_INT)n, x, (MKL_INT)incx); });
+            queue, cgh, [=]() { result[0] = ::cblas_isamin((MKL_INT)n, x, (MKL_INT)incx); });
     });
     return done;
 }
@@ -1092,8 +1164,9 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const double *x, int64_
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_idamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_idamin((const MKL_INT)n, x, (const MKL_INT)incx); });
+        host_task<class mkl_kernel_idamin_usm>(queue, cgh, [=]() {
+            result[0] = ::cblas_idamin((const MKL_INT)n, x, (const MKL_INT)incx);
+        });
     });
     return done;
 }
@@ -1106,7 +1179,7 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<floa
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_icamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_icamin((MKL_INT)n, x, (MKL_INT)incx); });
+            queue, cgh, [=]() { result[0] = ::cblas_icamin((MKL_INT)n, x, (MKL_INT)incx); });
     });
     return done;
 }
@@ -1120,7 +1193,7 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<doub
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_izamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_izamin((MKL_INT)n, x, (MKL_INT)incx); });
+            queue, cgh, [=]() { result[0] = ::cblas_izamin((MKL_INT)n, x, (MKL_INT)incx); });
     });
     return done;
 }
@@ -1133,7 +1206,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_isamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_isamax((MKL_INT)n, x, (MKL_INT)incx); });
+            queue, cgh, [=]() { result[0] = ::cblas_isamax((MKL_INT)n, x, (MKL_INT)incx); });
     });
     return done;
 }
@@ -1146,7 +1219,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const double *x, int64_
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_idamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_idamax((MKL_INT)n, x, (MKL_INT)incx); });
+            queue, cgh, [=]() { result[0] = ::cblas_idamax((MKL_INT)n, x, (MKL_INT)incx); });
     });
     return done;
 }
@@ -1159,7 +1232,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<floa
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_icamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_icamax((MKL_INT)n, x, (MKL_INT)incx); });
+            queue, cgh, [=]() { result[0] = ::cblas_icamax((MKL_INT)n, x, (MKL_INT)incx); });
     });
     return done;
 }
@@ -1173,7 +1246,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<doub
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_izamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_izamax((MKL_INT)n, x, (MKL_INT)incx); });
+            queue, cgh, [=]() { result[0] = ::cblas_izamax((MKL_INT)n, x, (MKL_INT)incx); });
     });
     return done;
 }
@@ -1185,8 +1258,9 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_snrm2_usm>(
-            cgh, [=]() { result[0] = ::snrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+        host_task<class mkl_kernel_snrm2_usm>(queue, cgh, [=]() {
+            result[0] = ::snrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
+        });
     });
     return done;
 }
@@ -1198,8 +1272,9 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_dnrm2_usm>(
-            cgh, [=]() { result[0] = ::dnrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+        host_task<class mkl_kernel_dnrm2_usm>(queue, cgh, [=]() {
+            result[0] = ::dnrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
+        });
     });
     return done;
 }
@@ -1211,8 +1286,9 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<float
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_scnrm2_usm>(
-            cgh, [=]() { result[0] = ::scnrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+        host_task<class mkl_kernel_scnrm2_usm>(queue, cgh, [=]() {
+            result[0] = ::scnrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
+        });
     });
     return done;
 }
@@ -1224,8 +1300,9 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_dznrm2_usm>(
-            cgh, [=]() { result[0] = ::dznrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx); });
+        host_task<class mkl_kernel_dznrm2_usm>(queue, cgh, [=]() {
+            result[0] = ::dznrm2((const MKL_INT *)&n, x, (const MKL_INT *)&incx);
+        });
     });
     return done;
 }
@@ -1238,7 +1315,7 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, f
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_srot_usm>(cgh,
+        host_task<class mkl_kernel_srot_usm>(queue, cgh,
                                              [=]() { ::cblas_srot(n, x, incx, y, incy, c, s); });
     });
     return done;
@@ -1252,7 +1329,7 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_drot_usm>(cgh,
+        host_task<class mkl_kernel_drot_usm>(queue, cgh,
                                              [=]() { ::cblas_drot(n, x, incx, y, incy, c, s); });
     });
     return done;
@@ -1266,7 +1343,7 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<float> *x, i
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_csrot_usm>(cgh,
+        host_task<class mkl_kernel_csrot_usm>(queue, cgh,
                                               [=]() { ::cblas_csrot(n, x, incx, y, incy, c, s); });
     });
     return done;
@@ -1280,7 +1357,7 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<double> *x,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_zdrot_usm>(cgh,
+        host_task<class mkl_kernel_zdrot_usm>(queue, cgh,
                                               [=]() { ::cblas_zdrot(n, x, incx, y, incy, c, s); });
     });
     return done;
@@ -1293,7 +1370,7 @@ cl::sycl::event rotg(cl::sycl::queue &queue, float *a, float *b, float *c, float
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_srotg_usm>(cgh, [=]() { ::cblas_srotg(a, b, c, s); });
+        host_task<class mkl_kernel_srotg_usm>(queue, cgh, [=]() { ::cblas_srotg(a, b, c, s); });
     });
     return done;
 }
@@ -1305,7 +1382,7 @@ cl::sycl::event rotg(cl::sycl::queue &queue, double *a, double *b, double *c, do
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_drotg_usm>(cgh, [=]() { ::cblas_drotg(a, b, c, s); });
+        host_task<class mkl_kernel_drotg_usm>(queue, cgh, [=]() { ::cblas_drotg(a, b, c, s); });
     });
     return done;
 }
@@ -1318,7 +1395,7 @@ cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<float> *a, std::comple
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_crotg_usm>(cgh, [=]() { ::cblas_crotg(a, b, c, s); });
+        host_task<class mkl_kernel_crotg_usm>(queue, cgh, [=]() { ::cblas_crotg(a, b, c, s); });
     });
     return done;
 }
@@ -1331,7 +1408,7 @@ cl::sycl::event rotg(cl::sycl::queue &queue, std::complex<double> *a, std::compl
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_zrotg_usm>(cgh, [=]() { ::cblas_zrotg(a, b, c, s); });
+        host_task<class mkl_kernel_zrotg_usm>(queue, cgh, [=]() { ::cblas_zrotg(a, b, c, s); });
     });
     return done;
 }
@@ -1343,7 +1420,7 @@ cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_srotm_usm>(cgh,
+        host_task<class mkl_kernel_srotm_usm>(queue, cgh,
                                               [=]() { ::cblas_srotm(n, x, incx, y, incy, param); });
     });
     return done;
@@ -1357,7 +1434,7 @@ cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_drotm_usm>(cgh,
+        host_task<class mkl_kernel_drotm_usm>(queue, cgh,
                                               [=]() { ::cblas_drotm(n, x, incx, y, incy, param); });
     });
     return done;
@@ -1370,7 +1447,7 @@ cl::sycl::event rotmg(cl::sycl::queue &queue, float *d1, float *d2, float *x1, f
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_srotmg_usm>(cgh,
+        host_task<class mkl_kernel_srotmg_usm>(queue, cgh,
                                                [=]() { ::cblas_srotmg(d1, d2, x1, y1, param); });
     });
     return done;
@@ -1383,7 +1460,7 @@ cl::sycl::event rotmg(cl::sycl::queue &queue, double *d1, double *d2, double *x1
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_drotmg_usm>(cgh,
+        host_task<class mkl_kernel_drotmg_usm>(queue, cgh,
                                                [=]() { ::cblas_drotmg(d1, d2, x1, y1, param); });
     });
     return done;
@@ -1396,7 +1473,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, float *x, i
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_sscal_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_sscal_usm>(queue, cgh, [=]() {
             ::sscal((const MKL_INT *)&n, (const float *)&alpha, x, (const MKL_INT *)&incx);
         });
     });
@@ -1410,7 +1487,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, double *x,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_dscal_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dscal_usm>(queue, cgh, [=]() {
             ::dscal((const MKL_INT *)&n, (const double *)&alpha, x, (const MKL_INT *)&incx);
         });
     });
@@ -1426,7 +1503,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<float> alph
             cgh.depends_on(dependencies[i]);
         }
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_cscal_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_cscal_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cscal((const MKL_INT *)&n, (const MKL_Complex8 *)&alpha_, x, (const MKL_INT *)&incx);
         });
@@ -1441,7 +1518,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, std::comple
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_csscal_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_csscal_usm>(queue, cgh, [=]() {
             ::csscal((const MKL_INT *)&n, (const float *)&alpha, x, (const MKL_INT *)&incx);
         });
     });
@@ -1457,7 +1534,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<double> alp
             cgh.depends_on(dependencies[i]);
         }
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_zscal_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zscal_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::zscal((const MKL_INT *)&n, (const MKL_Complex16 *)&alpha_, x, (const MKL_INT *)&incx);
         });
@@ -1472,13 +1549,101 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, std::compl
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_zdscal_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zdscal_usm>(queue, cgh, [=]() {
             ::zdscal((const MKL_INT *)&n, (const double *)&alpha, x, (const MKL_INT *)&incx);
         });
     });
     return done;
 }
 
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const float *alpha, float *x,
+                     int64_t incx, const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_sscal_ptr_usm>(queue, cgh, [=]() {
+            ::sscal((const MKL_INT *)&n, (const float *)alpha, x, (const MKL_INT *)&incx);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const double *alpha, double *x,
+                     int64_t incx, const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_dscal_ptr_usm>(queue, cgh, [=]() {
+            ::dscal((const MKL_INT *)&n, (const double *)alpha, x, (const MKL_INT *)&incx);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                     std::complex<float> *x, int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_cscal_ptr_usm>(queue, cgh, [=]() {
+            ::cscal((const MKL_INT *)&n, (const MKL_Complex8 *)alpha, x, (const MKL_INT *)&incx);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const float *alpha,
+                     std::complex<float> *x, int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_csscal_ptr_usm>(queue, cgh, [=]() {
+            ::csscal((const MKL_INT *)&n, (const float *)alpha, x, (const MKL_INT *)&incx);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                     std::complex<double> *x, int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_zscal_ptr_usm>(queue, cgh, [=]() {
+            ::zscal((const MKL_INT *)&n, (const MKL_Complex16 *)alpha, x, (const MKL_INT *)&incx);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const double *alpha,
+                     std::complex<double> *x, int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class mkl_kernel_zdscal_ptr_usm>(queue, cgh, [=]() {
+            ::zdscal((const MKL_INT *)&n, (const double *)alpha, x, (const MKL_INT *)&incx);
+        });
+    });
+    return done;
+}
+
 cl::sycl::event sdsdot(cl::sycl::queue &queue, int64_t n, float sb, const float *x, int64_t incx,
                        const float *y, int64_t incy, float *result,
                        const std::vector<cl::sycl::event> &dependencies) {
@@ -1488,7 +1653,7 @@ cl::sycl::event sdsdot(cl::sycl::queue &queue, int64_t n, float sb, const float
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_sdsdot_usm>(
-            cgh, [=]() { result[0] = ::cblas_sdsdot(n, sb, x, incx, y, incy); });
+            queue, cgh, [=]() { result[0] = ::cblas_sdsdot(n, sb, x, incx, y, incy); });
     });
     return done;
 }
@@ -1500,7 +1665,9 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_sswap_usm>(cgh, [=]() { ::cblas_sswap(n, x, incx, y, incy); });
+        host_task<class mkl_kernel_sswap_usm>(queue, cgh, [=]() {
+            ::cblas_sswap(n, x, incx, y, incy);
+        });
     });
     return done;
 }
@@ -1512,7 +1679,9 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_dswap_usm>(cgh, [=]() { ::cblas_dswap(n, x, incx, y, incy); });
+        host_task<class mkl_kernel_dswap_usm>(queue, cgh, [=]() {
+            ::cblas_dswap(n, x, incx, y, incy);
+        });
     });
     return done;
 }
@@ -1525,7 +1694,9 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, std::complex<float> *x,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_cswap_usm>(cgh, [=]() { ::cblas_cswap(n, x, incx, y, incy); });
+        host_task<class mkl_kernel_cswap_usm>(queue, cgh, [=]() {
+            ::cblas_cswap(n, x, incx, y, incy);
+        });
     });
     return done;
 }
@@ -1538,7 +1709,9 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, std::complex<double> *x,
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class mkl_kernel_zswap_usm>(cgh, [=]() { ::cblas_zswap(n, x, incx, y, incy); });
+        host_task<class mkl_kernel_zswap_usm>(queue, cgh, [=]() {
+            ::cblas_zswap(n, x, incx, y, incy);
+        });
     });
     return done;
 }
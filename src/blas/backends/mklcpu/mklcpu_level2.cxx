@@ -27,7 +27,7 @@ void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sgbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_sgbmv>(queue, cgh, [=]() {
             ::cblas_sgbmv(CBLASMAJOR, trans_, m, n, kl, ku, alpha, accessor_a.get_pointer(), lda,
                           accessor_x.get_pointer(), incx, beta, accessor_y.get_pointer(), incy);
         });
@@ -42,7 +42,7 @@ void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dgbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_dgbmv>(queue, cgh, [=]() {
             ::cblas_dgbmv(CBLASMAJOR, trans_, m, n, kl, ku, alpha, accessor_a.get_pointer(), lda,
                           accessor_x.get_pointer(), incx, beta, accessor_y.get_pointer(), incy);
         });
@@ -60,7 +60,7 @@ void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cgbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_cgbmv>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_cgbmv(CBLASMAJOR, trans_, m, n, kl, ku, (const void *)&alpha_,
@@ -81,7 +81,7 @@ void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zgbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_zgbmv>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zgbmv(CBLASMAJOR, trans_, m, n, kl, ku, (const void *)&alpha_,
@@ -99,7 +99,7 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float a
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sgemv>(cgh, [=]() {
+        host_task<class mkl_kernel_sgemv>(queue, cgh, [=]() {
             ::cblas_sgemv(CBLASMAJOR, trans_, m, n, alpha, accessor_a.get_pointer(), lda,
                           accessor_x.get_pointer(), incx, beta, accessor_y.get_pointer(), incy);
         });
@@ -114,7 +114,7 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dgemv>(cgh, [=]() {
+        host_task<class mkl_kernel_dgemv>(queue, cgh, [=]() {
             ::cblas_dgemv(CBLASMAJOR, trans_, m, n, alpha, accessor_a.get_pointer(), lda,
                           accessor_x.get_pointer(), incx, beta, accessor_y.get_pointer(), incy);
         });
@@ -132,7 +132,7 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::co
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cgemv>(cgh, [=]() {
+        host_task<class mkl_kernel_cgemv>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_cgemv(CBLASMAJOR, trans_, m, n, (const void *)&alpha_, accessor_a.get_pointer(),
@@ -153,7 +153,7 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::co
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zgemv>(cgh, [=]() {
+        host_task<class mkl_kernel_zgemv>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zgemv(CBLASMAJOR, trans_, m, n, (const void *)&alpha_, accessor_a.get_pointer(),
@@ -170,7 +170,7 @@ void ger(cl::sycl::queue &queue, int64_t m, int64_t n, float alpha, cl::sycl::bu
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sger>(cgh, [=]() {
+        host_task<class mkl_kernel_sger>(queue, cgh, [=]() {
             ::cblas_sger(CBLASMAJOR, m, n, alpha, accessor_x.get_pointer(), incx,
                          accessor_y.get_pointer(), incy, accessor_a.get_pointer(), lda);
         });
@@ -184,7 +184,7 @@ void ger(cl::sycl::queue &queue, int64_t m, int64_t n, double alpha, cl::sycl::b
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dger>(cgh, [=]() {
+        host_task<class mkl_kernel_dger>(queue, cgh, [=]() {
             ::cblas_dger(CBLASMAJOR, m, n, alpha, accessor_x.get_pointer(), incx,
                          accessor_y.get_pointer(), incy, accessor_a.get_pointer(), lda);
         });
@@ -200,7 +200,7 @@ void gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alph
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cgerc>(cgh, [=]() {
+        host_task<class mkl_kernel_cgerc>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_cgerc(CBLASMAJOR, m, n, (const void *)&alpha_, accessor_x.get_pointer(), incx,
                           accessor_y.get_pointer(), incy, accessor_a.get_pointer(), lda);
@@ -217,7 +217,7 @@ void gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alp
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zgerc>(cgh, [=]() {
+        host_task<class mkl_kernel_zgerc>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_zgerc(CBLASMAJOR, m, n, (const void *)&alpha_, accessor_x.get_pointer(), incx,
                           accessor_y.get_pointer(), incy, accessor_a.get_pointer(), lda);
@@ -234,7 +234,7 @@ void geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alph
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cgeru>(cgh, [=]() {
+        host_task<class mkl_kernel_cgeru>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_cgeru(CBLASMAJOR, m, n, (const void *)&alpha_, accessor_x.get_pointer(), incx,
                           accessor_y.get_pointer(), incy, accessor_a.get_pointer(), lda);
@@ -251,7 +251,7 @@ void geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alp
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zgeru>(cgh, [=]() {
+        host_task<class mkl_kernel_zgeru>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_zgeru(CBLASMAJOR, m, n, (const void *)&alpha_, accessor_x.get_pointer(), incx,
                           accessor_y.get_pointer(), incy, accessor_a.get_pointer(), lda);
@@ -270,7 +270,7 @@ void hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, std::c
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_chbmv>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_chbmv(CBLASMAJOR, upper_lower_, n, k, (const void *)&alpha_,
@@ -291,7 +291,7 @@ void hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_zhbmv>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zhbmv(CBLASMAJOR, upper_lower_, n, k, (const void *)&alpha_,
@@ -312,7 +312,7 @@ void hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chemv>(cgh, [=]() {
+        host_task<class mkl_kernel_chemv>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_chemv(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_,
@@ -333,7 +333,7 @@ void hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhemv>(cgh, [=]() {
+        host_task<class mkl_kernel_zhemv>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zhemv(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_,
@@ -350,7 +350,7 @@ void her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cher>(cgh, [=]() {
+        host_task<class mkl_kernel_cher>(queue, cgh, [=]() {
             ::cblas_cher(CBLASMAJOR, upper_lower_, n, alpha, accessor_x.get_pointer(), incx,
                          accessor_a.get_pointer(), lda);
         });
@@ -364,7 +364,7 @@ void her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zher>(cgh, [=]() {
+        host_task<class mkl_kernel_zher>(queue, cgh, [=]() {
             ::cblas_zher(CBLASMAJOR, upper_lower_, n, alpha, accessor_x.get_pointer(), incx,
                          accessor_a.get_pointer(), lda);
         });
@@ -381,7 +381,7 @@ void her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cher2>(cgh, [=]() {
+        host_task<class mkl_kernel_cher2>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_cher2(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_,
                           accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
@@ -400,7 +400,7 @@ void her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zher2>(cgh, [=]() {
+        host_task<class mkl_kernel_zher2>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_zher2(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_,
                           accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
@@ -420,7 +420,7 @@ void hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chpmv>(cgh, [=]() {
+        host_task<class mkl_kernel_chpmv>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_chpmv(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_,
@@ -441,7 +441,7 @@ void hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhpmv>(cgh, [=]() {
+        host_task<class mkl_kernel_zhpmv>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zhpmv(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_,
@@ -458,7 +458,7 @@ void hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chpr>(cgh, [=]() {
+        host_task<class mkl_kernel_chpr>(queue, cgh, [=]() {
             ::cblas_chpr(CBLASMAJOR, upper_lower_, n, alpha, accessor_x.get_pointer(), incx,
                          accessor_ap.get_pointer());
         });
@@ -472,7 +472,7 @@ void hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhpr>(cgh, [=]() {
+        host_task<class mkl_kernel_zhpr>(queue, cgh, [=]() {
             ::cblas_zhpr(CBLASMAJOR, upper_lower_, n, alpha, accessor_x.get_pointer(), incx,
                          accessor_ap.get_pointer());
         });
@@ -489,7 +489,7 @@ void hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chpr2>(cgh, [=]() {
+        host_task<class mkl_kernel_chpr2>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_chpr2(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_,
                           accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
@@ -508,7 +508,7 @@ void hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhpr2>(cgh, [=]() {
+        host_task<class mkl_kernel_zhpr2>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_zhpr2(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_,
                           accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
@@ -525,7 +525,7 @@ void sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, float
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_ssbmv>(queue, cgh, [=]() {
             ::cblas_ssbmv(CBLASMAJOR, upper_lower_, n, k, alpha, accessor_a.get_pointer(), lda,
                           accessor_x.get_pointer(), incx, beta, accessor_y.get_pointer(), incy);
         });
@@ -540,7 +540,7 @@ void sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, double
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_dsbmv>(queue, cgh, [=]() {
             ::cblas_dsbmv(CBLASMAJOR, upper_lower_, n, k, alpha, accessor_a.get_pointer(), lda,
                           accessor_x.get_pointer(), incx, beta, accessor_y.get_pointer(), incy);
         });
@@ -555,7 +555,7 @@ void spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sspmv>(cgh, [=]() {
+        host_task<class mkl_kernel_sspmv>(queue, cgh, [=]() {
             ::cblas_sspmv(CBLASMAJOR, upper_lower_, n, alpha, accessor_ap.get_pointer(),
                           accessor_x.get_pointer(), incx, beta, accessor_y.get_pointer(), incy);
         });
@@ -570,7 +570,7 @@ void spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dspmv>(cgh, [=]() {
+        host_task<class mkl_kernel_dspmv>(queue, cgh, [=]() {
             ::cblas_dspmv(CBLASMAJOR, upper_lower_, n, alpha, accessor_ap.get_pointer(),
                           accessor_x.get_pointer(), incx, beta, accessor_y.get_pointer(), incy);
         });
@@ -583,7 +583,7 @@ void spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sspr>(cgh, [=]() {
+        host_task<class mkl_kernel_sspr>(queue, cgh, [=]() {
             ::cblas_sspr(CBLASMAJOR, upper_lower_, n, alpha, accessor_x.get_pointer(), incx,
                          accessor_ap.get_pointer());
         });
@@ -596,7 +596,7 @@ void spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dspr>(cgh, [=]() {
+        host_task<class mkl_kernel_dspr>(queue, cgh, [=]() {
             ::cblas_dspr(CBLASMAJOR, upper_lower_, n, alpha, accessor_x.get_pointer(), incx,
                          accessor_ap.get_pointer());
         });
@@ -611,7 +611,7 @@ void spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sspr2>(cgh, [=]() {
+        host_task<class mkl_kernel_sspr2>(queue, cgh, [=]() {
             ::cblas_sspr2(CBLASMAJOR, upper_lower_, n, alpha, accessor_x.get_pointer(), incx,
                           accessor_y.get_pointer(), incy, accessor_ap.get_pointer());
         });
@@ -626,7 +626,7 @@ void spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dspr2>(cgh, [=]() {
+        host_task<class mkl_kernel_dspr2>(queue, cgh, [=]() {
             ::cblas_dspr2(CBLASMAJOR, upper_lower_, n, alpha, accessor_x.get_pointer(), incx,
                           accessor_y.get_pointer(), incy, accessor_ap.get_pointer());
         });
@@ -641,7 +641,7 @@ void symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssymv>(cgh, [=]() {
+        host_task<class mkl_kernel_ssymv>(queue, cgh, [=]() {
             ::cblas_ssymv(CBLASMAJOR, upper_lower_, n, alpha, accessor_a.get_pointer(), lda,
                           accessor_x.get_pointer(), incx, beta, accessor_y.get_pointer(), incy);
         });
@@ -656,7 +656,7 @@ void symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsymv>(cgh, [=]() {
+        host_task<class mkl_kernel_dsymv>(queue, cgh, [=]() {
             ::cblas_dsymv(CBLASMAJOR, upper_lower_, n, alpha, accessor_a.get_pointer(), lda,
                           accessor_x.get_pointer(), incx, beta, accessor_y.get_pointer(), incy);
         });
@@ -669,7 +669,7 @@ void syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssyr>(cgh, [=]() {
+        host_task<class mkl_kernel_ssyr>(queue, cgh, [=]() {
             ::cblas_ssyr(CBLASMAJOR, upper_lower_, n, alpha, accessor_x.get_pointer(), incx,
                          accessor_a.get_pointer(), lda);
         });
@@ -683,7 +683,7 @@ void syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsyr>(cgh, [=]() {
+        host_task<class mkl_kernel_dsyr>(queue, cgh, [=]() {
             ::cblas_dsyr(CBLASMAJOR, upper_lower_, n, alpha, accessor_x.get_pointer(), incx,
                          accessor_a.get_pointer(), lda);
         });
@@ -698,7 +698,7 @@ void syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssyr2>(cgh, [=]() {
+        host_task<class mkl_kernel_ssyr2>(queue, cgh, [=]() {
             ::cblas_ssyr2(CBLASMAJOR, upper_lower_, n, alpha, accessor_x.get_pointer(), incx,
                           accessor_y.get_pointer(), incy, accessor_a.get_pointer(), lda);
         });
@@ -713,7 +713,7 @@ void syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsyr2>(cgh, [=]() {
+        host_task<class mkl_kernel_dsyr2>(queue, cgh, [=]() {
             ::cblas_dsyr2(CBLASMAJOR, upper_lower_, n, alpha, accessor_x.get_pointer(), incx,
                           accessor_y.get_pointer(), incy, accessor_a.get_pointer(), lda);
         });
@@ -729,7 +729,7 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_stbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_stbmv>(queue, cgh, [=]() {
             ::cblas_stbmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k,
                           accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx);
         });
@@ -745,7 +745,7 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_dtbmv>(queue, cgh, [=]() {
             ::cblas_dtbmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k,
                           accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx);
         });
@@ -761,7 +761,7 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_ctbmv>(queue, cgh, [=]() {
             ::cblas_ctbmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k,
                           accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx);
         });
@@ -777,7 +777,7 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztbmv>(cgh, [=]() {
+        host_task<class mkl_kernel_ztbmv>(queue, cgh, [=]() {
             ::cblas_ztbmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k,
                           accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx);
         });
@@ -793,7 +793,7 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_stbsv>(cgh, [=]() {
+        host_task<class mkl_kernel_stbsv>(queue, cgh, [=]() {
             ::cblas_stbsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k,
                           accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx);
         });
@@ -809,7 +809,7 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtbsv>(cgh, [=]() {
+        host_task<class mkl_kernel_dtbsv>(queue, cgh, [=]() {
             ::cblas_dtbsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k,
                           accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx);
         });
@@ -825,7 +825,7 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctbsv>(cgh, [=]() {
+        host_task<class mkl_kernel_ctbsv>(queue, cgh, [=]() {
             ::cblas_ctbsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k,
                           accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx);
         });
@@ -841,7 +841,7 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztbsv>(cgh, [=]() {
+        host_task<class mkl_kernel_ztbsv>(queue, cgh, [=]() {
             ::cblas_ztbsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k,
                           accessor_a.get_pointer(), lda, accessor_x.get_pointer(), incx);
         });
@@ -856,7 +856,7 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_stpmv>(cgh, [=]() {
+        host_task<class mkl_kernel_stpmv>(queue, cgh, [=]() {
             ::cblas_stpmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n,
                           accessor_ap.get_pointer(), accessor_x.get_pointer(), incx);
         });
@@ -871,7 +871,7 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtpmv>(cgh, [=]() {
+        host_task<class mkl_kernel_dtpmv>(queue, cgh, [=]() {
             ::cblas_dtpmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n,
                           accessor_ap.get_pointer(), accessor_x.get_pointer(), incx);
         });
@@ -887,7 +887,7 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctpmv>(cgh, [=]() {
+        host_task<class mkl_kernel_ctpmv>(queue, cgh, [=]() {
             ::cblas_ctpmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n,
                           accessor_ap.get_pointer(), accessor_x.get_pointer(), incx);
         });
@@ -903,7 +903,7 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztpmv>(cgh, [=]() {
+        host_task<class mkl_kernel_ztpmv>(queue, cgh, [=]() {
             ::cblas_ztpmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n,
                           accessor_ap.get_pointer(), accessor_x.get_pointer(), incx);
         });
@@ -918,7 +918,7 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_stpsv>(cgh, [=]() {
+        host_task<class mkl_kernel_stpsv>(queue, cgh, [=]() {
             ::cblas_stpsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n,
                           accessor_ap.get_pointer(), accessor_x.get_pointer(), incx);
         });
@@ -933,7 +933,7 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtpsv>(cgh, [=]() {
+        host_task<class mkl_kernel_dtpsv>(queue, cgh, [=]() {
             ::cblas_dtpsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n,
                           accessor_ap.get_pointer(), accessor_x.get_pointer(), incx);
         });
@@ -949,7 +949,7 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctpsv>(cgh, [=]() {
+        host_task<class mkl_kernel_ctpsv>(queue, cgh, [=]() {
             ::cblas_ctpsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n,
                           accessor_ap.get_pointer(), accessor_x.get_pointer(), incx);
         });
@@ -965,7 +965,7 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztpsv>(cgh, [=]() {
+        host_task<class mkl_kernel_ztpsv>(queue, cgh, [=]() {
             ::cblas_ztpsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n,
                           accessor_ap.get_pointer(), accessor_x.get_pointer(), incx);
         });
@@ -980,7 +980,7 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_strmv>(cgh, [=]() {
+        host_task<class mkl_kernel_strmv>(queue, cgh, [=]() {
             ::cblas_strmv(CBLASMAJOR, upper_lower_, transa_, unit_diag_, n,
                           accessor_a.get_pointer(), lda, accessor_b.get_pointer(), incx);
         });
@@ -996,7 +996,7 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtrmv>(cgh, [=]() {
+        host_task<class mkl_kernel_dtrmv>(queue, cgh, [=]() {
             ::cblas_dtrmv(CBLASMAJOR, upper_lower_, transa_, unit_diag_, n,
                           accessor_a.get_pointer(), lda, accessor_b.get_pointer(), incx);
         });
@@ -1012,7 +1012,7 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctrmv>(cgh, [=]() {
+        host_task<class mkl_kernel_ctrmv>(queue, cgh, [=]() {
             ::cblas_ctrmv(CBLASMAJOR, upper_lower_, transa_, unit_diag_, n,
                           accessor_a.get_pointer(), lda, accessor_b.get_pointer(), incx);
         });
@@ -1028,7 +1028,7 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztrmv>(cgh, [=]() {
+        host_task<class mkl_kernel_ztrmv>(queue, cgh, [=]() {
             ::cblas_ztrmv(CBLASMAJOR, upper_lower_, transa_, unit_diag_, n,
                           accessor_a.get_pointer(), lda, accessor_b.get_pointer(), incx);
         });
@@ -1043,7 +1043,7 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_strsv>(cgh, [=]() {
+        host_task<class mkl_kernel_strsv>(queue, cgh, [=]() {
             ::cblas_strsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, accessor_a.get_pointer(),
                           lda, accessor_x.get_pointer(), incx);
         });
@@ -1059,7 +1059,7 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtrsv>(cgh, [=]() {
+        host_task<class mkl_kernel_dtrsv>(queue, cgh, [=]() {
             ::cblas_dtrsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, accessor_a.get_pointer(),
                           lda, accessor_x.get_pointer(), incx);
         });
@@ -1075,7 +1075,7 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctrsv>(cgh, [=]() {
+        host_task<class mkl_kernel_ctrsv>(queue, cgh, [=]() {
             ::cblas_ctrsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, accessor_a.get_pointer(),
                           lda, accessor_x.get_pointer(), incx);
         });
@@ -1091,7 +1091,7 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztrsv>(cgh, [=]() {
+        host_task<class mkl_kernel_ztrsv>(queue, cgh, [=]() {
             ::cblas_ztrsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, accessor_a.get_pointer(),
                           lda, accessor_x.get_pointer(), incx);
         });
@@ -1110,7 +1110,7 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
-        host_task<class mkl_kernel_sgbmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_sgbmv_usm>(queue, cgh, [=]() {
             ::cblas_sgbmv(CBLASMAJOR, trans_, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
         });
     });
@@ -1127,7 +1127,7 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
-        host_task<class mkl_kernel_dgbmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dgbmv_usm>(queue, cgh, [=]() {
             ::cblas_dgbmv(CBLASMAJOR, trans_, m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
         });
     });
@@ -1147,7 +1147,7 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_cgbmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_cgbmv_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_cgbmv(CBLASMAJOR, trans_, m, n, kl, ku, (const void *)&alpha_, a, lda, x, incx,
@@ -1170,7 +1170,7 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zgbmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zgbmv_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zgbmv(CBLASMAJOR, trans_, m, n, kl, ku, (const void *)&alpha_, a, lda, x, incx,
@@ -1189,7 +1189,7 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
-        host_task<class mkl_kernel_sgemv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_sgemv_usm>(queue, cgh, [=]() {
             ::cblas_sgemv(CBLASMAJOR, trans_, m, n, alpha, a, lda, x, incx, beta, y, incy);
         });
     });
@@ -1205,7 +1205,7 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
-        host_task<class mkl_kernel_dgemv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dgemv_usm>(queue, cgh, [=]() {
             ::cblas_dgemv(CBLASMAJOR, trans_, m, n, alpha, a, lda, x, incx, beta, y, incy);
         });
     });
@@ -1225,7 +1225,7 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_cgemv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_cgemv_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_cgemv(CBLASMAJOR, trans_, m, n, (const void *)&alpha_, a, lda, x, incx,
@@ -1248,7 +1248,7 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zgemv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zgemv_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zgemv(CBLASMAJOR, trans_, m, n, (const void *)&alpha_, a, lda, x, incx,
@@ -1267,7 +1267,7 @@ cl::sycl::event ger(cl::sycl::queue &queue, int64_t m, int64_t n, float alpha, c
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_sger_usm>(
-            cgh, [=]() { ::cblas_sger(CBLASMAJOR, m, n, alpha, x, incx, y, incy, a, lda); });
+            queue, cgh, [=]() { ::cblas_sger(CBLASMAJOR, m, n, alpha, x, incx, y, incy, a, lda); });
     });
     return done;
 }
@@ -1281,7 +1281,7 @@ cl::sycl::event ger(cl::sycl::queue &queue, int64_t m, int64_t n, double alpha,
             cgh.depends_on(dependencies[i]);
         }
         host_task<class mkl_kernel_dger_usm>(
-            cgh, [=]() { ::cblas_dger(CBLASMAJOR, m, n, alpha, x, incx, y, incy, a, lda); });
+            queue, cgh, [=]() { ::cblas_dger(CBLASMAJOR, m, n, alpha, x, incx, y, incy, a, lda); });
     });
     return done;
 }
@@ -1296,7 +1296,7 @@ cl::sycl::event gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
             cgh.depends_on(dependencies[i]);
         }
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_cgerc_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_cgerc_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_cgerc(CBLASMAJOR, m, n, (const void *)&alpha_, x, incx, y, incy, a, lda);
         });
@@ -1314,7 +1314,7 @@ cl::sycl::event gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
             cgh.depends_on(dependencies[i]);
         }
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_zgerc_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zgerc_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_zgerc(CBLASMAJOR, m, n, (const void *)&alpha_, x, incx, y, incy, a, lda);
         });
@@ -1332,7 +1332,7 @@ cl::sycl::event geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
             cgh.depends_on(dependencies[i]);
         }
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_cgeru_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_cgeru_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_cgeru(CBLASMAJOR, m, n, (const void *)&alpha_, x, incx, y, incy, a, lda);
         });
@@ -1350,7 +1350,7 @@ cl::sycl::event geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
             cgh.depends_on(dependencies[i]);
         }
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_zgeru_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zgeru_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_zgeru(CBLASMAJOR, m, n, (const void *)&alpha_, x, incx, y, incy, a, lda);
         });
@@ -1371,7 +1371,7 @@ cl::sycl::event hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_chbmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_chbmv_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_chbmv(CBLASMAJOR, upper_lower_, n, k, (const void *)&alpha_, a, lda, x, incx,
@@ -1394,7 +1394,7 @@ cl::sycl::event hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zhbmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zhbmv_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zhbmv(CBLASMAJOR, upper_lower_, n, k, (const void *)&alpha_, a, lda, x, incx,
@@ -1416,7 +1416,7 @@ cl::sycl::event hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_chemv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_chemv_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_chemv(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_, a, lda, x, incx,
@@ -1439,7 +1439,7 @@ cl::sycl::event hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zhemv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zhemv_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zhemv(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_, a, lda, x, incx,
@@ -1458,8 +1458,9 @@ cl::sycl::event her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_cher_usm>(
-            cgh, [=]() { ::cblas_cher(CBLASMAJOR, upper_lower_, n, alpha, x, incx, a, lda); });
+        host_task<class mkl_kernel_cher_usm>(queue, cgh, [=]() {
+            ::cblas_cher(CBLASMAJOR, upper_lower_, n, alpha, x, incx, a, lda);
+        });
     });
     return done;
 }
@@ -1473,8 +1474,9 @@ cl::sycl::event her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_zher_usm>(
-            cgh, [=]() { ::cblas_zher(CBLASMAJOR, upper_lower_, n, alpha, x, incx, a, lda); });
+        host_task<class mkl_kernel_zher_usm>(queue, cgh, [=]() {
+            ::cblas_zher(CBLASMAJOR, upper_lower_, n, alpha, x, incx, a, lda);
+        });
     });
     return done;
 }
@@ -1490,7 +1492,7 @@ cl::sycl::event her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_cher2_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_cher2_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_cher2(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_, x, incx, y, incy, a,
                           lda);
@@ -1510,7 +1512,7 @@ cl::sycl::event her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_zher2_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zher2_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_zher2(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_, x, incx, y, incy, a,
                           lda);
@@ -1531,7 +1533,7 @@ cl::sycl::event hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_chpmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_chpmv_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_chpmv(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_, ap, x, incx,
@@ -1554,7 +1556,7 @@ cl::sycl::event hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zhpmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zhpmv_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zhpmv(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_, ap, x, incx,
@@ -1574,7 +1576,7 @@ cl::sycl::event hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         host_task<class mkl_kernel_chpr_usm>(
-            cgh, [=]() { ::cblas_chpr(CBLASMAJOR, upper_lower_, n, alpha, x, incx, ap); });
+            queue, cgh, [=]() { ::cblas_chpr(CBLASMAJOR, upper_lower_, n, alpha, x, incx, ap); });
     });
     return done;
 }
@@ -1589,7 +1591,7 @@ cl::sycl::event hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         host_task<class mkl_kernel_zhpr_usm>(
-            cgh, [=]() { ::cblas_zhpr(CBLASMAJOR, upper_lower_, n, alpha, x, incx, ap); });
+            queue, cgh, [=]() { ::cblas_zhpr(CBLASMAJOR, upper_lower_, n, alpha, x, incx, ap); });
     });
     return done;
 }
@@ -1605,7 +1607,7 @@ cl::sycl::event hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_chpr2_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_chpr2_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_chpr2(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_, x, incx, y, incy, ap);
         });
@@ -1624,7 +1626,7 @@ cl::sycl::event hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_zhpr2_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zhpr2_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_zhpr2(CBLASMAJOR, upper_lower_, n, (const void *)&alpha_, x, incx, y, incy, ap);
         });
@@ -1641,7 +1643,7 @@ cl::sycl::event sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_ssbmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ssbmv_usm>(queue, cgh, [=]() {
             ::cblas_ssbmv(CBLASMAJOR, upper_lower_, n, k, alpha, a, lda, x, incx, beta, y, incy);
         });
     });
@@ -1657,7 +1659,7 @@ cl::sycl::event sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_dsbmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dsbmv_usm>(queue, cgh, [=]() {
             ::cblas_dsbmv(CBLASMAJOR, upper_lower_, n, k, alpha, a, lda, x, incx, beta, y, incy);
         });
     });
@@ -1673,7 +1675,7 @@ cl::sycl::event spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_sspmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_sspmv_usm>(queue, cgh, [=]() {
             ::cblas_sspmv(CBLASMAJOR, upper_lower_, n, alpha, ap, x, incx, beta, y, incy);
         });
     });
@@ -1689,7 +1691,7 @@ cl::sycl::event spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_dspmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dspmv_usm>(queue, cgh, [=]() {
             ::cblas_dspmv(CBLASMAJOR, upper_lower_, n, alpha, ap, x, incx, beta, y, incy);
         });
     });
@@ -1706,7 +1708,7 @@ cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         host_task<class mkl_kernel_sspr_usm>(
-            cgh, [=]() { ::cblas_sspr(CBLASMAJOR, upper_lower_, n, alpha, x, incx, ap); });
+            queue, cgh, [=]() { ::cblas_sspr(CBLASMAJOR, upper_lower_, n, alpha, x, incx, ap); });
     });
     return done;
 }
@@ -1721,7 +1723,7 @@ cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         host_task<class mkl_kernel_dspr_usm>(
-            cgh, [=]() { ::cblas_dspr(CBLASMAJOR, upper_lower_, n, alpha, x, incx, ap); });
+            queue, cgh, [=]() { ::cblas_dspr(CBLASMAJOR, upper_lower_, n, alpha, x, incx, ap); });
     });
     return done;
 }
@@ -1735,7 +1737,7 @@ cl::sycl::event spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_sspr2_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_sspr2_usm>(queue, cgh, [=]() {
             ::cblas_sspr2(CBLASMAJOR, upper_lower_, n, alpha, x, incx, y, incy, ap);
         });
     });
@@ -1751,7 +1753,7 @@ cl::sycl::event spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_dspr2_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dspr2_usm>(queue, cgh, [=]() {
             ::cblas_dspr2(CBLASMAJOR, upper_lower_, n, alpha, x, incx, y, incy, ap);
         });
     });
@@ -1767,7 +1769,7 @@ cl::sycl::event symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_ssymv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ssymv_usm>(queue, cgh, [=]() {
             ::cblas_ssymv(CBLASMAJOR, upper_lower_, n, alpha, a, lda, x, incx, beta, y, incy);
         });
     });
@@ -1783,7 +1785,7 @@ cl::sycl::event symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_dsymv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dsymv_usm>(queue, cgh, [=]() {
             ::cblas_dsymv(CBLASMAJOR, upper_lower_, n, alpha, a, lda, x, incx, beta, y, incy);
         });
     });
@@ -1799,8 +1801,9 @@ cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_ssyr_usm>(
-            cgh, [=]() { ::cblas_ssyr(CBLASMAJOR, upper_lower_, n, alpha, x, incx, a, lda); });
+        host_task<class mkl_kernel_ssyr_usm>(queue, cgh, [=]() {
+            ::cblas_ssyr(CBLASMAJOR, upper_lower_, n, alpha, x, incx, a, lda);
+        });
     });
     return done;
 }
@@ -1814,8 +1817,9 @@ cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_dsyr_usm>(
-            cgh, [=]() { ::cblas_dsyr(CBLASMAJOR, upper_lower_, n, alpha, x, incx, a, lda); });
+        host_task<class mkl_kernel_dsyr_usm>(queue, cgh, [=]() {
+            ::cblas_dsyr(CBLASMAJOR, upper_lower_, n, alpha, x, incx, a, lda);
+        });
     });
     return done;
 }
@@ -1829,7 +1833,7 @@ cl::sycl::event syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_ssyr2_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ssyr2_usm>(queue, cgh, [=]() {
             ::cblas_ssyr2(CBLASMAJOR, upper_lower_, n, alpha, x, incx, y, incy, a, lda);
         });
     });
@@ -1845,7 +1849,7 @@ cl::sycl::event syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
             cgh.depends_on(dependencies[i]);
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_dsyr2_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dsyr2_usm>(queue, cgh, [=]() {
             ::cblas_dsyr2(CBLASMAJOR, upper_lower_, n, alpha, x, incx, y, incy, a, lda);
         });
     });
@@ -1863,7 +1867,7 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_stbmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_stbmv_usm>(queue, cgh, [=]() {
             ::cblas_stbmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k, a, lda, x, incx);
         });
     });
@@ -1881,7 +1885,7 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_dtbmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dtbmv_usm>(queue, cgh, [=]() {
             ::cblas_dtbmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k, a, lda, x, incx);
         });
     });
@@ -1900,7 +1904,7 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_ctbmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ctbmv_usm>(queue, cgh, [=]() {
             ::cblas_ctbmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k, a, lda, x, incx);
         });
     });
@@ -1919,7 +1923,7 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_ztbmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ztbmv_usm>(queue, cgh, [=]() {
             ::cblas_ztbmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k, a, lda, x, incx);
         });
     });
@@ -1937,7 +1941,7 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_stbsv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_stbsv_usm>(queue, cgh, [=]() {
             ::cblas_stbsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k, a, lda, x, incx);
         });
     });
@@ -1955,7 +1959,7 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_dtbsv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dtbsv_usm>(queue, cgh, [=]() {
             ::cblas_dtbsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k, a, lda, x, incx);
         });
     });
@@ -1974,7 +1978,7 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_ctbsv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ctbsv_usm>(queue, cgh, [=]() {
             ::cblas_ctbsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k, a, lda, x, incx);
         });
     });
@@ -1993,7 +1997,7 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_ztbsv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ztbsv_usm>(queue, cgh, [=]() {
             ::cblas_ztbsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, k, a, lda, x, incx);
         });
     });
@@ -2011,7 +2015,7 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_stpmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_stpmv_usm>(queue, cgh, [=]() {
             ::cblas_stpmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, ap, x, incx);
         });
     });
@@ -2029,7 +2033,7 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_dtpmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dtpmv_usm>(queue, cgh, [=]() {
             ::cblas_dtpmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, ap, x, incx);
         });
     });
@@ -2047,7 +2051,7 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_ctpmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ctpmv_usm>(queue, cgh, [=]() {
             ::cblas_ctpmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, ap, x, incx);
         });
     });
@@ -2065,7 +2069,7 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_ztpmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ztpmv_usm>(queue, cgh, [=]() {
             ::cblas_ztpmv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, ap, x, incx);
         });
     });
@@ -2083,7 +2087,7 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_stpsv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_stpsv_usm>(queue, cgh, [=]() {
             ::cblas_stpsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, ap, x, incx);
         });
     });
@@ -2101,7 +2105,7 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_dtpsv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dtpsv_usm>(queue, cgh, [=]() {
             ::cblas_dtpsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, ap, x, incx);
         });
     });
@@ -2119,7 +2123,7 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_ctpsv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ctpsv_usm>(queue, cgh, [=]() {
             ::cblas_ctpsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, ap, x, incx);
         });
     });
@@ -2137,7 +2141,7 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_ztpsv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ztpsv_usm>(queue, cgh, [=]() {
             ::cblas_ztpsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, ap, x, incx);
         });
     });
@@ -2155,7 +2159,7 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_strmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_strmv_usm>(queue, cgh, [=]() {
             ::cblas_strmv(CBLASMAJOR, upper_lower_, transa_, unit_diag_, n, a, lda, b, incx);
         });
     });
@@ -2173,7 +2177,7 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_dtrmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dtrmv_usm>(queue, cgh, [=]() {
             ::cblas_dtrmv(CBLASMAJOR, upper_lower_, transa_, unit_diag_, n, a, lda, b, incx);
         });
     });
@@ -2191,7 +2195,7 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_ctrmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ctrmv_usm>(queue, cgh, [=]() {
             ::cblas_ctrmv(CBLASMAJOR, upper_lower_, transa_, unit_diag_, n, a, lda, b, incx);
         });
     });
@@ -2209,7 +2213,7 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_ztrmv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ztrmv_usm>(queue, cgh, [=]() {
             ::cblas_ztrmv(CBLASMAJOR, upper_lower_, transa_, unit_diag_, n, a, lda, b, incx);
         });
     });
@@ -2227,7 +2231,7 @@ cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_strsv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_strsv_usm>(queue, cgh, [=]() {
             ::cblas_strsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, a, lda, x, incx);
         });
     });
@@ -2245,7 +2249,7 @@ cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_dtrsv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dtrsv_usm>(queue, cgh, [=]() {
             ::cblas_dtrsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, a, lda, x, incx);
         });
     });
@@ -2263,7 +2267,7 @@ cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_ctrsv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ctrsv_usm>(queue, cgh, [=]() {
             ::cblas_ctrsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, a, lda, x, incx);
         });
     });
@@ -2281,7 +2285,7 @@ cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_ztrsv_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ztrsv_usm>(queue, cgh, [=]() {
             ::cblas_ztrsv(CBLASMAJOR, upper_lower_, trans_, unit_diag_, n, a, lda, x, incx);
         });
     });
@@ -20,13 +20,32 @@
 #include <CL/sycl.hpp>
 
 #include "oneapi/mkl/exceptions.hpp"
+#include "half_gemm.hpp"
 #include "mklcpu_common.hpp"
+#include "mklcpu_numa.hpp"
 #include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
 
 namespace oneapi {
 namespace mkl {
 namespace blas {
 namespace mklcpu {
+
+// MKL has no CBLAS half gemm; the matrices are converted to float by blocks.
+template <typename T_c>
+void half_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m,
+               int64_t n, int64_t k, float alpha, const half *a, int64_t lda, const half *b,
+               int64_t ldb, float beta, T_c *c, int64_t ldc) {
+    auto sgemm = [](bool transa, bool transb, int64_t m, int64_t n, int64_t k, float alpha,
+                    const float *a, int64_t lda, const float *b, int64_t ldb, float beta, float *c,
+                    int64_t ldc) {
+        ::cblas_sgemm(CblasColMajor, transa ? CblasTrans : CblasNoTrans,
+                      transb ? CblasTrans : CblasNoTrans, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                      ldc);
+    };
+    detail::half_gemm(sgemm, layout == CblasRowMajor, transa != CblasNoTrans,
+                      transb != CblasNoTrans, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
 namespace column_major {
 
 #define CBLASMAJOR CblasColMajor
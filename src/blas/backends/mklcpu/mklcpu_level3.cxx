@@ -29,7 +29,7 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_sgemm>(cgh, [=]() {
+        host_task<class mkl_kernel_sgemm>(queue, cgh, [=]() {
             ::cblas_sgemm(CBLASMAJOR, transa_, transb_, m, n, k, alpha, accessor_a.get_pointer(),
                           lda, accessor_b.get_pointer(), ldb, beta, accessor_c.get_pointer(), ldc);
         });
@@ -46,7 +46,7 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dgemm>(cgh, [=]() {
+        host_task<class mkl_kernel_dgemm>(queue, cgh, [=]() {
             ::cblas_dgemm(CBLASMAJOR, transa_, transb_, m, n, k, alpha, accessor_a.get_pointer(),
                           lda, accessor_b.get_pointer(), ldb, beta, accessor_c.get_pointer(), ldc);
         });
@@ -65,7 +65,7 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cgemm>(cgh, [=]() {
+        host_task<class mkl_kernel_cgemm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_cgemm(CBLASMAJOR, transa_, transb_, m, n, k, (const void *)&alpha_,
@@ -87,7 +87,7 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zgemm>(cgh, [=]() {
+        host_task<class mkl_kernel_zgemm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zgemm(CBLASMAJOR, transa_, transb_, m, n, k, (const void *)&alpha_,
@@ -114,33 +114,11 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_hgemm>(cgh, [=]() {
-            int64_t sizea, sizeb, sizec;
-#ifdef COLUMN_MAJOR
-            sizea = (transa == transpose::N) ? lda * k : lda * m;
-            sizeb = (transb == transpose::N) ? ldb * n : ldb * k;
-            sizec = ldc * n;
-#endif
-#ifdef ROW_MAJOR
-            sizea = (transa == transpose::N) ? lda * m : lda * k;
-            sizeb = (transb == transpose::N) ? ldb * k : ldb * n;
-            sizec = ldc * m;
-#endif
-            // copy A, B and C to float
-            float *f32_a = (float *)::malloc(sizeof(float) * sizea);
-            float *f32_b = (float *)::malloc(sizeof(float) * sizeb);
-            float *f32_c = (float *)::malloc(sizeof(float) * sizec);
-            copy_mat(accessor_a, MKLMAJOR, transa, m, k, lda, 0.0f, f32_a);
-            copy_mat(accessor_b, MKLMAJOR, transb, k, n, ldb, 0.0f, f32_b);
-            copy_mat(accessor_c, MKLMAJOR, transpose::N, m, n, ldc, 0.0f, f32_c);
-            ::cblas_sgemm(CBLASMAJOR, transa_, transb_, m, n, k, f32_alpha, f32_a, lda, f32_b, ldb,
-                          f32_beta, f32_c, ldc);
-            // copy C back to half
-            half co = 0.0f;
-            copy_mat(f32_c, MKLMAJOR, m, n, ldc, offset::F, &co, (half *)accessor_c.get_pointer());
-            ::free(f32_a);
-            ::free(f32_b);
-            ::free(f32_c);
+        host_task<class mkl_kernel_hgemm>(queue, cgh, [=]() {
+            half_gemm(CBLASMAJOR, transa_, transb_, m, n, k, f32_alpha,
+                      (const half *)accessor_a.get_pointer(), lda,
+                      (const half *)accessor_b.get_pointer(), ldb, f32_beta,
+                      (half *)accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -159,25 +137,11 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_gemm_f16f16f32>(cgh, [=]() {
-            int64_t sizea, sizeb;
-#ifdef COLUMN_MAJOR
-            sizea = (transa == transpose::N) ? lda * k : lda * m;
-            sizeb = (transb == transpose::N) ? ldb * n : ldb * k;
-#endif
-#ifdef ROW_MAJOR
-            sizea = (transa == transpose::N) ? lda * m : lda * k;
-            sizeb = (transb == transpose::N) ? ldb * k : ldb * n;
-#endif
-            // copy A and B to float
-            float *f32_a = (float *)::malloc(sizeof(float) * sizea);
-            float *f32_b = (float *)::malloc(sizeof(float) * sizeb);
-            copy_mat(accessor_a, MKLMAJOR, transa, m, k, lda, 0.0f, f32_a);
-            copy_mat(accessor_b, MKLMAJOR, transb, k, n, ldb, 0.0f, f32_b);
-            ::cblas_sgemm(CBLASMAJOR, transa_, transb_, m, n, k, alpha, f32_a, lda, f32_b, ldb,
-                          beta, accessor_c.get_pointer(), ldc);
-            ::free(f32_a);
-            ::free(f32_b);
+        host_task<class mkl_kernel_gemm_f16f16f32>(queue, cgh, [=]() {
+            half_gemm(CBLASMAJOR, transa_, transb_, m, n, k, alpha,
+                      (const half *)accessor_a.get_pointer(), lda,
+                      (const half *)accessor_b.get_pointer(), ldb, beta,
+                      (float *)accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -192,9 +156,9 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
         auto accessor_a = a.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.template get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_gemm_bf16bf16f32>(cgh, [=]() {
-            auto a_mat = (MKL_BF16 *)static_cast<void *>(accessor_a.get_pointer());
-            auto b_mat = (MKL_BF16 *)static_cast<void *>(accessor_b.get_pointer());
+        host_task<class mkl_kernel_gemm_bf16bf16f32>(queue, cgh, [=]() {
+            auto a_mat = (const MKL_BF16 *)static_cast<void *>(accessor_a.get_pointer());
+            auto b_mat = (const MKL_BF16 *)static_cast<void *>(accessor_b.get_pointer());
             ::cblas_gemm_bf16bf16f32(CBLASMAJOR, transa_, transb_, m, n, k, alpha, a_mat, lda,
                                      b_mat, ldb, beta, accessor_c.get_pointer(), ldc);
         });
@@ -213,7 +177,7 @@ void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_chemm>(cgh, [=]() {
+        host_task<class mkl_kernel_chemm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_chemm(CBLASMAJOR, left_right_, upper_lower_, m, n, (const void *)&alpha_,
@@ -235,7 +199,7 @@ void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zhemm>(cgh, [=]() {
+        host_task<class mkl_kernel_zhemm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zhemm(CBLASMAJOR, left_right_, upper_lower_, m, n, (const void *)&alpha_,
@@ -253,7 +217,7 @@ void herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cherk>(cgh, [=]() {
+        host_task<class mkl_kernel_cherk>(queue, cgh, [=]() {
             ::cblas_cherk(CBLASMAJOR, upper_lower_, trans_, n, k, alpha, accessor_a.get_pointer(),
                           lda, beta, accessor_c.get_pointer(), ldc);
         });
@@ -268,7 +232,7 @@ void herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zherk>(cgh, [=]() {
+        host_task<class mkl_kernel_zherk>(queue, cgh, [=]() {
             ::cblas_zherk(CBLASMAJOR, upper_lower_, trans_, n, k, alpha, accessor_a.get_pointer(),
                           lda, beta, accessor_c.get_pointer(), ldc);
         });
@@ -286,7 +250,7 @@ void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_cher2k>(cgh, [=]() {
+        host_task<class mkl_kernel_cher2k>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_cher2k(CBLASMAJOR, upper_lower_, trans_, n, k, (const void *)&alpha_,
                            accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb, beta,
@@ -306,7 +270,7 @@ void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zher2k>(cgh, [=]() {
+        host_task<class mkl_kernel_zher2k>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_zher2k(CBLASMAJOR, upper_lower_, trans_, n, k, (const void *)&alpha_,
                            accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb, beta,
@@ -324,7 +288,7 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssymm>(cgh, [=]() {
+        host_task<class mkl_kernel_ssymm>(queue, cgh, [=]() {
             ::cblas_ssymm(CBLASMAJOR, left_right_, upper_lower_, m, n, alpha,
                           accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb, beta,
                           accessor_c.get_pointer(), ldc);
@@ -341,7 +305,7 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsymm>(cgh, [=]() {
+        host_task<class mkl_kernel_dsymm>(queue, cgh, [=]() {
             ::cblas_dsymm(CBLASMAJOR, left_right_, upper_lower_, m, n, alpha,
                           accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb, beta,
                           accessor_c.get_pointer(), ldc);
@@ -361,7 +325,7 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_csymm>(cgh, [=]() {
+        host_task<class mkl_kernel_csymm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_csymm(CBLASMAJOR, left_right_, upper_lower_, m, n, (const void *)&alpha_,
@@ -383,7 +347,7 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zsymm>(cgh, [=]() {
+        host_task<class mkl_kernel_zsymm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zsymm(CBLASMAJOR, left_right_, upper_lower_, m, n, (const void *)&alpha_,
@@ -401,7 +365,7 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssyrk>(cgh, [=]() {
+        host_task<class mkl_kernel_ssyrk>(queue, cgh, [=]() {
             ::cblas_ssyrk(CBLASMAJOR, upper_lower_, trans_, n, k, alpha, accessor_a.get_pointer(),
                           lda, beta, accessor_c.get_pointer(), ldc);
         });
@@ -416,7 +380,7 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsyrk>(cgh, [=]() {
+        host_task<class mkl_kernel_dsyrk>(queue, cgh, [=]() {
             ::cblas_dsyrk(CBLASMAJOR, upper_lower_, trans_, n, k, alpha, accessor_a.get_pointer(),
                           lda, beta, accessor_c.get_pointer(), ldc);
         });
@@ -433,7 +397,7 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         float beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_csyrk>(cgh, [=]() {
+        host_task<class mkl_kernel_csyrk>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_csyrk(CBLASMAJOR, upper_lower_, trans_, n, k, (const void *)&alpha_,
@@ -453,7 +417,7 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         double beta_real = beta.real(), beta_imag = beta.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zsyrk>(cgh, [=]() {
+        host_task<class mkl_kernel_zsyrk>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zsyrk(CBLASMAJOR, upper_lower_, trans_, n, k, (const void *)&alpha_,
@@ -472,7 +436,7 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ssyr2k>(cgh, [=]() {
+        host_task<class mkl_kernel_ssyr2k>(queue, cgh, [=]() {
             ::cblas_ssyr2k(CBLASMAJOR, upper_lower_, trans_, n, k, alpha, accessor_a.get_pointer(),
                            lda, accessor_b.get_pointer(), ldb, beta, accessor_c.get_pointer(), ldc);
         });
@@ -489,7 +453,7 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dsyr2k>(cgh, [=]() {
+        host_task<class mkl_kernel_dsyr2k>(queue, cgh, [=]() {
             ::cblas_dsyr2k(CBLASMAJOR, upper_lower_, trans_, n, k, alpha, accessor_a.get_pointer(),
                            lda, accessor_b.get_pointer(), ldb, beta, accessor_c.get_pointer(), ldc);
         });
@@ -508,7 +472,7 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_csyr2k>(cgh, [=]() {
+        host_task<class mkl_kernel_csyr2k>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_csyr2k(CBLASMAJOR, upper_lower_, trans_, n, k, (const void *)&alpha_,
@@ -530,7 +494,7 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_zsyr2k>(cgh, [=]() {
+        host_task<class mkl_kernel_zsyr2k>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zsyr2k(CBLASMAJOR, upper_lower_, trans_, n, k, (const void *)&alpha_,
@@ -550,7 +514,7 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_strmm>(cgh, [=]() {
+        host_task<class mkl_kernel_strmm>(queue, cgh, [=]() {
             ::cblas_strmm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n, alpha,
                           accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb);
         });
@@ -567,7 +531,7 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtrmm>(cgh, [=]() {
+        host_task<class mkl_kernel_dtrmm>(queue, cgh, [=]() {
             ::cblas_dtrmm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n, alpha,
                           accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb);
         });
@@ -586,7 +550,7 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctrmm>(cgh, [=]() {
+        host_task<class mkl_kernel_ctrmm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_ctrmm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n,
                           (const void *)&alpha_, accessor_a.get_pointer(), lda,
@@ -607,7 +571,7 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztrmm>(cgh, [=]() {
+        host_task<class mkl_kernel_ztrmm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_ztrmm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n,
                           (const void *)&alpha_, accessor_a.get_pointer(), lda,
@@ -626,7 +590,7 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_strsm>(cgh, [=]() {
+        host_task<class mkl_kernel_strsm>(queue, cgh, [=]() {
             ::cblas_strsm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n, alpha,
                           accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb);
         });
@@ -643,7 +607,7 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_dtrsm>(cgh, [=]() {
+        host_task<class mkl_kernel_dtrsm>(queue, cgh, [=]() {
             ::cblas_dtrsm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n, alpha,
                           accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb);
         });
@@ -662,7 +626,7 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ctrsm>(cgh, [=]() {
+        host_task<class mkl_kernel_ctrsm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_ctrsm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n,
                           (const void *)&alpha_, accessor_a.get_pointer(), lda,
@@ -683,7 +647,7 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
-        host_task<class mkl_kernel_ztrsm>(cgh, [=]() {
+        host_task<class mkl_kernel_ztrsm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_ztrsm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n,
                           (const void *)&alpha_, accessor_a.get_pointer(), lda,
@@ -698,6 +662,10 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      int64_t n, int64_t k, float alpha, const float *a, int64_t lda, const float *b,
                      int64_t ldb, float beta, float *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    if (use_numa_domains(queue, (double)m * n * k))
+        return numa_gemm<class mkl_kernel_sgemm_usm_numa>(queue, CBLASMAJOR, transa, transb, m, n,
+                                                          k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                                          dependencies);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
@@ -705,7 +673,7 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
         }
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
-        host_task<class mkl_kernel_sgemm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_sgemm_usm>(queue, cgh, [=]() {
             ::cblas_sgemm(CBLASMAJOR, transa_, transb_, m, n, k, alpha, a, lda, b, ldb, beta, c,
                           ldc);
         });
@@ -717,6 +685,10 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
                      const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    if (use_numa_domains(queue, (double)m * n * k))
+        return numa_gemm<class mkl_kernel_dgemm_usm_numa>(queue, CBLASMAJOR, transa, transb, m, n,
+                                                          k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                                          dependencies);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
@@ -724,7 +696,7 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
         }
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
-        host_task<class mkl_kernel_dgemm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dgemm_usm>(queue, cgh, [=]() {
             ::cblas_dgemm(CBLASMAJOR, transa_, transb_, m, n, k, alpha, a, lda, b, ldb, beta, c,
                           ldc);
         });
@@ -737,6 +709,10 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      int64_t lda, const std::complex<float> *b, int64_t ldb,
                      std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    if (use_numa_domains(queue, (double)m * n * k))
+        return numa_gemm<class mkl_kernel_cgemm_usm_numa>(queue, CBLASMAJOR, transa, transb, m, n,
+                                                          k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                                          dependencies);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
@@ -746,7 +722,7 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_cgemm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_cgemm_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_cgemm(CBLASMAJOR, transa_, transb_, m, n, k, (const void *)&alpha_, a, lda, b,
@@ -761,6 +737,10 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      const std::complex<double> *a, int64_t lda, const std::complex<double> *b,
                      int64_t ldb, std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    if (use_numa_domains(queue, (double)m * n * k))
+        return numa_gemm<class mkl_kernel_zgemm_usm_numa>(queue, CBLASMAJOR, transa, transb, m, n,
+                                                          k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                                          dependencies);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
@@ -770,7 +750,7 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zgemm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zgemm_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zgemm(CBLASMAJOR, transa_, transb_, m, n, k, (const void *)&alpha_, a, lda, b,
@@ -798,33 +778,9 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         float f32_alpha = (float)alpha;
         float f32_beta = (float)beta;
-        host_task<class mkl_kernel_hgemm_usm>(cgh, [=]() {
-            int64_t sizea, sizeb, sizec;
-#ifdef COLUMN_MAJOR
-            sizea = (transa == transpose::N) ? lda * k : lda * m;
-            sizeb = (transb == transpose::N) ? ldb * n : ldb * k;
-            sizec = ldc * n;
-#endif
-#ifdef ROW_MAJOR
-            sizea = (transa == transpose::N) ? lda * m : lda * k;
-            sizeb = (transb == transpose::N) ? ldb * k : ldb * n;
-            sizec = ldc * m;
-#endif
-            // copy A, B and C to float
-            float *f32_a = (float *)::malloc(sizeof(float) * sizea);
-            float *f32_b = (float *)::malloc(sizeof(float) * sizeb);
-            float *f32_c = (float *)::malloc(sizeof(float) * sizec);
-            copy_mat(a, MKLMAJOR, transa, m, k, lda, 0.0f, f32_a);
-            copy_mat(b, MKLMAJOR, transb, k, n, ldb, 0.0f, f32_b);
-            copy_mat(c, MKLMAJOR, transpose::N, m, n, ldc, 0.0f, f32_c);
-            ::cblas_sgemm(CBLASMAJOR, transa_, transb_, m, n, k, f32_alpha, f32_a, lda, f32_b, ldb,
-                          f32_beta, f32_c, ldc);
-            // copy C back to half
-            half co = 0.0f;
-            copy_mat(f32_c, MKLMAJOR, m, n, ldc, offset::F, &co, c);
-            ::free(f32_a);
-            ::free(f32_b);
-            ::free(f32_c);
+        host_task<class mkl_kernel_hgemm_usm>(queue, cgh, [=]() {
+            half_gemm(CBLASMAJOR, transa_, transb_, m, n, k, f32_alpha, a, lda, b, ldb, f32_beta, c,
+                      ldc);
         });
     });
     return done;
@@ -848,25 +804,9 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
         float f32_alpha = (float)alpha;
         float f32_beta = (float)beta;
-        host_task<class mkl_kernel_gemm_f16f16f32_usm>(cgh, [=]() {
-            int64_t sizea, sizeb, sizec;
-#ifdef COLUMN_MAJOR
-            sizea = (transa == transpose::N) ? lda * k : lda * m;
-            sizeb = (transb == transpose::N) ? ldb * n : ldb * k;
-#endif
-#ifdef ROW_MAJOR
-            sizea = (transa == transpose::N) ? lda * m : lda * k;
-            sizeb = (transb == transpose::N) ? ldb * k : ldb * n;
-#endif
-            // copy A, B to float
-            float *f32_a = (float *)::malloc(sizeof(float) * sizea);
-            float *f32_b = (float *)::malloc(sizeof(float) * sizeb);
-            copy_mat(a, MKLMAJOR, transa, m, k, lda, 0.0f, f32_a);
-            copy_mat(b, MKLMAJOR, transb, k, n, ldb, 0.0f, f32_b);
-            ::cblas_sgemm(CBLASMAJOR, transa_, transb_, m, n, k, f32_alpha, f32_a, lda, f32_b, ldb,
-                          f32_beta, c, ldc);
-            ::free(f32_a);
-            ::free(f32_b);
+        host_task<class mkl_kernel_gemm_f16f16f32_usm>(queue, cgh, [=]() {
+            half_gemm(CBLASMAJOR, transa_, transb_, m, n, k, f32_alpha, a, lda, b, ldb, f32_beta, c,
+                      ldc);
         });
     });
     return done;
@@ -883,9 +823,10 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
         }
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
-        host_task<class mkl_kernel_gemm_bf16bf16f32_usm>(cgh, [=]() {
-            ::cblas_gemm_bf16bf16f32(CBLASMAJOR, transa_, transb_, m, n, k, alpha, (MKL_BF16 *)a,
-                                     lda, (MKL_BF16 *)b, ldb, beta, c, ldc);
+        host_task<class mkl_kernel_gemm_bf16bf16f32_usm>(queue, cgh, [=]() {
+            ::cblas_gemm_bf16bf16f32(CBLASMAJOR, transa_, transb_, m, n, k, alpha,
+                                     (const MKL_BF16 *)a, lda, (const MKL_BF16 *)b, ldb, beta, c,
+                                     ldc);
         });
     });
     return done;
@@ -905,7 +846,7 @@ cl::sycl::event hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_chemm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_chemm_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_chemm(CBLASMAJOR, left_right_, upper_lower_, m, n, (const void *)&alpha_, a,
@@ -929,7 +870,7 @@ cl::sycl::event hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zhemm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zhemm_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zhemm(CBLASMAJOR, left_right_, upper_lower_, m, n, (const void *)&alpha_, a,
@@ -950,7 +891,7 @@ cl::sycl::event herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
-        host_task<class mkl_kernel_cherk_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_cherk_usm>(queue, cgh, [=]() {
             ::cblas_cherk(CBLASMAJOR, upper_lower_, trans_, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
@@ -968,7 +909,7 @@ cl::sycl::event herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
-        host_task<class mkl_kernel_zherk_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zherk_usm>(queue, cgh, [=]() {
             ::cblas_zherk(CBLASMAJOR, upper_lower_, trans_, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
@@ -988,7 +929,7 @@ cl::sycl::event her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_cher2k_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_cher2k_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_cher2k(CBLASMAJOR, upper_lower_, trans_, n, k, (const void *)&alpha_, a, lda, b,
                            ldb, beta, c, ldc);
@@ -1010,7 +951,7 @@ cl::sycl::event her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_zher2k_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zher2k_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_zher2k(CBLASMAJOR, upper_lower_, trans_, n, k, (const void *)&alpha_, a, lda, b,
                            ldb, beta, c, ldc);
@@ -1030,7 +971,7 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         }
         CBLAS_SIDE left_right_ = cblas_convert(left_right);
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_ssymm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ssymm_usm>(queue, cgh, [=]() {
             ::cblas_ssymm(CBLASMAJOR, left_right_, upper_lower_, m, n, alpha, a, lda, b, ldb, beta,
                           c, ldc);
         });
@@ -1049,7 +990,7 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         }
         CBLAS_SIDE left_right_ = cblas_convert(left_right);
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
-        host_task<class mkl_kernel_dsymm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dsymm_usm>(queue, cgh, [=]() {
             ::cblas_dsymm(CBLASMAJOR, left_right_, upper_lower_, m, n, alpha, a, lda, b, ldb, beta,
                           c, ldc);
         });
@@ -1071,7 +1012,7 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_csymm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_csymm_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_csymm(CBLASMAJOR, left_right_, upper_lower_, m, n, (const void *)&alpha_, a,
@@ -1095,7 +1036,7 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zsymm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zsymm_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zsymm(CBLASMAJOR, left_right_, upper_lower_, m, n, (const void *)&alpha_, a,
@@ -1108,6 +1049,9 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
 cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                      int64_t k, float alpha, const float *a, int64_t lda, float beta, float *c,
                      int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+    if (use_numa_domains(queue, 0.5 * n * n * k))
+        return numa_syrk<class mkl_kernel_ssyrk_usm_numa>(
+            queue, CBLASMAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
@@ -1115,7 +1059,7 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
-        host_task<class mkl_kernel_ssyrk_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ssyrk_usm>(queue, cgh, [=]() {
             ::cblas_ssyrk(CBLASMAJOR, upper_lower_, trans_, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
@@ -1125,6 +1069,9 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                      int64_t k, double alpha, const double *a, int64_t lda, double beta, double *c,
                      int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+    if (use_numa_domains(queue, 0.5 * n * n * k))
+        return numa_syrk<class mkl_kernel_dsyrk_usm_numa>(
+            queue, CBLASMAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
@@ -1132,7 +1079,7 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
-        host_task<class mkl_kernel_dsyrk_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dsyrk_usm>(queue, cgh, [=]() {
             ::cblas_dsyrk(CBLASMAJOR, upper_lower_, trans_, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
@@ -1143,6 +1090,9 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t k, std::complex<float> alpha, const std::complex<float> *a,
                      int64_t lda, std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    if (use_numa_domains(queue, 0.5 * n * n * k))
+        return numa_syrk<class mkl_kernel_csyrk_usm_numa>(
+            queue, CBLASMAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
@@ -1152,7 +1102,7 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_csyrk_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_csyrk_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_csyrk(CBLASMAJOR, upper_lower_, trans_, n, k, (const void *)&alpha_, a, lda,
@@ -1166,6 +1116,9 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t k, std::complex<double> alpha, const std::complex<double> *a,
                      int64_t lda, std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    if (use_numa_domains(queue, 0.5 * n * n * k))
+        return numa_syrk<class mkl_kernel_zsyrk_usm_numa>(
+            queue, CBLASMAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc, dependencies);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
@@ -1175,7 +1128,7 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zsyrk_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zsyrk_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zsyrk(CBLASMAJOR, upper_lower_, trans_, n, k, (const void *)&alpha_, a, lda,
@@ -1196,7 +1149,7 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
-        host_task<class mkl_kernel_ssyr2k_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ssyr2k_usm>(queue, cgh, [=]() {
             ::cblas_ssyr2k(CBLASMAJOR, upper_lower_, trans_, n, k, alpha, a, lda, b, ldb, beta, c,
                            ldc);
         });
@@ -1215,7 +1168,7 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
-        host_task<class mkl_kernel_dsyr2k_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dsyr2k_usm>(queue, cgh, [=]() {
             ::cblas_dsyr2k(CBLASMAJOR, upper_lower_, trans_, n, k, alpha, a, lda, b, ldb, beta, c,
                            ldc);
         });
@@ -1237,7 +1190,7 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
         float beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_csyr2k_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_csyr2k_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex8 beta_ = { beta_real, beta_imag };
             ::cblas_csyr2k(CBLASMAJOR, upper_lower_, trans_, n, k, (const void *)&alpha_, a, lda, b,
@@ -1261,7 +1214,7 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         CBLAS_TRANSPOSE trans_ = cblas_convert(trans);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
         double beta_real = beta.real(), beta_imag = beta.imag();
-        host_task<class mkl_kernel_zsyr2k_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_zsyr2k_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             MKL_Complex16 beta_ = { beta_real, beta_imag };
             ::cblas_zsyr2k(CBLASMAJOR, upper_lower_, trans_, n, k, (const void *)&alpha_, a, lda, b,
@@ -1283,7 +1236,7 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_strmm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_strmm_usm>(queue, cgh, [=]() {
             ::cblas_strmm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n, alpha,
                           a, lda, b, ldb);
         });
@@ -1304,7 +1257,7 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_dtrmm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dtrmm_usm>(queue, cgh, [=]() {
             ::cblas_dtrmm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n, alpha,
                           a, lda, b, ldb);
         });
@@ -1326,7 +1279,7 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_ctrmm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ctrmm_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_ctrmm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n,
                           (const void *)&alpha_, a, lda, b, ldb);
@@ -1349,7 +1302,7 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_ztrmm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ztrmm_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_ztrmm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n,
                           (const void *)&alpha_, a, lda, b, ldb);
@@ -1370,7 +1323,7 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_strsm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_strsm_usm>(queue, cgh, [=]() {
             ::cblas_strsm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n, alpha,
                           a, lda, b, ldb);
         });
@@ -1391,7 +1344,7 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
-        host_task<class mkl_kernel_dtrsm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_dtrsm_usm>(queue, cgh, [=]() {
             ::cblas_dtrsm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n, alpha,
                           a, lda, b, ldb);
         });
@@ -1413,7 +1366,7 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         float alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_ctrsm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ctrsm_usm>(queue, cgh, [=]() {
             MKL_Complex8 alpha_ = { alpha_real, alpha_imag };
             ::cblas_ctrsm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n,
                           (const void *)&alpha_, a, lda, b, ldb);
@@ -1436,7 +1389,7 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
         CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
         CBLAS_DIAG unit_diag_ = cblas_convert(unit_diag);
         double alpha_real = alpha.real(), alpha_imag = alpha.imag();
-        host_task<class mkl_kernel_ztrsm_usm>(cgh, [=]() {
+        host_task<class mkl_kernel_ztrsm_usm>(queue, cgh, [=]() {
             MKL_Complex16 alpha_ = { alpha_real, alpha_imag };
             ::cblas_ztrsm(CBLASMAJOR, left_right_, upper_lower_, transa_, unit_diag_, m, n,
                           (const void *)&alpha_, a, lda, b, ldb);
@@ -0,0 +1,446 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKLCPU_NUMA_HPP_
+#define _MKLCPU_NUMA_HPP_
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "mkl_service.h"
+#include "mklcpu_common.hpp"
+
+#ifdef ENABLE_MKLCPU_THREAD_TBB
+#include <tbb/info.h>
+#include <tbb/task_arena.h>
+#endif
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace mklcpu {
+
+// USM level 3 calls are split across the NUMA domains of the CPU when they perform at least
+// this many multiply-adds. Splitting is disabled with ONEMKL_MKLCPU_NUMA=0.
+constexpr double numa_min_work = 1 << 29;
+
+// Matrices read by every panel are copied to each domain's node up to this size
+constexpr std::size_t numa_max_copy_bytes = std::size_t(1) << 28;
+
+template <typename K>
+class mkl_kernel_numa_part;
+template <typename K>
+class mkl_kernel_numa_join;
+
+#ifdef ENABLE_MKLCPU_THREAD_TBB
+// A task arena constrained to one NUMA domain that runs the panels of that domain. With the TBB
+// threading layer MKL runs the parallel regions of a call in the arena it is made from, and TBB
+// binds the threads that join this arena to the domain's cores, so the panels of a domain run on
+// its cores and the memory they touch first is allocated on its node.
+class numa_worker {
+public:
+    numa_worker(tbb::numa_node_id node, int cores)
+            : cores_(cores),
+              arena_(tbb::task_arena::constraints(node, cores)) {}
+
+    int cores() const {
+        return cores_;
+    }
+
+    // Runs f in the arena and waits for it, rethrowing its exception
+    void run_and_wait(std::function<void()> f) {
+        arena_.execute(f);
+    }
+
+private:
+    const int cores_;
+    tbb::task_arena arena_;
+};
+#else
+// A thread bound to the CPUs of one NUMA domain that runs the panels of that domain. With the
+// OpenMP threading layer MKL creates the threads of the calls it runs from this thread, which
+// inherit its affinity, and keeps them for the next calls, so the panels of a domain always run
+// on the domain's cores and the memory they touch first is allocated on its node.
+class numa_worker {
+public:
+    explicit numa_worker(std::vector<int> cpus)
+            : cpus_(std::move(cpus)),
+              thread_([this] { run(); }) {}
+
+    ~numa_worker() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_one();
+        thread_.join();
+    }
+
+    int cores() const {
+        return static_cast<int>(cpus_.size());
+    }
+
+    // Runs f on the worker thread and waits for it, rethrowing its exception
+    void run_and_wait(std::function<void()> f) {
+        std::packaged_task<void()> task(std::move(f));
+        auto done = task.get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            jobs_.push_back(std::move(task));
+        }
+        wake_.notify_one();
+        done.get();
+    }
+
+private:
+    void run() {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : cpus_)
+            CPU_SET(cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+        ::mkl_set_num_threads_local(cores());
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            wake_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+            if (jobs_.empty())
+                return;
+            auto job = std::move(jobs_.front());
+            jobs_.pop_front();
+            lock.unlock();
+            job();
+            lock.lock();
+        }
+    }
+
+    const std::vector<int> cpus_;
+    std::deque<std::packaged_task<void()>> jobs_;
+    bool stop_ = false;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::thread thread_;
+};
+#endif
+
+#if defined(__linux__) && !defined(ENABLE_MKLCPU_THREAD_TBB)
+// CPUs of a sysfs cpulist such as "0-3,8-11" that the process may run on
+static inline std::vector<int> numa_parse_cpulist(const std::string &list,
+                                                  const cpu_set_t &allowed) {
+    std::vector<int> cpus;
+    std::istringstream ranges(list);
+    std::string range;
+    while (std::getline(ranges, range, ',')) {
+        if (range.empty())
+            continue;
+        const auto dash = range.find('-');
+        const int first = std::atoi(range.c_str());
+        const int last = (dash == std::string::npos) ? first : std::atoi(range.c_str() + dash + 1);
+        for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &allowed))
+                cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+#endif
+
+// Returns one worker per NUMA domain of the host, or an empty vector if the host has a single
+// domain with CPUs available to the process. Domains are read once, from TBB with the TBB
+// threading layer and from sysfs otherwise.
+static inline const std::vector<std::unique_ptr<numa_worker>> &numa_workers() {
+    static const std::vector<std::unique_ptr<numa_worker>> workers = [] {
+        std::vector<std::unique_ptr<numa_worker>> result;
+        const char *env = std::getenv("ONEMKL_MKLCPU_NUMA");
+        if (env != nullptr && std::strcmp(env, "0") == 0)
+            return result;
+#ifdef ENABLE_MKLCPU_THREAD_TBB
+        // TBB reports a single automatic node when it cannot read the topology
+        const auto nodes = tbb::info::numa_nodes();
+        if (nodes.size() > 1) {
+            for (auto node : nodes)
+                result.push_back(
+                    std::make_unique<numa_worker>(node, tbb::info::default_concurrency(node)));
+        }
+#elif defined(__linux__)
+        cpu_set_t allowed;
+        if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+            return result;
+        std::vector<std::vector<int>> domains;
+        for (int node = 0;; node++) {
+            std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) +
+                               "/cpulist");
+            if (!file)
+                break;
+            std::string list;
+            std::getline(file, list);
+            auto cpus = numa_parse_cpulist(list, allowed);
+            if (!cpus.empty())
+                domains.push_back(std::move(cpus));
+        }
+        if (domains.size() > 1) {
+            for (auto &cpus : domains)
+                result.push_back(std::make_unique<numa_worker>(std::move(cpus)));
+        }
+#endif
+        return result;
+    }();
+    return workers;
+}
+
+static inline bool use_numa_domains(cl::sycl::queue &queue, double work) {
+    return work >= numa_min_work && queue.get_device().is_cpu() && !numa_workers().empty();
+}
+
+// Splits the n columns of a matrix into one panel per domain, sized by the domain's cores. For
+// triangular matrices the panels cover the same part of the triangle instead of the same number
+// of columns.
+static inline std::vector<int64_t> numa_panels(
+    int64_t n, const std::vector<std::unique_ptr<numa_worker>> &workers,
+    CBLAS_UPLO triangle = CblasUpper, bool triangular = false) {
+    double total = 0.0, sum = 0.0;
+    for (auto &worker : workers)
+        total += worker->cores();
+    std::vector<int64_t> bounds(1, 0);
+    for (auto &worker : workers) {
+        sum += worker->cores();
+        double share = sum / total;
+        if (triangular)
+            share = (triangle == CblasUpper) ? std::sqrt(share) : 1.0 - std::sqrt(1.0 - share);
+        bounds.push_back(std::min(n, static_cast<int64_t>(std::llround(share * n))));
+    }
+    bounds.back() = n;
+    return bounds;
+}
+
+// Runs f(begin, end) for each panel in its own host task, which hands it to the worker of its
+// domain, and returns an event that completes with the last panel.
+template <typename K, typename F>
+cl::sycl::event numa_host_tasks(cl::sycl::queue &queue, const std::vector<int64_t> &bounds,
+                                const std::vector<cl::sycl::event> &dependencies, F f) {
+    const auto &workers = numa_workers();
+    std::vector<cl::sycl::event> panels;
+    for (std::size_t d = 0; d < workers.size(); d++) {
+        int64_t begin = bounds[d], end = bounds[d + 1];
+        numa_worker *worker = workers[d].get();
+        if (begin == end)
+            continue;
+        panels.push_back(queue.submit([&](cl::sycl::handler &cgh) {
+            for (auto &e : dependencies)
+                cgh.depends_on(e);
+            host_task<mkl_kernel_numa_part<K>>(
+                cgh, [=]() { worker->run_and_wait([=]() { f(begin, end); }); });
+        }));
+    }
+    return queue.submit([&](cl::sycl::handler &cgh) {
+        for (auto &e : panels)
+            cgh.depends_on(e);
+        host_task<mkl_kernel_numa_join<K>>(cgh, []() {});
+    });
+}
+
+// Column major copy of the rows x cols matrix at src, made on a domain's worker so that its
+// pages are first touched, and allocated, on the domain's node. Matrices larger than
+// numa_max_copy_bytes are read in place.
+template <typename T>
+class numa_local_matrix {
+public:
+    numa_local_matrix(const T *src, int64_t ld_src, int64_t rows, int64_t cols)
+            : data_(src),
+              ld_(ld_src) {
+        if (rows * cols * sizeof(T) > numa_max_copy_bytes || rows == 0 || cols == 0)
+            return;
+        copy_.reset(new T[rows * cols]);
+        for (int64_t j = 0; j < cols; j++)
+            std::copy(src + j * ld_src, src + j * ld_src + rows, copy_.get() + j * rows);
+        data_ = copy_.get();
+        ld_ = rows;
+    }
+
+    const T *data() const {
+        return data_;
+    }
+
+    int64_t ld() const {
+        return ld_;
+    }
+
+private:
+    std::unique_ptr<T[]> copy_;
+    const T *data_;
+    int64_t ld_;
+};
+
+// Column major CBLAS calls by data type
+static inline void numa_cblas_gemm(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m,
+                                   int64_t n, int64_t k, float alpha, const float *a, int64_t lda,
+                                   const float *b, int64_t ldb, float beta, float *c, int64_t ldc) {
+    ::cblas_sgemm(CblasColMajor, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void numa_cblas_gemm(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m,
+                                   int64_t n, int64_t k, double alpha, const double *a,
+                                   int64_t lda, const double *b, int64_t ldb, double beta,
+                                   double *c, int64_t ldc) {
+    ::cblas_dgemm(CblasColMajor, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+static inline void numa_cblas_gemm(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m,
+                                   int64_t n, int64_t k, std::complex<float> alpha,
+                                   const std::complex<float> *a, int64_t lda,
+                                   const std::complex<float> *b, int64_t ldb,
+                                   std::complex<float> beta, std::complex<float> *c, int64_t ldc) {
+    ::cblas_cgemm(CblasColMajor, transa, transb, m, n, k, (const void *)&alpha, a, lda, b, ldb,
+                  (const void *)&beta, c, ldc);
+}
+
+static inline void numa_cblas_gemm(CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m,
+                                   int64_t n, int64_t k, std::complex<double> alpha,
+                                   const std::complex<double> *a, int64_t lda,
+                                   const std::complex<double> *b, int64_t ldb,
+                                   std::complex<double> beta, std::complex<double> *c,
+                                   int64_t ldc) {
+    ::cblas_zgemm(CblasColMajor, transa, transb, m, n, k, (const void *)&alpha, a, lda, b, ldb,
+                  (const void *)&beta, c, ldc);
+}
+
+static inline void numa_cblas_syrk(CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, int64_t n,
+                                   int64_t k, float alpha, const float *a, int64_t lda, float beta,
+                                   float *c, int64_t ldc) {
+    ::cblas_ssyrk(CblasColMajor, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+}
+
+static inline void numa_cblas_syrk(CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, int64_t n,
+                                   int64_t k, double alpha, const double *a, int64_t lda,
+                                   double beta, double *c, int64_t ldc) {
+    ::cblas_dsyrk(CblasColMajor, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
+}
+
+static inline void numa_cblas_syrk(CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, int64_t n,
+                                   int64_t k, std::complex<float> alpha,
+                                   const std::complex<float> *a, int64_t lda,
+                                   std::complex<float> beta, std::complex<float> *c, int64_t ldc) {
+    ::cblas_csyrk(CblasColMajor, upper_lower, trans, n, k, (const void *)&alpha, a, lda,
+                  (const void *)&beta, c, ldc);
+}
+
+static inline void numa_cblas_syrk(CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, int64_t n,
+                                   int64_t k, std::complex<double> alpha,
+                                   const std::complex<double> *a, int64_t lda,
+                                   std::complex<double> beta, std::complex<double> *c,
+                                   int64_t ldc) {
+    ::cblas_zsyrk(CblasColMajor, upper_lower, trans, n, k, (const void *)&alpha, a, lda,
+                  (const void *)&beta, c, ldc);
+}
+
+// gemm split into panels of columns of C. Row major calls are computed as the column major
+// product C^T = B^T * A^T, so that the panels are contiguous in both layouts.
+template <typename K, typename T>
+cl::sycl::event numa_gemm(cl::sycl::queue &queue, CBLAS_LAYOUT layout, transpose transa,
+                          transpose transb, int64_t m, int64_t n, int64_t k, T alpha, const T *a,
+                          int64_t lda, const T *b, int64_t ldb, T beta, T *c, int64_t ldc,
+                          const std::vector<cl::sycl::event> &dependencies) {
+    if (layout == CblasRowMajor) {
+        std::swap(transa, transb);
+        std::swap(m, n);
+        std::swap(a, b);
+        std::swap(lda, ldb);
+    }
+    CBLAS_TRANSPOSE transa_ = cblas_convert(transa);
+    CBLAS_TRANSPOSE transb_ = cblas_convert(transb);
+    const int64_t a_rows = (transa_ == CblasNoTrans) ? m : k;
+    const int64_t a_cols = (transa_ == CblasNoTrans) ? k : m;
+    return numa_host_tasks<K>(
+        queue, numa_panels(n, numa_workers()), dependencies, [=](int64_t begin, int64_t end) {
+            // Every panel reads all of A
+            const numa_local_matrix<T> local_a(a, lda, a_rows, a_cols);
+            const T *b_panel = b + ((transb_ == CblasNoTrans) ? begin * ldb : begin);
+            numa_cblas_gemm(transa_, transb_, m, end - begin, k, alpha, local_a.data(),
+                            local_a.ld(), b_panel, ldb, beta, c + begin * ldc, ldc);
+        });
+}
+
+// syrk split into panels of columns of C. Each panel updates its diagonal block with syrk and
+// the rest of its columns in the referenced triangle with gemm. Row major calls are computed as
+// the column major update of the opposite triangle with the opposite transposition.
+template <typename K, typename T>
+cl::sycl::event numa_syrk(cl::sycl::queue &queue, CBLAS_LAYOUT layout, uplo upper_lower,
+                          transpose trans, int64_t n, int64_t k, T alpha, const T *a, int64_t lda,
+                          T beta, T *c, int64_t ldc,
+                          const std::vector<cl::sycl::event> &dependencies) {
+    CBLAS_UPLO upper_lower_ = cblas_convert(upper_lower);
+    CBLAS_TRANSPOSE trans_ = (trans == transpose::nontrans) ? CblasNoTrans : CblasTrans;
+    if (layout == CblasRowMajor) {
+        upper_lower_ = (upper_lower_ == CblasUpper) ? CblasLower : CblasUpper;
+        trans_ = (trans_ == CblasNoTrans) ? CblasTrans : CblasNoTrans;
+    }
+    // The transpositions that multiply two blocks of rows of op(A)
+    CBLAS_TRANSPOSE left = trans_;
+    CBLAS_TRANSPOSE right = (trans_ == CblasNoTrans) ? CblasTrans : CblasNoTrans;
+    const int64_t a_rows = (trans_ == CblasNoTrans) ? n : k;
+    const int64_t a_cols = (trans_ == CblasNoTrans) ? k : n;
+    return numa_host_tasks<K>(
+        queue, numa_panels(n, numa_workers(), upper_lower_, true), dependencies,
+        [=](int64_t begin, int64_t end) {
+            // Every panel reads A, row i of op(A) is row(i)
+            const numa_local_matrix<T> local_a(a, lda, a_rows, a_cols);
+            const int64_t ld = local_a.ld();
+            auto row = [&](int64_t i) {
+                return local_a.data() + ((trans_ == CblasNoTrans) ? i : i * ld);
+            };
+            int64_t width = end - begin;
+            numa_cblas_syrk(upper_lower_, trans_, width, k, alpha, row(begin), ld, beta,
+                            c + begin + begin * ldc, ldc);
+            if (upper_lower_ == CblasUpper && begin > 0)
+                numa_cblas_gemm(left, right, begin, width, k, alpha, row(0), ld, row(begin), ld,
+                                beta, c + begin * ldc, ldc);
+            if (upper_lower_ == CblasLower && end < n)
+                numa_cblas_gemm(left, right, n - end, width, k, alpha, row(end), ld, row(begin),
+                                ld, beta, c + end + begin * ldc, ldc);
+        });
+}
+
+} // namespace mklcpu
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_MKLCPU_NUMA_HPP_
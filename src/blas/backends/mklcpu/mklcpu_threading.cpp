@@ -0,0 +1,127 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+#include "mkl_service.h"
+#include "mklcpu_common.hpp"
+#include "oneapi/mkl/blas/detail/mklcpu/onemkl_blas_mklcpu.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace mklcpu {
+
+namespace {
+
+// Policies of the queues that do not use the default one, keyed on the std::hash of the queue so
+// that the registry does not keep the queues alive.
+struct policy_registry {
+    std::mutex mutex;
+    std::unordered_map<std::size_t, thread_policy> queues;
+    // Lets the call path skip the lock until a policy is set on some queue.
+    std::atomic<bool> empty{ true };
+};
+
+policy_registry &registry() {
+    static policy_registry instance;
+    return instance;
+}
+
+thread_policy default_thread_policy() {
+    static const thread_policy policy = [] {
+        const char *env = std::getenv("ONEMKL_MKLCPU_THREAD_POLICY");
+        return (env != nullptr && std::strcmp(env, "shared") == 0) ? thread_policy::shared
+                                                                   : thread_policy::unrestricted;
+    }();
+    return policy;
+}
+
+struct thread_governor {
+    std::mutex mutex;
+    int running = 0;
+    int threads_in_use = 0;
+};
+
+thread_governor &governor() {
+    static thread_governor instance;
+    return instance;
+}
+
+} // namespace
+
+thread_policy exchange_thread_policy(std::size_t queue_key, thread_policy policy) {
+    auto &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    auto it = reg.queues.find(queue_key);
+    thread_policy previous = default_thread_policy();
+    if (it != reg.queues.end()) {
+        previous = it->second;
+        reg.queues.erase(it);
+    }
+    if (policy != default_thread_policy())
+        reg.queues.emplace(queue_key, policy);
+    reg.empty.store(reg.queues.empty(), std::memory_order_release);
+    return previous;
+}
+
+thread_policy get_thread_policy(const cl::sycl::queue &queue) {
+    auto &reg = registry();
+    if (reg.empty.load(std::memory_order_acquire))
+        return default_thread_policy();
+    const std::size_t queue_key = std::hash<cl::sycl::queue>{}(queue);
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    auto it = reg.queues.find(queue_key);
+    return (it != reg.queues.end()) ? it->second : default_thread_policy();
+}
+
+int thread_governor_enter() {
+    static const int max_threads = ::mkl_get_max_threads();
+    auto &gov = governor();
+    int threads;
+    {
+        std::lock_guard<std::mutex> lock(gov.mutex);
+        gov.running++;
+        // Tasks that started earlier keep the share they took, so a new task only gets the threads
+        // they left, even if that is less than an even share.
+        threads =
+            std::max(1, std::min(max_threads / gov.running, max_threads - gov.threads_in_use));
+        gov.threads_in_use += threads;
+    }
+    return threads;
+}
+
+void thread_governor_exit(int threads) {
+    auto &gov = governor();
+    std::lock_guard<std::mutex> lock(gov.mutex);
+    gov.running--;
+    gov.threads_in_use -= threads;
+}
+
+} // namespace mklcpu
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
@@ -91,6 +91,57 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
                                mkl_convert(transb), n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
+template <>
+std::int64_t gemm_pack_get_size<float>(cl::sycl::queue &queue, identifier which, int64_t m,
+                                       int64_t n, int64_t k) {
+    throw unimplemented("blas", "gemm_pack_get_size", "for mklgpu backend");
+}
+
+template <>
+std::int64_t gemm_pack_get_size<double>(cl::sycl::queue &queue, identifier which, int64_t m,
+                                        int64_t n, int64_t k) {
+    throw unimplemented("blas", "gemm_pack_get_size", "for mklgpu backend");
+}
+
+void gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+               int64_t k, float alpha, cl::sycl::buffer<float, 1> &src, int64_t ld,
+               cl::sycl::buffer<float, 1> &dest) {
+    throw unimplemented("blas", "gemm_pack", "for mklgpu backend");
+}
+
+void gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+               int64_t k, double alpha, cl::sycl::buffer<double, 1> &src, int64_t ld,
+               cl::sycl::buffer<double, 1> &dest) {
+    throw unimplemented("blas", "gemm_pack", "for mklgpu backend");
+}
+
+void gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, cl::sycl::buffer<float, 1> &packed, cl::sycl::buffer<float, 1> &other,
+                  int64_t ld, float beta, cl::sycl::buffer<float, 1> &c, int64_t ldc) {
+    throw unimplemented("blas", "gemm_compute", "for mklgpu backend");
+}
+
+void gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, cl::sycl::buffer<double, 1> &packed,
+                  cl::sycl::buffer<double, 1> &other, int64_t ld, double beta,
+                  cl::sycl::buffer<double, 1> &c, int64_t ldc) {
+    throw unimplemented("blas", "gemm_compute", "for mklgpu backend");
+}
+
+void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+            int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+            int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb,
+            std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    throw unimplemented("blas", "gemm3m", "for mklgpu backend");
+}
+
+void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+            int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+            int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
+            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    throw unimplemented("blas", "gemm3m", "for mklgpu backend");
+}
+
 // USM APIs
 
 cl::sycl::event gemm_bias(cl::sycl::queue &queue, transpose transa, transpose transb,
@@ -170,3 +221,45 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
                                            mkl_convert(transa), mkl_convert(transb), n, k, alpha, a,
                                            lda, b, ldb, beta, c, ldc, dependencies);
 }
+
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *src, int64_t ld,
+                          float *dest, const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_pack", "for mklgpu backend");
+}
+
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                          int64_t n, int64_t k, double alpha, const double *src, int64_t ld,
+                          double *dest, const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_pack", "for mklgpu backend");
+}
+
+cl::sycl::event gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                             int64_t n, int64_t k, const float *packed, const float *other,
+                             int64_t ld, float beta, float *c, int64_t ldc,
+                             const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_compute", "for mklgpu backend");
+}
+
+cl::sycl::event gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                             int64_t n, int64_t k, const double *packed, const double *other,
+                             int64_t ld, double beta, double *c, int64_t ldc,
+                             const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm_compute", "for mklgpu backend");
+}
+
+cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, std::complex<float> alpha,
+                       const std::complex<float> *a, int64_t lda, const std::complex<float> *b,
+                       int64_t ldb, std::complex<float> beta, std::complex<float> *c, int64_t ldc,
+                       const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm3m", "for mklgpu backend");
+}
+
+cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, std::complex<double> alpha,
+                       const std::complex<double> *a, int64_t lda, const std::complex<double> *b,
+                       int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+                       int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "gemm3m", "for mklgpu backend");
+}
@@ -371,6 +371,30 @@ cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, std::complex<double
     return ::oneapi::mkl::gpu::zaxpy_sycl(&queue, n, alpha, x, incx, y, incy, dependencies);
 }
 
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const float *alpha, const float *x,
+                     std::int64_t incx, float *y, std::int64_t incy,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "for mklgpu backend");
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const double *alpha, const double *x,
+                     std::int64_t incx, double *y, std::int64_t incy,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "for mklgpu backend");
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+                     const std::complex<float> *x, std::int64_t incx, std::complex<float> *y,
+                     std::int64_t incy, const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "for mklgpu backend");
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+                     const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
+                     std::int64_t incy, const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "axpy", "for mklgpu backend");
+}
+
 cl::sycl::event axpby(cl::sycl::queue &queue, std::int64_t n, float alpha, const float *x,
                       std::int64_t incx, float beta, float *y, std::int64_t incy,
                       const std::vector<cl::sycl::event> &dependencies) {
@@ -595,6 +619,40 @@ cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, double alpha, std::
     return ::oneapi::mkl::gpu::zdscal_sycl(&queue, n, alpha, x, incx, dependencies);
 }
 
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const float *alpha, float *x,
+                     std::int64_t incx, const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "for mklgpu backend");
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const double *alpha, double *x,
+                     std::int64_t incx, const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "for mklgpu backend");
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+                     std::complex<float> *x, std::int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "for mklgpu backend");
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const float *alpha,
+                     std::complex<float> *x, std::int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "for mklgpu backend");
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+                     std::complex<double> *x, std::int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "for mklgpu backend");
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, std::int64_t n, const double *alpha,
+                     std::complex<double> *x, std::int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    throw unimplemented("blas", "scal", "for mklgpu backend");
+}
+
 cl::sycl::event swap(cl::sycl::queue &queue, std::int64_t n, float *x, std::int64_t incx, float *y,
                      std::int64_t incy, const std::vector<cl::sycl::event> &dependencies) {
     return ::oneapi::mkl::gpu::sswap_sycl(&queue, n, x, incx, y, incy, dependencies);
@@ -19,6 +19,7 @@
 
 #include <CL/sycl.hpp>
 
+#include "half_gemm.hpp"
 #include "netlib_common.hpp"
 #include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/blas/detail/netlib/onemkl_blas_netlib.hpp"
@@ -27,17 +28,495 @@ namespace oneapi {
 namespace mkl {
 namespace blas {
 namespace netlib {
+
+namespace {
+
+void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m,
+                int64_t n, int64_t k, float alpha, const float *a, int64_t lda, const float *b,
+                int64_t ldb, float beta, float *c, int64_t ldc) {
+    ::cblas_sgemm(layout, transa, transb, to_cblas_int(m), to_cblas_int(n), to_cblas_int(k), alpha,
+                  a, to_cblas_int(lda), b, to_cblas_int(ldb), beta, c, to_cblas_int(ldc));
+}
+
+void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m,
+                int64_t n, int64_t k, double alpha, const double *a, int64_t lda, const double *b,
+                int64_t ldb, double beta, double *c, int64_t ldc) {
+    ::cblas_dgemm(layout, transa, transb, to_cblas_int(m), to_cblas_int(n), to_cblas_int(k), alpha,
+                  a, to_cblas_int(lda), b, to_cblas_int(ldb), beta, c, to_cblas_int(ldc));
+}
+
+void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m,
+                int64_t n, int64_t k, std::complex<float> alpha, const std::complex<float> *a,
+                int64_t lda, const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                std::complex<float> *c, int64_t ldc) {
+    ::cblas_cgemm(layout, transa, transb, to_cblas_int(m), to_cblas_int(n), to_cblas_int(k),
+                  (const void *)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb),
+                  (const void *)&beta, c, to_cblas_int(ldc));
+}
+
+void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m,
+                int64_t n, int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                int64_t lda, const std::complex<double> *b, int64_t ldb, std::complex<double> beta,
+                std::complex<double> *c, int64_t ldc) {
+    ::cblas_zgemm(layout, transa, transb, to_cblas_int(m), to_cblas_int(n), to_cblas_int(k),
+                  (const void *)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb),
+                  (const void *)&beta, c, to_cblas_int(ldc));
+}
+
+// Reference CBLAS has no half precision gemm; the matrices are converted to float by blocks.
+void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m,
+                int64_t n, int64_t k, half alpha, const half *a, int64_t lda, const half *b,
+                int64_t ldb, half beta, half *c, int64_t ldc) {
+    auto sgemm = [](bool transa, bool transb, int64_t m, int64_t n, int64_t k, float alpha,
+                    const float *a, int64_t lda, const float *b, int64_t ldb, float beta, float *c,
+                    int64_t ldc) {
+        cblas_gemm(CblasColMajor, transa ? CblasTrans : CblasNoTrans,
+                   transb ? CblasTrans : CblasNoTrans, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                   ldc);
+    };
+    detail::half_gemm(sgemm, layout == CblasRowMajor, transa != CblasNoTrans,
+                      transb != CblasNoTrans, m, n, k, static_cast<float>(alpha), a, lda, b, ldb,
+                      static_cast<float>(beta), c, ldc);
+}
+
+void cblas_trsm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower,
+                CBLAS_TRANSPOSE trans, CBLAS_DIAG unit_diag, int64_t m, int64_t n, float alpha,
+                const float *a, int64_t lda, float *b, int64_t ldb) {
+    ::cblas_strsm(layout, left_right, upper_lower, trans, unit_diag, to_cblas_int(m),
+                  to_cblas_int(n), alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb));
+}
+
+void cblas_trsm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower,
+                CBLAS_TRANSPOSE trans, CBLAS_DIAG unit_diag, int64_t m, int64_t n, double alpha,
+                const double *a, int64_t lda, double *b, int64_t ldb) {
+    ::cblas_dtrsm(layout, left_right, upper_lower, trans, unit_diag, to_cblas_int(m),
+                  to_cblas_int(n), alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb));
+}
+
+void cblas_trsm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower,
+                CBLAS_TRANSPOSE trans, CBLAS_DIAG unit_diag, int64_t m, int64_t n,
+                std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                std::complex<float> *b, int64_t ldb) {
+    ::cblas_ctrsm(layout, left_right, upper_lower, trans, unit_diag, to_cblas_int(m),
+                  to_cblas_int(n), (const void *)&alpha, a, to_cblas_int(lda), b,
+                  to_cblas_int(ldb));
+}
+
+void cblas_trsm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower,
+                CBLAS_TRANSPOSE trans, CBLAS_DIAG unit_diag, int64_t m, int64_t n,
+                std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                std::complex<double> *b, int64_t ldb) {
+    ::cblas_ztrsm(layout, left_right, upper_lower, trans, unit_diag, to_cblas_int(m),
+                  to_cblas_int(n), (const void *)&alpha, a, to_cblas_int(lda), b,
+                  to_cblas_int(ldb));
+}
+
+void cblas_syrk(CBLAS_LAYOUT layout, CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, int64_t n,
+                int64_t k, float alpha, const float *a, int64_t lda, float beta, float *c,
+                int64_t ldc) {
+    ::cblas_ssyrk(layout, upper_lower, trans, to_cblas_int(n), to_cblas_int(k), alpha, a,
+                  to_cblas_int(lda), beta, c, to_cblas_int(ldc));
+}
+
+void cblas_syrk(CBLAS_LAYOUT layout, CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, int64_t n,
+                int64_t k, double alpha, const double *a, int64_t lda, double beta, double *c,
+                int64_t ldc) {
+    ::cblas_dsyrk(layout, upper_lower, trans, to_cblas_int(n), to_cblas_int(k), alpha, a,
+                  to_cblas_int(lda), beta, c, to_cblas_int(ldc));
+}
+
+void cblas_syrk(CBLAS_LAYOUT layout, CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, int64_t n,
+                int64_t k, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                std::complex<float> beta, std::complex<float> *c, int64_t ldc) {
+    ::cblas_csyrk(layout, upper_lower, trans, to_cblas_int(n), to_cblas_int(k),
+                  (const void *)&alpha, a, to_cblas_int(lda), (const void *)&beta, c,
+                  to_cblas_int(ldc));
+}
+
+void cblas_syrk(CBLAS_LAYOUT layout, CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, int64_t n,
+                int64_t k, std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                std::complex<double> beta, std::complex<double> *c, int64_t ldc) {
+    ::cblas_zsyrk(layout, upper_lower, trans, to_cblas_int(n), to_cblas_int(k),
+                  (const void *)&alpha, a, to_cblas_int(lda), (const void *)&beta, c,
+                  to_cblas_int(ldc));
+}
+
+void cblas_gemv(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, int64_t m, int64_t n, float alpha,
+                const float *a, int64_t lda, const float *x, int64_t incx, float beta, float *y,
+                int64_t incy) {
+    ::cblas_sgemv(layout, transa, to_cblas_int(m), to_cblas_int(n), alpha, a, to_cblas_int(lda), x,
+                  to_cblas_int(incx), beta, y, to_cblas_int(incy));
+}
+
+void cblas_gemv(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, int64_t m, int64_t n, double alpha,
+                const double *a, int64_t lda, const double *x, int64_t incx, double beta, double *y,
+                int64_t incy) {
+    ::cblas_dgemv(layout, transa, to_cblas_int(m), to_cblas_int(n), alpha, a, to_cblas_int(lda), x,
+                  to_cblas_int(incx), beta, y, to_cblas_int(incy));
+}
+
+void cblas_gemv(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, int64_t m, int64_t n,
+                std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                const std::complex<float> *x, int64_t incx, std::complex<float> beta,
+                std::complex<float> *y, int64_t incy) {
+    ::cblas_cgemv(layout, transa, to_cblas_int(m), to_cblas_int(n), (const void *)&alpha, a,
+                  to_cblas_int(lda), x, to_cblas_int(incx), (const void *)&beta, y,
+                  to_cblas_int(incy));
+}
+
+void cblas_gemv(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, int64_t m, int64_t n,
+                std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                const std::complex<double> *x, int64_t incx, std::complex<double> beta,
+                std::complex<double> *y, int64_t incy) {
+    ::cblas_zgemv(layout, transa, to_cblas_int(m), to_cblas_int(n), (const void *)&alpha, a,
+                  to_cblas_int(lda), x, to_cblas_int(incx), (const void *)&beta, y,
+                  to_cblas_int(incy));
+}
+
+double gemm_cost(int64_t m, int64_t n, int64_t k) {
+    return double(m) * double(n) * double(std::max<int64_t>(k, 1));
+}
+
+// op(A) is m x m for side::left and n x n for side::right; half of it is used.
+double trsm_cost(side left_right, int64_t m, int64_t n) {
+    return 0.5 * double(m) * double(n) * double(left_right == side::left ? m : n);
+}
+
+// Only one triangle of C is computed.
+double syrk_cost(int64_t n, int64_t k) {
+    return 0.5 * double(n) * double(n + 1) * double(std::max<int64_t>(k, 1));
+}
+
+// Each matrix of a batch is one cblas call, run on the thread pool.
+template <typename T>
+void gemm_batch_strided(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                        int64_t n, int64_t k, T alpha, const T *a, int64_t lda, int64_t stride_a,
+                        const T *b, int64_t ldb, int64_t stride_b, T beta, T *c, int64_t ldc,
+                        int64_t stride_c, int64_t batch_size) {
+    const CBLAS_TRANSPOSE transa_ = convert_to_cblas_trans(transa);
+    const CBLAS_TRANSPOSE transb_ = convert_to_cblas_trans(transb);
+    parallel_batch(
+        1, &batch_size, [=](int64_t) { return gemm_cost(m, n, k); },
+        [=](int64_t, int64_t i) {
+            cblas_gemm(layout, transa_, transb_, m, n, k, alpha, a + i * stride_a, lda,
+                       b + i * stride_b, ldb, beta, c + i * stride_c, ldc);
+        });
+}
+
+template <typename T>
+void gemm_batch_group(CBLAS_LAYOUT layout, const transpose *transa, const transpose *transb,
+                      const int64_t *m, const int64_t *n, const int64_t *k, const T *alpha,
+                      const T **a, const int64_t *lda, const T **b, const int64_t *ldb,
+                      const T *beta, T **c, const int64_t *ldc, int64_t group_count,
+                      const int64_t *group_size) {
+    parallel_batch(
+        group_count, group_size, [=](int64_t g) { return gemm_cost(m[g], n[g], k[g]); },
+        [=](int64_t g, int64_t i) {
+            cblas_gemm(layout, convert_to_cblas_trans(transa[g]),
+                       convert_to_cblas_trans(transb[g]), m[g], n[g], k[g], alpha[g], a[i],
+                       lda[g], b[i], ldb[g], beta[g], c[i], ldc[g]);
+        });
+}
+
+template <typename T>
+void trsm_batch_strided(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                        diag unit_diag, int64_t m, int64_t n, T alpha, const T *a, int64_t lda,
+                        int64_t stride_a, T *b, int64_t ldb, int64_t stride_b,
+                        int64_t batch_size) {
+    const CBLAS_SIDE left_right_ = convert_to_cblas_side(left_right);
+    const CBLAS_UPLO upper_lower_ = convert_to_cblas_uplo(upper_lower);
+    const CBLAS_TRANSPOSE trans_ = convert_to_cblas_trans(trans);
+    const CBLAS_DIAG unit_diag_ = convert_to_cblas_diag(unit_diag);
+    parallel_batch(
+        1, &batch_size, [=](int64_t) { return trsm_cost(left_right, m, n); },
+        [=](int64_t, int64_t i) {
+            cblas_trsm(layout, left_right_, upper_lower_, trans_, unit_diag_, m, n, alpha,
+                       a + i * stride_a, lda, b + i * stride_b, ldb);
+        });
+}
+
+template <typename T>
+void trsm_batch_group(CBLAS_LAYOUT layout, const side *left_right, const uplo *upper_lower,
+                      const transpose *trans, const diag *unit_diag, const int64_t *m,
+                      const int64_t *n, const T *alpha, const T **a, const int64_t *lda, T **b,
+                      const int64_t *ldb, int64_t group_count, const int64_t *group_size) {
+    parallel_batch(
+        group_count, group_size, [=](int64_t g) { return trsm_cost(left_right[g], m[g], n[g]); },
+        [=](int64_t g, int64_t i) {
+            cblas_trsm(layout, convert_to_cblas_side(left_right[g]),
+                       convert_to_cblas_uplo(upper_lower[g]), convert_to_cblas_trans(trans[g]),
+                       convert_to_cblas_diag(unit_diag[g]), m[g], n[g], alpha[g], a[i], lda[g],
+                       b[i], ldb[g]);
+        });
+}
+
+template <typename T>
+void syrk_batch_strided(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n,
+                        int64_t k, T alpha, const T *a, int64_t lda, int64_t stride_a, T beta,
+                        T *c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    const CBLAS_UPLO upper_lower_ = convert_to_cblas_uplo(upper_lower);
+    const CBLAS_TRANSPOSE trans_ = convert_to_cblas_trans(trans);
+    parallel_batch(
+        1, &batch_size, [=](int64_t) { return syrk_cost(n, k); },
+        [=](int64_t, int64_t i) {
+            cblas_syrk(layout, upper_lower_, trans_, n, k, alpha, a + i * stride_a, lda, beta,
+                       c + i * stride_c, ldc);
+        });
+}
+
+template <typename T>
+void syrk_batch_group(CBLAS_LAYOUT layout, const uplo *upper_lower, const transpose *trans,
+                      const int64_t *n, const int64_t *k, const T *alpha, const T **a,
+                      const int64_t *lda, const T *beta, T **c, const int64_t *ldc,
+                      int64_t group_count, const int64_t *group_size) {
+    parallel_batch(
+        group_count, group_size, [=](int64_t g) { return syrk_cost(n[g], k[g]); },
+        [=](int64_t g, int64_t i) {
+            cblas_syrk(layout, convert_to_cblas_uplo(upper_lower[g]),
+                       convert_to_cblas_trans(trans[g]), n[g], k[g], alpha[g], a[i], lda[g],
+                       beta[g], c[i], ldc[g]);
+        });
+}
+
+// The level 1 and 2 batches are memory bound. Vectors are streamed by plain loops rather than one
+// cblas call each, with separate loops for unit increments that the compiler can vectorize.
+
+// First element of a BLAS vector of n elements; negative increments run backwards from the end.
+template <typename T>
+T *vector_start(T *x, int64_t n, int64_t inc) {
+    return inc < 0 ? x - (n - 1) * inc : x;
+}
+
+// Copies a vector read by every item of a batch (a stride of 0) to contiguous scratch memory, so
+// that the loops read it with unit increment.
+template <typename T>
+const T *pack_vector(oneapi::mkl::detail::scratch_arena::scope &scratch, int64_t n, const T *x,
+                     int64_t incx) {
+    T *packed = scratch.allocate<T>(n);
+    x = vector_start(x, n, incx);
+    for (int64_t i = 0; i < n; i++)
+        packed[i] = x[i * incx];
+    return packed;
+}
+
+template <typename T>
+void copy_kernel(int64_t n, const T *x, int64_t incx, T *y, int64_t incy) {
+    x = vector_start(x, n, incx);
+    y = vector_start(y, n, incy);
+    if (incx == 1 && incy == 1) {
+        for (int64_t i = 0; i < n; i++)
+            y[i] = x[i];
+    }
+    else {
+        for (int64_t i = 0; i < n; i++)
+            y[i * incy] = x[i * incx];
+    }
+}
+
+template <typename T>
+void axpy_kernel(int64_t n, T alpha, const T *x, int64_t incx, T *y, int64_t incy) {
+    // As in BLAS, y is left unchanged when alpha is zero.
+    if (alpha == T(0))
+        return;
+    x = vector_start(x, n, incx);
+    y = vector_start(y, n, incy);
+    if (incx == 1 && incy == 1) {
+        for (int64_t i = 0; i < n; i++)
+            y[i] += alpha * x[i];
+    }
+    else {
+        for (int64_t i = 0; i < n; i++)
+            y[i * incy] += alpha * x[i * incx];
+    }
+}
+
+// Column major C = diag(x) * A (left) or C = A * diag(x).
+template <typename T>
+void dgmm_col_major(bool left, int64_t m, int64_t n, const T *a, int64_t lda, const T *x,
+                    int64_t incx, T *c, int64_t ldc) {
+    x = vector_start(x, left ? m : n, incx);
+    for (int64_t j = 0; j < n; j++) {
+        const T *a_j = a + j * lda;
+        T *c_j = c + j * ldc;
+        if (!left) {
+            const T x_j = x[j * incx];
+            for (int64_t i = 0; i < m; i++)
+                c_j[i] = x_j * a_j[i];
+        }
+        else if (incx == 1) {
+            for (int64_t i = 0; i < m; i++)
+                c_j[i] = x[i] * a_j[i];
+        }
+        else {
+            for (int64_t i = 0; i < m; i++)
+                c_j[i] = x[i * incx] * a_j[i];
+        }
+    }
+}
+
+// Row major matrices are handled as their column major transposes, with the side exchanged.
+template <typename T>
+void dgmm_kernel(CBLAS_LAYOUT layout, side left_right, int64_t m, int64_t n, const T *a,
+                 int64_t lda, const T *x, int64_t incx, T *c, int64_t ldc) {
+    if (layout == CblasRowMajor)
+        dgmm_col_major(left_right == side::right, n, m, a, lda, x, incx, c, ldc);
+    else
+        dgmm_col_major(left_right == side::left, m, n, a, lda, x, incx, c, ldc);
+}
+
+// Runs f(begin, end) over the items of a strided batch. Items with an output stride of 0 all write
+// the same output, so they run in order on one thread.
+template <typename F>
+void strided_batch(int64_t batch_size, double cost, int64_t stride_out, F f) {
+    if (stride_out != 0)
+        parallel_range(batch_size, cost, f);
+    else if (batch_size > 0)
+        f(int64_t(0), batch_size);
+}
+
+template <typename T>
+void copy_batch_strided(int64_t n, const T *x, int64_t incx, int64_t stridex, T *y, int64_t incy,
+                        int64_t stridey, int64_t batch_size) {
+    strided_batch(batch_size, double(n), stridey, [=](int64_t begin, int64_t end) {
+        oneapi::mkl::detail::scratch_arena::scope scratch("blas", "copy_batch");
+        const T *x_ = x;
+        int64_t incx_ = incx;
+        if (stridex == 0 && incx != 1 && end - begin > 1) {
+            x_ = pack_vector(scratch, n, x, incx);
+            incx_ = 1;
+        }
+        for (int64_t i = begin; i < end; i++)
+            copy_kernel(n, x_ + i * stridex, incx_, y + i * stridey, incy);
+    });
+}
+
+template <typename T>
+void copy_batch_group(const int64_t *n, const T **x, const int64_t *incx, T **y,
+                      const int64_t *incy, int64_t group_count, const int64_t *group_size) {
+    parallel_batch(
+        group_count, group_size, [=](int64_t g) { return double(n[g]); },
+        [=](int64_t g, int64_t i) { copy_kernel(n[g], x[i], incx[g], y[i], incy[g]); });
+}
+
+template <typename T>
+void axpy_batch_strided(int64_t n, T alpha, const T *x, int64_t incx, int64_t stridex, T *y,
+                        int64_t incy, int64_t stridey, int64_t batch_size) {
+    strided_batch(batch_size, double(n), stridey, [=](int64_t begin, int64_t end) {
+        oneapi::mkl::detail::scratch_arena::scope scratch("blas", "axpy_batch");
+        const T *x_ = x;
+        int64_t incx_ = incx;
+        if (stridex == 0 && incx != 1 && end - begin > 1) {
+            x_ = pack_vector(scratch, n, x, incx);
+            incx_ = 1;
+        }
+        for (int64_t i = begin; i < end; i++)
+            axpy_kernel(n, alpha, x_ + i * stridex, incx_, y + i * stridey, incy);
+    });
+}
+
+template <typename T>
+void axpy_batch_group(const int64_t *n, const T *alpha, const T **x, const int64_t *incx, T **y,
+                      const int64_t *incy, int64_t group_count, const int64_t *group_size) {
+    parallel_batch(
+        group_count, group_size, [=](int64_t g) { return double(n[g]); },
+        [=](int64_t g, int64_t i) { axpy_kernel(n[g], alpha[g], x[i], incx[g], y[i], incy[g]); });
+}
+
+template <typename T>
+void dgmm_batch_strided(CBLAS_LAYOUT layout, side left_right, int64_t m, int64_t n, const T *a,
+                        int64_t lda, int64_t stride_a, const T *x, int64_t incx, int64_t stride_x,
+                        T *c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    const int64_t len_x = left_right == side::left ? m : n;
+    strided_batch(batch_size, double(m) * n, stride_c, [=](int64_t begin, int64_t end) {
+        oneapi::mkl::detail::scratch_arena::scope scratch("blas", "dgmm_batch");
+        const T *x_ = x;
+        int64_t incx_ = incx;
+        if (stride_x == 0 && incx != 1 && end - begin > 1) {
+            x_ = pack_vector(scratch, len_x, x, incx);
+            incx_ = 1;
+        }
+        for (int64_t i = begin; i < end; i++)
+            dgmm_kernel(layout, left_right, m, n, a + i * stride_a, lda, x_ + i * stride_x, incx_,
+                        c + i * stride_c, ldc);
+    });
+}
+
+template <typename T>
+void dgmm_batch_group(CBLAS_LAYOUT layout, const side *left_right, const int64_t *m,
+                      const int64_t *n, const T **a, const int64_t *lda, const T **x,
+                      const int64_t *incx, T **c, const int64_t *ldc, int64_t group_count,
+                      const int64_t *group_size) {
+    parallel_batch(
+        group_count, group_size, [=](int64_t g) { return double(m[g]) * n[g]; },
+        [=](int64_t g, int64_t i) {
+            dgmm_kernel(layout, left_right[g], m[g], n[g], a[i], lda[g], x[i], incx[g], c[i],
+                        ldc[g]);
+        });
+}
+
+template <typename T>
+void gemv_batch_strided(CBLAS_LAYOUT layout, transpose transa, int64_t m, int64_t n, T alpha,
+                        const T *a, int64_t lda, int64_t stride_a, const T *x, int64_t incx,
+                        int64_t stride_x, T beta, T *y, int64_t incy, int64_t stride_y,
+                        int64_t batch_size) {
+    const CBLAS_TRANSPOSE transa_ = convert_to_cblas_trans(transa);
+    const int64_t len_x = transa == transpose::nontrans ? n : m;
+    const int64_t len_y = transa == transpose::nontrans ? m : n;
+    // With stride_a == 0 every vector is multiplied by the same matrix. Contiguous vectors are then
+    // the columns of X and Y, and each thread computes Y = alpha * op(A) * X + beta * Y for its
+    // columns with one gemm. In row major this is Y^T = X^T * op(A)^T, which has no gemm form for
+    // conjugate transposes.
+    if (stride_a == 0 && incx == 1 && incy == 1 && len_x > 0 && len_y > 0 && stride_x >= len_x &&
+        stride_y >= len_y && (layout == CblasColMajor || transa != transpose::conjtrans)) {
+        parallel_range(batch_size, double(m) * n, [=](int64_t begin, int64_t end) {
+            if (layout == CblasColMajor)
+                cblas_gemm(layout, transa_, CblasNoTrans, len_y, end - begin, len_x, alpha, a, lda,
+                           x + begin * stride_x, stride_x, beta, y + begin * stride_y, stride_y);
+            else
+                cblas_gemm(layout, CblasNoTrans,
+                           transa == transpose::nontrans ? CblasTrans : CblasNoTrans, end - begin,
+                           len_y, len_x, alpha, x + begin * stride_x, stride_x, a, lda, beta,
+                           y + begin * stride_y, stride_y);
+        });
+        return;
+    }
+    strided_batch(batch_size, double(m) * n, stride_y, [=](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++)
+            cblas_gemv(layout, transa_, m, n, alpha, a + i * stride_a, lda, x + i * stride_x, incx,
+                       beta, y + i * stride_y, incy);
+    });
+}
+
+template <typename T>
+void gemv_batch_group(CBLAS_LAYOUT layout, const transpose *transa, const int64_t *m,
+                      const int64_t *n, const T *alpha, const T **a, const int64_t *lda,
+                      const T **x, const int64_t *incx, const T *beta, T **y, const int64_t *incy,
+                      int64_t group_count, const int64_t *group_size) {
+    parallel_batch(
+        group_count, group_size, [=](int64_t g) { return double(m[g]) * n[g]; },
+        [=](int64_t g, int64_t i) {
+            cblas_gemv(layout, convert_to_cblas_trans(transa[g]), m[g], n[g], alpha[g], a[i],
+                       lda[g], x[i], incx[g], beta[g], y[i], incy[g]);
+        });
+}
+
+} // namespace
+
 namespace column_major {
 
+#define MAJOR CblasColMajor
 #define COLUMN_MAJOR
 #include "netlib_batch.cxx"
+#undef MAJOR
 #undef COLUMN_MAJOR
 
 } // namespace column_major
 namespace row_major {
 
+#define MAJOR CblasRowMajor
 #define ROW_MAJOR
 #include "netlib_batch.cxx"
+#undef MAJOR
 #undef ROW_MAJOR
 
 } // namespace row_major
@@ -22,103 +22,127 @@
 void copy_batch(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64_t incx,
                 int64_t stridex, cl::sycl::buffer<float, 1> &y, int64_t incy, int64_t stridey,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_scopy_batch_strided>(cgh, [=]() {
+            copy_batch_strided<float>(n, accessor_x.get_pointer(), incx, stridex,
+                                      accessor_y.get_pointer(), incy, stridey, batch_size);
+        });
+    });
 }
 
 void copy_batch(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int64_t incx,
                 int64_t stridex, cl::sycl::buffer<double, 1> &y, int64_t incy, int64_t stridey,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dcopy_batch_strided>(cgh, [=]() {
+            copy_batch_strided<double>(n, accessor_x.get_pointer(), incx, stridex,
+                                       accessor_y.get_pointer(), incy, stridey, batch_size);
+        });
+    });
 }
 
 void copy_batch(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>, 1> &x,
                 int64_t incx, int64_t stridex, cl::sycl::buffer<std::complex<float>, 1> &y,
                 int64_t incy, int64_t stridey, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ccopy_batch_strided>(cgh, [=]() {
+            copy_batch_strided<std::complex<float>>(n, accessor_x.get_pointer(), incx, stridex,
+                                                    accessor_y.get_pointer(), incy, stridey,
+                                                    batch_size);
+        });
+    });
 }
 
 void copy_batch(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double>, 1> &x,
                 int64_t incx, int64_t stridex, cl::sycl::buffer<std::complex<double>, 1> &y,
                 int64_t incy, int64_t stridey, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zcopy_batch_strided>(cgh, [=]() {
+            copy_batch_strided<std::complex<double>>(n, accessor_x.get_pointer(), incx, stridex,
+                                                     accessor_y.get_pointer(), incy, stridey,
+                                                     batch_size);
+        });
+    });
 }
 
 void axpy_batch(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float, 1> &x,
                 int64_t incx, int64_t stridex, cl::sycl::buffer<float, 1> &y, int64_t incy,
                 int64_t stridey, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_saxpy_batch_strided>(cgh, [=]() {
+            axpy_batch_strided<float>(n, alpha, accessor_x.get_pointer(), incx, stridex,
+                                      accessor_y.get_pointer(), incy, stridey, batch_size);
+        });
+    });
 }
 
 void axpy_batch(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<double, 1> &x,
                 int64_t incx, int64_t stridex, cl::sycl::buffer<double, 1> &y, int64_t incy,
                 int64_t stridey, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_daxpy_batch_strided>(cgh, [=]() {
+            axpy_batch_strided<double>(n, alpha, accessor_x.get_pointer(), incx, stridex,
+                                       accessor_y.get_pointer(), incy, stridey, batch_size);
+        });
+    });
 }
 
 void axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
                 cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx, int64_t stridex,
                 cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy, int64_t stridey,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_caxpy_batch_strided>(cgh, [=]() {
+            axpy_batch_strided<std::complex<float>>(n, alpha, accessor_x.get_pointer(), incx,
+                                                    stridex, accessor_y.get_pointer(), incy,
+                                                    stridey, batch_size);
+        });
+    });
 }
 
 void axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
                 cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, int64_t stridex,
                 cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy, int64_t stridey,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zaxpy_batch_strided>(cgh, [=]() {
+            axpy_batch_strided<std::complex<double>>(n, alpha, accessor_x.get_pointer(), incx,
+                                                     stridex, accessor_y.get_pointer(), incy,
+                                                     stridey, batch_size);
+        });
+    });
 }
 
 void gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n, float alpha,
                 cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
                 cl::sycl::buffer<float, 1> &x, int64_t incx, int64_t stride_x, float beta,
                 cl::sycl::buffer<float, 1> &y, int64_t incy, int64_t stride_y, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgemv_batch_strided>(cgh, [=]() {
+            gemv_batch_strided<float>(MAJOR, transa, m, n, alpha, accessor_a.get_pointer(), lda,
+                                      stride_a, accessor_x.get_pointer(), incx, stride_x, beta,
+                                      accessor_y.get_pointer(), incy, stride_y, batch_size);
+        });
+    });
 }
 
 void gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n, double alpha,
@@ -126,12 +150,16 @@ void gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
                 cl::sycl::buffer<double, 1> &x, int64_t incx, int64_t stride_x, double beta,
                 cl::sycl::buffer<double, 1> &y, int64_t incy, int64_t stride_y,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgemv_batch_strided>(cgh, [=]() {
+            gemv_batch_strided<double>(MAJOR, transa, m, n, alpha, accessor_a.get_pointer(), lda,
+                                       stride_a, accessor_x.get_pointer(), incx, stride_x, beta,
+                                       accessor_y.get_pointer(), incy, stride_y, batch_size);
+        });
+    });
 }
 
 void gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
@@ -140,12 +168,17 @@ void gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
                 int64_t stride_x, std::complex<float> beta,
                 cl::sycl::buffer<std::complex<float>, 1> &y, int64_t incy, int64_t stride_y,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgemv_batch_strided>(cgh, [=]() {
+            gemv_batch_strided<std::complex<float>>(
+                MAJOR, transa, m, n, alpha, accessor_a.get_pointer(), lda, stride_a,
+                accessor_x.get_pointer(), incx, stride_x, beta, accessor_y.get_pointer(), incy,
+                stride_y, batch_size);
+        });
+    });
 }
 
 void gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
@@ -154,36 +187,49 @@ void gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
                 int64_t incx, int64_t stride_x, std::complex<double> beta,
                 cl::sycl::buffer<std::complex<double>, 1> &y, int64_t incy, int64_t stride_y,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgemv_batch_strided>(cgh, [=]() {
+            gemv_batch_strided<std::complex<double>>(
+                MAJOR, transa, m, n, alpha, accessor_a.get_pointer(), lda, stride_a,
+                accessor_x.get_pointer(), incx, stride_x, beta, accessor_y.get_pointer(), incy,
+                stride_y, batch_size);
+        });
+    });
 }
 
 void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
                 cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
                 cl::sycl::buffer<float, 1> &x, int64_t incx, int64_t stride_x,
                 cl::sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sdgmm_batch_strided>(cgh, [=]() {
+            dgmm_batch_strided<float>(MAJOR, left_right, m, n, accessor_a.get_pointer(), lda,
+                                      stride_a, accessor_x.get_pointer(), incx, stride_x,
+                                      accessor_c.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
                 cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
                 cl::sycl::buffer<double, 1> &x, int64_t incx, int64_t stride_x,
                 cl::sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ddgmm_batch_strided>(cgh, [=]() {
+            dgmm_batch_strided<double>(MAJOR, left_right, m, n, accessor_a.get_pointer(), lda,
+                                       stride_a, accessor_x.get_pointer(), incx, stride_x,
+                                       accessor_c.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
@@ -191,12 +237,17 @@ void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
                 cl::sycl::buffer<std::complex<float>, 1> &x, int64_t incx, int64_t stride_x,
                 cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cdgmm_batch_strided>(cgh, [=]() {
+            dgmm_batch_strided<std::complex<float>>(
+                MAJOR, left_right, m, n, accessor_a.get_pointer(), lda, stride_a,
+                accessor_x.get_pointer(), incx, stride_x, accessor_c.get_pointer(), ldc, stride_c,
+                batch_size);
+        });
+    });
 }
 
 void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
@@ -204,12 +255,17 @@ void dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
                 cl::sycl::buffer<std::complex<double>, 1> &x, int64_t incx, int64_t stride_x,
                 cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zdgmm_batch_strided>(cgh, [=]() {
+            dgmm_batch_strided<std::complex<double>>(
+                MAJOR, left_right, m, n, accessor_a.get_pointer(), lda, stride_a,
+                accessor_x.get_pointer(), incx, stride_x, accessor_c.get_pointer(), ldc, stride_c,
+                batch_size);
+        });
+    });
 }
 
 void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -217,12 +273,17 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 int64_t stride_a, cl::sycl::buffer<float, 1> &b, int64_t ldb, int64_t stride_b,
                 float beta, cl::sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgemm_batch_strided>(cgh, [=]() {
+            gemm_batch_strided<float>(MAJOR, transa, transb, m, n, k, alpha,
+                                      accessor_a.get_pointer(), lda, stride_a,
+                                      accessor_b.get_pointer(), ldb, stride_b, beta,
+                                      accessor_c.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -230,12 +291,17 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 int64_t stride_a, cl::sycl::buffer<double, 1> &b, int64_t ldb, int64_t stride_b,
                 double beta, cl::sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgemm_batch_strided>(cgh, [=]() {
+            gemm_batch_strided<double>(MAJOR, transa, transb, m, n, k, alpha,
+                                       accessor_a.get_pointer(), lda, stride_a,
+                                       accessor_b.get_pointer(), ldb, stride_b, beta,
+                                       accessor_c.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -244,12 +310,17 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 int64_t ldb, int64_t stride_b, std::complex<float> beta,
                 cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgemm_batch_strided>(cgh, [=]() {
+            gemm_batch_strided<std::complex<float>>(
+                MAJOR, transa, transb, m, n, k, alpha, accessor_a.get_pointer(), lda, stride_a,
+                accessor_b.get_pointer(), ldb, stride_b, beta, accessor_c.get_pointer(), ldc,
+                stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -258,48 +329,64 @@ void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int6
                 int64_t ldb, int64_t stride_b, std::complex<double> beta,
                 cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgemm_batch_strided>(cgh, [=]() {
+            gemm_batch_strided<std::complex<double>>(
+                MAJOR, transa, transb, m, n, k, alpha, accessor_a.get_pointer(), lda, stride_a,
+                accessor_b.get_pointer(), ldb, stride_b, beta, accessor_c.get_pointer(), ldc,
+                stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
                 int64_t k, half alpha, cl::sycl::buffer<half, 1> &a, int64_t lda, int64_t stride_a,
                 cl::sycl::buffer<half, 1> &b, int64_t ldb, int64_t stride_b, half beta,
                 cl::sycl::buffer<half, 1> &c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_hgemm_batch_strided>(cgh, [=]() {
+            gemm_batch_strided<half>(MAJOR, transa, transb, m, n, k, alpha,
+                                     accessor_a.get_pointer(), lda, stride_a,
+                                     accessor_b.get_pointer(), ldb, stride_b, beta,
+                                     accessor_c.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
                 diag unit_diag, int64_t m, int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
                 int64_t lda, int64_t stride_a, cl::sycl::buffer<float, 1> &b, int64_t ldb,
                 int64_t stride_b, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_strsm_batch_strided>(cgh, [=]() {
+            trsm_batch_strided<float>(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                                      accessor_a.get_pointer(), lda, stride_a,
+                                      accessor_b.get_pointer(), ldb, stride_b, batch_size);
+        });
+    });
 }
 
 void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
                 diag unit_diag, int64_t m, int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
                 int64_t lda, int64_t stride_a, cl::sycl::buffer<double, 1> &b, int64_t ldb,
                 int64_t stride_b, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dtrsm_batch_strided>(cgh, [=]() {
+            trsm_batch_strided<double>(MAJOR, left_right, upper_lower, trans, unit_diag, m, n,
+                                       alpha, accessor_a.get_pointer(), lda, stride_a,
+                                       accessor_b.get_pointer(), ldb, stride_b, batch_size);
+        });
+    });
 }
 
 void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
@@ -307,12 +394,16 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
                 cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda, int64_t stride_a,
                 cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, int64_t stride_b,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ctrsm_batch_strided>(cgh, [=]() {
+            trsm_batch_strided<std::complex<float>>(
+                MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                accessor_a.get_pointer(), lda, stride_a, accessor_b.get_pointer(), ldb, stride_b,
+                batch_size);
+        });
+    });
 }
 
 void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose trans,
@@ -320,36 +411,46 @@ void trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower, trans
                 cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda, int64_t stride_a,
                 cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, int64_t stride_b,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ztrsm_batch_strided>(cgh, [=]() {
+            trsm_batch_strided<std::complex<double>>(
+                MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                accessor_a.get_pointer(), lda, stride_a, accessor_b.get_pointer(), ldb, stride_b,
+                batch_size);
+        });
+    });
 }
 
 void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                 float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda, int64_t stride_a,
                 float beta, cl::sycl::buffer<float, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ssyrk_batch_strided>(cgh, [=]() {
+            syrk_batch_strided<float>(MAJOR, upper_lower, trans, n, k, alpha,
+                                      accessor_a.get_pointer(), lda, stride_a, beta,
+                                      accessor_c.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                 double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda, int64_t stride_a,
                 double beta, cl::sycl::buffer<double, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dsyrk_batch_strided>(cgh, [=]() {
+            syrk_batch_strided<double>(MAJOR, upper_lower, trans, n, k, alpha,
+                                       accessor_a.get_pointer(), lda, stride_a, beta,
+                                       accessor_c.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
@@ -357,12 +458,15 @@ void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64
                 int64_t stride_a, std::complex<float> beta,
                 cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_csyrk_batch_strided>(cgh, [=]() {
+            syrk_batch_strided<std::complex<float>>(
+                MAJOR, upper_lower, trans, n, k, alpha, accessor_a.get_pointer(), lda, stride_a,
+                beta, accessor_c.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
@@ -370,12 +474,15 @@ void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64
                 int64_t lda, int64_t stride_a, std::complex<double> beta,
                 cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zsyrk_batch_strided>(cgh, [=]() {
+            syrk_batch_strided<std::complex<double>>(
+                MAJOR, upper_lower, trans, n, k, alpha, accessor_a.get_pointer(), lda, stride_a,
+                beta, accessor_c.get_pointer(), ldc, stride_c, batch_size);
+        });
+    });
 }
 
 // USM APIs
@@ -383,187 +490,251 @@ void syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64
 cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t *n, const float **x, int64_t *incx,
                            float **y, int64_t *incy, int64_t group_count, int64_t *group_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_scopy_batch_group_usm>(cgh, [=]() {
+            copy_batch_group(n, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t *n, const double **x, int64_t *incx,
                            double **y, int64_t *incy, int64_t group_count, int64_t *group_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dcopy_batch_group_usm>(cgh, [=]() {
+            copy_batch_group(n, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t *n, const std::complex<float> **x,
                            int64_t *incx, std::complex<float> **y, int64_t *incy,
                            int64_t group_count, int64_t *group_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ccopy_batch_group_usm>(cgh, [=]() {
+            copy_batch_group(n, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t *n, const std::complex<double> **x,
                            int64_t *incx, std::complex<double> **y, int64_t *incy,
                            int64_t group_count, int64_t *group_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zcopy_batch_group_usm>(cgh, [=]() {
+            copy_batch_group(n, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t n, const float *x, int64_t incx,
                            std::int64_t stridex, float *y, int64_t incy, std::int64_t stridey,
                            std::int64_t batch_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_scopy_batch_strided_usm>(cgh, [=]() {
+            copy_batch_strided(n, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t n, const double *x, int64_t incx,
                            std::int64_t stridex, double *y, int64_t incy, std::int64_t stridey,
                            std::int64_t batch_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dcopy_batch_strided_usm>(cgh, [=]() {
+            copy_batch_strided(n, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t n, const std::complex<float> *x,
                            int64_t incx, std::int64_t stridex, std::complex<float> *y, int64_t incy,
                            std::int64_t stridey, std::int64_t batch_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ccopy_batch_strided_usm>(cgh, [=]() {
+            copy_batch_strided(n, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event copy_batch(cl::sycl::queue &queue, int64_t n, const std::complex<double> *x,
                            int64_t incx, std::int64_t stridex, std::complex<double> *y,
                            int64_t incy, std::int64_t stridey, std::int64_t batch_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zcopy_batch_strided_usm>(cgh, [=]() {
+            copy_batch_strided(n, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, float *alpha, const float **x,
                            int64_t *incx, float **y, int64_t *incy, int64_t group_count,
                            int64_t *group_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_saxpy_batch_group_usm>(cgh, [=]() {
+            axpy_batch_group(n, alpha, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, double *alpha, const double **x,
                            int64_t *incx, double **y, int64_t *incy, int64_t group_count,
                            int64_t *group_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_daxpy_batch_group_usm>(cgh, [=]() {
+            axpy_batch_group(n, alpha, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, std::complex<float> *alpha,
                            const std::complex<float> **x, int64_t *incx, std::complex<float> **y,
                            int64_t *incy, int64_t group_count, int64_t *group_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_caxpy_batch_group_usm>(cgh, [=]() {
+            axpy_batch_group(n, alpha, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t *n, std::complex<double> *alpha,
                            const std::complex<double> **x, int64_t *incx, std::complex<double> **y,
                            int64_t *incy, int64_t group_count, int64_t *group_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zaxpy_batch_group_usm>(cgh, [=]() {
+            axpy_batch_group(n, alpha, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, float alpha, const float *x,
                            int64_t incx, int64_t stridex, float *y, int64_t incy, int64_t stridey,
                            int64_t batch_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_saxpy_batch_strided_usm>(cgh, [=]() {
+            axpy_batch_strided(n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, double alpha, const double *x,
                            int64_t incx, int64_t stridex, double *y, int64_t incy, int64_t stridey,
                            int64_t batch_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_daxpy_batch_strided_usm>(cgh, [=]() {
+            axpy_batch_strided(n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
                            const std::complex<float> *x, int64_t incx, int64_t stridex,
                            std::complex<float> *y, int64_t incy, int64_t stridey,
                            int64_t batch_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_caxpy_batch_strided_usm>(cgh, [=]() {
+            axpy_batch_strided(n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event axpy_batch(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
                            const std::complex<double> *x, int64_t incx, int64_t stridex,
                            std::complex<double> *y, int64_t incy, int64_t stridey,
                            int64_t batch_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zaxpy_batch_strided_usm>(cgh, [=]() {
+            axpy_batch_strided(n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
@@ -571,12 +742,17 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m,
                            const float *x, int64_t incx, int64_t stride_x, float beta, float *y,
                            int64_t incy, int64_t stride_y, int64_t batch_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemv_batch_strided_usm>(cgh, [=]() {
+            gemv_batch_strided(MAJOR, transa, m, n, alpha, a, lda, stride_a, x, incx, stride_x,
+                               beta, y, incy, stride_y, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
@@ -584,12 +760,17 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m,
                            const double *x, int64_t incx, int64_t stride_x, double beta, double *y,
                            int64_t incy, int64_t stride_y, int64_t batch_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemv_batch_strided_usm>(cgh, [=]() {
+            gemv_batch_strided(MAJOR, transa, m, n, alpha, a, lda, stride_a, x, incx, stride_x,
+                               beta, y, incy, stride_y, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
@@ -598,12 +779,17 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m,
                            int64_t stride_x, std::complex<float> beta, std::complex<float> *y,
                            int64_t incy, int64_t stride_y, int64_t batch_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemv_batch_strided_usm>(cgh, [=]() {
+            gemv_batch_strided(MAJOR, transa, m, n, alpha, a, lda, stride_a, x, incx, stride_x,
+                               beta, y, incy, stride_y, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m, int64_t n,
@@ -612,12 +798,17 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose transa, int64_t m,
                            int64_t stride_x, std::complex<double> beta, std::complex<double> *y,
                            int64_t incy, int64_t stride_y, int64_t batch_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemv_batch_strided_usm>(cgh, [=]() {
+            gemv_batch_strided(MAJOR, transa, m, n, alpha, a, lda, stride_a, x, incx, stride_x,
+                               beta, y, incy, stride_y, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m, int64_t *n,
@@ -625,12 +816,17 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m
                            int64_t *incx, float *beta, float **y, int64_t *incy,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemv_batch_group_usm>(cgh, [=]() {
+            gemv_batch_group(MAJOR, transa, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m, int64_t *n,
@@ -638,12 +834,17 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m
                            int64_t *incx, double *beta, double **y, int64_t *incy,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemv_batch_group_usm>(cgh, [=]() {
+            gemv_batch_group(MAJOR, transa, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m, int64_t *n,
@@ -651,12 +852,17 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m
                            const std::complex<float> **x, int64_t *incx, std::complex<float> *beta,
                            std::complex<float> **y, int64_t *incy, int64_t group_count,
                            int64_t *groupsize, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemv_batch_group_usm>(cgh, [=]() {
+            gemv_batch_group(MAJOR, transa, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m, int64_t *n,
@@ -665,36 +871,51 @@ cl::sycl::event gemv_batch(cl::sycl::queue &queue, transpose *transa, int64_t *m
                            std::complex<double> *beta, std::complex<double> **y, int64_t *incy,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemv_batch_group_usm>(cgh, [=]() {
+            gemv_batch_group(MAJOR, transa, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
                            const float *a, int64_t lda, int64_t stride_a, const float *x,
                            int64_t incx, int64_t stride_x, float *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sdgmm_batch_strided_usm>(cgh, [=]() {
+            dgmm_batch_strided(MAJOR, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                               stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
                            const double *a, int64_t lda, int64_t stride_a, const double *x,
                            int64_t incx, int64_t stride_x, double *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ddgmm_batch_strided_usm>(cgh, [=]() {
+            dgmm_batch_strided(MAJOR, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                               stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
@@ -702,12 +923,17 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, i
                            const std::complex<float> *x, int64_t incx, int64_t stride_x,
                            std::complex<float> *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cdgmm_batch_strided_usm>(cgh, [=]() {
+            dgmm_batch_strided(MAJOR, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                               stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, int64_t n,
@@ -715,36 +941,51 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side left_right, int64_t m, i
                            const std::complex<double> *x, int64_t incx, int64_t stride_x,
                            std::complex<double> *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zdgmm_batch_strided_usm>(cgh, [=]() {
+            dgmm_batch_strided(MAJOR, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                               stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side *left_right, int64_t *m, int64_t *n,
                            const float **a, int64_t *lda, const float **x, int64_t *incx, float **c,
                            int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sdgmm_batch_group_usm>(cgh, [=]() {
+            dgmm_batch_group(MAJOR, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side *left_right, int64_t *m, int64_t *n,
                            const double **a, int64_t *lda, const double **x, int64_t *incx,
                            double **c, int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ddgmm_batch_group_usm>(cgh, [=]() {
+            dgmm_batch_group(MAJOR, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side *left_right, int64_t *m, int64_t *n,
@@ -752,12 +993,17 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side *left_right, int64_t *m,
                            const std::complex<float> **x, int64_t *incx, std::complex<float> **c,
                            int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cdgmm_batch_group_usm>(cgh, [=]() {
+            dgmm_batch_group(MAJOR, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side *left_right, int64_t *m, int64_t *n,
@@ -765,12 +1011,17 @@ cl::sycl::event dgmm_batch(cl::sycl::queue &queue, side *left_right, int64_t *m,
                            const std::complex<double> **x, int64_t *incx, std::complex<double> **c,
                            int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zdgmm_batch_group_usm>(cgh, [=]() {
+            dgmm_batch_group(MAJOR, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -778,12 +1029,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                            const float **b, int64_t *ldb, float *beta, float **c, int64_t *ldc,
                            int64_t group_count, int64_t *group_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_batch_group_usm>(cgh, [=]() {
+            gemm_batch_group(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -791,12 +1047,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                            const double **b, int64_t *ldb, double *beta, double **c, int64_t *ldc,
                            int64_t group_count, int64_t *group_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_batch_group_usm>(cgh, [=]() {
+            gemm_batch_group(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -805,12 +1066,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                            const std::complex<float> **b, int64_t *ldb, std::complex<float> *beta,
                            std::complex<float> **c, int64_t *ldc, int64_t group_count,
                            int64_t *group_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_batch_group_usm>(cgh, [=]() {
+            gemm_batch_group(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -819,12 +1085,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                            const std::complex<double> **b, int64_t *ldb, std::complex<double> *beta,
                            std::complex<double> **c, int64_t *ldc, int64_t group_count,
                            int64_t *group_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_batch_group_usm>(cgh, [=]() {
+            gemm_batch_group(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose *transb, int64_t *m,
@@ -832,12 +1103,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose *transa, transpose
                            const half **b, int64_t *ldb, half *beta, half **c, int64_t *ldc,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_hgemm_batch_group_usm>(cgh, [=]() {
+            gemm_batch_group(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -845,12 +1121,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                            int64_t stride_a, const float *b, int64_t ldb, int64_t stride_b,
                            float beta, float *c, int64_t ldc, int64_t stride_c, int64_t batch_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_batch_strided_usm>(cgh, [=]() {
+            gemm_batch_strided(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -858,12 +1139,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                            int64_t stride_a, const double *b, int64_t ldb, int64_t stride_b,
                            double beta, double *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_batch_strided_usm>(cgh, [=]() {
+            gemm_batch_strided(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -873,12 +1159,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                            std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                            int64_t stride_c, int64_t batch_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_batch_strided_usm>(cgh, [=]() {
+            gemm_batch_strided(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -888,12 +1179,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                            std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                            int64_t stride_c, int64_t batch_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_batch_strided_usm>(cgh, [=]() {
+            gemm_batch_strided(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
@@ -901,12 +1197,17 @@ cl::sycl::event gemm_batch(cl::sycl::queue &queue, transpose transa, transpose t
                            int64_t stride_a, const half *b, int64_t ldb, int64_t stride_b,
                            half beta, half *c, int64_t ldc, int64_t stride_c, int64_t batch_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_hgemm_batch_strided_usm>(cgh, [=]() {
+            gemm_batch_strided(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
@@ -914,12 +1215,17 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_l
                            const float *a, int64_t lda, int64_t stride_a, float *b, int64_t ldb,
                            int64_t stride_b, int64_t batch_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_strsm_batch_strided_usm>(cgh, [=]() {
+            trsm_batch_strided(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                               lda, stride_a, b, ldb, stride_b, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
@@ -927,12 +1233,17 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_l
                            const double *a, int64_t lda, int64_t stride_a, double *b, int64_t ldb,
                            int64_t stride_b, int64_t batch_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dtrsm_batch_strided_usm>(cgh, [=]() {
+            trsm_batch_strided(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                               lda, stride_a, b, ldb, stride_b, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
@@ -940,12 +1251,17 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_l
                            std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
                            int64_t stride_a, std::complex<float> *b, int64_t ldb, int64_t stride_b,
                            int64_t batch_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ctrsm_batch_strided_usm>(cgh, [=]() {
+            trsm_batch_strided(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                               lda, stride_a, b, ldb, stride_b, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_lower,
@@ -953,12 +1269,17 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side left_right, uplo upper_l
                            std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
                            int64_t stride_a, std::complex<double> *b, int64_t ldb, int64_t stride_b,
                            int64_t batch_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ztrsm_batch_strided_usm>(cgh, [=]() {
+            trsm_batch_strided(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a,
+                               lda, stride_a, b, ldb, stride_b, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
@@ -966,12 +1287,17 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper
                            const float **a, int64_t *lda, float **b, int64_t *ldb,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_strsm_batch_group_usm>(cgh, [=]() {
+            trsm_batch_group(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
@@ -979,12 +1305,17 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper
                            const double **a, int64_t *lda, double **b, int64_t *ldb,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dtrsm_batch_group_usm>(cgh, [=]() {
+            trsm_batch_group(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
@@ -992,12 +1323,17 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper
                            std::complex<float> *alpha, const std::complex<float> **a, int64_t *lda,
                            std::complex<float> **b, int64_t *ldb, int64_t group_count,
                            int64_t *groupsize, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ctrsm_batch_group_usm>(cgh, [=]() {
+            trsm_batch_group(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper_lower,
@@ -1006,36 +1342,51 @@ cl::sycl::event trsm_batch(cl::sycl::queue &queue, side *left_right, uplo *upper
                            int64_t *lda, std::complex<double> **b, int64_t *ldb,
                            int64_t group_count, int64_t *groupsize,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ztrsm_batch_group_usm>(cgh, [=]() {
+            trsm_batch_group(MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha, a, lda,
+                             b, ldb, group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo *upper_lower, transpose *trans, int64_t *n,
                            int64_t *k, float *alpha, const float **a, int64_t *lda, float *beta,
                            float **c, int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ssyrk_batch_group_usm>(cgh, [=]() {
+            syrk_batch_group(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo *upper_lower, transpose *trans, int64_t *n,
                            int64_t *k, double *alpha, const double **a, int64_t *lda, double *beta,
                            double **c, int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dsyrk_batch_group_usm>(cgh, [=]() {
+            syrk_batch_group(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo *upper_lower, transpose *trans, int64_t *n,
@@ -1043,12 +1394,17 @@ cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo *upper_lower, transpose
                            int64_t *lda, std::complex<float> *beta, std::complex<float> **c,
                            int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_csyrk_batch_group_usm>(cgh, [=]() {
+            syrk_batch_group(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo *upper_lower, transpose *trans, int64_t *n,
@@ -1056,36 +1412,51 @@ cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo *upper_lower, transpose
                            int64_t *lda, std::complex<double> *beta, std::complex<double> **c,
                            int64_t *ldc, int64_t group_count, int64_t *groupsize,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zsyrk_batch_group_usm>(cgh, [=]() {
+            syrk_batch_group(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                            int64_t k, float alpha, const float *a, int64_t lda, int64_t stride_a,
                            float beta, float *c, int64_t ldc, int64_t stride_c, int64_t batch_size,
                            const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ssyrk_batch_strided_usm>(cgh, [=]() {
+            syrk_batch_strided(MAJOR, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                               ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                            int64_t k, double alpha, const double *a, int64_t lda, int64_t stride_a,
                            double beta, double *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dsyrk_batch_strided_usm>(cgh, [=]() {
+            syrk_batch_strided(MAJOR, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                               ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
@@ -1093,12 +1464,17 @@ cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose t
                            int64_t lda, int64_t stride_a, std::complex<float> beta,
                            std::complex<float> *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_csyrk_batch_strided_usm>(cgh, [=]() {
+            syrk_batch_strided(MAJOR, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                               ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
@@ -1106,10 +1482,15 @@ cl::sycl::event syrk_batch(cl::sycl::queue &queue, uplo upper_lower, transpose t
                            int64_t lda, int64_t stride_a, std::complex<double> beta,
                            std::complex<double> *c, int64_t ldc, int64_t stride_c,
                            int64_t batch_size, const std::vector<cl::sycl::event> &dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zsyrk_batch_strided_usm>(cgh, [=]() {
+            syrk_batch_strided(MAJOR, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                               ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
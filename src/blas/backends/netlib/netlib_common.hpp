@@ -21,11 +21,22 @@
 #define _NETLIB_COMMON_HPP_
 
 #include <CL/sycl.hpp>
+#include <algorithm>
+#include <cmath>
 #include <complex>
-
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+// Netlib CBLAS built with 64-bit integers (cblas64) reads the integer type from CBLAS_INT.
+#if defined(NETLIB_ILP64) && !defined(CBLAS_INT)
+#define CBLAS_INT int64_t
+#endif
 #include "cblas.h"
 
 #include "oneapi/mkl/blas/detail/netlib/onemkl_blas_netlib.hpp"
+#include "oneapi/mkl/exceptions.hpp"
 #include "oneapi/mkl/types.hpp"
 
 namespace oneapi {
@@ -70,6 +81,37 @@ inline CBLAS_OFFSET convert_to_cblas_offset(offset offsetc) {
         return CBLAS_OFFSET::CblasRowOffset;
 }
 
+// Integer type of the CBLAS arguments: int64_t when the backend is built with
+// ENABLE_NETLIB_ILP64 against cblas64, int otherwise.
+#ifdef NETLIB_ILP64
+using cblas_int = int64_t;
+#else
+using cblas_int = int;
+#endif
+
+#ifdef NETLIB_ILP64
+template <typename R, typename N, typename... Args>
+constexpr std::size_t first_argument_size(R (*)(N, Args...)) {
+    return sizeof(N);
+}
+
+// A cblas.h that ignores CBLAS_INT would declare 32-bit integers and the backend would pass them to
+// cblas64 as such.
+static_assert(first_argument_size(&::cblas_ddot) == sizeof(int64_t),
+              "ENABLE_NETLIB_ILP64 needs a cblas.h that declares its integers with CBLAS_INT");
+#endif
+
+// Converts a size, leading dimension or increment to the CBLAS integer type. Values that do not
+// fit throw instead of being truncated.
+inline cblas_int to_cblas_int(int64_t value) {
+#ifndef NETLIB_ILP64
+    if (value > std::numeric_limits<int>::max() || value < std::numeric_limits<int>::min())
+        throw unimplemented("blas", "netlib",
+                            "argument exceeds 32-bit range, build with ENABLE_NETLIB_ILP64");
+#endif
+    return static_cast<cblas_int>(value);
+}
+
 // host_task automatically uses run_on_host_intel if it is supported by the
 //  compiler. Otherwise, it falls back to single_task.
 template <typename K, typename H, typename F>
@@ -87,6 +129,89 @@ static inline void host_task(H &cgh, F f) {
     (void)host_task_internal<K>(cgh, f, 0);
 }
 
+// Reference CBLAS runs on the calling thread, so batched and tiled level 3 routines spread their
+// work over a pool of host threads shared by all calls. The pool has ONEMKL_NETLIB_NUM_THREADS
+// threads, or one per hardware thread when it is not set, counting the calling thread.
+int num_threads();
+
+// Runs f(part) for every part in [0, parts) on the pool and returns when all parts are done. The
+// calling thread runs parts too, so nested and concurrent calls cannot deadlock. The first
+// exception thrown by f is rethrown once all parts have finished.
+void parallel_for(int64_t parts, const std::function<void(int64_t part)> &f);
+
+// Same, using at most threads threads of the pool, counting the calling thread.
+void parallel_for(int64_t parts, int threads, const std::function<void(int64_t part)> &f);
+
+// Smallest estimated cost, in multiply-adds, of the matrices or vectors handed to one thread of a
+// batched routine. Small items are grouped so that scheduling does not dominate the work of a
+// thread.
+constexpr double batch_min_part_cost = 1 << 18;
+
+// Number of threads given count items of total estimated cost.
+inline int64_t batch_parts(int64_t count, double cost) {
+    const double max_parts =
+        std::min<double>({ double(num_threads()), double(count), cost / batch_min_part_cost });
+    return std::max<int64_t>(1, static_cast<int64_t>(max_parts));
+}
+
+// Calls f(begin, end) for consecutive ranges of about equal size covering [0, count), one per
+// thread, for items of cost multiply-adds each.
+template <typename F>
+void parallel_range(int64_t count, double cost, F f) {
+    if (count <= 0)
+        return;
+    const int64_t parts = batch_parts(count, std::max(cost, 1.0) * count);
+    if (parts == 1)
+        f(int64_t(0), count);
+    else
+        parallel_for(parts,
+                     [&](int64_t part) { f(count * part / parts, count * (part + 1) / parts); });
+}
+
+// Calls f(group, index) for each matrix of a batch of group_count groups, where group g holds
+// group_size[g] matrices of cost(g) multiply-adds each and index numbers the matrices of all
+// groups consecutively. The matrices are split into consecutive runs of about equal cost, one per
+// thread.
+template <typename Cost, typename F>
+void parallel_batch(int64_t group_count, const int64_t *group_size, Cost cost, F f) {
+    double total_cost = 0.0;
+    int64_t total_count = 0;
+    for (int64_t g = 0; g < group_count; g++) {
+        total_cost += std::max(cost(g), 1.0) * std::max<int64_t>(group_size[g], 0);
+        total_count += std::max<int64_t>(group_size[g], 0);
+    }
+    const int64_t parts = batch_parts(total_count, total_cost);
+    // Cost at which part p starts. Neighbouring parts compute their common bound the same way, so
+    // every matrix belongs to exactly one part.
+    auto bound = [=](int64_t p) {
+        return p == parts ? std::numeric_limits<double>::infinity() : total_cost * p / parts;
+    };
+    auto run_part = [&](int64_t part) {
+        const double begin = bound(part), end = bound(part + 1);
+        double start = 0.0;
+        int64_t index = 0;
+        for (int64_t g = 0; g < group_count && start < end; g++) {
+            const int64_t count = std::max<int64_t>(group_size[g], 0);
+            const double each = std::max(cost(g), 1.0);
+            // Matrix i of the group starts at start + i * each; this finds the first one starting
+            // at or after the bound.
+            auto first_at = [&](double at) {
+                const double i = std::ceil((at - start) / each);
+                return static_cast<int64_t>(std::min(std::max(i, 0.0), double(count)));
+            };
+            const int64_t first = first_at(begin), last = first_at(end);
+            for (int64_t i = first; i < last; i++)
+                f(g, index + i);
+            start += each * count;
+            index += count;
+        }
+    };
+    if (parts == 1)
+        run_part(0);
+    else
+        parallel_for(parts, run_part);
+}
+
 } // namespace netlib
 } // namespace blas
 } // namespace mkl
@@ -17,11 +17,15 @@
 * SPDX-License-Identifier: Apache-2.0
 *******************************************************************************/
 
+#include <algorithm>
+#include <complex>
+#include <vector>
 #include <CL/sycl.hpp>
 
 #include "netlib_common.hpp"
 #include "oneapi/mkl/blas/detail/netlib/onemkl_blas_netlib.hpp"
 #include "oneapi/mkl/exceptions.hpp"
+#include "scratch_arena.hpp"
 
 namespace oneapi {
 namespace mkl {
@@ -29,15 +33,19 @@ namespace blas {
 namespace netlib {
 namespace column_major {
 
+#define MAJOR CblasColMajor
 #define COLUMN_MAJOR
 #include "netlib_extensions.cxx"
+#undef MAJOR
 #undef COLUMN_MAJOR
 
 } // namespace column_major
 namespace row_major {
 
+#define MAJOR CblasRowMajor
 #define ROW_MAJOR
 #include "netlib_extensions.cxx"
+#undef MAJOR
 #undef ROW_MAJOR
 
 } // namespace row_major
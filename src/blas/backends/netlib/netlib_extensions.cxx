@@ -17,6 +17,123 @@
 * SPDX-License-Identifier: Apache-2.0
 *******************************************************************************/
 
+// Packed gemm: the packed format is alpha * op(X) stored contiguously in the order of the layout,
+// so the packed operand is passed to cblas_?gemm as a non-transposed matrix.
+
+inline void gemm_pack_dims(identifier which, int64_t m, int64_t n, int64_t k, int64_t &rows,
+                           int64_t &cols) {
+    rows = (which == identifier::A) ? m : k;
+    cols = (which == identifier::A) ? k : n;
+}
+
+// Leading dimension of a contiguous rows x cols matrix.
+inline int64_t dense_ld(int64_t rows, int64_t cols) {
+#ifdef COLUMN_MAJOR
+    return std::max<int64_t>(rows, 1);
+#endif
+#ifdef ROW_MAJOR
+    return std::max<int64_t>(cols, 1);
+#endif
+}
+
+template <typename T>
+void gemm_pack_copy(transpose trans, int64_t rows, int64_t cols, T alpha, const T *src, int64_t ld,
+                    T *dest) {
+    const bool nontrans = trans == transpose::nontrans;
+#ifdef COLUMN_MAJOR
+    for (int64_t j = 0; j < cols; j++)
+        for (int64_t i = 0; i < rows; i++)
+            dest[i + j * rows] = alpha * (nontrans ? src[i + j * ld] : src[j + i * ld]);
+#endif
+#ifdef ROW_MAJOR
+    for (int64_t i = 0; i < rows; i++)
+        for (int64_t j = 0; j < cols; j++)
+            dest[j + i * cols] = alpha * (nontrans ? src[j + i * ld] : src[i + j * ld]);
+#endif
+}
+
+// gemm3m: op(A) and op(B) are split into real and imaginary planes, and the product is formed from
+// three real products, Re = Ar * Br - Ai * Bi and Im = (Ar + Ai) * (Br + Bi) - Ar * Br - Ai * Bi.
+
+template <typename T>
+void gemm3m_split(transpose trans, int64_t rows, int64_t cols, const std::complex<T> *src,
+                  int64_t ld, T *re, T *im, T *sum) {
+    const int64_t ldd = dense_ld(rows, cols);
+    const bool nontrans = trans == transpose::nontrans;
+    for (int64_t j = 0; j < cols; j++) {
+        for (int64_t i = 0; i < rows; i++) {
+#ifdef COLUMN_MAJOR
+            std::complex<T> x = nontrans ? src[i + j * ld] : src[j + i * ld];
+            const int64_t idx = i + j * ldd;
+#endif
+#ifdef ROW_MAJOR
+            std::complex<T> x = nontrans ? src[j + i * ld] : src[i + j * ld];
+            const int64_t idx = j + i * ldd;
+#endif
+            if (trans == transpose::conjtrans)
+                x = std::conj(x);
+            re[idx] = x.real();
+            im[idx] = x.imag();
+            sum[idx] = x.real() + x.imag();
+        }
+    }
+}
+
+inline void gemm3m_real(int64_t m, int64_t n, int64_t k, const float *a, const float *b,
+                        float *c) {
+    ::cblas_sgemm(MAJOR, CBLAS_TRANSPOSE::CblasNoTrans, CBLAS_TRANSPOSE::CblasNoTrans,
+                  to_cblas_int(m), to_cblas_int(n), to_cblas_int(k), 1.0f, a,
+                  to_cblas_int(dense_ld(m, k)), b, to_cblas_int(dense_ld(k, n)), 0.0f, c,
+                  to_cblas_int(dense_ld(m, n)));
+}
+
+inline void gemm3m_real(int64_t m, int64_t n, int64_t k, const double *a, const double *b,
+                        double *c) {
+    ::cblas_dgemm(MAJOR, CBLAS_TRANSPOSE::CblasNoTrans, CBLAS_TRANSPOSE::CblasNoTrans,
+                  to_cblas_int(m), to_cblas_int(n), to_cblas_int(k), 1.0, a,
+                  to_cblas_int(dense_ld(m, k)), b, to_cblas_int(dense_ld(k, n)), 0.0, c,
+                  to_cblas_int(dense_ld(m, n)));
+}
+
+template <typename T>
+void gemm3m_host(transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
+                 std::complex<T> alpha, const std::complex<T> *a, int64_t lda,
+                 const std::complex<T> *b, int64_t ldb, std::complex<T> beta, std::complex<T> *c,
+                 int64_t ldc) {
+    if (m <= 0 || n <= 0)
+        return;
+    const int64_t size_a = m * k, size_b = k * n, size_c = m * n;
+    // Every element of the workspace is written by gemm3m_split or gemm3m_real before it is read.
+    oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm3m");
+    T *a_re = scratch.allocate<T>(3 * (size_a + size_b + size_c));
+    T *a_im = a_re + size_a, *a_sum = a_im + size_a;
+    T *b_re = a_sum + size_a, *b_im = b_re + size_b, *b_sum = b_im + size_b;
+    T *t1 = b_sum + size_b, *t2 = t1 + size_c, *t3 = t2 + size_c;
+    gemm3m_split(transa, m, k, a, lda, a_re, a_im, a_sum);
+    gemm3m_split(transb, k, n, b, ldb, b_re, b_im, b_sum);
+    gemm3m_real(m, n, k, a_re, b_re, t1);
+    gemm3m_real(m, n, k, a_im, b_im, t2);
+    gemm3m_real(m, n, k, a_sum, b_sum, t3);
+
+    const int64_t ldt = dense_ld(m, n);
+    const bool beta_zero = beta == std::complex<T>(0);
+    for (int64_t j = 0; j < n; j++) {
+        for (int64_t i = 0; i < m; i++) {
+#ifdef COLUMN_MAJOR
+            const int64_t idx = i + j * ldt;
+            std::complex<T> &c_ij = c[i + j * ldc];
+#endif
+#ifdef ROW_MAJOR
+            const int64_t idx = j + i * ldt;
+            std::complex<T> &c_ij = c[j + i * ldc];
+#endif
+            const std::complex<T> ab(t1[idx] - t2[idx], t3[idx] - t1[idx] - t2[idx]);
+            // As in BLAS, C is not read when beta is zero.
+            c_ij = beta_zero ? alpha * ab : alpha * ab + beta * c_ij;
+        }
+    }
+}
+
 // Buffer APIs
 
 void gemm_bias(cl::sycl::queue &queue, transpose transa, transpose transb, offset offsetc,
@@ -119,6 +236,135 @@ void gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa, transpose
 #endif
 }
 
+template <>
+std::int64_t gemm_pack_get_size<float>(cl::sycl::queue &queue, identifier which, int64_t m,
+                                       int64_t n, int64_t k) {
+    int64_t rows, cols;
+    gemm_pack_dims(which, m, n, k, rows, cols);
+    return rows * cols;
+}
+
+template <>
+std::int64_t gemm_pack_get_size<double>(cl::sycl::queue &queue, identifier which, int64_t m,
+                                        int64_t n, int64_t k) {
+    int64_t rows, cols;
+    gemm_pack_dims(which, m, n, k, rows, cols);
+    return rows * cols;
+}
+
+void gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+               int64_t k, float alpha, cl::sycl::buffer<float, 1> &src, int64_t ld,
+               cl::sycl::buffer<float, 1> &dest) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t rows, cols;
+        gemm_pack_dims(which, m, n, k, rows, cols);
+        auto accessor_src = src.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_dest = dest.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class netlib_sgemm_pack>(cgh, [=]() {
+            gemm_pack_copy(trans, rows, cols, alpha, accessor_src.get_pointer(), ld,
+                           accessor_dest.get_pointer());
+        });
+    });
+}
+
+void gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+               int64_t k, double alpha, cl::sycl::buffer<double, 1> &src, int64_t ld,
+               cl::sycl::buffer<double, 1> &dest) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t rows, cols;
+        gemm_pack_dims(which, m, n, k, rows, cols);
+        auto accessor_src = src.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_dest = dest.get_access<cl::sycl::access::mode::write>(cgh);
+        host_task<class netlib_dgemm_pack>(cgh, [=]() {
+            gemm_pack_copy(trans, rows, cols, alpha, accessor_src.get_pointer(), ld,
+                           accessor_dest.get_pointer());
+        });
+    });
+}
+
+void gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, cl::sycl::buffer<float, 1> &packed, cl::sycl::buffer<float, 1> &other,
+                  int64_t ld, float beta, cl::sycl::buffer<float, 1> &c, int64_t ldc) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t rows, cols;
+        gemm_pack_dims(which, m, n, k, rows, cols);
+        const int64_t ldp = dense_ld(rows, cols);
+        const bool packed_a = which == identifier::A;
+        CBLAS_TRANSPOSE trans_ = convert_to_cblas_trans(trans);
+        CBLAS_TRANSPOSE transa_ = packed_a ? CBLAS_TRANSPOSE::CblasNoTrans : trans_;
+        CBLAS_TRANSPOSE transb_ = packed_a ? trans_ : CBLAS_TRANSPOSE::CblasNoTrans;
+        auto accessor_packed = packed.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_other = other.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgemm_compute>(cgh, [=]() {
+            const float *packed_ = accessor_packed.get_pointer();
+            const float *other_ = accessor_other.get_pointer();
+            ::cblas_sgemm(MAJOR, transa_, transb_, to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(k), 1.0f, packed_a ? packed_ : other_,
+                          to_cblas_int(packed_a ? ldp : ld), packed_a ? other_ : packed_,
+                          to_cblas_int(packed_a ? ld : ldp), (const float)beta,
+                          accessor_c.get_pointer(), to_cblas_int(ldc));
+        });
+    });
+}
+
+void gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m, int64_t n,
+                  int64_t k, cl::sycl::buffer<double, 1> &packed,
+                  cl::sycl::buffer<double, 1> &other, int64_t ld, double beta,
+                  cl::sycl::buffer<double, 1> &c, int64_t ldc) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t rows, cols;
+        gemm_pack_dims(which, m, n, k, rows, cols);
+        const int64_t ldp = dense_ld(rows, cols);
+        const bool packed_a = which == identifier::A;
+        CBLAS_TRANSPOSE trans_ = convert_to_cblas_trans(trans);
+        CBLAS_TRANSPOSE transa_ = packed_a ? CBLAS_TRANSPOSE::CblasNoTrans : trans_;
+        CBLAS_TRANSPOSE transb_ = packed_a ? trans_ : CBLAS_TRANSPOSE::CblasNoTrans;
+        auto accessor_packed = packed.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_other = other.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgemm_compute>(cgh, [=]() {
+            const double *packed_ = accessor_packed.get_pointer();
+            const double *other_ = accessor_other.get_pointer();
+            ::cblas_dgemm(MAJOR, transa_, transb_, to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(k), 1.0, packed_a ? packed_ : other_,
+                          to_cblas_int(packed_a ? ldp : ld), packed_a ? other_ : packed_,
+                          to_cblas_int(packed_a ? ld : ldp), (const double)beta,
+                          accessor_c.get_pointer(), to_cblas_int(ldc));
+        });
+    });
+}
+
+void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+            int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
+            int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb,
+            std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgemm3m>(cgh, [=]() {
+            gemm3m_host(transa, transb, m, n, k, alpha, accessor_a.get_pointer(), lda,
+                        accessor_b.get_pointer(), ldb, beta, accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
+void gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m, int64_t n,
+            int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
+            int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
+            std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    queue.submit([&](cl::sycl::handler &cgh) {
+        auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgemm3m>(cgh, [=]() {
+            gemm3m_host(transa, transb, m, n, k, alpha, accessor_a.get_pointer(), lda,
+                        accessor_b.get_pointer(), ldb, beta, accessor_c.get_pointer(), ldc);
+        });
+    });
+}
+
 // USM APIs
 
 cl::sycl::event gemm_bias(cl::sycl::queue &queue, transpose transa, transpose transb,
@@ -222,3 +468,123 @@ cl::sycl::event gemmt(cl::sycl::queue &queue, uplo upper_lower, transpose transa
     throw unimplemented("blas", "gemmt", "for row_major layout");
 #endif
 }
+
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                          int64_t n, int64_t k, float alpha, const float *src, int64_t ld,
+                          float *dest, const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        int64_t rows, cols;
+        gemm_pack_dims(which, m, n, k, rows, cols);
+        host_task<class netlib_sgemm_pack_usm>(
+            cgh, [=]() { gemm_pack_copy(trans, rows, cols, alpha, src, ld, dest); });
+    });
+    return done;
+}
+
+cl::sycl::event gemm_pack(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                          int64_t n, int64_t k, double alpha, const double *src, int64_t ld,
+                          double *dest, const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        int64_t rows, cols;
+        gemm_pack_dims(which, m, n, k, rows, cols);
+        host_task<class netlib_dgemm_pack_usm>(
+            cgh, [=]() { gemm_pack_copy(trans, rows, cols, alpha, src, ld, dest); });
+    });
+    return done;
+}
+
+cl::sycl::event gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                             int64_t n, int64_t k, const float *packed, const float *other,
+                             int64_t ld, float beta, float *c, int64_t ldc,
+                             const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        int64_t rows, cols;
+        gemm_pack_dims(which, m, n, k, rows, cols);
+        const int64_t ldp = dense_ld(rows, cols);
+        const bool packed_a = which == identifier::A;
+        CBLAS_TRANSPOSE trans_ = convert_to_cblas_trans(trans);
+        CBLAS_TRANSPOSE transa_ = packed_a ? CBLAS_TRANSPOSE::CblasNoTrans : trans_;
+        CBLAS_TRANSPOSE transb_ = packed_a ? trans_ : CBLAS_TRANSPOSE::CblasNoTrans;
+        host_task<class netlib_sgemm_compute_usm>(cgh, [=]() {
+            ::cblas_sgemm(MAJOR, transa_, transb_, to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(k), 1.0f, packed_a ? packed : other,
+                          to_cblas_int(packed_a ? ldp : ld), packed_a ? other : packed,
+                          to_cblas_int(packed_a ? ld : ldp), (const float)beta, c,
+                          to_cblas_int(ldc));
+        });
+    });
+    return done;
+}
+
+cl::sycl::event gemm_compute(cl::sycl::queue &queue, identifier which, transpose trans, int64_t m,
+                             int64_t n, int64_t k, const double *packed, const double *other,
+                             int64_t ld, double beta, double *c, int64_t ldc,
+                             const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        int64_t rows, cols;
+        gemm_pack_dims(which, m, n, k, rows, cols);
+        const int64_t ldp = dense_ld(rows, cols);
+        const bool packed_a = which == identifier::A;
+        CBLAS_TRANSPOSE trans_ = convert_to_cblas_trans(trans);
+        CBLAS_TRANSPOSE transa_ = packed_a ? CBLAS_TRANSPOSE::CblasNoTrans : trans_;
+        CBLAS_TRANSPOSE transb_ = packed_a ? trans_ : CBLAS_TRANSPOSE::CblasNoTrans;
+        host_task<class netlib_dgemm_compute_usm>(cgh, [=]() {
+            ::cblas_dgemm(MAJOR, transa_, transb_, to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(k), 1.0, packed_a ? packed : other,
+                          to_cblas_int(packed_a ? ldp : ld), packed_a ? other : packed,
+                          to_cblas_int(packed_a ? ld : ldp), (const double)beta, c,
+                          to_cblas_int(ldc));
+        });
+    });
+    return done;
+}
+
+cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, std::complex<float> alpha,
+                       const std::complex<float> *a, int64_t lda, const std::complex<float> *b,
+                       int64_t ldb, std::complex<float> beta, std::complex<float> *c, int64_t ldc,
+                       const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm3m_usm>(cgh, [=]() {
+            gemm3m_host(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
+}
+
+cl::sycl::event gemm3m(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
+                       int64_t n, int64_t k, std::complex<double> alpha,
+                       const std::complex<double> *a, int64_t lda, const std::complex<double> *b,
+                       int64_t ldb, std::complex<double> beta, std::complex<double> *c,
+                       int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm3m_usm>(cgh, [=]() {
+            gemm3m_host(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        });
+    });
+    return done;
+}
@@ -39,15 +39,15 @@ inline double abs_val(std::complex<double> val) {
     return std::abs(val.real()) + std::abs(val.imag());
 }
 
-int cblas_isamin(int n, const float *x, int incx) {
+int64_t cblas_isamin(int64_t n, const float *x, int64_t incx) {
     if (n < 1 || incx < 1) {
         return 0;
     }
-    int min_idx = 0;
+    int64_t min_idx = 0;
     auto min_val = abs_val(x[0]);
 
-    for (int logical_i = 0; logical_i < n; ++logical_i) {
-        int i = logical_i * std::abs(incx);
+    for (int64_t logical_i = 0; logical_i < n; ++logical_i) {
+        int64_t i = logical_i * std::abs(incx);
         auto curr_val = abs_val(x[i]);
         bool is_first_nan = std::isnan(curr_val) && !std::isnan(min_val);
         if (is_first_nan || curr_val < min_val) {
@@ -58,15 +58,15 @@ int cblas_isamin(int n, const float *x, int incx) {
     return min_idx;
 }
 
-int cblas_idamin(int n, const double *x, int incx) {
+int64_t cblas_idamin(int64_t n, const double *x, int64_t incx) {
     if (n < 1 || incx < 1) {
         return 0;
     }
-    int min_idx = 0;
+    int64_t min_idx = 0;
     auto min_val = abs_val(x[0]);
 
-    for (int logical_i = 0; logical_i < n; ++logical_i) {
-        int i = logical_i * std::abs(incx);
+    for (int64_t logical_i = 0; logical_i < n; ++logical_i) {
+        int64_t i = logical_i * std::abs(incx);
         auto curr_val = abs_val(x[i]);
         bool is_first_nan = std::isnan(curr_val) && !std::isnan(min_val);
         if (is_first_nan || curr_val < min_val) {
@@ -77,15 +77,15 @@ int cblas_idamin(int n, const double *x, int incx) {
     return min_idx;
 }
 
-int cblas_icamin(int n, const std::complex<float> *x, int incx) {
+int64_t cblas_icamin(int64_t n, const std::complex<float> *x, int64_t incx) {
     if (n < 1 || incx < 1) {
         return 0;
     }
-    int min_idx = 0;
+    int64_t min_idx = 0;
     auto min_val = abs_val(x[0]);
 
-    for (int logical_i = 0; logical_i < n; ++logical_i) {
-        int i = logical_i * std::abs(incx);
+    for (int64_t logical_i = 0; logical_i < n; ++logical_i) {
+        int64_t i = logical_i * std::abs(incx);
         auto curr_val = abs_val(x[i]);
         bool is_first_nan = std::isnan(curr_val) && !std::isnan(min_val);
         if (is_first_nan || curr_val < min_val) {
@@ -96,15 +96,15 @@ int cblas_icamin(int n, const std::complex<float> *x, int incx) {
     return min_idx;
 }
 
-int cblas_izamin(int n, const std::complex<double> *x, int incx) {
+int64_t cblas_izamin(int64_t n, const std::complex<double> *x, int64_t incx) {
     if (n < 1 || incx < 1) {
         return 0;
     }
-    int min_idx = 0;
+    int64_t min_idx = 0;
     auto min_val = abs_val(x[0]);
 
-    for (int logical_i = 0; logical_i < n; ++logical_i) {
-        int i = logical_i * std::abs(incx);
+    for (int64_t logical_i = 0; logical_i < n; ++logical_i) {
+        int64_t i = logical_i * std::abs(incx);
         auto curr_val = abs_val(x[i]);
         bool is_first_nan = std::isnan(curr_val) && !std::isnan(min_val);
         if (is_first_nan || curr_val < min_val) {
@@ -115,24 +115,24 @@ int cblas_izamin(int n, const std::complex<double> *x, int incx) {
     return min_idx;
 }
 
-void cblas_csrot(const int n, std::complex<float> *cx, const int incx, std::complex<float> *cy,
-                 const int incy, const float c, const float s) {
+void cblas_csrot(const int64_t n, std::complex<float> *cx, const int64_t incx,
+                 std::complex<float> *cy, const int64_t incy, const float c, const float s) {
     if (n < 1)
         return;
     if (incx == 1 && incy == 1) {
-        for (int i = 0; i < n; i++) {
+        for (int64_t i = 0; i < n; i++) {
             std::complex<float> ctemp = c * cx[i] + s * cy[i];
             cy[i] = c * cy[i] - s * cx[i];
             cx[i] = ctemp;
         }
     }
     else {
-        int ix = 0, iy = 0;
+        int64_t ix = 0, iy = 0;
         if (incx < 0)
             ix = (-n + 1) * incx;
         if (incy < 0)
             iy = (-n + 1) * incy;
-        for (int i = 0; i < n; i++) {
+        for (int64_t i = 0; i < n; i++) {
             std::complex<float> ctemp = c * cx[ix] + s * cy[iy];
             cy[iy] = c * cy[iy] - s * cx[ix];
             cx[ix] = ctemp;
@@ -142,24 +142,24 @@ void cblas_csrot(const int n, std::complex<float> *cx, const int incx, std::comp
     }
 }
 
-void cblas_zdrot(const int n, std::complex<double> *zx, const int incx, std::complex<double> *zy,
-                 const int incy, const double c, const double s) {
+void cblas_zdrot(const int64_t n, std::complex<double> *zx, const int64_t incx,
+                 std::complex<double> *zy, const int64_t incy, const double c, const double s) {
     if (n < 1)
         return;
     if (incx == 1 && incy == 1) {
-        for (int i = 0; i < n; i++) {
+        for (int64_t i = 0; i < n; i++) {
             std::complex<double> ctemp = c * zx[i] + s * zy[i];
             zy[i] = c * zy[i] - s * zx[i];
             zx[i] = ctemp;
         }
     }
     else {
-        int ix = 0, iy = 0;
+        int64_t ix = 0, iy = 0;
         if (incx < 0)
             ix = (-n + 1) * incx;
         if (incy < 0)
             iy = (-n + 1) * incy;
-        for (int i = 0; i < n; i++) {
+        for (int64_t i = 0; i < n; i++) {
             std::complex<double> ctemp = c * zx[ix] + s * zy[iy];
             zy[iy] = c * zy[iy] - s * zx[ix];
             zx[ix] = ctemp;
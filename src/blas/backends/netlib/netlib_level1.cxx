@@ -25,8 +25,8 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_sasum>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_sasum((const int)n, accessor_x.get_pointer(), (const int)std::abs(incx));
+            accessor_result[0] = ::cblas_sasum(to_cblas_int(n), accessor_x.get_pointer(),
+                                               to_cblas_int(std::abs(incx)));
         });
     });
 }
@@ -37,8 +37,8 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_dasum>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_dasum((const int)n, accessor_x.get_pointer(), (const int)std::abs(incx));
+            accessor_result[0] = ::cblas_dasum(to_cblas_int(n), accessor_x.get_pointer(),
+                                               to_cblas_int(std::abs(incx)));
         });
     });
 }
@@ -49,8 +49,8 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_scasum>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_scasum((const int)n, accessor_x.get_pointer(), (const int)std::abs(incx));
+            accessor_result[0] = ::cblas_scasum(to_cblas_int(n), accessor_x.get_pointer(),
+                                                to_cblas_int(std::abs(incx)));
         });
     });
 }
@@ -61,8 +61,8 @@ void asum(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_dzasum>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_dzasum((const int)n, accessor_x.get_pointer(), (const int)std::abs(incx));
+            accessor_result[0] = ::cblas_dzasum(to_cblas_int(n), accessor_x.get_pointer(),
+                                                to_cblas_int(std::abs(incx)));
         });
     });
 }
@@ -73,8 +73,8 @@ void axpy(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_saxpy>(cgh, [=]() {
-            ::cblas_saxpy((const int)n, (const float)alpha, accessor_x.get_pointer(),
-                          (const int)incx, accessor_y.get_pointer(), (const int)incy);
+            ::cblas_saxpy(to_cblas_int(n), (const float)alpha, accessor_x.get_pointer(),
+                          to_cblas_int(incx), accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -85,8 +85,8 @@ void axpy(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<doub
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_daxpy>(cgh, [=]() {
-            ::cblas_daxpy((const int)n, (const double)alpha, accessor_x.get_pointer(),
-                          (const int)incx, accessor_y.get_pointer(), (const int)incy);
+            ::cblas_daxpy(to_cblas_int(n), (const double)alpha, accessor_x.get_pointer(),
+                          to_cblas_int(incx), accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -98,8 +98,8 @@ void axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_caxpy>(cgh, [=]() {
-            ::cblas_caxpy((const int)n, (const void *)&alpha, accessor_x.get_pointer(),
-                          (const int)incx, accessor_y.get_pointer(), (const int)incy);
+            ::cblas_caxpy(to_cblas_int(n), (const void *)&alpha, accessor_x.get_pointer(),
+                          to_cblas_int(incx), accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -111,8 +111,8 @@ void axpy(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zaxpy>(cgh, [=]() {
-            ::cblas_zaxpy((const int)n, (const void *)&alpha, accessor_x.get_pointer(),
-                          (const int)incx, accessor_y.get_pointer(), (const int)incy);
+            ::cblas_zaxpy(to_cblas_int(n), (const void *)&alpha, accessor_x.get_pointer(),
+                          to_cblas_int(incx), accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -165,8 +165,8 @@ void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_scopy>(cgh, [=]() {
-            ::cblas_scopy((const int)n, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_scopy(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -177,8 +177,8 @@ void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dcopy>(cgh, [=]() {
-            ::cblas_dcopy((const int)n, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_dcopy(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -189,8 +189,8 @@ void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ccopy>(cgh, [=]() {
-            ::cblas_ccopy((const int)n, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_ccopy(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -201,8 +201,8 @@ void copy(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zcopy>(cgh, [=]() {
-            ::cblas_zcopy((const int)n, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_zcopy(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -214,9 +214,9 @@ void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_sdot>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_sdot((const int)n, accessor_x.get_pointer(), (const int)incx,
-                             accessor_y.get_pointer(), (const int)incy);
+            accessor_result[0] = ::cblas_sdot(to_cblas_int(n), accessor_x.get_pointer(),
+                                              to_cblas_int(incx), accessor_y.get_pointer(),
+                                              to_cblas_int(incy));
         });
     });
 }
@@ -228,9 +228,9 @@ void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int6
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_ddot>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_ddot((const int)n, accessor_x.get_pointer(), (const int)incx,
-                             accessor_y.get_pointer(), (const int)incy);
+            accessor_result[0] = ::cblas_ddot(to_cblas_int(n), accessor_x.get_pointer(),
+                                              to_cblas_int(incx), accessor_y.get_pointer(),
+                                              to_cblas_int(incy));
         });
     });
 }
@@ -242,9 +242,9 @@ void dot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_dsdot>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_dsdot((const int)n, accessor_x.get_pointer(), (const int)incx,
-                              accessor_y.get_pointer(), (const int)incy);
+            accessor_result[0] = ::cblas_dsdot(to_cblas_int(n), accessor_x.get_pointer(),
+                                               to_cblas_int(incx), accessor_y.get_pointer(),
+                                               to_cblas_int(incy));
         });
     });
 }
@@ -257,8 +257,8 @@ void dotc(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_cdotc>(cgh, [=]() {
-            ::cblas_cdotc_sub((const int)n, accessor_x.get_pointer(), (const int)incx,
-                              accessor_y.get_pointer(), (const int)incy,
+            ::cblas_cdotc_sub(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                              accessor_y.get_pointer(), to_cblas_int(incy),
                               accessor_result.get_pointer());
         });
     });
@@ -272,8 +272,8 @@ void dotc(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zdotc>(cgh, [=]() {
-            ::cblas_zdotc_sub((const int)n, accessor_x.get_pointer(), (const int)incx,
-                              accessor_y.get_pointer(), (const int)incy,
+            ::cblas_zdotc_sub(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                              accessor_y.get_pointer(), to_cblas_int(incy),
                               accessor_result.get_pointer());
         });
     });
@@ -287,8 +287,8 @@ void dotu(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_cdotu>(cgh, [=]() {
-            ::cblas_cdotu_sub((const int)n, accessor_x.get_pointer(), (const int)incx,
-                              accessor_y.get_pointer(), (const int)incy,
+            ::cblas_cdotu_sub(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                              accessor_y.get_pointer(), to_cblas_int(incy),
                               accessor_result.get_pointer());
         });
     });
@@ -302,8 +302,8 @@ void dotu(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zdotu>(cgh, [=]() {
-            ::cblas_zdotu_sub((const int)n, accessor_x.get_pointer(), (const int)incx,
-                              accessor_y.get_pointer(), (const int)incy,
+            ::cblas_zdotu_sub(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                              accessor_y.get_pointer(), to_cblas_int(incy),
                               accessor_result.get_pointer());
         });
     });
@@ -315,7 +315,7 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_isamin>(cgh, [=]() {
-            accessor_result[0] = ::cblas_isamin((int)n, accessor_x.get_pointer(), (int)incx);
+            accessor_result[0] = ::cblas_isamin(n, accessor_x.get_pointer(), incx);
         });
     });
 }
@@ -326,7 +326,7 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, in
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.template get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_idamin>(cgh, [=]() {
-            accessor_result[0] = ::cblas_idamin((int)n, accessor_x.get_pointer(), (int)incx);
+            accessor_result[0] = ::cblas_idamin(n, accessor_x.get_pointer(), incx);
         });
     });
 }
@@ -337,7 +337,7 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<floa
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_icamin>(cgh, [=]() {
-            accessor_result[0] = ::cblas_icamin((int)n, accessor_x.get_pointer(), (int)incx);
+            accessor_result[0] = ::cblas_icamin(n, accessor_x.get_pointer(), incx);
         });
     });
 }
@@ -348,7 +348,7 @@ void iamin(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doub
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_izamin>(cgh, [=]() {
-            accessor_result[0] = ::cblas_izamin((int)n, accessor_x.get_pointer(), (int)incx);
+            accessor_result[0] = ::cblas_izamin(n, accessor_x.get_pointer(), incx);
         });
     });
 }
@@ -359,7 +359,8 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_isamax>(cgh, [=]() {
-            accessor_result[0] = ::cblas_isamax((int)n, accessor_x.get_pointer(), (int)incx);
+            accessor_result[0] = ::cblas_isamax(to_cblas_int(n), accessor_x.get_pointer(),
+                                                to_cblas_int(incx));
         });
     });
 }
@@ -370,7 +371,8 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, in
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_idamax>(cgh, [=]() {
-            accessor_result[0] = ::cblas_idamax((int)n, accessor_x.get_pointer(), (int)incx);
+            accessor_result[0] = ::cblas_idamax(to_cblas_int(n), accessor_x.get_pointer(),
+                                                to_cblas_int(incx));
         });
     });
 }
@@ -381,7 +383,8 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<floa
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_icamax>(cgh, [=]() {
-            accessor_result[0] = ::cblas_icamax((int)n, accessor_x.get_pointer(), (int)incx);
+            accessor_result[0] = ::cblas_icamax(to_cblas_int(n), accessor_x.get_pointer(),
+                                                to_cblas_int(incx));
         });
     });
 }
@@ -392,7 +395,8 @@ void iamax(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doub
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_izamax>(cgh, [=]() {
-            accessor_result[0] = ::cblas_izamax((int)n, accessor_x.get_pointer(), (int)incx);
+            accessor_result[0] = ::cblas_izamax(to_cblas_int(n), accessor_x.get_pointer(),
+                                                to_cblas_int(incx));
         });
     });
 }
@@ -403,8 +407,8 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
         auto accessor_x = x.template get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.template get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_snrm2>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_snrm2((const int)n, accessor_x.get_pointer(), (const int)std::abs(incx));
+            accessor_result[0] = ::cblas_snrm2(to_cblas_int(n), accessor_x.get_pointer(),
+                                               to_cblas_int(std::abs(incx)));
         });
     });
 }
@@ -415,8 +419,8 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_dnrm2>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_dnrm2((const int)n, accessor_x.get_pointer(), (const int)std::abs(incx));
+            accessor_result[0] = ::cblas_dnrm2(to_cblas_int(n), accessor_x.get_pointer(),
+                                               to_cblas_int(std::abs(incx)));
         });
     });
 }
@@ -427,8 +431,8 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_scnrm2>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_scnrm2((const int)n, accessor_x.get_pointer(), (const int)std::abs(incx));
+            accessor_result[0] = ::cblas_scnrm2(to_cblas_int(n), accessor_x.get_pointer(),
+                                                to_cblas_int(std::abs(incx)));
         });
     });
 }
@@ -439,8 +443,8 @@ void nrm2(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_dznrm2>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_dznrm2((const int)n, accessor_x.get_pointer(), (const int)std::abs(incx));
+            accessor_result[0] = ::cblas_dznrm2(to_cblas_int(n), accessor_x.get_pointer(),
+                                                to_cblas_int(std::abs(incx)));
         });
     });
 }
@@ -451,8 +455,9 @@ void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int64
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_srot>(cgh, [=]() {
-            ::cblas_srot((const int)n, accessor_x.get_pointer(), (const int)incx,
-                         accessor_y.get_pointer(), (const int)incy, (const float)c, (const float)s);
+            ::cblas_srot(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                         accessor_y.get_pointer(), to_cblas_int(incy), (const float)c,
+                         (const float)s);
         });
     });
 }
@@ -463,8 +468,9 @@ void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int6
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_drot>(cgh, [=]() {
-            ::cblas_drot((const int)n, accessor_x.get_pointer(), (const int)incx,
-                         accessor_y.get_pointer(), (const int)incy, (const float)c, (const float)s);
+            ::cblas_drot(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                         accessor_y.get_pointer(), to_cblas_int(incy), (const float)c,
+                         (const float)s);
         });
     });
 }
@@ -476,9 +482,8 @@ void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float>
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_csrot>(cgh, [=]() {
-            ::cblas_csrot((const int)n, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy, (const float)c,
-                          (const float)s);
+            ::cblas_csrot(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
+                          (const float)c, (const float)s);
         });
     });
 }
@@ -490,9 +495,8 @@ void rot(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<double
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zdrot>(cgh, [=]() {
-            ::cblas_zdrot((const int)n, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy, (const double)c,
-                          (const double)s);
+            ::cblas_zdrot(n, accessor_x.get_pointer(), incx, accessor_y.get_pointer(), incy,
+                          (const double)c, (const double)s);
         });
     });
 }
@@ -562,8 +566,9 @@ void rotm(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_param = param.get_access<cl::sycl::access::mode::read>(cgh);
         host_task<class netlib_srotm>(cgh, [=]() {
-            ::cblas_srotm((const int)n, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy, accessor_param.get_pointer());
+            ::cblas_srotm(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy),
+                          accessor_param.get_pointer());
         });
     });
 }
@@ -575,8 +580,9 @@ void rotm(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_param = param.get_access<cl::sycl::access::mode::read>(cgh);
         host_task<class netlib_drotm>(cgh, [=]() {
-            ::cblas_drotm((const int)n, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy, accessor_param.get_pointer());
+            ::cblas_drotm(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy),
+                          accessor_param.get_pointer());
         });
     });
 }
@@ -614,8 +620,8 @@ void scal(cl::sycl::queue &queue, int64_t n, float alpha, cl::sycl::buffer<float
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_sscal>(cgh, [=]() {
-            ::cblas_sscal((const int)n, (const float)alpha, accessor_x.get_pointer(),
-                          (const int)std::abs(incx));
+            ::cblas_sscal(to_cblas_int(n), (const float)alpha, accessor_x.get_pointer(),
+                          to_cblas_int(std::abs(incx)));
         });
     });
 }
@@ -625,8 +631,8 @@ void scal(cl::sycl::queue &queue, int64_t n, double alpha, cl::sycl::buffer<doub
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dscal>(cgh, [=]() {
-            ::cblas_dscal((const int)n, (const double)alpha, accessor_x.get_pointer(),
-                          (const int)std::abs(incx));
+            ::cblas_dscal(to_cblas_int(n), (const double)alpha, accessor_x.get_pointer(),
+                          to_cblas_int(std::abs(incx)));
         });
     });
 }
@@ -636,8 +642,8 @@ void scal(cl::sycl::queue &queue, int64_t n, std::complex<float> alpha,
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_cscal>(cgh, [=]() {
-            ::cblas_cscal((const int)n, (const void *)&alpha, accessor_x.get_pointer(),
-                          (const int)std::abs(incx));
+            ::cblas_cscal(to_cblas_int(n), (const void *)&alpha, accessor_x.get_pointer(),
+                          to_cblas_int(std::abs(incx)));
         });
     });
 }
@@ -647,8 +653,8 @@ void scal(cl::sycl::queue &queue, int64_t n, float alpha,
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_csscal>(cgh, [=]() {
-            ::cblas_csscal((const int)n, (const float)alpha, accessor_x.get_pointer(),
-                           (const int)std::abs(incx));
+            ::cblas_csscal(to_cblas_int(n), (const float)alpha, accessor_x.get_pointer(),
+                           to_cblas_int(std::abs(incx)));
         });
     });
 }
@@ -658,8 +664,8 @@ void scal(cl::sycl::queue &queue, int64_t n, std::complex<double> alpha,
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zscal>(cgh, [=]() {
-            ::cblas_zscal((const int)n, (const void *)&alpha, accessor_x.get_pointer(),
-                          (const int)std::abs(incx));
+            ::cblas_zscal(to_cblas_int(n), (const void *)&alpha, accessor_x.get_pointer(),
+                          to_cblas_int(std::abs(incx)));
         });
     });
 }
@@ -669,8 +675,8 @@ void scal(cl::sycl::queue &queue, int64_t n, double alpha,
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zdscal>(cgh, [=]() {
-            ::cblas_zdscal((const int)n, (const double)alpha, accessor_x.get_pointer(),
-                           (const int)std::abs(incx));
+            ::cblas_zdscal(to_cblas_int(n), (const double)alpha, accessor_x.get_pointer(),
+                           to_cblas_int(std::abs(incx)));
         });
     });
 }
@@ -683,9 +689,9 @@ void sdsdot(cl::sycl::queue &queue, int64_t n, float sb, cl::sycl::buffer<float,
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_result = result.get_access<cl::sycl::access::mode::write>(cgh);
         host_task<class netlib_sdsdot>(cgh, [=]() {
-            accessor_result[0] =
-                ::cblas_sdsdot((const int)n, (const float)sb, accessor_x.get_pointer(),
-                               (const int)incx, accessor_y.get_pointer(), (const int)incy);
+            accessor_result[0] = ::cblas_sdsdot(to_cblas_int(n), (const float)sb,
+                                                accessor_x.get_pointer(), to_cblas_int(incx),
+                                                accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -696,8 +702,8 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<float, 1> &x, int6
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_sswap>(cgh, [=]() {
-            ::cblas_sswap((const int)n, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_sswap(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -708,8 +714,8 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<double, 1> &x, int
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dswap>(cgh, [=]() {
-            ::cblas_dswap((const int)n, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_dswap(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -720,8 +726,8 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<float
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_cswap>(cgh, [=]() {
-            ::cblas_cswap((const int)n, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_cswap(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -732,8 +738,8 @@ void swap(cl::sycl::queue &queue, int64_t n, cl::sycl::buffer<std::complex<doubl
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zswap>(cgh, [=]() {
-            ::cblas_zswap((const int)n, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_zswap(to_cblas_int(n), accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -748,7 +754,8 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sasum_usm>(
-            cgh, [=]() { result[0] = ::cblas_sasum((const int)n, x, (const int)std::abs(incx)); });
+            cgh, [=]() { result[0] = ::cblas_sasum(to_cblas_int(n), x,
+                                                   to_cblas_int(std::abs(incx))); });
     });
     return done;
 }
@@ -761,7 +768,8 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dasum_usm>(
-            cgh, [=]() { result[0] = ::cblas_dasum((const int)n, x, (const int)std::abs(incx)); });
+            cgh, [=]() { result[0] = ::cblas_dasum(to_cblas_int(n), x,
+                                                   to_cblas_int(std::abs(incx))); });
     });
     return done;
 }
@@ -774,7 +782,8 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<float
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_scasum_usm>(
-            cgh, [=]() { result[0] = ::cblas_scasum((const int)n, x, (const int)std::abs(incx)); });
+            cgh, [=]() { result[0] = ::cblas_scasum(to_cblas_int(n), x,
+                                                    to_cblas_int(std::abs(incx))); });
     });
     return done;
 }
@@ -787,7 +796,8 @@ cl::sycl::event asum(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dzasum_usm>(
-            cgh, [=]() { result[0] = ::cblas_dzasum((const int)n, x, (const int)std::abs(incx)); });
+            cgh, [=]() { result[0] = ::cblas_dzasum(to_cblas_int(n), x,
+                                                    to_cblas_int(std::abs(incx))); });
     });
     return done;
 }
@@ -800,7 +810,8 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, float alpha, const float
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_saxpy_usm>(cgh, [=]() {
-            ::cblas_saxpy((const int)n, (const float)alpha, x, (const int)incx, y, (const int)incy);
+            ::cblas_saxpy(to_cblas_int(n), (const float)alpha, x, to_cblas_int(incx), y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -814,8 +825,8 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, double alpha, const doub
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_daxpy_usm>(cgh, [=]() {
-            ::cblas_daxpy((const int)n, (const double)alpha, x, (const int)incx, y,
-                          (const int)incy);
+            ::cblas_daxpy(to_cblas_int(n), (const double)alpha, x, to_cblas_int(incx), y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -830,8 +841,8 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<float> alph
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_caxpy_usm>(cgh, [=]() {
-            ::cblas_caxpy((const int)n, (const void *)&alpha, x, (const int)incx, y,
-                          (const int)incy);
+            ::cblas_caxpy(to_cblas_int(n), (const void *)&alpha, x, to_cblas_int(incx), y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -846,8 +857,70 @@ cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, std::complex<double> alp
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zaxpy_usm>(cgh, [=]() {
-            ::cblas_zaxpy((const int)n, (const void *)&alpha, x, (const int)incx, y,
-                          (const int)incy);
+            ::cblas_zaxpy(to_cblas_int(n), (const void *)&alpha, x, to_cblas_int(incx), y,
+                          to_cblas_int(incy));
+        });
+    });
+    return done;
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const float *alpha, const float *x,
+                     int64_t incx, float *y, int64_t incy,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_saxpy_ptr_usm>(cgh, [=]() {
+            ::cblas_saxpy(to_cblas_int(n), *alpha, x, to_cblas_int(incx), y, to_cblas_int(incy));
+        });
+    });
+    return done;
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const double *alpha, const double *x,
+                     int64_t incx, double *y, int64_t incy,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_daxpy_ptr_usm>(cgh, [=]() {
+            ::cblas_daxpy(to_cblas_int(n), *alpha, x, to_cblas_int(incx), y, to_cblas_int(incy));
+        });
+    });
+    return done;
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                     const std::complex<float> *x, int64_t incx, std::complex<float> *y,
+                     int64_t incy, const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_caxpy_ptr_usm>(cgh, [=]() {
+            ::cblas_caxpy(to_cblas_int(n), (const void *)alpha, x, to_cblas_int(incx), y,
+                          to_cblas_int(incy));
+        });
+    });
+    return done;
+}
+
+cl::sycl::event axpy(cl::sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                     const std::complex<double> *x, int64_t incx, std::complex<double> *y,
+                     int64_t incy, const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zaxpy_ptr_usm>(cgh, [=]() {
+            ::cblas_zaxpy(to_cblas_int(n), (const void *)alpha, x, to_cblas_int(incx), y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -907,7 +980,8 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_scopy_usm>(
-            cgh, [=]() { ::cblas_scopy((const int)n, x, (const int)incx, y, (const int)incy); });
+            cgh, [=]() { ::cblas_scopy(to_cblas_int(n), x, to_cblas_int(incx), y,
+                                       to_cblas_int(incy)); });
     });
     return done;
 }
@@ -920,7 +994,8 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dcopy_usm>(
-            cgh, [=]() { ::cblas_dcopy((const int)n, x, (const int)incx, y, (const int)incy); });
+            cgh, [=]() { ::cblas_dcopy(to_cblas_int(n), x, to_cblas_int(incx), y,
+                                       to_cblas_int(incy)); });
     });
     return done;
 }
@@ -934,7 +1009,8 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<float
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ccopy_usm>(
-            cgh, [=]() { ::cblas_ccopy((const int)n, x, (const int)incx, y, (const int)incy); });
+            cgh, [=]() { ::cblas_ccopy(to_cblas_int(n), x, to_cblas_int(incx), y,
+                                       to_cblas_int(incy)); });
     });
     return done;
 }
@@ -948,7 +1024,8 @@ cl::sycl::event copy(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zcopy_usm>(
-            cgh, [=]() { ::cblas_zcopy((const int)n, x, (const int)incx, y, (const int)incy); });
+            cgh, [=]() { ::cblas_zcopy(to_cblas_int(n), x, to_cblas_int(incx), y,
+                                       to_cblas_int(incy)); });
     });
     return done;
 }
@@ -961,7 +1038,7 @@ cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t i
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sdot_usm>(cgh, [=]() {
-            result[0] = ::cblas_sdot((const int)n, x, (const int)incx, y, (const int)incy);
+            result[0] = ::cblas_sdot(to_cblas_int(n), x, to_cblas_int(incx), y, to_cblas_int(incy));
         });
     });
     return done;
@@ -976,7 +1053,7 @@ cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ddot_usm>(cgh, [=]() {
-            result[0] = ::cblas_ddot((const int)n, x, (const int)incx, y, (const int)incy);
+            result[0] = ::cblas_ddot(to_cblas_int(n), x, to_cblas_int(incx), y, to_cblas_int(incy));
         });
     });
     return done;
@@ -991,7 +1068,8 @@ cl::sycl::event dot(cl::sycl::queue &queue, int64_t n, const float *x, int64_t i
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dsdot_usm>(cgh, [=]() {
-            result[0] = ::cblas_dsdot((const int)n, x, (const int)incx, y, (const int)incy);
+            result[0] = ::cblas_dsdot(to_cblas_int(n), x, to_cblas_int(incx), y,
+                                      to_cblas_int(incy));
         });
     });
     return done;
@@ -1006,7 +1084,8 @@ cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<float
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_cdotc_usm>(cgh, [=]() {
-            ::cblas_cdotc_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
+            ::cblas_cdotc_sub(to_cblas_int(n), x, to_cblas_int(incx), y, to_cblas_int(incy),
+                              result);
         });
     });
     return done;
@@ -1021,7 +1100,8 @@ cl::sycl::event dotc(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zdotc_usm>(cgh, [=]() {
-            ::cblas_zdotc_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
+            ::cblas_zdotc_sub(to_cblas_int(n), x, to_cblas_int(incx), y, to_cblas_int(incy),
+                              result);
         });
     });
     return done;
@@ -1036,7 +1116,8 @@ cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<float
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_cdotu_usm>(cgh, [=]() {
-            ::cblas_cdotu_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
+            ::cblas_cdotu_sub(to_cblas_int(n), x, to_cblas_int(incx), y, to_cblas_int(incy),
+                              result);
         });
     });
     return done;
@@ -1051,7 +1132,8 @@ cl::sycl::event dotu(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zdotu_usm>(cgh, [=]() {
-            ::cblas_zdotu_sub((const int)n, x, (const int)incx, y, (const int)incy, result);
+            ::cblas_zdotu_sub(to_cblas_int(n), x, to_cblas_int(incx), y, to_cblas_int(incy),
+                              result);
         });
     });
     return done;
@@ -1064,8 +1146,7 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_isamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_isamin((int)n, x, (int)incx); });
+        host_task<class netlib_isamin_usm>(cgh, [=]() { result[0] = ::cblas_isamin(n, x, incx); });
     });
     return done;
 }
@@ -1077,8 +1158,7 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const double *x, int64_
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_idamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_idamin((const int)n, x, (const int)incx); });
+        host_task<class netlib_idamin_usm>(cgh, [=]() { result[0] = ::cblas_idamin(n, x, incx); });
     });
     return done;
 }
@@ -1090,8 +1170,7 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<floa
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_icamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_icamin((int)n, x, (int)incx); });
+        host_task<class netlib_icamin_usm>(cgh, [=]() { result[0] = ::cblas_icamin(n, x, incx); });
     });
     return done;
 }
@@ -1104,8 +1183,7 @@ cl::sycl::event iamin(cl::sycl::queue &queue, int64_t n, const std::complex<doub
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_izamin_usm>(
-            cgh, [=]() { result[0] = ::cblas_izamin((int)n, x, (int)incx); });
+        host_task<class netlib_izamin_usm>(cgh, [=]() { result[0] = ::cblas_izamin(n, x, incx); });
     });
     return done;
 }
@@ -1118,7 +1196,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_isamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_isamax((int)n, x, (int)incx); });
+            cgh, [=]() { result[0] = ::cblas_isamax(to_cblas_int(n), x, to_cblas_int(incx)); });
     });
     return done;
 }
@@ -1131,7 +1209,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const double *x, int64_
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_idamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_idamax((int)n, x, (int)incx); });
+            cgh, [=]() { result[0] = ::cblas_idamax(to_cblas_int(n), x, to_cblas_int(incx)); });
     });
     return done;
 }
@@ -1144,7 +1222,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<floa
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_icamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_icamax((int)n, x, (int)incx); });
+            cgh, [=]() { result[0] = ::cblas_icamax(to_cblas_int(n), x, to_cblas_int(incx)); });
     });
     return done;
 }
@@ -1158,7 +1236,7 @@ cl::sycl::event iamax(cl::sycl::queue &queue, int64_t n, const std::complex<doub
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_izamax_usm>(
-            cgh, [=]() { result[0] = ::cblas_izamax((int)n, x, (int)incx); });
+            cgh, [=]() { result[0] = ::cblas_izamax(to_cblas_int(n), x, to_cblas_int(incx)); });
     });
     return done;
 }
@@ -1171,7 +1249,8 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const float *x, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_snrm2_usm>(
-            cgh, [=]() { result[0] = ::cblas_snrm2((const int)n, x, (const int)std::abs(incx)); });
+            cgh, [=]() { result[0] = ::cblas_snrm2(to_cblas_int(n), x,
+                                                   to_cblas_int(std::abs(incx))); });
     });
     return done;
 }
@@ -1184,7 +1263,8 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const double *x, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dnrm2_usm>(
-            cgh, [=]() { result[0] = ::cblas_dnrm2((const int)n, x, (const int)std::abs(incx)); });
+            cgh, [=]() { result[0] = ::cblas_dnrm2(to_cblas_int(n), x,
+                                                   to_cblas_int(std::abs(incx))); });
     });
     return done;
 }
@@ -1197,7 +1277,8 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<float
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_scnrm2_usm>(
-            cgh, [=]() { result[0] = ::cblas_scnrm2((const int)n, x, (const int)std::abs(incx)); });
+            cgh, [=]() { result[0] = ::cblas_scnrm2(to_cblas_int(n), x,
+                                                    to_cblas_int(std::abs(incx))); });
     });
     return done;
 }
@@ -1210,7 +1291,8 @@ cl::sycl::event nrm2(cl::sycl::queue &queue, int64_t n, const std::complex<doubl
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dznrm2_usm>(
-            cgh, [=]() { result[0] = ::cblas_dznrm2((const int)n, x, (const int)std::abs(incx)); });
+            cgh, [=]() { result[0] = ::cblas_dznrm2(to_cblas_int(n), x,
+                                                    to_cblas_int(std::abs(incx))); });
     });
     return done;
 }
@@ -1224,8 +1306,8 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx, f
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_srot_usm>(cgh, [=]() {
-            ::cblas_srot((const int)n, x, (const int)incx, y, (const int)incy, (const float)c,
-                         (const float)s);
+            ::cblas_srot(to_cblas_int(n), x, to_cblas_int(incx), y, to_cblas_int(incy),
+                         (const float)c, (const float)s);
         });
     });
     return done;
@@ -1240,8 +1322,8 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx,
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_drot_usm>(cgh, [=]() {
-            ::cblas_drot((const int)n, x, (const int)incx, y, (const int)incy, (const float)c,
-                         (const float)s);
+            ::cblas_drot(to_cblas_int(n), x, to_cblas_int(incx), y, to_cblas_int(incy),
+                         (const float)c, (const float)s);
         });
     });
     return done;
@@ -1256,8 +1338,7 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<float> *x, i
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_csrot_usm>(cgh, [=]() {
-            ::cblas_csrot((const int)n, x, (const int)incx, y, (const int)incy, (const float)c,
-                          (const float)s);
+            ::cblas_csrot(n, x, incx, y, incy, (const float)c, (const float)s);
         });
     });
     return done;
@@ -1272,8 +1353,7 @@ cl::sycl::event rot(cl::sycl::queue &queue, int64_t n, std::complex<double> *x,
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zdrot_usm>(cgh, [=]() {
-            ::cblas_zdrot((const int)n, x, (const int)incx, y, (const int)incy, (const double)c,
-                          (const double)s);
+            ::cblas_zdrot(n, x, incx, y, incy, (const double)c, (const double)s);
         });
     });
     return done;
@@ -1337,7 +1417,7 @@ cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx,
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_srotm_usm>(cgh, [=]() {
-            ::cblas_srotm((const int)n, x, (const int)incx, y, (const int)incy, param);
+            ::cblas_srotm(to_cblas_int(n), x, to_cblas_int(incx), y, to_cblas_int(incy), param);
         });
     });
     return done;
@@ -1352,7 +1432,7 @@ cl::sycl::event rotm(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx,
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_drotm_usm>(cgh, [=]() {
-            ::cblas_drotm((const int)n, x, (const int)incx, y, (const int)incy, param);
+            ::cblas_drotm(to_cblas_int(n), x, to_cblas_int(incx), y, to_cblas_int(incy), param);
         });
     });
     return done;
@@ -1392,7 +1472,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, float *x, i
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sscal_usm>(cgh, [=]() {
-            ::cblas_sscal((const int)n, (const float)alpha, x, (const int)std::abs(incx));
+            ::cblas_sscal(to_cblas_int(n), (const float)alpha, x, to_cblas_int(std::abs(incx)));
         });
     });
     return done;
@@ -1406,7 +1486,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, double *x,
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dscal_usm>(cgh, [=]() {
-            ::cblas_dscal((const int)n, (const double)alpha, x, (const int)std::abs(incx));
+            ::cblas_dscal(to_cblas_int(n), (const double)alpha, x, to_cblas_int(std::abs(incx)));
         });
     });
     return done;
@@ -1421,7 +1501,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<float> alph
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_cscal_usm>(cgh, [=]() {
-            ::cblas_cscal((const int)n, (const void *)&alpha, x, (const int)std::abs(incx));
+            ::cblas_cscal(to_cblas_int(n), (const void *)&alpha, x, to_cblas_int(std::abs(incx)));
         });
     });
     return done;
@@ -1435,7 +1515,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, float alpha, std::comple
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_csscal_usm>(cgh, [=]() {
-            ::cblas_csscal((const int)n, (const float)alpha, x, (const int)std::abs(incx));
+            ::cblas_csscal(to_cblas_int(n), (const float)alpha, x, to_cblas_int(std::abs(incx)));
         });
     });
     return done;
@@ -1450,7 +1530,7 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, std::complex<double> alp
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zscal_usm>(cgh, [=]() {
-            ::cblas_zscal((const int)n, (const void *)&alpha, x, (const int)std::abs(incx));
+            ::cblas_zscal(to_cblas_int(n), (const void *)&alpha, x, to_cblas_int(std::abs(incx)));
         });
     });
     return done;
@@ -1464,7 +1544,95 @@ cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, double alpha, std::compl
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zdscal_usm>(cgh, [=]() {
-            ::cblas_zdscal((const int)n, (const double)alpha, x, (const int)std::abs(incx));
+            ::cblas_zdscal(to_cblas_int(n), (const double)alpha, x, to_cblas_int(std::abs(incx)));
+        });
+    });
+    return done;
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const float *alpha, float *x,
+                     int64_t incx, const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sscal_ptr_usm>(cgh, [=]() {
+            ::cblas_sscal(to_cblas_int(n), *alpha, x, to_cblas_int(std::abs(incx)));
+        });
+    });
+    return done;
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const double *alpha, double *x,
+                     int64_t incx, const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dscal_ptr_usm>(cgh, [=]() {
+            ::cblas_dscal(to_cblas_int(n), *alpha, x, to_cblas_int(std::abs(incx)));
+        });
+    });
+    return done;
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const std::complex<float> *alpha,
+                     std::complex<float> *x, int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cscal_ptr_usm>(cgh, [=]() {
+            ::cblas_cscal(to_cblas_int(n), (const void *)alpha, x, to_cblas_int(std::abs(incx)));
+        });
+    });
+    return done;
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const float *alpha,
+                     std::complex<float> *x, int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_csscal_ptr_usm>(cgh, [=]() {
+            ::cblas_csscal(to_cblas_int(n), *alpha, x, to_cblas_int(std::abs(incx)));
+        });
+    });
+    return done;
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const std::complex<double> *alpha,
+                     std::complex<double> *x, int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zscal_ptr_usm>(cgh, [=]() {
+            ::cblas_zscal(to_cblas_int(n), (const void *)alpha, x, to_cblas_int(std::abs(incx)));
+        });
+    });
+    return done;
+}
+
+cl::sycl::event scal(cl::sycl::queue &queue, int64_t n, const double *alpha,
+                     std::complex<double> *x, int64_t incx,
+                     const std::vector<cl::sycl::event> &dependencies) {
+    auto done = queue.submit([&](cl::sycl::handler &cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zdscal_ptr_usm>(cgh, [=]() {
+            ::cblas_zdscal(to_cblas_int(n), *alpha, x, to_cblas_int(std::abs(incx)));
         });
     });
     return done;
@@ -1479,8 +1647,8 @@ cl::sycl::event sdsdot(cl::sycl::queue &queue, int64_t n, float sb, const float
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sdsdot_usm>(cgh, [=]() {
-            result[0] = ::cblas_sdsdot((const int)n, (const float)sb, x, (const int)incx, y,
-                                       (const int)incy);
+            result[0] = ::cblas_sdsdot(to_cblas_int(n), (const float)sb, x, to_cblas_int(incx), y,
+                                       to_cblas_int(incy));
         });
     });
     return done;
@@ -1494,7 +1662,8 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, float *x, int64_t incx,
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sswap_usm>(
-            cgh, [=]() { ::cblas_sswap((const int)n, x, (const int)incx, y, (const int)incy); });
+            cgh, [=]() { ::cblas_sswap(to_cblas_int(n), x, to_cblas_int(incx), y,
+                                       to_cblas_int(incy)); });
     });
     return done;
 }
@@ -1507,7 +1676,8 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, double *x, int64_t incx,
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dswap_usm>(
-            cgh, [=]() { ::cblas_dswap((const int)n, x, (const int)incx, y, (const int)incy); });
+            cgh, [=]() { ::cblas_dswap(to_cblas_int(n), x, to_cblas_int(incx), y,
+                                       to_cblas_int(incy)); });
     });
     return done;
 }
@@ -1521,7 +1691,8 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, std::complex<float> *x,
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_cswap_usm>(
-            cgh, [=]() { ::cblas_cswap((const int)n, x, (const int)incx, y, (const int)incy); });
+            cgh, [=]() { ::cblas_cswap(to_cblas_int(n), x, to_cblas_int(incx), y,
+                                       to_cblas_int(incy)); });
     });
     return done;
 }
@@ -1535,7 +1706,8 @@ cl::sycl::event swap(cl::sycl::queue &queue, int64_t n, std::complex<double> *x,
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zswap_usm>(
-            cgh, [=]() { ::cblas_zswap((const int)n, x, (const int)incx, y, (const int)incy); });
+            cgh, [=]() { ::cblas_zswap(to_cblas_int(n), x, to_cblas_int(incx), y,
+                                       to_cblas_int(incy)); });
     });
     return done;
 }
@@ -27,11 +27,11 @@ void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_sgbmv>(cgh, [=]() {
-            ::cblas_sgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const float)alpha,
-                          accessor_a.get_pointer(), (const int)lda, accessor_x.get_pointer(),
-                          (const int)incx, (const float)beta, accessor_y.get_pointer(),
-                          (const int)incy);
+            ::cblas_sgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const float)alpha,
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx), (const float)beta, accessor_y.get_pointer(),
+                          to_cblas_int(incy));
         });
     });
 }
@@ -44,11 +44,11 @@ void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dgbmv>(cgh, [=]() {
-            ::cblas_dgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const double)alpha,
-                          accessor_a.get_pointer(), (const int)lda, accessor_x.get_pointer(),
-                          (const int)incx, (const double)beta, accessor_y.get_pointer(),
-                          (const int)incy);
+            ::cblas_dgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const double)alpha,
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx), (const double)beta, accessor_y.get_pointer(),
+                          to_cblas_int(incy));
         });
     });
 }
@@ -62,11 +62,11 @@ void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_cgbmv>(cgh, [=]() {
-            ::cblas_cgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const void *)&alpha,
-                          accessor_a.get_pointer(), (const int)lda, accessor_x.get_pointer(),
-                          (const int)incx, (const void *)&beta, accessor_y.get_pointer(),
-                          (const int)incy);
+            ::cblas_cgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const void *)&alpha,
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx), (const void *)&beta, accessor_y.get_pointer(),
+                          to_cblas_int(incy));
         });
     });
 }
@@ -80,11 +80,11 @@ void gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, int64_t
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zgbmv>(cgh, [=]() {
-            ::cblas_zgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const void *)&alpha,
-                          accessor_a.get_pointer(), (const int)lda, accessor_x.get_pointer(),
-                          (const int)incx, (const void *)&beta, accessor_y.get_pointer(),
-                          (const int)incy);
+            ::cblas_zgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const void *)&alpha,
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx), (const void *)&beta, accessor_y.get_pointer(),
+                          to_cblas_int(incy));
         });
     });
 }
@@ -97,10 +97,10 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, float a
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_sgemv>(cgh, [=]() {
-            ::cblas_sgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const float)alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_x.get_pointer(), (const int)incx, (const float)beta,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_sgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const float)alpha, accessor_a.get_pointer(), to_cblas_int(lda),
+                          accessor_x.get_pointer(), to_cblas_int(incx), (const float)beta,
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -113,10 +113,10 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, double
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dgemv>(cgh, [=]() {
-            ::cblas_dgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const double)alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_x.get_pointer(), (const int)incx, (const double)beta,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_dgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const double)alpha, accessor_a.get_pointer(), to_cblas_int(lda),
+                          accessor_x.get_pointer(), to_cblas_int(incx), (const double)beta,
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -130,10 +130,10 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::co
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_cgemv>(cgh, [=]() {
-            ::cblas_cgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_x.get_pointer(), (const int)incx, (const void *)&beta,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_cgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const void *)&alpha, accessor_a.get_pointer(), to_cblas_int(lda),
+                          accessor_x.get_pointer(), to_cblas_int(incx), (const void *)&beta,
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -147,10 +147,10 @@ void gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t n, std::co
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zgemv>(cgh, [=]() {
-            ::cblas_zgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_x.get_pointer(), (const int)incx, (const void *)&beta,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_zgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const void *)&alpha, accessor_a.get_pointer(), to_cblas_int(lda),
+                          accessor_x.get_pointer(), to_cblas_int(incx), (const void *)&beta,
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -163,9 +163,9 @@ void ger(cl::sycl::queue &queue, int64_t m, int64_t n, float alpha, cl::sycl::bu
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_sger>(cgh, [=]() {
-            ::cblas_sger(MAJOR, (const int)m, (const int)n, (const float)alpha,
-                         accessor_x.get_pointer(), (const int)incx, accessor_y.get_pointer(),
-                         (const int)incy, accessor_a.get_pointer(), (const int)lda);
+            ::cblas_sger(MAJOR, to_cblas_int(m), to_cblas_int(n), (const float)alpha,
+                         accessor_x.get_pointer(), to_cblas_int(incx), accessor_y.get_pointer(),
+                         to_cblas_int(incy), accessor_a.get_pointer(), to_cblas_int(lda));
         });
     });
 }
@@ -178,9 +178,9 @@ void ger(cl::sycl::queue &queue, int64_t m, int64_t n, double alpha, cl::sycl::b
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dger>(cgh, [=]() {
-            ::cblas_dger(MAJOR, (const int)m, (const int)n, (const double)alpha,
-                         accessor_x.get_pointer(), (const int)incx, accessor_y.get_pointer(),
-                         (const int)incy, accessor_a.get_pointer(), (const int)lda);
+            ::cblas_dger(MAJOR, to_cblas_int(m), to_cblas_int(n), (const double)alpha,
+                         accessor_x.get_pointer(), to_cblas_int(incx), accessor_y.get_pointer(),
+                         to_cblas_int(incy), accessor_a.get_pointer(), to_cblas_int(lda));
         });
     });
 }
@@ -194,9 +194,9 @@ void gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alph
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_cgerc>(cgh, [=]() {
-            ::cblas_cgerc(MAJOR, (const int)m, (const int)n, (const void *)&alpha,
-                          accessor_x.get_pointer(), (const int)incx, accessor_y.get_pointer(),
-                          (const int)incy, accessor_a.get_pointer(), (const int)lda);
+            ::cblas_cgerc(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void *)&alpha,
+                          accessor_x.get_pointer(), to_cblas_int(incx), accessor_y.get_pointer(),
+                          to_cblas_int(incy), accessor_a.get_pointer(), to_cblas_int(lda));
         });
     });
 }
@@ -210,9 +210,9 @@ void gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alp
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zgerc>(cgh, [=]() {
-            ::cblas_zgerc(MAJOR, (const int)m, (const int)n, (const void *)&alpha,
-                          accessor_x.get_pointer(), (const int)incx, accessor_y.get_pointer(),
-                          (const int)incy, accessor_a.get_pointer(), (const int)lda);
+            ::cblas_zgerc(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void *)&alpha,
+                          accessor_x.get_pointer(), to_cblas_int(incx), accessor_y.get_pointer(),
+                          to_cblas_int(incy), accessor_a.get_pointer(), to_cblas_int(lda));
         });
     });
 }
@@ -226,9 +226,9 @@ void geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<float> alph
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_cgeru>(cgh, [=]() {
-            ::cblas_cgeru(MAJOR, (const int)m, (const int)n, (const void *)&alpha,
-                          accessor_x.get_pointer(), (const int)incx, accessor_y.get_pointer(),
-                          (const int)incy, accessor_a.get_pointer(), (const int)lda);
+            ::cblas_cgeru(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void *)&alpha,
+                          accessor_x.get_pointer(), to_cblas_int(incx), accessor_y.get_pointer(),
+                          to_cblas_int(incy), accessor_a.get_pointer(), to_cblas_int(lda));
         });
     });
 }
@@ -242,9 +242,9 @@ void geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<double> alp
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zgeru>(cgh, [=]() {
-            ::cblas_zgeru(MAJOR, (const int)m, (const int)n, (const void *)&alpha,
-                          accessor_x.get_pointer(), (const int)incx, accessor_y.get_pointer(),
-                          (const int)incy, accessor_a.get_pointer(), (const int)lda);
+            ::cblas_zgeru(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void *)&alpha,
+                          accessor_x.get_pointer(), to_cblas_int(incx), accessor_y.get_pointer(),
+                          to_cblas_int(incy), accessor_a.get_pointer(), to_cblas_int(lda));
         });
     });
 }
@@ -258,10 +258,10 @@ void hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, std::c
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_chbmv>(cgh, [=]() {
-            ::cblas_chbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_x.get_pointer(), (const int)incx, (const void *)&beta,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_chbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const void *)&alpha, accessor_a.get_pointer(),
+                          to_cblas_int(lda), accessor_x.get_pointer(), to_cblas_int(incx),
+                          (const void *)&beta, accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -275,10 +275,10 @@ void hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zhbmv>(cgh, [=]() {
-            ::cblas_zhbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_x.get_pointer(), (const int)incx, (const void *)&beta,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_zhbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const void *)&alpha, accessor_a.get_pointer(),
+                          to_cblas_int(lda), accessor_x.get_pointer(), to_cblas_int(incx),
+                          (const void *)&beta, accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -292,10 +292,10 @@ void hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_chemv>(cgh, [=]() {
-            ::cblas_chemv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_x.get_pointer(), (const int)incx, (const void *)&beta,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_chemv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void *)&alpha, accessor_a.get_pointer(), to_cblas_int(lda),
+                          accessor_x.get_pointer(), to_cblas_int(incx), (const void *)&beta,
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -309,10 +309,10 @@ void hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zhemv>(cgh, [=]() {
-            ::cblas_zhemv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_x.get_pointer(), (const int)incx, (const void *)&beta,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_zhemv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void *)&alpha, accessor_a.get_pointer(), to_cblas_int(lda),
+                          accessor_x.get_pointer(), to_cblas_int(incx), (const void *)&beta,
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -324,9 +324,9 @@ void her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_cher>(cgh, [=]() {
-            ::cblas_cher(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, accessor_x.get_pointer(), (const int)incx,
-                         accessor_a.get_pointer(), (const int)lda);
+            ::cblas_cher(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, accessor_x.get_pointer(), to_cblas_int(incx),
+                         accessor_a.get_pointer(), to_cblas_int(lda));
         });
     });
 }
@@ -338,9 +338,9 @@ void her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zher>(cgh, [=]() {
-            ::cblas_zher(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, accessor_x.get_pointer(), (const int)incx,
-                         accessor_a.get_pointer(), (const int)lda);
+            ::cblas_zher(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, accessor_x.get_pointer(), to_cblas_int(incx),
+                         accessor_a.get_pointer(), to_cblas_int(lda));
         });
     });
 }
@@ -354,10 +354,10 @@ void her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_cher2>(cgh, [=]() {
-            ::cblas_cher2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void *)&alpha, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy, accessor_a.get_pointer(),
-                          (const int)lda);
+            ::cblas_cher2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void *)&alpha, accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy), accessor_a.get_pointer(),
+                          to_cblas_int(lda));
         });
     });
 }
@@ -371,10 +371,10 @@ void her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zher2>(cgh, [=]() {
-            ::cblas_zher2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void *)&alpha, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy, accessor_a.get_pointer(),
-                          (const int)lda);
+            ::cblas_zher2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void *)&alpha, accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy), accessor_a.get_pointer(),
+                          to_cblas_int(lda));
         });
     });
 }
@@ -388,10 +388,10 @@ void hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_chpmv>(cgh, [=]() {
-            ::cblas_chpmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
+            ::cblas_chpmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
                           (const void *)&alpha, accessor_ap.get_pointer(), accessor_x.get_pointer(),
-                          (const int)incx, (const void *)&beta, accessor_y.get_pointer(),
-                          (const int)incy);
+                          to_cblas_int(incx), (const void *)&beta, accessor_y.get_pointer(),
+                          to_cblas_int(incy));
         });
     });
 }
@@ -405,10 +405,10 @@ void hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zhpmv>(cgh, [=]() {
-            ::cblas_zhpmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
+            ::cblas_zhpmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
                           (const void *)&alpha, accessor_ap.get_pointer(), accessor_x.get_pointer(),
-                          (const int)incx, (const void *)&beta, accessor_y.get_pointer(),
-                          (const int)incy);
+                          to_cblas_int(incx), (const void *)&beta, accessor_y.get_pointer(),
+                          to_cblas_int(incy));
         });
     });
 }
@@ -420,8 +420,8 @@ void hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_chpr>(cgh, [=]() {
-            ::cblas_chpr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, accessor_x.get_pointer(), (const int)incx,
+            ::cblas_chpr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, accessor_x.get_pointer(), to_cblas_int(incx),
                          accessor_ap.get_pointer());
         });
     });
@@ -434,8 +434,8 @@ void hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zhpr>(cgh, [=]() {
-            ::cblas_zhpr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, accessor_x.get_pointer(), (const int)incx,
+            ::cblas_zhpr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, accessor_x.get_pointer(), to_cblas_int(incx),
                          accessor_ap.get_pointer());
         });
     });
@@ -450,9 +450,9 @@ void hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<floa
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_chpr2>(cgh, [=]() {
-            ::cblas_chpr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void *)&alpha, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy, accessor_ap.get_pointer());
+            ::cblas_chpr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void *)&alpha, accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy), accessor_ap.get_pointer());
         });
     });
 }
@@ -466,9 +466,9 @@ void hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::complex<doub
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zhpr2>(cgh, [=]() {
-            ::cblas_zhpr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void *)&alpha, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy, accessor_ap.get_pointer());
+            ::cblas_zhpr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void *)&alpha, accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy), accessor_ap.get_pointer());
         });
     });
 }
@@ -481,10 +481,10 @@ void sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, float
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ssbmv>(cgh, [=]() {
-            ::cblas_ssbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const float)alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_x.get_pointer(), (const int)incx, (const float)beta,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_ssbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const float)alpha, accessor_a.get_pointer(),
+                          to_cblas_int(lda), accessor_x.get_pointer(), to_cblas_int(incx),
+                          (const float)beta, accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -497,10 +497,10 @@ void sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_t k, double
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dsbmv>(cgh, [=]() {
-            ::cblas_dsbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const double)alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_x.get_pointer(), (const int)incx, (const double)beta,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_dsbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const double)alpha, accessor_a.get_pointer(),
+                          to_cblas_int(lda), accessor_x.get_pointer(), to_cblas_int(incx),
+                          (const double)beta, accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -513,10 +513,10 @@ void spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_sspmv>(cgh, [=]() {
-            ::cblas_sspmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
+            ::cblas_sspmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
                           (const float)alpha, accessor_ap.get_pointer(), accessor_x.get_pointer(),
-                          (const int)incx, (const float)beta, accessor_y.get_pointer(),
-                          (const int)incy);
+                          to_cblas_int(incx), (const float)beta, accessor_y.get_pointer(),
+                          to_cblas_int(incy));
         });
     });
 }
@@ -529,10 +529,10 @@ void spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dspmv>(cgh, [=]() {
-            ::cblas_dspmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
+            ::cblas_dspmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
                           (const double)alpha, accessor_ap.get_pointer(), accessor_x.get_pointer(),
-                          (const int)incx, (const double)beta, accessor_y.get_pointer(),
-                          (const int)incy);
+                          to_cblas_int(incx), (const double)beta, accessor_y.get_pointer(),
+                          to_cblas_int(incy));
         });
     });
 }
@@ -543,8 +543,8 @@ void spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_sspr>(cgh, [=]() {
-            ::cblas_sspr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, accessor_x.get_pointer(), (const int)incx,
+            ::cblas_sspr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, accessor_x.get_pointer(), to_cblas_int(incx),
                          accessor_ap.get_pointer());
         });
     });
@@ -556,8 +556,8 @@ void spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dspr>(cgh, [=]() {
-            ::cblas_dspr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, accessor_x.get_pointer(), (const int)incx,
+            ::cblas_dspr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, accessor_x.get_pointer(), to_cblas_int(incx),
                          accessor_ap.get_pointer());
         });
     });
@@ -571,9 +571,9 @@ void spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_sspr2>(cgh, [=]() {
-            ::cblas_sspr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const float)alpha, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy, accessor_ap.get_pointer());
+            ::cblas_sspr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const float)alpha, accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy), accessor_ap.get_pointer());
         });
     });
 }
@@ -586,9 +586,9 @@ void spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dspr2>(cgh, [=]() {
-            ::cblas_dspr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const double)alpha, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy, accessor_ap.get_pointer());
+            ::cblas_dspr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const double)alpha, accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy), accessor_ap.get_pointer());
         });
     });
 }
@@ -601,10 +601,10 @@ void symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ssymv>(cgh, [=]() {
-            ::cblas_ssymv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const float)alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_x.get_pointer(), (const int)incx, (const float)beta,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_ssymv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const float)alpha, accessor_a.get_pointer(), to_cblas_int(lda),
+                          accessor_x.get_pointer(), to_cblas_int(incx), (const float)beta,
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -617,10 +617,10 @@ void symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dsymv>(cgh, [=]() {
-            ::cblas_dsymv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const double)alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_x.get_pointer(), (const int)incx, (const double)beta,
-                          accessor_y.get_pointer(), (const int)incy);
+            ::cblas_dsymv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const double)alpha, accessor_a.get_pointer(), to_cblas_int(lda),
+                          accessor_x.get_pointer(), to_cblas_int(incx), (const double)beta,
+                          accessor_y.get_pointer(), to_cblas_int(incy));
         });
     });
 }
@@ -631,9 +631,9 @@ void syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ssyr>(cgh, [=]() {
-            ::cblas_ssyr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, accessor_x.get_pointer(), (const int)incx,
-                         accessor_a.get_pointer(), (const int)lda);
+            ::cblas_ssyr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, accessor_x.get_pointer(), to_cblas_int(incx),
+                         accessor_a.get_pointer(), to_cblas_int(lda));
         });
     });
 }
@@ -645,9 +645,9 @@ void syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_x = x.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dsyr>(cgh, [=]() {
-            ::cblas_dsyr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, accessor_x.get_pointer(), (const int)incx,
-                         accessor_a.get_pointer(), (const int)lda);
+            ::cblas_dsyr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, accessor_x.get_pointer(), to_cblas_int(incx),
+                         accessor_a.get_pointer(), to_cblas_int(lda));
         });
     });
 }
@@ -660,10 +660,10 @@ void syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float alpha,
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ssyr2>(cgh, [=]() {
-            ::cblas_ssyr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const float)alpha, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy, accessor_a.get_pointer(),
-                          (const int)lda);
+            ::cblas_ssyr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const float)alpha, accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy), accessor_a.get_pointer(),
+                          to_cblas_int(lda));
         });
     });
 }
@@ -676,10 +676,10 @@ void syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double alpha,
         auto accessor_y = y.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dsyr2>(cgh, [=]() {
-            ::cblas_dsyr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const double)alpha, accessor_x.get_pointer(), (const int)incx,
-                          accessor_y.get_pointer(), (const int)incy, accessor_a.get_pointer(),
-                          (const int)lda);
+            ::cblas_dsyr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const double)alpha, accessor_x.get_pointer(), to_cblas_int(incx),
+                          accessor_y.get_pointer(), to_cblas_int(incy), accessor_a.get_pointer(),
+                          to_cblas_int(lda));
         });
     });
 }
@@ -692,9 +692,9 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_stbmv>(cgh, [=]() {
             ::cblas_stbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.get_pointer(), (const int)lda, accessor_x.get_pointer(),
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -707,9 +707,9 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dtbmv>(cgh, [=]() {
             ::cblas_dtbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.get_pointer(), (const int)lda, accessor_x.get_pointer(),
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -722,9 +722,9 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ctbmv>(cgh, [=]() {
             ::cblas_ctbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.get_pointer(), (const int)lda, accessor_x.get_pointer(),
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -737,9 +737,9 @@ void tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ztbmv>(cgh, [=]() {
             ::cblas_ztbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.get_pointer(), (const int)lda, accessor_x.get_pointer(),
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -752,9 +752,9 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_stbsv>(cgh, [=]() {
             ::cblas_stbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.get_pointer(), (const int)lda, accessor_x.get_pointer(),
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -767,9 +767,9 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dtbsv>(cgh, [=]() {
             ::cblas_dtbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.get_pointer(), (const int)lda, accessor_x.get_pointer(),
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -782,9 +782,9 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ctbsv>(cgh, [=]() {
             ::cblas_ctbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.get_pointer(), (const int)lda, accessor_x.get_pointer(),
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -797,9 +797,9 @@ void tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ztbsv>(cgh, [=]() {
             ::cblas_ztbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.get_pointer(), (const int)lda, accessor_x.get_pointer(),
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -811,8 +811,8 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_stpmv>(cgh, [=]() {
             ::cblas_stpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.get_pointer(),
-                          accessor_x.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.get_pointer(), accessor_x.get_pointer(), to_cblas_int(incx));
         });
     });
 }
@@ -824,8 +824,8 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dtpmv>(cgh, [=]() {
             ::cblas_dtpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.get_pointer(),
-                          accessor_x.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.get_pointer(), accessor_x.get_pointer(), to_cblas_int(incx));
         });
     });
 }
@@ -838,8 +838,8 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ctpmv>(cgh, [=]() {
             ::cblas_ctpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.get_pointer(),
-                          accessor_x.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.get_pointer(), accessor_x.get_pointer(), to_cblas_int(incx));
         });
     });
 }
@@ -852,8 +852,8 @@ void tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ztpmv>(cgh, [=]() {
             ::cblas_ztpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.get_pointer(),
-                          accessor_x.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.get_pointer(), accessor_x.get_pointer(), to_cblas_int(incx));
         });
     });
 }
@@ -865,8 +865,8 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_stpsv>(cgh, [=]() {
             ::cblas_stpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.get_pointer(),
-                          accessor_x.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.get_pointer(), accessor_x.get_pointer(), to_cblas_int(incx));
         });
     });
 }
@@ -878,8 +878,8 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dtpsv>(cgh, [=]() {
             ::cblas_dtpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.get_pointer(),
-                          accessor_x.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.get_pointer(), accessor_x.get_pointer(), to_cblas_int(incx));
         });
     });
 }
@@ -892,8 +892,8 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ctpsv>(cgh, [=]() {
             ::cblas_ctpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.get_pointer(),
-                          accessor_x.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.get_pointer(), accessor_x.get_pointer(), to_cblas_int(incx));
         });
     });
 }
@@ -906,8 +906,8 @@ void tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ztpsv>(cgh, [=]() {
             ::cblas_ztpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.get_pointer(),
-                          accessor_x.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.get_pointer(), accessor_x.get_pointer(), to_cblas_int(incx));
         });
     });
 }
@@ -919,8 +919,9 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_strmv>(cgh, [=]() {
             ::cblas_strmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.get_pointer(),
-                          (const int)lda, accessor_b.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_b.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -933,8 +934,9 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dtrmv>(cgh, [=]() {
             ::cblas_dtrmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.get_pointer(),
-                          (const int)lda, accessor_b.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_b.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -947,8 +949,9 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ctrmv>(cgh, [=]() {
             ::cblas_ctrmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.get_pointer(),
-                          (const int)lda, accessor_b.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_b.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -961,8 +964,9 @@ void trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa, diag unit_
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ztrmv>(cgh, [=]() {
             ::cblas_ztrmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.get_pointer(),
-                          (const int)lda, accessor_b.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_b.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -974,8 +978,9 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_strsv>(cgh, [=]() {
             ::cblas_strsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.get_pointer(),
-                          (const int)lda, accessor_x.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -988,8 +993,9 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dtrsv>(cgh, [=]() {
             ::cblas_dtrsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.get_pointer(),
-                          (const int)lda, accessor_x.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -1002,8 +1008,9 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ctrsv>(cgh, [=]() {
             ::cblas_ctrsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.get_pointer(),
-                          (const int)lda, accessor_x.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -1016,8 +1023,9 @@ void trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans, diag unit_d
         auto accessor_x = x.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ztrsv>(cgh, [=]() {
             ::cblas_ztrsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.get_pointer(),
-                          (const int)lda, accessor_x.get_pointer(), (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.get_pointer(), to_cblas_int(lda), accessor_x.get_pointer(),
+                          to_cblas_int(incx));
         });
     });
 }
@@ -1034,9 +1042,10 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sgbmv_usm>(cgh, [=]() {
-            ::cblas_sgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const float)alpha, a, (const int)lda, x,
-                          (const int)incx, (const float)beta, y, (const int)incy);
+            ::cblas_sgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const float)alpha, a,
+                          to_cblas_int(lda), x, to_cblas_int(incx), (const float)beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1052,9 +1061,10 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dgbmv_usm>(cgh, [=]() {
-            ::cblas_dgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const double)alpha, a, (const int)lda, x,
-                          (const int)incx, (const double)beta, y, (const int)incy);
+            ::cblas_dgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const double)alpha, a,
+                          to_cblas_int(lda), x, to_cblas_int(incx), (const double)beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1071,9 +1081,10 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_cgbmv_usm>(cgh, [=]() {
-            ::cblas_cgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const void *)&alpha, a, (const int)lda, x,
-                          (const int)incx, (const void *)&beta, y, (const int)incy);
+            ::cblas_cgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const void *)&alpha, a,
+                          to_cblas_int(lda), x, to_cblas_int(incx), (const void *)&beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1090,9 +1101,10 @@ cl::sycl::event gbmv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zgbmv_usm>(cgh, [=]() {
-            ::cblas_zgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const void *)&alpha, a, (const int)lda, x,
-                          (const int)incx, (const void *)&beta, y, (const int)incy);
+            ::cblas_zgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const void *)&alpha, a,
+                          to_cblas_int(lda), x, to_cblas_int(incx), (const void *)&beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1107,9 +1119,9 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sgemv_usm>(cgh, [=]() {
-            ::cblas_sgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, x, (const int)incx,
-                          (const float)beta, y, (const int)incy);
+            ::cblas_sgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const float)alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const float)beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1124,9 +1136,9 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dgemv_usm>(cgh, [=]() {
-            ::cblas_dgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, x, (const int)incx,
-                          (const double)beta, y, (const int)incy);
+            ::cblas_dgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const double)alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const double)beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1143,9 +1155,9 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_cgemv_usm>(cgh, [=]() {
-            ::cblas_cgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, x, (const int)incx,
-                          (const void *)&beta, y, (const int)incy);
+            ::cblas_cgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const void *)&alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const void *)&beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1162,9 +1174,9 @@ cl::sycl::event gemv(cl::sycl::queue &queue, transpose trans, int64_t m, int64_t
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zgemv_usm>(cgh, [=]() {
-            ::cblas_zgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, x, (const int)incx,
-                          (const void *)&beta, y, (const int)incy);
+            ::cblas_zgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const void *)&alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const void *)&beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1179,8 +1191,8 @@ cl::sycl::event ger(cl::sycl::queue &queue, int64_t m, int64_t n, float alpha, c
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sger_usm>(cgh, [=]() {
-            ::cblas_sger(MAJOR, (const int)m, (const int)n, (const float)alpha, x, (const int)incx,
-                         y, (const int)incy, a, (const int)lda);
+            ::cblas_sger(MAJOR, to_cblas_int(m), to_cblas_int(n), (const float)alpha, x,
+                         to_cblas_int(incx), y, to_cblas_int(incy), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1195,8 +1207,8 @@ cl::sycl::event ger(cl::sycl::queue &queue, int64_t m, int64_t n, double alpha,
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dger_usm>(cgh, [=]() {
-            ::cblas_dger(MAJOR, (const int)m, (const int)n, (const double)alpha, x, (const int)incx,
-                         y, (const int)incy, a, (const int)lda);
+            ::cblas_dger(MAJOR, to_cblas_int(m), to_cblas_int(n), (const double)alpha, x,
+                         to_cblas_int(incx), y, to_cblas_int(incy), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1212,8 +1224,8 @@ cl::sycl::event gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_cgerc_usm>(cgh, [=]() {
-            ::cblas_cgerc(MAJOR, (const int)m, (const int)n, (const void *)&alpha, x,
-                          (const int)incx, y, (const int)incy, a, (const int)lda);
+            ::cblas_cgerc(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void *)&alpha, x,
+                          to_cblas_int(incx), y, to_cblas_int(incy), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1229,8 +1241,8 @@ cl::sycl::event gerc(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zgerc_usm>(cgh, [=]() {
-            ::cblas_zgerc(MAJOR, (const int)m, (const int)n, (const void *)&alpha, x,
-                          (const int)incx, y, (const int)incy, a, (const int)lda);
+            ::cblas_zgerc(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void *)&alpha, x,
+                          to_cblas_int(incx), y, to_cblas_int(incy), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1246,8 +1258,8 @@ cl::sycl::event geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_cgeru_usm>(cgh, [=]() {
-            ::cblas_cgeru(MAJOR, (const int)m, (const int)n, (const void *)&alpha, x,
-                          (const int)incx, y, (const int)incy, a, (const int)lda);
+            ::cblas_cgeru(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void *)&alpha, x,
+                          to_cblas_int(incx), y, to_cblas_int(incy), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1263,8 +1275,8 @@ cl::sycl::event geru(cl::sycl::queue &queue, int64_t m, int64_t n, std::complex<
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zgeru_usm>(cgh, [=]() {
-            ::cblas_zgeru(MAJOR, (const int)m, (const int)n, (const void *)&alpha, x,
-                          (const int)incx, y, (const int)incy, a, (const int)lda);
+            ::cblas_zgeru(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void *)&alpha, x,
+                          to_cblas_int(incx), y, to_cblas_int(incy), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1281,9 +1293,9 @@ cl::sycl::event hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_chbmv_usm>(cgh, [=]() {
-            ::cblas_chbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const void *)&alpha, a, (const int)lda, x, (const int)incx,
-                          (const void *)&beta, y, (const int)incy);
+            ::cblas_chbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const void *)&alpha, a, to_cblas_int(lda), x,
+                          to_cblas_int(incx), (const void *)&beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1300,9 +1312,9 @@ cl::sycl::event hbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zhbmv_usm>(cgh, [=]() {
-            ::cblas_zhbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const void *)&alpha, a, (const int)lda, x, (const int)incx,
-                          (const void *)&beta, y, (const int)incy);
+            ::cblas_zhbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const void *)&alpha, a, to_cblas_int(lda), x,
+                          to_cblas_int(incx), (const void *)&beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1318,9 +1330,9 @@ cl::sycl::event hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_chemv_usm>(cgh, [=]() {
-            ::cblas_chemv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void *)&alpha, a, (const int)lda, x, (const int)incx,
-                          (const void *)&beta, y, (const int)incy);
+            ::cblas_chemv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void *)&alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const void *)&beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1337,9 +1349,9 @@ cl::sycl::event hemv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zhemv_usm>(cgh, [=]() {
-            ::cblas_zhemv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void *)&alpha, a, (const int)lda, x, (const int)incx,
-                          (const void *)&beta, y, (const int)incy);
+            ::cblas_zhemv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void *)&alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const void *)&beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1354,8 +1366,8 @@ cl::sycl::event her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_cher_usm>(cgh, [=]() {
-            ::cblas_cher(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, x, (const int)incx, a, (const int)lda);
+            ::cblas_cher(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, x, to_cblas_int(incx), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1370,8 +1382,8 @@ cl::sycl::event her(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zher_usm>(cgh, [=]() {
-            ::cblas_zher(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, x, (const int)incx, a, (const int)lda);
+            ::cblas_zher(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, x, to_cblas_int(incx), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1387,9 +1399,9 @@ cl::sycl::event her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_cher2_usm>(cgh, [=]() {
-            ::cblas_cher2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void *)&alpha, x, (const int)incx, y, (const int)incy, a,
-                          (const int)lda);
+            ::cblas_cher2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void *)&alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), a,
+                          to_cblas_int(lda));
         });
     });
     return done;
@@ -1405,9 +1417,9 @@ cl::sycl::event her2(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zher2_usm>(cgh, [=]() {
-            ::cblas_zher2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void *)&alpha, x, (const int)incx, y, (const int)incy, a,
-                          (const int)lda);
+            ::cblas_zher2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void *)&alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), a,
+                          to_cblas_int(lda));
         });
     });
     return done;
@@ -1423,9 +1435,9 @@ cl::sycl::event hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_chpmv_usm>(cgh, [=]() {
-            ::cblas_chpmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void *)&alpha, ap, x, (const int)incx, (const void *)&beta, y,
-                          (const int)incy);
+            ::cblas_chpmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void *)&alpha, ap, x, to_cblas_int(incx), (const void *)&beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1442,9 +1454,9 @@ cl::sycl::event hpmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zhpmv_usm>(cgh, [=]() {
-            ::cblas_zhpmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void *)&alpha, ap, x, (const int)incx, (const void *)&beta, y,
-                          (const int)incy);
+            ::cblas_zhpmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void *)&alpha, ap, x, to_cblas_int(incx), (const void *)&beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1459,8 +1471,8 @@ cl::sycl::event hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_chpr_usm>(cgh, [=]() {
-            ::cblas_chpr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, x, (const int)incx, ap);
+            ::cblas_chpr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, x, to_cblas_int(incx), ap);
         });
     });
     return done;
@@ -1475,8 +1487,8 @@ cl::sycl::event hpr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zhpr_usm>(cgh, [=]() {
-            ::cblas_zhpr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, x, (const int)incx, ap);
+            ::cblas_zhpr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, x, to_cblas_int(incx), ap);
         });
     });
     return done;
@@ -1492,8 +1504,8 @@ cl::sycl::event hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, std::c
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_chpr2_usm>(cgh, [=]() {
-            ::cblas_chpr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void *)&alpha, x, (const int)incx, y, (const int)incy, ap);
+            ::cblas_chpr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void *)&alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), ap);
         });
     });
     return done;
@@ -1509,8 +1521,8 @@ cl::sycl::event hpr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n,
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zhpr2_usm>(cgh, [=]() {
-            ::cblas_zhpr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void *)&alpha, x, (const int)incx, y, (const int)incy, ap);
+            ::cblas_zhpr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void *)&alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), ap);
         });
     });
     return done;
@@ -1525,9 +1537,9 @@ cl::sycl::event sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ssbmv_usm>(cgh, [=]() {
-            ::cblas_ssbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const float)alpha, a, (const int)lda, x, (const int)incx,
-                          (const float)beta, y, (const int)incy);
+            ::cblas_ssbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const float)alpha, a, to_cblas_int(lda), x,
+                          to_cblas_int(incx), (const float)beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1542,9 +1554,9 @@ cl::sycl::event sbmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, int64_
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dsbmv_usm>(cgh, [=]() {
-            ::cblas_dsbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const double)alpha, a, (const int)lda, x, (const int)incx,
-                          (const double)beta, y, (const int)incy);
+            ::cblas_dsbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const double)alpha, a, to_cblas_int(lda), x,
+                          to_cblas_int(incx), (const double)beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1559,9 +1571,9 @@ cl::sycl::event spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sspmv_usm>(cgh, [=]() {
-            ::cblas_sspmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const float)alpha, ap, x, (const int)incx, (const float)beta, y,
-                          (const int)incy);
+            ::cblas_sspmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const float)alpha, ap, x, to_cblas_int(incx), (const float)beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1576,9 +1588,9 @@ cl::sycl::event spmv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dspmv_usm>(cgh, [=]() {
-            ::cblas_dspmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const double)alpha, ap, x, (const int)incx, (const double)beta, y,
-                          (const int)incy);
+            ::cblas_dspmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const double)alpha, ap, x, to_cblas_int(incx), (const double)beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1593,8 +1605,8 @@ cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sspr_usm>(cgh, [=]() {
-            ::cblas_sspr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, x, (const int)incx, ap);
+            ::cblas_sspr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, x, to_cblas_int(incx), ap);
         });
     });
     return done;
@@ -1609,8 +1621,8 @@ cl::sycl::event spr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dspr_usm>(cgh, [=]() {
-            ::cblas_dspr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, x, (const int)incx, ap);
+            ::cblas_dspr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, x, to_cblas_int(incx), ap);
         });
     });
     return done;
@@ -1625,8 +1637,8 @@ cl::sycl::event spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sspr2_usm>(cgh, [=]() {
-            ::cblas_sspr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const float)alpha, x, (const int)incx, y, (const int)incy, ap);
+            ::cblas_sspr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const float)alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), ap);
         });
     });
     return done;
@@ -1641,8 +1653,8 @@ cl::sycl::event spr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dspr2_usm>(cgh, [=]() {
-            ::cblas_dspr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const double)alpha, x, (const int)incx, y, (const int)incy, ap);
+            ::cblas_dspr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const double)alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), ap);
         });
     });
     return done;
@@ -1657,9 +1669,9 @@ cl::sycl::event symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ssymv_usm>(cgh, [=]() {
-            ::cblas_ssymv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const float)alpha, a, (const int)lda, x, (const int)incx,
-                          (const float)beta, y, (const int)incy);
+            ::cblas_ssymv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const float)alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const float)beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1674,9 +1686,9 @@ cl::sycl::event symv(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dsymv_usm>(cgh, [=]() {
-            ::cblas_dsymv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const double)alpha, a, (const int)lda, x, (const int)incx,
-                          (const double)beta, y, (const int)incy);
+            ::cblas_dsymv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const double)alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const double)beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1691,8 +1703,8 @@ cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float a
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ssyr_usm>(cgh, [=]() {
-            ::cblas_ssyr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, x, (const int)incx, a, (const int)lda);
+            ::cblas_ssyr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, x, to_cblas_int(incx), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1707,8 +1719,8 @@ cl::sycl::event syr(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dsyr_usm>(cgh, [=]() {
-            ::cblas_dsyr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, x, (const int)incx, a, (const int)lda);
+            ::cblas_dsyr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, x, to_cblas_int(incx), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1723,9 +1735,9 @@ cl::sycl::event syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, float
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ssyr2_usm>(cgh, [=]() {
-            ::cblas_ssyr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const float)alpha, x, (const int)incx, y, (const int)incy, a,
-                          (const int)lda);
+            ::cblas_ssyr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const float)alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), a,
+                          to_cblas_int(lda));
         });
     });
     return done;
@@ -1740,9 +1752,9 @@ cl::sycl::event syr2(cl::sycl::queue &queue, uplo upper_lower, int64_t n, double
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dsyr2_usm>(cgh, [=]() {
-            ::cblas_dsyr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const double)alpha, x, (const int)incx, y, (const int)incy, a,
-                          (const int)lda);
+            ::cblas_dsyr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const double)alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), a,
+                          to_cblas_int(lda));
         });
     });
     return done;
@@ -1758,8 +1770,8 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_stbmv_usm>(cgh, [=]() {
             ::cblas_stbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1775,8 +1787,8 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_dtbmv_usm>(cgh, [=]() {
             ::cblas_dtbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1793,8 +1805,8 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_ctbmv_usm>(cgh, [=]() {
             ::cblas_ctbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1811,8 +1823,8 @@ cl::sycl::event tbmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_ztbmv_usm>(cgh, [=]() {
             ::cblas_ztbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1828,8 +1840,8 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_stbsv_usm>(cgh, [=]() {
             ::cblas_stbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1845,8 +1857,8 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_dtbsv_usm>(cgh, [=]() {
             ::cblas_dtbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1863,8 +1875,8 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_ctbsv_usm>(cgh, [=]() {
             ::cblas_ctbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1881,8 +1893,8 @@ cl::sycl::event tbsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_ztbsv_usm>(cgh, [=]() {
             ::cblas_ztbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1898,7 +1910,8 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_stpmv_usm>(cgh, [=]() {
             ::cblas_stpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -1914,7 +1927,8 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_dtpmv_usm>(cgh, [=]() {
             ::cblas_dtpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -1930,7 +1944,8 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_ctpmv_usm>(cgh, [=]() {
             ::cblas_ctpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -1946,7 +1961,8 @@ cl::sycl::event tpmv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_ztpmv_usm>(cgh, [=]() {
             ::cblas_ztpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -1962,7 +1978,8 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_stpsv_usm>(cgh, [=]() {
             ::cblas_stpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -1978,7 +1995,8 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_dtpsv_usm>(cgh, [=]() {
             ::cblas_dtpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -1994,7 +2012,8 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_ctpsv_usm>(cgh, [=]() {
             ::cblas_ctpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -2010,7 +2029,8 @@ cl::sycl::event tpsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_ztpsv_usm>(cgh, [=]() {
             ::cblas_ztpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -2026,8 +2046,8 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
         }
         host_task<class netlib_strmv_usm>(cgh, [=]() {
             ::cblas_strmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, b,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          b, to_cblas_int(incx));
         });
     });
     return done;
@@ -2043,8 +2063,8 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
         }
         host_task<class netlib_dtrmv_usm>(cgh, [=]() {
             ::cblas_dtrmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, b,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          b, to_cblas_int(incx));
         });
     });
     return done;
@@ -2060,8 +2080,8 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
         }
         host_task<class netlib_ctrmv_usm>(cgh, [=]() {
             ::cblas_ctrmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, b,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          b, to_cblas_int(incx));
         });
     });
     return done;
@@ -2077,8 +2097,8 @@ cl::sycl::event trmv(cl::sycl::queue &queue, uplo upper_lower, transpose transa,
         }
         host_task<class netlib_ztrmv_usm>(cgh, [=]() {
             ::cblas_ztrmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, b,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          b, to_cblas_int(incx));
         });
     });
     return done;
@@ -2094,8 +2114,8 @@ cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_strsv_usm>(cgh, [=]() {
             ::cblas_strsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, x,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          x, to_cblas_int(incx));
         });
     });
     return done;
@@ -2111,8 +2131,8 @@ cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_dtrsv_usm>(cgh, [=]() {
             ::cblas_dtrsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, x,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          x, to_cblas_int(incx));
         });
     });
     return done;
@@ -2128,8 +2148,8 @@ cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_ctrsv_usm>(cgh, [=]() {
             ::cblas_ctrsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, x,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          x, to_cblas_int(incx));
         });
     });
     return done;
@@ -2145,8 +2165,8 @@ cl::sycl::event trsv(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_ztrsv_usm>(cgh, [=]() {
             ::cblas_ztrsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, x,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          x, to_cblas_int(incx));
         });
     });
     return done;
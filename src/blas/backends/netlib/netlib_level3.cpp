@@ -18,6 +18,10 @@
 *******************************************************************************/
 
 #include <CL/sycl.hpp>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
 
 #include "netlib_common.hpp"
 #include "oneapi/mkl/exceptions.hpp"
@@ -27,6 +31,433 @@ namespace oneapi {
 namespace mkl {
 namespace blas {
 namespace netlib {
+
+namespace {
+
+void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m,
+                int64_t n, int64_t k, float alpha, const float *a, int64_t lda, const float *b,
+                int64_t ldb, float beta, float *c, int64_t ldc) {
+    ::cblas_sgemm(layout, transa, transb, to_cblas_int(m), to_cblas_int(n), to_cblas_int(k), alpha,
+                  a, to_cblas_int(lda), b, to_cblas_int(ldb), beta, c, to_cblas_int(ldc));
+}
+
+void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m,
+                int64_t n, int64_t k, double alpha, const double *a, int64_t lda, const double *b,
+                int64_t ldb, double beta, double *c, int64_t ldc) {
+    ::cblas_dgemm(layout, transa, transb, to_cblas_int(m), to_cblas_int(n), to_cblas_int(k), alpha,
+                  a, to_cblas_int(lda), b, to_cblas_int(ldb), beta, c, to_cblas_int(ldc));
+}
+
+void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m,
+                int64_t n, int64_t k, std::complex<float> alpha, const std::complex<float> *a,
+                int64_t lda, const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                std::complex<float> *c, int64_t ldc) {
+    ::cblas_cgemm(layout, transa, transb, to_cblas_int(m), to_cblas_int(n), to_cblas_int(k),
+                  (const void *)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb),
+                  (const void *)&beta, c, to_cblas_int(ldc));
+}
+
+void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, int64_t m,
+                int64_t n, int64_t k, std::complex<double> alpha, const std::complex<double> *a,
+                int64_t lda, const std::complex<double> *b, int64_t ldb, std::complex<double> beta,
+                std::complex<double> *c, int64_t ldc) {
+    ::cblas_zgemm(layout, transa, transb, to_cblas_int(m), to_cblas_int(n), to_cblas_int(k),
+                  (const void *)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb),
+                  (const void *)&beta, c, to_cblas_int(ldc));
+}
+
+void cblas_symm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower, int64_t m,
+                int64_t n, float alpha, const float *a, int64_t lda, const float *b, int64_t ldb,
+                float beta, float *c, int64_t ldc) {
+    ::cblas_ssymm(layout, left_right, upper_lower, to_cblas_int(m), to_cblas_int(n), alpha, a,
+                  to_cblas_int(lda), b, to_cblas_int(ldb), beta, c, to_cblas_int(ldc));
+}
+
+void cblas_symm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower, int64_t m,
+                int64_t n, double alpha, const double *a, int64_t lda, const double *b, int64_t ldb,
+                double beta, double *c, int64_t ldc) {
+    ::cblas_dsymm(layout, left_right, upper_lower, to_cblas_int(m), to_cblas_int(n), alpha, a,
+                  to_cblas_int(lda), b, to_cblas_int(ldb), beta, c, to_cblas_int(ldc));
+}
+
+void cblas_symm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower, int64_t m,
+                int64_t n, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                std::complex<float> *c, int64_t ldc) {
+    ::cblas_csymm(layout, left_right, upper_lower, to_cblas_int(m), to_cblas_int(n),
+                  (const void *)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb),
+                  (const void *)&beta, c, to_cblas_int(ldc));
+}
+
+void cblas_symm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower, int64_t m,
+                int64_t n, std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                const std::complex<double> *b, int64_t ldb, std::complex<double> beta,
+                std::complex<double> *c, int64_t ldc) {
+    ::cblas_zsymm(layout, left_right, upper_lower, to_cblas_int(m), to_cblas_int(n),
+                  (const void *)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb),
+                  (const void *)&beta, c, to_cblas_int(ldc));
+}
+
+void cblas_hemm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower, int64_t m,
+                int64_t n, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                const std::complex<float> *b, int64_t ldb, std::complex<float> beta,
+                std::complex<float> *c, int64_t ldc) {
+    ::cblas_chemm(layout, left_right, upper_lower, to_cblas_int(m), to_cblas_int(n),
+                  (const void *)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb),
+                  (const void *)&beta, c, to_cblas_int(ldc));
+}
+
+void cblas_hemm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower, int64_t m,
+                int64_t n, std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                const std::complex<double> *b, int64_t ldb, std::complex<double> beta,
+                std::complex<double> *c, int64_t ldc) {
+    ::cblas_zhemm(layout, left_right, upper_lower, to_cblas_int(m), to_cblas_int(n),
+                  (const void *)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb),
+                  (const void *)&beta, c, to_cblas_int(ldc));
+}
+
+void cblas_syrk(CBLAS_LAYOUT layout, CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, int64_t n,
+                int64_t k, float alpha, const float *a, int64_t lda, float beta, float *c,
+                int64_t ldc) {
+    ::cblas_ssyrk(layout, upper_lower, trans, to_cblas_int(n), to_cblas_int(k), alpha, a,
+                  to_cblas_int(lda), beta, c, to_cblas_int(ldc));
+}
+
+void cblas_syrk(CBLAS_LAYOUT layout, CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, int64_t n,
+                int64_t k, double alpha, const double *a, int64_t lda, double beta, double *c,
+                int64_t ldc) {
+    ::cblas_dsyrk(layout, upper_lower, trans, to_cblas_int(n), to_cblas_int(k), alpha, a,
+                  to_cblas_int(lda), beta, c, to_cblas_int(ldc));
+}
+
+void cblas_syrk(CBLAS_LAYOUT layout, CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, int64_t n,
+                int64_t k, std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                std::complex<float> beta, std::complex<float> *c, int64_t ldc) {
+    ::cblas_csyrk(layout, upper_lower, trans, to_cblas_int(n), to_cblas_int(k),
+                  (const void *)&alpha, a, to_cblas_int(lda), (const void *)&beta, c,
+                  to_cblas_int(ldc));
+}
+
+void cblas_syrk(CBLAS_LAYOUT layout, CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, int64_t n,
+                int64_t k, std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                std::complex<double> beta, std::complex<double> *c, int64_t ldc) {
+    ::cblas_zsyrk(layout, upper_lower, trans, to_cblas_int(n), to_cblas_int(k),
+                  (const void *)&alpha, a, to_cblas_int(lda), (const void *)&beta, c,
+                  to_cblas_int(ldc));
+}
+
+void cblas_herk(CBLAS_LAYOUT layout, CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, int64_t n,
+                int64_t k, float alpha, const std::complex<float> *a, int64_t lda, float beta,
+                std::complex<float> *c, int64_t ldc) {
+    ::cblas_cherk(layout, upper_lower, trans, to_cblas_int(n), to_cblas_int(k), alpha, a,
+                  to_cblas_int(lda), beta, c, to_cblas_int(ldc));
+}
+
+void cblas_herk(CBLAS_LAYOUT layout, CBLAS_UPLO upper_lower, CBLAS_TRANSPOSE trans, int64_t n,
+                int64_t k, double alpha, const std::complex<double> *a, int64_t lda, double beta,
+                std::complex<double> *c, int64_t ldc) {
+    ::cblas_zherk(layout, upper_lower, trans, to_cblas_int(n), to_cblas_int(k), alpha, a,
+                  to_cblas_int(lda), beta, c, to_cblas_int(ldc));
+}
+
+void cblas_trmm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower,
+                CBLAS_TRANSPOSE transa, CBLAS_DIAG unit_diag, int64_t m, int64_t n, float alpha,
+                const float *a, int64_t lda, float *b, int64_t ldb) {
+    ::cblas_strmm(layout, left_right, upper_lower, transa, unit_diag, to_cblas_int(m),
+                  to_cblas_int(n), alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb));
+}
+
+void cblas_trmm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower,
+                CBLAS_TRANSPOSE transa, CBLAS_DIAG unit_diag, int64_t m, int64_t n, double alpha,
+                const double *a, int64_t lda, double *b, int64_t ldb) {
+    ::cblas_dtrmm(layout, left_right, upper_lower, transa, unit_diag, to_cblas_int(m),
+                  to_cblas_int(n), alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb));
+}
+
+void cblas_trmm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower,
+                CBLAS_TRANSPOSE transa, CBLAS_DIAG unit_diag, int64_t m, int64_t n,
+                std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                std::complex<float> *b, int64_t ldb) {
+    ::cblas_ctrmm(layout, left_right, upper_lower, transa, unit_diag, to_cblas_int(m),
+                  to_cblas_int(n), (const void *)&alpha, a, to_cblas_int(lda), b,
+                  to_cblas_int(ldb));
+}
+
+void cblas_trmm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower,
+                CBLAS_TRANSPOSE transa, CBLAS_DIAG unit_diag, int64_t m, int64_t n,
+                std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                std::complex<double> *b, int64_t ldb) {
+    ::cblas_ztrmm(layout, left_right, upper_lower, transa, unit_diag, to_cblas_int(m),
+                  to_cblas_int(n), (const void *)&alpha, a, to_cblas_int(lda), b,
+                  to_cblas_int(ldb));
+}
+
+void cblas_trsm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower,
+                CBLAS_TRANSPOSE transa, CBLAS_DIAG unit_diag, int64_t m, int64_t n, float alpha,
+                const float *a, int64_t lda, float *b, int64_t ldb) {
+    ::cblas_strsm(layout, left_right, upper_lower, transa, unit_diag, to_cblas_int(m),
+                  to_cblas_int(n), alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb));
+}
+
+void cblas_trsm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower,
+                CBLAS_TRANSPOSE transa, CBLAS_DIAG unit_diag, int64_t m, int64_t n, double alpha,
+                const double *a, int64_t lda, double *b, int64_t ldb) {
+    ::cblas_dtrsm(layout, left_right, upper_lower, transa, unit_diag, to_cblas_int(m),
+                  to_cblas_int(n), alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb));
+}
+
+void cblas_trsm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower,
+                CBLAS_TRANSPOSE transa, CBLAS_DIAG unit_diag, int64_t m, int64_t n,
+                std::complex<float> alpha, const std::complex<float> *a, int64_t lda,
+                std::complex<float> *b, int64_t ldb) {
+    ::cblas_ctrsm(layout, left_right, upper_lower, transa, unit_diag, to_cblas_int(m),
+                  to_cblas_int(n), (const void *)&alpha, a, to_cblas_int(lda), b,
+                  to_cblas_int(ldb));
+}
+
+void cblas_trsm(CBLAS_LAYOUT layout, CBLAS_SIDE left_right, CBLAS_UPLO upper_lower,
+                CBLAS_TRANSPOSE transa, CBLAS_DIAG unit_diag, int64_t m, int64_t n,
+                std::complex<double> alpha, const std::complex<double> *a, int64_t lda,
+                std::complex<double> *b, int64_t ldb) {
+    ::cblas_ztrsm(layout, left_right, upper_lower, transa, unit_diag, to_cblas_int(m),
+                  to_cblas_int(n), (const void *)&alpha, a, to_cblas_int(lda), b,
+                  to_cblas_int(ldb));
+}
+
+// Level 3 calls of queues with more than one level 3 thread split large problems into tiles that
+// are computed by separate cblas calls on the thread pool. Tiles span at least level3_min_tile rows
+// or columns, and there are up to level3_tiles_per_thread tiles per thread so that threads that
+// finish early take over the remaining tiles.
+constexpr int64_t level3_min_tile = 64;
+constexpr int64_t level3_tiles_per_thread = 4;
+
+// Largest number of tiles worth running on threads threads for a problem of cost multiply-adds.
+int64_t max_tiles(int threads, double cost) {
+    if (threads < 2)
+        return 1;
+    return static_cast<int64_t>(
+        std::min(double(threads * level3_tiles_per_thread), cost / batch_min_part_cost));
+}
+
+// Number of tiles a dimension of size n is split into, for at most tiles tiles.
+int64_t tile_count(int64_t n, int64_t tiles) {
+    return std::max<int64_t>(1, std::min(tiles, n / level3_min_tile));
+}
+
+// Start of tile t of the count tiles that split [0, n).
+int64_t tile_start(int64_t n, int64_t count, int64_t t) {
+    return n * t / count;
+}
+
+// Element (i, j) of a matrix.
+template <typename T>
+T *element(CBLAS_LAYOUT layout, T *a, int64_t ld, int64_t i, int64_t j) {
+    return layout == CblasColMajor ? a + i + j * ld : a + i * ld + j;
+}
+
+// Runs f(i, j, rows, cols) on tiles covering the m x n matrix, splitting both dimensions. A single
+// tile covers the matrix when the problem is too small to split.
+template <typename F>
+void for_each_tile(int threads, double cost, int64_t m, int64_t n, F f) {
+    const int64_t tiles = max_tiles(threads, cost);
+    if (tiles < 2) {
+        f(int64_t(0), int64_t(0), m, n);
+        return;
+    }
+    // Tiles about as square as the matrix allows.
+    const double rows_wanted = std::sqrt(double(tiles) * m / n);
+    const int64_t rows = tile_count(m, std::max<int64_t>(1, std::llround(rows_wanted)));
+    const int64_t cols = tile_count(n, std::max<int64_t>(1, tiles / rows));
+    parallel_for(rows * cols, threads, [&](int64_t t) {
+        const int64_t r = t % rows, c = t / rows;
+        const int64_t i = tile_start(m, rows, r), j = tile_start(n, cols, c);
+        f(i, j, tile_start(m, rows, r + 1) - i, tile_start(n, cols, c + 1) - j);
+    });
+}
+
+// Same with tiles that split only the rows (by_rows) or only the columns, for routines whose rows
+// or columns are independent.
+template <typename F>
+void for_each_panel(int threads, double cost, bool by_rows, int64_t m, int64_t n, F f) {
+    const int64_t count = tile_count(by_rows ? m : n, max_tiles(threads, cost));
+    if (count < 2) {
+        f(int64_t(0), int64_t(0), m, n);
+        return;
+    }
+    parallel_for(count, threads, [&](int64_t t) {
+        if (by_rows) {
+            const int64_t i = tile_start(m, count, t);
+            f(i, int64_t(0), tile_start(m, count, t + 1) - i, n);
+        }
+        else {
+            const int64_t j = tile_start(n, count, t);
+            f(int64_t(0), j, m, tile_start(n, count, t + 1) - j);
+        }
+    });
+}
+
+// Runs diagonal(i, size) on the diagonal blocks and off_diagonal(i, j, rows, cols) on the other
+// blocks of the upper or lower triangle of an n x n matrix.
+template <typename D, typename O>
+void for_each_triangle_tile(int threads, double cost, bool upper, int64_t n, D diagonal,
+                            O off_diagonal) {
+    const int64_t tiles = max_tiles(threads, cost);
+    // count * (count + 1) / 2 blocks.
+    const int64_t count = tile_count(n, static_cast<int64_t>(std::sqrt(2.0 * tiles)));
+    if (count < 2) {
+        diagonal(int64_t(0), n);
+        return;
+    }
+    parallel_for(count * (count + 1) / 2, threads, [&](int64_t t) {
+        // Block (r, c) of the lower triangle, numbered by rows.
+        int64_t r = static_cast<int64_t>((std::sqrt(8.0 * t + 1.0) - 1.0) / 2.0);
+        while (r * (r + 1) / 2 > t)
+            r--;
+        while ((r + 1) * (r + 2) / 2 <= t)
+            r++;
+        const int64_t c = t - r * (r + 1) / 2;
+        const int64_t i = tile_start(n, count, r), rows = tile_start(n, count, r + 1) - i;
+        const int64_t j = tile_start(n, count, c), cols = tile_start(n, count, c + 1) - j;
+        if (r == c)
+            diagonal(i, rows);
+        else if (upper)
+            off_diagonal(j, i, cols, rows);
+        else
+            off_diagonal(i, j, rows, cols);
+    });
+}
+
+template <typename T>
+void tiled_gemm(int threads, CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                int64_t n, int64_t k, T alpha, const T *a, int64_t lda, const T *b, int64_t ldb,
+                T beta, T *c, int64_t ldc) {
+    const CBLAS_TRANSPOSE transa_ = convert_to_cblas_trans(transa);
+    const CBLAS_TRANSPOSE transb_ = convert_to_cblas_trans(transb);
+    for_each_tile(threads, double(m) * n * k, m, n,
+                  [&](int64_t i, int64_t j, int64_t rows, int64_t cols) {
+                      const T *a_i = transa == transpose::nontrans ? element(layout, a, lda, i, 0)
+                                                                   : element(layout, a, lda, 0, i);
+                      const T *b_j = transb == transpose::nontrans ? element(layout, b, ldb, 0, j)
+                                                                   : element(layout, b, ldb, j, 0);
+                      cblas_gemm(layout, transa_, transb_, rows, cols, k, alpha, a_i, lda, b_j,
+                                 ldb, beta, element(layout, c, ldc, i, j), ldc);
+                  });
+}
+
+// symm and hemm with A on the left combine the rows of B, so the columns of C are independent, and
+// the other way around with A on the right.
+template <typename T>
+void tiled_symm(int threads, CBLAS_LAYOUT layout, side left_right, uplo upper_lower, int64_t m,
+                int64_t n, T alpha, const T *a, int64_t lda, const T *b, int64_t ldb, T beta, T *c,
+                int64_t ldc) {
+    const CBLAS_SIDE left_right_ = convert_to_cblas_side(left_right);
+    const CBLAS_UPLO upper_lower_ = convert_to_cblas_uplo(upper_lower);
+    const bool left = left_right == side::left;
+    for_each_panel(threads, double(m) * n * (left ? m : n), !left, m, n,
+                   [&](int64_t i, int64_t j, int64_t rows, int64_t cols) {
+                       cblas_symm(layout, left_right_, upper_lower_, rows, cols, alpha, a, lda,
+                                  element(layout, b, ldb, i, j), ldb, beta,
+                                  element(layout, c, ldc, i, j), ldc);
+                   });
+}
+
+template <typename T>
+void tiled_hemm(int threads, CBLAS_LAYOUT layout, side left_right, uplo upper_lower, int64_t m,
+                int64_t n, T alpha, const T *a, int64_t lda, const T *b, int64_t ldb, T beta, T *c,
+                int64_t ldc) {
+    const CBLAS_SIDE left_right_ = convert_to_cblas_side(left_right);
+    const CBLAS_UPLO upper_lower_ = convert_to_cblas_uplo(upper_lower);
+    const bool left = left_right == side::left;
+    for_each_panel(threads, double(m) * n * (left ? m : n), !left, m, n,
+                   [&](int64_t i, int64_t j, int64_t rows, int64_t cols) {
+                       cblas_hemm(layout, left_right_, upper_lower_, rows, cols, alpha, a, lda,
+                                  element(layout, b, ldb, i, j), ldb, beta,
+                                  element(layout, c, ldc, i, j), ldc);
+                   });
+}
+
+// syrk and herk update the diagonal blocks of C with syrk or herk and the others with gemm, as
+// C(I, J) = alpha * op(A)(I, :) * op(A)(J, :)^T + beta * C(I, J), conjugated for herk.
+template <typename T>
+void tiled_syrk(int threads, CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n,
+                int64_t k, T alpha, const T *a, int64_t lda, T beta, T *c, int64_t ldc) {
+    const CBLAS_UPLO upper_lower_ = convert_to_cblas_uplo(upper_lower);
+    const CBLAS_TRANSPOSE trans_ = convert_to_cblas_trans(trans);
+    const bool nontrans = trans == transpose::nontrans;
+    auto a_rows = [&](int64_t i) {
+        return nontrans ? element(layout, a, lda, i, 0) : element(layout, a, lda, 0, i);
+    };
+    for_each_triangle_tile(
+        threads, double(n) * (n + 1) * k / 2, upper_lower == uplo::upper, n,
+        [&](int64_t i, int64_t size) {
+            cblas_syrk(layout, upper_lower_, trans_, size, k, alpha, a_rows(i), lda, beta,
+                       element(layout, c, ldc, i, i), ldc);
+        },
+        [&](int64_t i, int64_t j, int64_t rows, int64_t cols) {
+            cblas_gemm(layout, trans_, nontrans ? CblasTrans : CblasNoTrans, rows, cols, k, alpha,
+                       a_rows(i), lda, a_rows(j), lda, beta, element(layout, c, ldc, i, j), ldc);
+        });
+}
+
+template <typename T>
+void tiled_herk(int threads, CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n,
+                int64_t k, T alpha, const std::complex<T> *a, int64_t lda, T beta,
+                std::complex<T> *c, int64_t ldc) {
+    const CBLAS_UPLO upper_lower_ = convert_to_cblas_uplo(upper_lower);
+    const CBLAS_TRANSPOSE trans_ = convert_to_cblas_trans(trans);
+    const bool nontrans = trans == transpose::nontrans;
+    auto a_rows = [&](int64_t i) {
+        return nontrans ? element(layout, a, lda, i, 0) : element(layout, a, lda, 0, i);
+    };
+    for_each_triangle_tile(
+        threads, double(n) * (n + 1) * k / 2, upper_lower == uplo::upper, n,
+        [&](int64_t i, int64_t size) {
+            cblas_herk(layout, upper_lower_, trans_, size, k, alpha, a_rows(i), lda, beta,
+                       element(layout, c, ldc, i, i), ldc);
+        },
+        [&](int64_t i, int64_t j, int64_t rows, int64_t cols) {
+            cblas_gemm(layout, trans_, nontrans ? CblasConjTrans : CblasNoTrans, rows, cols, k,
+                       std::complex<T>(alpha), a_rows(i), lda, a_rows(j), lda,
+                       std::complex<T>(beta), element(layout, c, ldc, i, j), ldc);
+        });
+}
+
+// trmm and trsm with A on the left work on the columns of B independently, and on its rows with A
+// on the right.
+template <typename T>
+void tiled_trmm(int threads, CBLAS_LAYOUT layout, side left_right, uplo upper_lower,
+                transpose transa, diag unit_diag, int64_t m, int64_t n, T alpha, const T *a,
+                int64_t lda, T *b, int64_t ldb) {
+    const CBLAS_SIDE left_right_ = convert_to_cblas_side(left_right);
+    const CBLAS_UPLO upper_lower_ = convert_to_cblas_uplo(upper_lower);
+    const CBLAS_TRANSPOSE transa_ = convert_to_cblas_trans(transa);
+    const CBLAS_DIAG unit_diag_ = convert_to_cblas_diag(unit_diag);
+    const bool left = left_right == side::left;
+    for_each_panel(threads, double(m) * n * (left ? m : n) / 2, !left, m, n,
+                   [&](int64_t i, int64_t j, int64_t rows, int64_t cols) {
+                       cblas_trmm(layout, left_right_, upper_lower_, transa_, unit_diag_, rows,
+                                  cols, alpha, a, lda, element(layout, b, ldb, i, j), ldb);
+                   });
+}
+
+template <typename T>
+void tiled_trsm(int threads, CBLAS_LAYOUT layout, side left_right, uplo upper_lower,
+                transpose transa, diag unit_diag, int64_t m, int64_t n, T alpha, const T *a,
+                int64_t lda, T *b, int64_t ldb) {
+    const CBLAS_SIDE left_right_ = convert_to_cblas_side(left_right);
+    const CBLAS_UPLO upper_lower_ = convert_to_cblas_uplo(upper_lower);
+    const CBLAS_TRANSPOSE transa_ = convert_to_cblas_trans(transa);
+    const CBLAS_DIAG unit_diag_ = convert_to_cblas_diag(unit_diag);
+    const bool left = left_right == side::left;
+    for_each_panel(threads, double(m) * n * (left ? m : n) / 2, !left, m, n,
+                   [&](int64_t i, int64_t j, int64_t rows, int64_t cols) {
+                       cblas_trsm(layout, left_right_, upper_lower_, transa_, unit_diag_, rows,
+                                  cols, alpha, a, lda, element(layout, b, ldb, i, j), ldb);
+                   });
+}
+
+} // namespace
+
 namespace column_major {
 
 #define MAJOR CblasColMajor
@@ -23,16 +23,15 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
           int64_t k, float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda,
           cl::sycl::buffer<float, 1> &b, int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c,
           int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_sgemm>(cgh, [=]() {
-            ::cblas_sgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const float)alpha,
-                          accessor_a.get_pointer(), (const int)lda, accessor_b.get_pointer(),
-                          (const int)ldb, (const float)beta, accessor_c.get_pointer(),
-                          (const int)ldc);
+            tiled_gemm<float>(threads, MAJOR, transa, transb, m, n, k, alpha,
+                              accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb, beta,
+                              accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -41,16 +40,15 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
           int64_t k, double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda,
           cl::sycl::buffer<double, 1> &b, int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c,
           int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dgemm>(cgh, [=]() {
-            ::cblas_dgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const double)alpha,
-                          accessor_a.get_pointer(), (const int)lda, accessor_b.get_pointer(),
-                          (const int)ldb, (const double)beta, accessor_c.get_pointer(),
-                          (const int)ldc);
+            tiled_gemm<double>(threads, MAJOR, transa, transb, m, n, k, alpha,
+                               accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb, beta,
+                               accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -59,16 +57,15 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
           int64_t k, std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a,
           int64_t lda, cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb,
           std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_cgemm>(cgh, [=]() {
-            ::cblas_cgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha,
-                          accessor_a.get_pointer(), (const int)lda, accessor_b.get_pointer(),
-                          (const int)ldb, (const void *)&beta, accessor_c.get_pointer(),
-                          (const int)ldc);
+            tiled_gemm<std::complex<float>>(threads, MAJOR, transa, transb, m, n, k, alpha,
+                                            accessor_a.get_pointer(), lda, accessor_b.get_pointer(),
+                                            ldb, beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -77,16 +74,15 @@ void gemm(cl::sycl::queue &queue, transpose transa, transpose transb, int64_t m,
           int64_t k, std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a,
           int64_t lda, cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zgemm>(cgh, [=]() {
-            ::cblas_zgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha,
-                          accessor_a.get_pointer(), (const int)lda, accessor_b.get_pointer(),
-                          (const int)ldb, (const void *)&beta, accessor_c.get_pointer(),
-                          (const int)ldc);
+            tiled_gemm<std::complex<double>>(
+                threads, MAJOR, transa, transb, m, n, k, alpha, accessor_a.get_pointer(), lda,
+                accessor_b.get_pointer(), ldb, beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -131,16 +127,15 @@ void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_chemm>(cgh, [=]() {
-            ::cblas_chemm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb, (const void *)&beta,
-                          accessor_c.get_pointer(), (const int)ldc);
+            tiled_hemm<std::complex<float>>(threads, MAJOR, left_right, upper_lower, m, n, alpha,
+                                            accessor_a.get_pointer(), lda, accessor_b.get_pointer(),
+                                            ldb, beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -149,16 +144,15 @@ void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zhemm>(cgh, [=]() {
-            ::cblas_zhemm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb, (const void *)&beta,
-                          accessor_c.get_pointer(), (const int)ldc);
+            tiled_hemm<std::complex<double>>(
+                threads, MAJOR, left_right, upper_lower, m, n, alpha, accessor_a.get_pointer(), lda,
+                accessor_b.get_pointer(), ldb, beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -166,14 +160,13 @@ void hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
 void herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           float alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda, float beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_cherk>(cgh, [=]() {
-            ::cblas_cherk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const float)alpha, accessor_a.get_pointer(),
-                          (const int)lda, (const float)beta, accessor_c.get_pointer(),
-                          (const int)ldc);
+            tiled_herk<float>(threads, MAJOR, upper_lower, trans, n, k, alpha,
+                              accessor_a.get_pointer(), lda, beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -181,14 +174,13 @@ void herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
 void herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           double alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda, double beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zherk>(cgh, [=]() {
-            ::cblas_zherk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const double)alpha, accessor_a.get_pointer(),
-                          (const int)lda, (const double)beta, accessor_c.get_pointer(),
-                          (const int)ldc);
+            tiled_herk<double>(threads, MAJOR, upper_lower, trans, n, k, alpha,
+                               accessor_a.get_pointer(), lda, beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -203,10 +195,10 @@ void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_cher2k>(cgh, [=]() {
             ::cblas_cher2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void *)&alpha,
-                           accessor_a.get_pointer(), (const int)lda, accessor_b.get_pointer(),
-                           (const int)ldb, (const float)beta, accessor_c.get_pointer(),
-                           (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void *)&alpha,
+                           accessor_a.get_pointer(), to_cblas_int(lda), accessor_b.get_pointer(),
+                           to_cblas_int(ldb), (const float)beta, accessor_c.get_pointer(),
+                           to_cblas_int(ldc));
         });
     });
 }
@@ -221,10 +213,10 @@ void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zher2k>(cgh, [=]() {
             ::cblas_zher2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void *)&alpha,
-                           accessor_a.get_pointer(), (const int)lda, accessor_b.get_pointer(),
-                           (const int)ldb, (const double)beta, accessor_c.get_pointer(),
-                           (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void *)&alpha,
+                           accessor_a.get_pointer(), to_cblas_int(lda), accessor_b.get_pointer(),
+                           to_cblas_int(ldb), (const double)beta, accessor_c.get_pointer(),
+                           to_cblas_int(ldc));
         });
     });
 }
@@ -232,16 +224,15 @@ void her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
 void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
           float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda, cl::sycl::buffer<float, 1> &b,
           int64_t ldb, float beta, cl::sycl::buffer<float, 1> &c, int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ssymm>(cgh, [=]() {
-            ::cblas_ssymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const float)alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb, (const float)beta,
-                          accessor_c.get_pointer(), (const int)ldc);
+            tiled_symm<float>(threads, MAJOR, left_right, upper_lower, m, n, alpha,
+                              accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb, beta,
+                              accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -249,16 +240,15 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
 void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
           double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda, cl::sycl::buffer<double, 1> &b,
           int64_t ldb, double beta, cl::sycl::buffer<double, 1> &c, int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dsymm>(cgh, [=]() {
-            ::cblas_dsymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const double)alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb, (const double)beta,
-                          accessor_c.get_pointer(), (const int)ldc);
+            tiled_symm<double>(threads, MAJOR, left_right, upper_lower, m, n, alpha,
+                               accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb, beta,
+                               accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -267,16 +257,15 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb, std::complex<float> beta,
           cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_csymm>(cgh, [=]() {
-            ::cblas_csymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb, (const void *)&beta,
-                          accessor_c.get_pointer(), (const int)ldc);
+            tiled_symm<std::complex<float>>(threads, MAJOR, left_right, upper_lower, m, n, alpha,
+                                            accessor_a.get_pointer(), lda, accessor_b.get_pointer(),
+                                            ldb, beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -285,16 +274,15 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb, std::complex<double> beta,
           cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zsymm>(cgh, [=]() {
-            ::cblas_zsymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb, (const void *)&beta,
-                          accessor_c.get_pointer(), (const int)ldc);
+            tiled_symm<std::complex<double>>(
+                threads, MAJOR, left_right, upper_lower, m, n, alpha, accessor_a.get_pointer(), lda,
+                accessor_b.get_pointer(), ldb, beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -302,14 +290,13 @@ void symm(cl::sycl::queue &queue, side left_right, uplo upper_lower, int64_t m,
 void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           float alpha, cl::sycl::buffer<float, 1> &a, int64_t lda, float beta,
           cl::sycl::buffer<float, 1> &c, int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ssyrk>(cgh, [=]() {
-            ::cblas_ssyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const float)alpha, accessor_a.get_pointer(),
-                          (const int)lda, (const float)beta, accessor_c.get_pointer(),
-                          (const int)ldc);
+            tiled_syrk<float>(threads, MAJOR, upper_lower, trans, n, k, alpha,
+                              accessor_a.get_pointer(), lda, beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -317,14 +304,13 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
 void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           double alpha, cl::sycl::buffer<double, 1> &a, int64_t lda, double beta,
           cl::sycl::buffer<double, 1> &c, int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dsyrk>(cgh, [=]() {
-            ::cblas_dsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const double)alpha, accessor_a.get_pointer(),
-                          (const int)lda, (const double)beta, accessor_c.get_pointer(),
-                          (const int)ldc);
+            tiled_syrk<double>(threads, MAJOR, upper_lower, trans, n, k, alpha,
+                               accessor_a.get_pointer(), lda, beta, accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -332,14 +318,14 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
 void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           std::complex<float> alpha, cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           std::complex<float> beta, cl::sycl::buffer<std::complex<float>, 1> &c, int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_csyrk>(cgh, [=]() {
-            ::cblas_csyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void *)&alpha,
-                          accessor_a.get_pointer(), (const int)lda, (const void *)&beta,
-                          accessor_c.get_pointer(), (const int)ldc);
+            tiled_syrk<std::complex<float>>(threads, MAJOR, upper_lower, trans, n, k, alpha,
+                                            accessor_a.get_pointer(), lda, beta,
+                                            accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -347,14 +333,14 @@ void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
 void syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           std::complex<double> alpha, cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           std::complex<double> beta, cl::sycl::buffer<std::complex<double>, 1> &c, int64_t ldc) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zsyrk>(cgh, [=]() {
-            ::cblas_zsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void *)&alpha,
-                          accessor_a.get_pointer(), (const int)lda, (const void *)&beta,
-                          accessor_c.get_pointer(), (const int)ldc);
+            tiled_syrk<std::complex<double>>(threads, MAJOR, upper_lower, trans, n, k, alpha,
+                                             accessor_a.get_pointer(), lda, beta,
+                                             accessor_c.get_pointer(), ldc);
         });
     });
 }
@@ -368,9 +354,10 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ssyr2k>(cgh, [=]() {
             ::cblas_ssyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const float)alpha, accessor_a.get_pointer(),
-                           (const int)lda, accessor_b.get_pointer(), (const int)ldb,
-                           (const float)beta, accessor_c.get_pointer(), (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const float)alpha,
+                           accessor_a.get_pointer(), to_cblas_int(lda), accessor_b.get_pointer(),
+                           to_cblas_int(ldb), (const float)beta, accessor_c.get_pointer(),
+                           to_cblas_int(ldc));
         });
     });
 }
@@ -385,10 +372,10 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dsyr2k>(cgh, [=]() {
             ::cblas_dsyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const double)alpha,
-                           accessor_a.get_pointer(), (const int)lda, accessor_b.get_pointer(),
-                           (const int)ldb, (const double)beta, accessor_c.get_pointer(),
-                           (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const double)alpha,
+                           accessor_a.get_pointer(), to_cblas_int(lda), accessor_b.get_pointer(),
+                           to_cblas_int(ldb), (const double)beta, accessor_c.get_pointer(),
+                           to_cblas_int(ldc));
         });
     });
 }
@@ -403,10 +390,10 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_csyr2k>(cgh, [=]() {
             ::cblas_csyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void *)&alpha,
-                           accessor_a.get_pointer(), (const int)lda, accessor_b.get_pointer(),
-                           (const int)ldb, (const void *)&beta, accessor_c.get_pointer(),
-                           (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void *)&alpha,
+                           accessor_a.get_pointer(), to_cblas_int(lda), accessor_b.get_pointer(),
+                           to_cblas_int(ldb), (const void *)&beta, accessor_c.get_pointer(),
+                           to_cblas_int(ldc));
         });
     });
 }
@@ -421,10 +408,10 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
         auto accessor_c = c.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_zsyr2k>(cgh, [=]() {
             ::cblas_zsyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void *)&alpha,
-                           accessor_a.get_pointer(), (const int)lda, accessor_b.get_pointer(),
-                           (const int)ldb, (const void *)&beta, accessor_c.get_pointer(),
-                           (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void *)&alpha,
+                           accessor_a.get_pointer(), to_cblas_int(lda), accessor_b.get_pointer(),
+                           to_cblas_int(ldb), (const void *)&beta, accessor_c.get_pointer(),
+                           to_cblas_int(ldc));
         });
     });
 }
@@ -432,15 +419,13 @@ void syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
 void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
           diag unit_diag, int64_t m, int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
           int64_t lda, cl::sycl::buffer<float, 1> &b, int64_t ldb) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_strmm>(cgh, [=]() {
-            ::cblas_strmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb);
+            tiled_trmm<float>(threads, MAJOR, left_right, upper_lower, transa, unit_diag, m, n,
+                              alpha, accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb);
         });
     });
 }
@@ -448,15 +433,13 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
 void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
           diag unit_diag, int64_t m, int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
           int64_t lda, cl::sycl::buffer<double, 1> &b, int64_t ldb) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dtrmm>(cgh, [=]() {
-            ::cblas_dtrmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb);
+            tiled_trmm<double>(threads, MAJOR, left_right, upper_lower, transa, unit_diag, m, n,
+                               alpha, accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb);
         });
     });
 }
@@ -465,15 +448,14 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
           diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
           cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ctrmm>(cgh, [=]() {
-            ::cblas_ctrmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb);
+            tiled_trmm<std::complex<float>>(threads, MAJOR, left_right, upper_lower, transa,
+                                            unit_diag, m, n, alpha, accessor_a.get_pointer(), lda,
+                                            accessor_b.get_pointer(), ldb);
         });
     });
 }
@@ -482,15 +464,14 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
           diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
           cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ztrmm>(cgh, [=]() {
-            ::cblas_ztrmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb);
+            tiled_trmm<std::complex<double>>(threads, MAJOR, left_right, upper_lower, transa,
+                                             unit_diag, m, n, alpha, accessor_a.get_pointer(), lda,
+                                             accessor_b.get_pointer(), ldb);
         });
     });
 }
@@ -498,15 +479,13 @@ void trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
 void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
           diag unit_diag, int64_t m, int64_t n, float alpha, cl::sycl::buffer<float, 1> &a,
           int64_t lda, cl::sycl::buffer<float, 1> &b, int64_t ldb) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_strsm>(cgh, [=]() {
-            ::cblas_strsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb);
+            tiled_trsm<float>(threads, MAJOR, left_right, upper_lower, transa, unit_diag, m, n,
+                              alpha, accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb);
         });
     });
 }
@@ -514,15 +493,13 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
 void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
           diag unit_diag, int64_t m, int64_t n, double alpha, cl::sycl::buffer<double, 1> &a,
           int64_t lda, cl::sycl::buffer<double, 1> &b, int64_t ldb) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_dtrsm>(cgh, [=]() {
-            ::cblas_dtrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb);
+            tiled_trsm<double>(threads, MAJOR, left_right, upper_lower, transa, unit_diag, m, n,
+                               alpha, accessor_a.get_pointer(), lda, accessor_b.get_pointer(), ldb);
         });
     });
 }
@@ -531,15 +508,14 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
           diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
           cl::sycl::buffer<std::complex<float>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<float>, 1> &b, int64_t ldb) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ctrsm>(cgh, [=]() {
-            ::cblas_ctrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb);
+            tiled_trsm<std::complex<float>>(threads, MAJOR, left_right, upper_lower, transa,
+                                            unit_diag, m, n, alpha, accessor_a.get_pointer(), lda,
+                                            accessor_b.get_pointer(), ldb);
         });
     });
 }
@@ -548,15 +524,14 @@ void trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose t
           diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
           cl::sycl::buffer<std::complex<double>, 1> &a, int64_t lda,
           cl::sycl::buffer<std::complex<double>, 1> &b, int64_t ldb) {
+    const int threads = get_level3_threads(queue);
     queue.submit([&](cl::sycl::handler &cgh) {
         auto accessor_a = a.get_access<cl::sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<cl::sycl::access::mode::read_write>(cgh);
         host_task<class netlib_ztrsm>(cgh, [=]() {
-            ::cblas_ztrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, accessor_a.get_pointer(), (const int)lda,
-                          accessor_b.get_pointer(), (const int)ldb);
+            tiled_trsm<std::complex<double>>(threads, MAJOR, left_right, upper_lower, transa,
+                                             unit_diag, m, n, alpha, accessor_a.get_pointer(), lda,
+                                             accessor_b.get_pointer(), ldb);
         });
     });
 }
@@ -567,15 +542,15 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      int64_t n, int64_t k, float alpha, const float *a, int64_t lda, const float *b,
                      int64_t ldb, float beta, float *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_sgemm_usm>(cgh, [=]() {
-            ::cblas_sgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const float)alpha, a,
-                          (const int)lda, b, (const int)ldb, (const float)beta, c, (const int)ldc);
+            tiled_gemm(threads, MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                       ldc);
         });
     });
     return done;
@@ -585,15 +560,15 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      int64_t n, int64_t k, double alpha, const double *a, int64_t lda,
                      const double *b, int64_t ldb, double beta, double *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dgemm_usm>(cgh, [=]() {
-            ::cblas_dgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const double)alpha, a,
-                          (const int)lda, b, (const int)ldb, (const double)beta, c, (const int)ldc);
+            tiled_gemm(threads, MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                       ldc);
         });
     });
     return done;
@@ -604,16 +579,15 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      int64_t lda, const std::complex<float> *b, int64_t ldb,
                      std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_cgemm_usm>(cgh, [=]() {
-            ::cblas_cgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha, a,
-                          (const int)lda, b, (const int)ldb, (const void *)&beta, c,
-                          (const int)ldc);
+            tiled_gemm(threads, MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                       ldc);
         });
     });
     return done;
@@ -624,16 +598,15 @@ cl::sycl::event gemm(cl::sycl::queue &queue, transpose transa, transpose transb,
                      const std::complex<double> *a, int64_t lda, const std::complex<double> *b,
                      int64_t ldb, std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zgemm_usm>(cgh, [=]() {
-            ::cblas_zgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void *)&alpha, a,
-                          (const int)lda, b, (const int)ldb, (const void *)&beta, c,
-                          (const int)ldc);
+            tiled_gemm(threads, MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                       ldc);
         });
     });
     return done;
@@ -680,16 +653,15 @@ cl::sycl::event hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t lda, const std::complex<float> *b, int64_t ldb,
                      std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_chemm_usm>(cgh, [=]() {
-            ::cblas_chemm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb,
-                          (const void *)&beta, c, (const int)ldc);
+            tiled_hemm(threads, MAJOR, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta,
+                       c, ldc);
         });
     });
     return done;
@@ -700,16 +672,15 @@ cl::sycl::event hemm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t lda, const std::complex<double> *b, int64_t ldb,
                      std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zhemm_usm>(cgh, [=]() {
-            ::cblas_zhemm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb,
-                          (const void *)&beta, c, (const int)ldc);
+            tiled_hemm(threads, MAJOR, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta,
+                       c, ldc);
         });
     });
     return done;
@@ -719,15 +690,14 @@ cl::sycl::event herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t k, float alpha, const std::complex<float> *a, int64_t lda, float beta,
                      std::complex<float> *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_cherk_usm>(cgh, [=]() {
-            ::cblas_cherk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const float)alpha, a, (const int)lda,
-                          (const float)beta, c, (const int)ldc);
+            tiled_herk(threads, MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
     return done;
@@ -737,15 +707,14 @@ cl::sycl::event herk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t k, double alpha, const std::complex<double> *a, int64_t lda,
                      double beta, std::complex<double> *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zherk_usm>(cgh, [=]() {
-            ::cblas_zherk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const double)alpha, a, (const int)lda,
-                          (const double)beta, c, (const int)ldc);
+            tiled_herk(threads, MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
     return done;
@@ -763,8 +732,9 @@ cl::sycl::event her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_cher2k_usm>(cgh, [=]() {
             ::cblas_cher2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void *)&alpha, a, (const int)lda, b,
-                           (const int)ldb, (const float)beta, c, (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void *)&alpha, a,
+                           to_cblas_int(lda), b, to_cblas_int(ldb), (const float)beta, c,
+                           to_cblas_int(ldc));
         });
     });
     return done;
@@ -782,8 +752,9 @@ cl::sycl::event her2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_zher2k_usm>(cgh, [=]() {
             ::cblas_zher2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void *)&alpha, a, (const int)lda, b,
-                           (const int)ldb, (const double)beta, c, (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void *)&alpha, a,
+                           to_cblas_int(lda), b, to_cblas_int(ldb), (const double)beta, c,
+                           to_cblas_int(ldc));
         });
     });
     return done;
@@ -793,16 +764,15 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t n, float alpha, const float *a, int64_t lda, const float *b,
                      int64_t ldb, float beta, float *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ssymm_usm>(cgh, [=]() {
-            ::cblas_ssymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, b, (const int)ldb,
-                          (const float)beta, c, (const int)ldc);
+            tiled_symm(threads, MAJOR, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta,
+                       c, ldc);
         });
     });
     return done;
@@ -812,16 +782,15 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t n, double alpha, const double *a, int64_t lda, const double *b,
                      int64_t ldb, double beta, double *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dsymm_usm>(cgh, [=]() {
-            ::cblas_dsymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, b, (const int)ldb,
-                          (const double)beta, c, (const int)ldc);
+            tiled_symm(threads, MAJOR, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta,
+                       c, ldc);
         });
     });
     return done;
@@ -832,16 +801,15 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t lda, const std::complex<float> *b, int64_t ldb,
                      std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_csymm_usm>(cgh, [=]() {
-            ::cblas_csymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb,
-                          (const void *)&beta, c, (const int)ldc);
+            tiled_symm(threads, MAJOR, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta,
+                       c, ldc);
         });
     });
     return done;
@@ -852,16 +820,15 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      int64_t lda, const std::complex<double> *b, int64_t ldb,
                      std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zsymm_usm>(cgh, [=]() {
-            ::cblas_zsymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb,
-                          (const void *)&beta, c, (const int)ldc);
+            tiled_symm(threads, MAJOR, left_right, upper_lower, m, n, alpha, a, lda, b, ldb, beta,
+                       c, ldc);
         });
     });
     return done;
@@ -870,15 +837,14 @@ cl::sycl::event symm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
 cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                      int64_t k, float alpha, const float *a, int64_t lda, float beta, float *c,
                      int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ssyrk_usm>(cgh, [=]() {
-            ::cblas_ssyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const float)alpha, a, (const int)lda,
-                          (const float)beta, c, (const int)ldc);
+            tiled_syrk(threads, MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
     return done;
@@ -887,15 +853,14 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans, int64_t n,
                      int64_t k, double alpha, const double *a, int64_t lda, double beta, double *c,
                      int64_t ldc, const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dsyrk_usm>(cgh, [=]() {
-            ::cblas_dsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const double)alpha, a, (const int)lda,
-                          (const double)beta, c, (const int)ldc);
+            tiled_syrk(threads, MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
     return done;
@@ -905,15 +870,14 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t k, std::complex<float> alpha, const std::complex<float> *a,
                      int64_t lda, std::complex<float> beta, std::complex<float> *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_csyrk_usm>(cgh, [=]() {
-            ::cblas_csyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void *)&alpha, a, (const int)lda,
-                          (const void *)&beta, c, (const int)ldc);
+            tiled_syrk(threads, MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
     return done;
@@ -923,15 +887,14 @@ cl::sycl::event syrk(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
                      int64_t k, std::complex<double> alpha, const std::complex<double> *a,
                      int64_t lda, std::complex<double> beta, std::complex<double> *c, int64_t ldc,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_zsyrk_usm>(cgh, [=]() {
-            ::cblas_zsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void *)&alpha, a, (const int)lda,
-                          (const void *)&beta, c, (const int)ldc);
+            tiled_syrk(threads, MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc);
         });
     });
     return done;
@@ -948,8 +911,9 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_ssyr2k_usm>(cgh, [=]() {
             ::cblas_ssyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const float)alpha, a, (const int)lda, b,
-                           (const int)ldb, (const float)beta, c, (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const float)alpha, a,
+                           to_cblas_int(lda), b, to_cblas_int(ldb), (const float)beta, c,
+                           to_cblas_int(ldc));
         });
     });
     return done;
@@ -966,8 +930,9 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_dsyr2k_usm>(cgh, [=]() {
             ::cblas_dsyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const double)alpha, a, (const int)lda, b,
-                           (const int)ldb, (const double)beta, c, (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const double)alpha, a,
+                           to_cblas_int(lda), b, to_cblas_int(ldb), (const double)beta, c,
+                           to_cblas_int(ldc));
         });
     });
     return done;
@@ -985,8 +950,9 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_csyr2k_usm>(cgh, [=]() {
             ::cblas_csyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void *)&alpha, a, (const int)lda, b,
-                           (const int)ldb, (const void *)&beta, c, (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void *)&alpha, a,
+                           to_cblas_int(lda), b, to_cblas_int(ldb), (const void *)&beta, c,
+                           to_cblas_int(ldc));
         });
     });
     return done;
@@ -1004,8 +970,9 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
         }
         host_task<class netlib_zsyr2k_usm>(cgh, [=]() {
             ::cblas_zsyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void *)&alpha, a, (const int)lda, b,
-                           (const int)ldb, (const void *)&beta, c, (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void *)&alpha, a,
+                           to_cblas_int(lda), b, to_cblas_int(ldb), (const void *)&beta, c,
+                           to_cblas_int(ldc));
         });
     });
     return done;
@@ -1014,16 +981,15 @@ cl::sycl::event syr2k(cl::sycl::queue &queue, uplo upper_lower, transpose trans,
 cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
                      diag unit_diag, int64_t m, int64_t n, float alpha, const float *a, int64_t lda,
                      float *b, int64_t ldb, const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_strmm_usm>(cgh, [=]() {
-            ::cblas_strmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, b, (const int)ldb);
+            tiled_trmm(threads, MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a,
+                       lda, b, ldb);
         });
     });
     return done;
@@ -1033,16 +999,15 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      diag unit_diag, int64_t m, int64_t n, double alpha, const double *a,
                      int64_t lda, double *b, int64_t ldb,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dtrmm_usm>(cgh, [=]() {
-            ::cblas_dtrmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, b, (const int)ldb);
+            tiled_trmm(threads, MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a,
+                       lda, b, ldb);
         });
     });
     return done;
@@ -1052,16 +1017,15 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *a, int64_t lda, std::complex<float> *b, int64_t ldb,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ctrmm_usm>(cgh, [=]() {
-            ::cblas_ctrmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+            tiled_trmm(threads, MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a,
+                       lda, b, ldb);
         });
     });
     return done;
@@ -1071,16 +1035,15 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
                      const std::complex<double> *a, int64_t lda, std::complex<double> *b,
                      int64_t ldb, const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ztrmm_usm>(cgh, [=]() {
-            ::cblas_ztrmm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+            tiled_trmm(threads, MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a,
+                       lda, b, ldb);
         });
     });
     return done;
@@ -1089,16 +1052,15 @@ cl::sycl::event trmm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
 cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower, transpose transa,
                      diag unit_diag, int64_t m, int64_t n, float alpha, const float *a, int64_t lda,
                      float *b, int64_t ldb, const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_strsm_usm>(cgh, [=]() {
-            ::cblas_strsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, b, (const int)ldb);
+            tiled_trsm(threads, MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a,
+                       lda, b, ldb);
         });
     });
     return done;
@@ -1108,16 +1070,15 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      diag unit_diag, int64_t m, int64_t n, double alpha, const double *a,
                      int64_t lda, double *b, int64_t ldb,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_dtrsm_usm>(cgh, [=]() {
-            ::cblas_dtrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, b, (const int)ldb);
+            tiled_trsm(threads, MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a,
+                       lda, b, ldb);
         });
     });
     return done;
@@ -1127,16 +1088,15 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
                      const std::complex<float> *a, int64_t lda, std::complex<float> *b, int64_t ldb,
                      const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ctrsm_usm>(cgh, [=]() {
-            ::cblas_ctrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+            tiled_trsm(threads, MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a,
+                       lda, b, ldb);
         });
     });
     return done;
@@ -1146,16 +1106,15 @@ cl::sycl::event trsm(cl::sycl::queue &queue, side left_right, uplo upper_lower,
                      diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
                      const std::complex<double> *a, int64_t lda, std::complex<double> *b,
                      int64_t ldb, const std::vector<cl::sycl::event> &dependencies) {
+    const int threads = get_level3_threads(queue);
     auto done = queue.submit([&](cl::sycl::handler &cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
         host_task<class netlib_ztrsm_usm>(cgh, [=]() {
-            ::cblas_ztrsm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void *)&alpha, a, (const int)lda, b, (const int)ldb);
+            tiled_trsm(threads, MAJOR, left_right, upper_lower, transa, unit_diag, m, n, alpha, a,
+                       lda, b, ldb);
         });
     });
     return done;
@@ -0,0 +1,235 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "netlib_common.hpp"
+#include "oneapi/mkl/blas/detail/netlib/onemkl_blas_netlib.hpp"
+#include "oneapi/mkl/exceptions.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace netlib {
+
+namespace {
+
+// Worker threads started on first use and stopped at exit. A call of run publishes a job whose
+// parts are claimed one at a time by the calling thread and by up to threads - 1 idle workers.
+// Parts are claimed as threads become free, so threads that finish early take over the remaining
+// parts of slower ones.
+class thread_pool {
+public:
+    explicit thread_pool(int threads) {
+        for (int i = 1; i < threads; i++)
+            workers_.emplace_back([this] { work(); });
+    }
+
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        work_ready_.notify_all();
+        for (auto &worker : workers_)
+            worker.join();
+    }
+
+    int size() const {
+        return static_cast<int>(workers_.size()) + 1;
+    }
+
+    void run(int64_t parts, int threads, const std::function<void(int64_t)> &f) {
+        job j{ &f, parts, threads - 1 };
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            jobs_.push_back(&j);
+        }
+        work_ready_.notify_all();
+        run_parts(j);
+        std::unique_lock<std::mutex> lock(mutex_);
+        // All parts are claimed once run_parts returns, so no worker may pick the job up again.
+        auto it = std::find(jobs_.begin(), jobs_.end(), &j);
+        if (it != jobs_.end())
+            jobs_.erase(it);
+        job_done_.wait(lock, [&] { return j.workers == 0; });
+        if (j.error)
+            std::rethrow_exception(j.error);
+    }
+
+private:
+    struct job {
+        const std::function<void(int64_t)> *f;
+        int64_t parts;
+        int max_workers;
+        std::atomic<int64_t> next{ 0 };
+        // Workers running parts of the job, guarded by the pool mutex.
+        int workers = 0;
+        std::exception_ptr error;
+        std::mutex error_mutex;
+    };
+
+    static void run_parts(job &j) {
+        for (int64_t part = j.next++; part < j.parts; part = j.next++) {
+            try {
+                (*j.f)(part);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(j.error_mutex);
+                if (!j.error)
+                    j.error = std::current_exception();
+            }
+        }
+    }
+
+    // First job that takes another worker, or nullptr. Called with the mutex held.
+    job *open_job() {
+        for (job *j : jobs_) {
+            if (j->workers < j->max_workers)
+                return j;
+        }
+        return nullptr;
+    }
+
+    void work() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            job *j = nullptr;
+            work_ready_.wait(lock, [&] { return stop_ || (j = open_job()) != nullptr; });
+            if (stop_)
+                return;
+            j->workers++;
+            lock.unlock();
+            run_parts(*j);
+            lock.lock();
+            auto it = std::find(jobs_.begin(), jobs_.end(), j);
+            if (it != jobs_.end())
+                jobs_.erase(it);
+            if (--j->workers == 0)
+                job_done_.notify_all();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable work_ready_;
+    std::condition_variable job_done_;
+    std::deque<job *> jobs_;
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+};
+
+thread_pool &pool() {
+    static thread_pool instance(num_threads());
+    return instance;
+}
+
+// Level 3 threads of the queues that do not use the default value, keyed on the std::hash of the
+// queue so that the registry does not keep the queues alive.
+struct level3_registry {
+    std::mutex mutex;
+    std::unordered_map<std::size_t, int> queues;
+    // Lets the call path skip the lock until a thread count is set on some queue.
+    std::atomic<bool> empty{ true };
+};
+
+level3_registry &registry() {
+    static level3_registry instance;
+    return instance;
+}
+
+int default_level3_threads() {
+    static const int threads = [] {
+        const char *env = std::getenv("ONEMKL_NETLIB_LEVEL3_THREADS");
+        int value = env != nullptr ? std::atoi(env) : 0;
+        return std::max(value, 1);
+    }();
+    return threads;
+}
+
+} // namespace
+
+int exchange_level3_threads(std::size_t queue_key, int threads) {
+    if (threads < 1)
+        throw invalid_argument("blas", "level3_threads_scope", "threads must be at least 1");
+    auto &reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    auto it = reg.queues.find(queue_key);
+    int previous = default_level3_threads();
+    if (it != reg.queues.end()) {
+        previous = it->second;
+        reg.queues.erase(it);
+    }
+    if (threads != default_level3_threads())
+        reg.queues.emplace(queue_key, threads);
+    reg.empty.store(reg.queues.empty(), std::memory_order_release);
+    return previous;
+}
+
+int get_level3_threads(const cl::sycl::queue &queue) {
+    auto &reg = registry();
+    if (reg.empty.load(std::memory_order_acquire))
+        return default_level3_threads();
+    const std::size_t queue_key = std::hash<cl::sycl::queue>{}(queue);
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    auto it = reg.queues.find(queue_key);
+    return (it != reg.queues.end()) ? it->second : default_level3_threads();
+}
+
+int num_threads() {
+    static const int threads = [] {
+        const char *env = std::getenv("ONEMKL_NETLIB_NUM_THREADS");
+        int value = env != nullptr ? std::atoi(env) : 0;
+        if (value <= 0)
+            value = static_cast<int>(std::thread::hardware_concurrency());
+        return std::max(value, 1);
+    }();
+    return threads;
+}
+
+void parallel_for(int64_t parts, const std::function<void(int64_t part)> &f) {
+    parallel_for(parts, num_threads(), f);
+}
+
+void parallel_for(int64_t parts, int threads, const std::function<void(int64_t part)> &f) {
+    if (parts <= 0)
+        return;
+    threads = std::min(threads, num_threads());
+    if (parts == 1 || threads <= 1) {
+        for (int64_t part = 0; part < parts; part++)
+            f(part);
+        return;
+    }
+    pool().run(parts, threads, f);
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
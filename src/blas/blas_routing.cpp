@@ -0,0 +1,323 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "oneapi/mkl/blas/detail/blas_loader.hpp"
+
+#include "function_table_initializer.hpp"
+#include "blas/blas_routing.hpp"
+#include "blas/function_table.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace detail {
+
+namespace {
+
+using oneapi::mkl::detail::routing_table;
+using loader = oneapi::mkl::detail::table_initializer<domain::blas, blas_function_table_t>;
+namespace cm = oneapi::mkl::blas::column_major::detail;
+
+// Each size is timed once to warm up, then up to calibration_runs times or until
+// calibration_seconds have been spent, and the best time is kept.
+constexpr int calibration_runs = 5;
+constexpr double calibration_seconds = 0.02;
+
+// Another backend replaces the default one at a size only if it is faster by this factor, so
+// that timing noise does not produce rules.
+constexpr double calibration_margin = 0.9;
+
+// Problem dimensions timed for level 1 (n), level 2 (m = n) and level 3 (m = n = k) routines.
+// Larger sizes are skipped once the default backend has won twice in a row.
+const std::vector<std::int64_t> level1_dims = { 64, 256, 1024, 4096, 16384, 65536, 262144 };
+const std::vector<std::int64_t> level2_dims = { 8, 16, 32, 64, 128, 256, 512 };
+const std::vector<std::int64_t> level3_dims = { 4, 8, 16, 32, 64, 128, 256 };
+constexpr std::int64_t max_elements = 512 * 512;
+
+// Makes the routed calls of this thread use one backend while it exists
+class force_backend {
+public:
+    explicit force_backend(const std::string &backend) {
+        routing_table::forced_backend() = backend.c_str();
+    }
+    ~force_backend() {
+        routing_table::forced_backend() = nullptr;
+    }
+};
+
+// USM operands of the calibration calls. The values keep repeated in-place updates (axpy, trmm,
+// trsm with a unit diagonal) finite and avoid the zero entries reference BLAS skips.
+template <typename T>
+class operands {
+    using real_t = decltype(std::abs(T()));
+
+public:
+    explicit operands(cl::sycl::queue &queue) : queue(queue) {
+        a = cl::sycl::malloc_shared<T>(max_elements, queue);
+        b = cl::sycl::malloc_shared<T>(max_elements, queue);
+        c = cl::sycl::malloc_shared<T>(max_elements, queue);
+        result = cl::sycl::malloc_shared<T>(1, queue);
+        real_result = cl::sycl::malloc_shared<real_t>(1, queue);
+        double_result = cl::sycl::malloc_shared<double>(1, queue);
+        if (!a || !b || !c || !result || !real_result || !double_result) {
+            release();
+            throw std::bad_alloc();
+        }
+        std::fill(a, a + max_elements, T(0.001));
+        std::fill(b, b + max_elements, T(0.5));
+        std::fill(c, c + max_elements, T(0.5));
+    }
+    ~operands() {
+        release();
+    }
+    operands(const operands &) = delete;
+    operands &operator=(const operands &) = delete;
+
+    T *a = nullptr, *b = nullptr, *c = nullptr, *result = nullptr;
+    real_t *real_result = nullptr;
+    double *double_result = nullptr;
+
+private:
+    void release() {
+        for (void *p : { (void *)a, (void *)b, (void *)c, (void *)result, (void *)real_result,
+                         (void *)double_result }) {
+            if (p)
+                cl::sycl::free(p, queue);
+        }
+    }
+
+    cl::sycl::queue &queue;
+};
+
+class calibrator {
+public:
+    calibrator(cl::sycl::queue &queue, oneapi::mkl::device libkey,
+               const std::string &default_backend, std::ostream &rules)
+            : queue(queue),
+              libkey(libkey),
+              backends(loader::backend_names(libkey)),
+              default_backend(default_backend),
+              rules(rules) {}
+
+    // Times variant on every backend implementing it for each dimension in dims, and appends the
+    // rules selecting the fastest backend by size. The routing size of a dimension is
+    // dim^dim_power, run(dim) submits one call and returns its event.
+    template <typename Run>
+    void variant(const std::string &name, const std::vector<std::int64_t> &dims, int dim_power,
+                 Run &&run) {
+        std::vector<std::string> candidates;
+        for (const auto &backend : backends) {
+            if (backend != default_backend && routing().implemented(backend, name))
+                candidates.push_back(backend);
+        }
+        if (candidates.empty() || !routing().implemented(default_backend, name))
+            return;
+
+        // Fastest backend at each routing size
+        std::vector<std::pair<std::int64_t, std::string>> winners;
+        int default_wins = 0;
+        for (std::int64_t dim : dims) {
+            const std::string *best = &default_backend;
+            double best_time = calibration_margin * time(default_backend, run, dim);
+            for (const auto &backend : candidates) {
+                const double t = time(backend, run, dim);
+                if (t < best_time) {
+                    best_time = t;
+                    best = &backend;
+                }
+            }
+            winners.emplace_back(static_cast<std::int64_t>(std::pow(dim, dim_power)), *best);
+            default_wins = *best == default_backend ? default_wins + 1 : 0;
+            if (default_wins == 2)
+                break;
+        }
+
+        // One rule per run of sizes with the same winner, up to the geometric mean of the last
+        // size of the run and the first size of the next one. Sizes after the last run of another
+        // backend need no rule.
+        std::size_t last = winners.size();
+        while (last > 0 && winners[last - 1].second == default_backend)
+            last--;
+        for (std::size_t i = 0; i < last; i++) {
+            if (i + 1 < last && winners[i + 1].second == winners[i].second)
+                continue;
+            const std::int64_t bound =
+                i + 1 < winners.size()
+                    ? static_cast<std::int64_t>(
+                          std::sqrt(double(winners[i].first) * double(winners[i + 1].first)))
+                    : std::numeric_limits<std::int64_t>::max();
+            rules << name << ' ' << bound << ' ' << winners[i].second << '\n';
+        }
+    }
+
+    cl::sycl::queue &queue;
+    const oneapi::mkl::device libkey;
+
+private:
+    template <typename Run>
+    double time(const std::string &backend, Run &run, std::int64_t dim) {
+        using clock = std::chrono::steady_clock;
+        force_backend force(backend);
+        run(dim).wait_and_throw();
+        double best = std::numeric_limits<double>::infinity(), spent = 0.0;
+        for (int i = 0; i < calibration_runs && spent < calibration_seconds; i++) {
+            const auto start = clock::now();
+            run(dim).wait_and_throw();
+            const double t = std::chrono::duration<double>(clock::now() - start).count();
+            best = std::min(best, t);
+            spent += t;
+        }
+        return best;
+    }
+
+    const std::vector<std::string> backends;
+    const std::string default_backend;
+    std::ostream &rules;
+};
+
+// Calibrates the routed variants of precision T. prefix is the BLAS prefix of T, real_prefix the
+// one of asum and nrm2 (s, d, sc, dz), whose first letter also names the real scal (csscal).
+template <typename T>
+void calibrate_precision(calibrator &c, const std::string &prefix, const std::string &real_prefix) {
+    constexpr bool complex = !std::is_same<T, decltype(std::abs(T()))>::value;
+    operands<T> x(c.queue);
+    const auto libkey = c.libkey;
+    auto &queue = c.queue;
+    const T one(1), zero(0);
+    const auto l = side::left;
+    const auto u = uplo::upper;
+    const auto nt = transpose::nontrans;
+    const auto unit = diag::unit;
+
+    c.variant(real_prefix + "asum", level1_dims, 1, [&](std::int64_t n) {
+        return cm::asum(libkey, queue, n, x.b, 1, x.real_result);
+    });
+    c.variant(prefix + "axpy", level1_dims, 1, [&](std::int64_t n) {
+        return cm::axpy(libkey, queue, n, one, x.b, 1, x.c, 1);
+    });
+    c.variant(prefix + "copy", level1_dims, 1, [&](std::int64_t n) {
+        return cm::copy(libkey, queue, n, x.b, 1, x.c, 1);
+    });
+    c.variant(real_prefix + "nrm2", level1_dims, 1, [&](std::int64_t n) {
+        return cm::nrm2(libkey, queue, n, x.b, 1, x.real_result);
+    });
+    c.variant(prefix + "scal", level1_dims, 1, [&](std::int64_t n) {
+        return cm::scal(libkey, queue, n, one, x.c, 1);
+    });
+    c.variant(prefix + "swap", level1_dims, 1, [&](std::int64_t n) {
+        return cm::swap(libkey, queue, n, x.b, 1, x.c, 1);
+    });
+    c.variant(prefix + "gemv", level2_dims, 2, [&](std::int64_t n) {
+        return cm::gemv(libkey, queue, nt, n, n, one, x.a, n, x.b, 1, zero, x.c, 1);
+    });
+    c.variant(prefix + "gemm", level3_dims, 3, [&](std::int64_t n) {
+        return cm::gemm(libkey, queue, nt, nt, n, n, n, one, x.a, n, x.b, n, zero, x.c, n);
+    });
+    c.variant(prefix + "symm", level3_dims, 3, [&](std::int64_t n) {
+        return cm::symm(libkey, queue, l, u, n, n, one, x.a, n, x.b, n, zero, x.c, n);
+    });
+    c.variant(prefix + "syrk", level3_dims, 3, [&](std::int64_t n) {
+        return cm::syrk(libkey, queue, u, nt, n, n, one, x.a, n, zero, x.c, n);
+    });
+    c.variant(prefix + "trmm", level3_dims, 3, [&](std::int64_t n) {
+        return cm::trmm(libkey, queue, l, u, nt, unit, n, n, one, x.a, n, x.b, n);
+    });
+    c.variant(prefix + "trsm", level3_dims, 3, [&](std::int64_t n) {
+        return cm::trsm(libkey, queue, l, u, nt, unit, n, n, one, x.a, n, x.b, n);
+    });
+    if constexpr (complex) {
+        const auto real_one = decltype(std::abs(T()))(1);
+        c.variant(prefix + real_prefix.substr(0, 1) + "scal", level1_dims, 1,
+                  [&](std::int64_t n) { return cm::scal(libkey, queue, n, real_one, x.c, 1); });
+    }
+    else {
+        c.variant(prefix + "dot", level1_dims, 1, [&](std::int64_t n) {
+            return cm::dot(libkey, queue, n, x.b, 1, x.c, 1, x.result);
+        });
+        c.variant(prefix + "ger", level2_dims, 2, [&](std::int64_t n) {
+            return cm::ger(libkey, queue, n, n, one, x.b, 1, x.b, 1, x.c, n);
+        });
+        c.variant(prefix + "symv", level2_dims, 2, [&](std::int64_t n) {
+            return cm::symv(libkey, queue, u, n, one, x.a, n, x.b, 1, zero, x.c, 1);
+        });
+        if constexpr (std::is_same<T, float>::value) {
+            c.variant("dsdot", level1_dims, 1, [&](std::int64_t n) {
+                return cm::dot(libkey, queue, n, x.b, 1, x.c, 1, x.double_result);
+            });
+        }
+    }
+}
+
+} // namespace
+
+oneapi::mkl::detail::routing_table &routing() {
+    static oneapi::mkl::detail::routing_table table(
+        { { { "asum", { "sasum", "dasum", "scasum", "dzasum" } },
+            { "axpy", { "saxpy", "daxpy", "caxpy", "zaxpy" } },
+            { "copy", { "scopy", "dcopy", "ccopy", "zcopy" } },
+            { "dot", { "sdot", "ddot", "dsdot" } },
+            { "nrm2", { "snrm2", "dnrm2", "scnrm2", "dznrm2" } },
+            { "scal", { "sscal", "dscal", "cscal", "zscal", "csscal", "zdscal" } },
+            { "swap", { "sswap", "dswap", "cswap", "zswap" } },
+            { "gemv", { "sgemv", "dgemv", "cgemv", "zgemv" } },
+            { "ger", { "sger", "dger" } },
+            { "symv", { "ssymv", "dsymv" } },
+            { "gemm",
+              { "sgemm", "dgemm", "cgemm", "zgemm", "hgemm", "gemm_f16f16f32",
+                "gemm_bf16bf16f32" } },
+            { "symm", { "ssymm", "dsymm", "csymm", "zsymm" } },
+            { "syrk", { "ssyrk", "dsyrk", "csyrk", "zsyrk" } },
+            { "trmm", { "strmm", "dtrmm", "ctrmm", "ztrmm" } },
+            { "trsm", { "strsm", "dtrsm", "ctrsm", "ztrsm" } } },
+          loader::backend_names(),
+          { { "netlib", "hgemm" },
+            { "netlib", "gemm_f16f16f32" },
+            { "netlib", "gemm_bf16bf16f32" },
+            { "cublas", "dsdot" },
+            { "cublas", "gemm_bf16bf16f32" } } },
+        "ONEMKL_BLAS_ROUTING", "ONEMKL_BLAS_ROUTING_FILE", "ONEMKL_BLAS_ROUTING_CACHE");
+    return table;
+}
+
+void prepare_routing(cl::sycl::queue &queue, oneapi::mkl::device libkey, const char *library) {
+    const std::string device = queue.get_device().get_info<cl::sycl::info::device::name>();
+    routing().prepare(device, [&](std::ostream &rules) {
+        calibrator c(queue, libkey, loader::backend_name(library), rules);
+        calibrate_precision<float>(c, "s", "s");
+        calibrate_precision<double>(c, "d", "d");
+        calibrate_precision<std::complex<float>>(c, "c", "sc");
+        calibrate_precision<std::complex<double>>(c, "z", "dz");
+    });
+}
+
+} //namespace detail
+} //namespace blas
+} //namespace mkl
+} //namespace oneapi
@@ -0,0 +1,53 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BLAS_ROUTING_HPP_
+#define _ONEMKL_BLAS_ROUTING_HPP_
+
+#include <CL/sycl.hpp>
+
+#include "oneapi/mkl/detail/backends_table.hpp"
+
+#include "backend_routing.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace detail {
+
+// Size-based routing of the run-time BLAS API between the backends of a device.
+//
+// Rules come from ONEMKL_BLAS_ROUTING_FILE and ONEMKL_BLAS_ROUTING (see backend_routing.hpp) and
+// from the calibration cache named by ONEMKL_BLAS_ROUTING_CACHE. Routines are routed by variant,
+// the BLAS name of the routine for one precision (sgemm, dznrm2, csscal, gemm_f16f16f32, ...).
+// The routing size is n for level 1 routines, m * n for gemv and ger, n * n for symv,
+// m * n * k for gemm, n * n * k for syrk and m * n times the order of A for symm, trmm and trsm.
+oneapi::mkl::detail::routing_table &routing();
+
+// Loads the calibration cache on the first routed call, or, if there is none for the device of
+// queue, times each routed variant on every backend of libkey and writes the cache. library is
+// the default backend library of libkey.
+void prepare_routing(cl::sycl::queue &queue, oneapi::mkl::device libkey, const char *library);
+
+} //namespace detail
+} //namespace blas
+} //namespace mkl
+} //namespace oneapi
+
+#endif //_ONEMKL_BLAS_ROUTING_HPP_
@@ -984,6 +984,42 @@ typedef struct {
         cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
         cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo, float beta,
         cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co);
+    std::int64_t (*column_major_sgemm_pack_get_size_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, std::int64_t m, std::int64_t n,
+        std::int64_t k);
+    std::int64_t (*column_major_dgemm_pack_get_size_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, std::int64_t m, std::int64_t n,
+        std::int64_t k);
+    void (*column_major_sgemm_pack_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha,
+        cl::sycl::buffer<float, 1> &src, std::int64_t ld, cl::sycl::buffer<float, 1> &dest);
+    void (*column_major_dgemm_pack_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+        cl::sycl::buffer<double, 1> &src, std::int64_t ld, cl::sycl::buffer<double, 1> &dest);
+    void (*column_major_sgemm_compute_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &packed,
+        cl::sycl::buffer<float, 1> &other, std::int64_t ld, float beta,
+        cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+    void (*column_major_dgemm_compute_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &packed,
+        cl::sycl::buffer<double, 1> &other, std::int64_t ld, double beta,
+        cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+    void (*column_major_cgemm3m_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+        cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+        cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+    void (*column_major_zgemm3m_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+        cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+        cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
 
     // USM APIs
 
@@ -1013,6 +1049,22 @@ typedef struct {
         cl::sycl::queue &queue, std::int64_t n, std::complex<double> alpha,
         const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
         std::int64_t incy, const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_saxpy_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const float *alpha, const float *x,
+        std::int64_t incx, float *y, std::int64_t incy,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_daxpy_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const double *alpha, const double *x,
+        std::int64_t incx, double *y, std::int64_t incy,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_caxpy_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+        const std::complex<float> *x, std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_zaxpy_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+        const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
+        std::int64_t incy, const std::vector<cl::sycl::event> &dependencies);
     cl::sycl::event (*column_major_saxpy_batch_group_usm_sycl)(
         cl::sycl::queue &queue, std::int64_t *n, float *alpha, const float **x, std::int64_t *incx,
         float **y, std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
@@ -1235,6 +1287,26 @@ typedef struct {
     cl::sycl::event (*column_major_zdscal_usm_sycl)(
         cl::sycl::queue &queue, std::int64_t n, double alpha, std::complex<double> *x,
         std::int64_t incx, const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_sscal_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const float *alpha, float *x, std::int64_t incx,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_dscal_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const double *alpha, double *x, std::int64_t incx,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_cscal_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+        std::complex<float> *x, std::int64_t incx,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_csscal_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const float *alpha, std::complex<float> *x,
+        std::int64_t incx, const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_zscal_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+        std::complex<double> *x, std::int64_t incx,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_zdscal_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const double *alpha, std::complex<double> *x,
+        std::int64_t incx, const std::vector<cl::sycl::event> &dependencies);
     cl::sycl::event (*column_major_sdsdot_usm_sycl)(
         cl::sycl::queue &queue, std::int64_t n, float sb, const float *x, std::int64_t incx,
         const float *y, std::int64_t incy, float *result,
@@ -2037,6 +2109,36 @@ typedef struct {
         const std::uint8_t *a, std::int64_t lda, std::uint8_t ao, const std::uint8_t *b,
         std::int64_t ldb, std::uint8_t bo, float beta, std::int32_t *c, std::int64_t ldc,
         const std::int32_t *co, const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_sgemm_pack_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *src,
+        std::int64_t ld, float *dest, const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_dgemm_pack_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *src,
+        std::int64_t ld, double *dest, const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_sgemm_compute_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, const float *packed, const float *other,
+        std::int64_t ld, float beta, float *c, std::int64_t ldc,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_dgemm_compute_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, const double *packed, const double *other,
+        std::int64_t ld, double beta, double *c, std::int64_t ldc,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_cgemm3m_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+        std::int64_t ldb, std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*column_major_zgemm3m_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+        std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+        const std::vector<cl::sycl::event> &dependencies);
 
     // Buffer APIs
 
@@ -2964,6 +3066,42 @@ typedef struct {
         cl::sycl::buffer<uint8_t, 1> &a, std::int64_t lda, uint8_t ao,
         cl::sycl::buffer<uint8_t, 1> &b, std::int64_t ldb, uint8_t bo, float beta,
         cl::sycl::buffer<int32_t, 1> &c, std::int64_t ldc, cl::sycl::buffer<int32_t, 1> &co);
+    std::int64_t (*row_major_sgemm_pack_get_size_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, std::int64_t m, std::int64_t n,
+        std::int64_t k);
+    std::int64_t (*row_major_dgemm_pack_get_size_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, std::int64_t m, std::int64_t n,
+        std::int64_t k);
+    void (*row_major_sgemm_pack_sycl)(cl::sycl::queue &queue, oneapi::mkl::identifier which,
+                                      oneapi::mkl::transpose trans, std::int64_t m, std::int64_t n,
+                                      std::int64_t k, float alpha, cl::sycl::buffer<float, 1> &src,
+                                      std::int64_t ld, cl::sycl::buffer<float, 1> &dest);
+    void (*row_major_dgemm_pack_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha,
+        cl::sycl::buffer<double, 1> &src, std::int64_t ld, cl::sycl::buffer<double, 1> &dest);
+    void (*row_major_sgemm_compute_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, cl::sycl::buffer<float, 1> &packed,
+        cl::sycl::buffer<float, 1> &other, std::int64_t ld, float beta,
+        cl::sycl::buffer<float, 1> &c, std::int64_t ldc);
+    void (*row_major_dgemm_compute_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, cl::sycl::buffer<double, 1> &packed,
+        cl::sycl::buffer<double, 1> &other, std::int64_t ld, double beta,
+        cl::sycl::buffer<double, 1> &c, std::int64_t ldc);
+    void (*row_major_cgemm3m_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        cl::sycl::buffer<std::complex<float>, 1> &a, std::int64_t lda,
+        cl::sycl::buffer<std::complex<float>, 1> &b, std::int64_t ldb, std::complex<float> beta,
+        cl::sycl::buffer<std::complex<float>, 1> &c, std::int64_t ldc);
+    void (*row_major_zgemm3m_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        cl::sycl::buffer<std::complex<double>, 1> &a, std::int64_t lda,
+        cl::sycl::buffer<std::complex<double>, 1> &b, std::int64_t ldb, std::complex<double> beta,
+        cl::sycl::buffer<std::complex<double>, 1> &c, std::int64_t ldc);
 
     // USM APIs
 
@@ -2999,6 +3137,22 @@ typedef struct {
                                                 const std::complex<double> *x, std::int64_t incx,
                                                 std::complex<double> *y, std::int64_t incy,
                                                 const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_saxpy_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const float *alpha, const float *x,
+        std::int64_t incx, float *y, std::int64_t incy,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_daxpy_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const double *alpha, const double *x,
+        std::int64_t incx, double *y, std::int64_t incy,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_caxpy_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+        const std::complex<float> *x, std::int64_t incx, std::complex<float> *y, std::int64_t incy,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_zaxpy_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+        const std::complex<double> *x, std::int64_t incx, std::complex<double> *y,
+        std::int64_t incy, const std::vector<cl::sycl::event> &dependencies);
     cl::sycl::event (*row_major_saxpy_batch_group_usm_sycl)(
         cl::sycl::queue &queue, std::int64_t *n, float *alpha, const float **x, std::int64_t *incx,
         float **y, std::int64_t *incy, std::int64_t group_count, std::int64_t *group_size,
@@ -3248,6 +3402,26 @@ typedef struct {
                                                  double alpha, std::complex<double> *x,
                                                  std::int64_t incx,
                                                  const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_sscal_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const float *alpha, float *x, std::int64_t incx,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_dscal_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const double *alpha, double *x, std::int64_t incx,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_cscal_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const std::complex<float> *alpha,
+        std::complex<float> *x, std::int64_t incx,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_csscal_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const float *alpha, std::complex<float> *x,
+        std::int64_t incx, const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_zscal_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const std::complex<double> *alpha,
+        std::complex<double> *x, std::int64_t incx,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_zdscal_ptr_usm_sycl)(
+        cl::sycl::queue &queue, std::int64_t n, const double *alpha, std::complex<double> *x,
+        std::int64_t incx, const std::vector<cl::sycl::event> &dependencies);
     cl::sycl::event (*row_major_sdsdot_usm_sycl)(cl::sycl::queue &queue, std::int64_t n, float sb,
                                                  const float *x, std::int64_t incx, const float *y,
                                                  std::int64_t incy, float *result,
@@ -4138,6 +4312,36 @@ typedef struct {
         const std::uint8_t *a, std::int64_t lda, std::uint8_t ao, const std::uint8_t *b,
         std::int64_t ldb, std::uint8_t bo, float beta, std::int32_t *c, std::int64_t ldc,
         const std::int32_t *co, const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_sgemm_pack_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, float alpha, const float *src,
+        std::int64_t ld, float *dest, const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_dgemm_pack_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, double alpha, const double *src,
+        std::int64_t ld, double *dest, const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_sgemm_compute_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, const float *packed, const float *other,
+        std::int64_t ld, float beta, float *c, std::int64_t ldc,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_dgemm_compute_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::identifier which, oneapi::mkl::transpose trans,
+        std::int64_t m, std::int64_t n, std::int64_t k, const double *packed, const double *other,
+        std::int64_t ld, double beta, double *c, std::int64_t ldc,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_cgemm3m_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<float> alpha,
+        const std::complex<float> *a, std::int64_t lda, const std::complex<float> *b,
+        std::int64_t ldb, std::complex<float> beta, std::complex<float> *c, std::int64_t ldc,
+        const std::vector<cl::sycl::event> &dependencies);
+    cl::sycl::event (*row_major_zgemm3m_usm_sycl)(
+        cl::sycl::queue &queue, oneapi::mkl::transpose transa, oneapi::mkl::transpose transb,
+        std::int64_t m, std::int64_t n, std::int64_t k, std::complex<double> alpha,
+        const std::complex<double> *a, std::int64_t lda, const std::complex<double> *b,
+        std::int64_t ldb, std::complex<double> beta, std::complex<double> *c, std::int64_t ldc,
+        const std::vector<cl::sycl::event> &dependencies);
 
 } blas_function_table_t;
 
@@ -0,0 +1,252 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_BACKEND_ROUTING_HPP_
+#define _ONEMKL_BACKEND_ROUTING_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+
+// Routines that can be routed and what the backends implement
+struct routing_spec {
+    // Each routed routine with its variants, e.g. gemm -> sgemm, dgemm, cgemm, ...
+    std::vector<std::pair<std::string, std::vector<std::string>>> routines;
+    // Backends that rules can name
+    std::vector<std::string> backends;
+    // (backend, variant) pairs the backend does not implement
+    std::vector<std::pair<std::string, std::string>> unimplemented;
+};
+
+// Per-routine backend routing by problem size.
+//
+// A rule "gemm 4096 netlib" routes gemm calls whose size is at most 4096 to the netlib backend;
+// larger calls and routines without rules use the default backend of the device. A rule can name
+// a routine, which applies to all its variants the backend implements, or one variant
+// ("sgemm 4096 netlib"), which replaces the routine rules for that variant. Rules are read from,
+// in increasing precedence:
+//  - the calibration cache, see prepare()
+//  - the routing file named by file_env, one rule per line, '#' starts a comment:
+//        gemm 4096 netlib
+//        sgemv 16384 netlib
+//  - the inline variable inline_env, comma separated: "gemm:4096:netlib,sgemv:16384:netlib"
+// Rules of a source replace the rules of lower precedence sources for the same variant. Rules for
+// an unknown routine or backend, or for a variant the backend does not implement, are rejected
+// with a message when they are read.
+class routing_table {
+    struct rule {
+        std::int64_t max_size;
+        std::string backend;
+    };
+    using rule_map = std::map<std::string, std::vector<rule>>;
+
+public:
+    routing_table(routing_spec spec, const char *inline_env, const char *file_env,
+                  const char *cache_env)
+            : spec(std::move(spec)) {
+        if (const char *path = std::getenv(file_env)) {
+            std::ifstream file(path);
+            if (!file)
+                std::cerr << "oneMKL: cannot open routing file " << path << '\n';
+            std::string text, line;
+            while (std::getline(file, line))
+                text += line.substr(0, line.find('#')) + '\n';
+            merge(routes, parse(text, '\n'));
+        }
+        if (const char *rules = std::getenv(inline_env)) {
+            std::string text(rules);
+            std::replace(text.begin(), text.end(), ':', ' ');
+            merge(routes, parse(text, ','));
+        }
+        if (const char *path = std::getenv(cache_env)) {
+            cache_path = path;
+            pending.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    bool empty() const {
+        return !pending.load(std::memory_order_acquire) && routes.empty();
+    }
+
+    // False until prepare() has loaded or written the calibration cache
+    bool prepared() const {
+        return !pending.load(std::memory_order_acquire);
+    }
+
+    // With a calibration cache configured, loads its rules on the first call. If the cache does
+    // not exist or was calibrated on another device, calibrate(rules) is called instead to append
+    // "<variant> <max size> <backend>" lines to rules, which are then used and written to the
+    // cache. Other threads routing calls wait until this is done.
+    template <typename Calibrate>
+    void prepare(const std::string &device, Calibrate &&calibrate) {
+        if (!pending.load(std::memory_order_acquire))
+            return;
+        std::call_once(prepare_once, [&]() {
+            const std::string header = "# device: " + device;
+            std::ifstream in(cache_path);
+            std::string line, text;
+            const bool cached = std::getline(in, line) && line == header;
+            if (cached) {
+                while (std::getline(in, line))
+                    text += line.substr(0, line.find('#')) + '\n';
+            }
+            else {
+                std::ostringstream rules;
+                try {
+                    calibrate(rules);
+                }
+                catch (const std::exception &e) {
+                    std::cerr << "oneMKL: routing calibration failed: " << e.what() << '\n';
+                }
+                text = rules.str();
+                std::ofstream out(cache_path);
+                if (out)
+                    out << header << '\n' << text;
+                else
+                    std::cerr << "oneMKL: cannot write routing cache " << cache_path << '\n';
+            }
+            rule_map all = parse(text, '\n');
+            merge(all, std::move(routes));
+            routes = std::move(all);
+            pending.store(false, std::memory_order_release);
+        });
+    }
+
+    // Returns the backend selected for the call, or nullptr to use the default one.
+    const char *select(const char *variant, std::int64_t size) const {
+        auto it = routes.find(variant);
+        if (it == routes.end())
+            return nullptr;
+        for (const auto &r : it->second) {
+            if (size <= r.max_size)
+                return r.backend.c_str();
+        }
+        return nullptr;
+    }
+
+    // Returns false if the backend does not implement the variant.
+    bool implemented(const std::string &backend, const std::string &variant) const {
+        return std::find(spec.unimplemented.begin(), spec.unimplemented.end(),
+                         std::make_pair(backend, variant)) == spec.unimplemented.end();
+    }
+
+    const std::vector<std::pair<std::string, std::vector<std::string>>> &routines() const {
+        return spec.routines;
+    }
+
+    // Backend used by all routed calls of the calling thread while set, e.g. to time each
+    // backend during calibration.
+    static const char *&forced_backend() {
+        static thread_local const char *backend = nullptr;
+        return backend;
+    }
+
+private:
+    // Parses the rules of one source. Variant rules replace the routine rules of the variant.
+    rule_map parse(const std::string &text, char separator) const {
+        rule_map routine_rules, variant_rules;
+        std::stringstream items(text);
+        std::string item;
+        while (std::getline(items, item, separator))
+            add_rule(routine_rules, variant_rules, item);
+        rule_map rules;
+        merge(rules, std::move(routine_rules));
+        merge(rules, std::move(variant_rules));
+        return rules;
+    }
+
+    void add_rule(rule_map &routine_rules, rule_map &variant_rules,
+                  const std::string &text) const {
+        std::istringstream fields(text);
+        std::string name, backend, extra;
+        std::int64_t max_size;
+        if (!(fields >> name))
+            return;
+        if (!(fields >> max_size >> backend) || (fields >> extra)) {
+            reject(text, "malformed rule");
+            return;
+        }
+        if (std::find(spec.backends.begin(), spec.backends.end(), backend) == spec.backends.end()) {
+            reject(text, "backend " + backend + " is not built");
+            return;
+        }
+        for (const auto &routine : spec.routines) {
+            if (routine.first == name) {
+                std::string skipped;
+                for (const auto &variant : routine.second) {
+                    if (implemented(backend, variant))
+                        routine_rules[variant].push_back({ max_size, backend });
+                    else
+                        skipped += (skipped.empty() ? "" : ", ") + variant;
+                }
+                if (!skipped.empty())
+                    std::cerr << "oneMKL: routing rule \"" << text << "\" does not apply to "
+                              << skipped << ", which " << backend << " does not implement\n";
+                return;
+            }
+            if (std::find(routine.second.begin(), routine.second.end(), name) !=
+                routine.second.end()) {
+                if (implemented(backend, name))
+                    variant_rules[name].push_back({ max_size, backend });
+                else
+                    reject(text, backend + " does not implement " + name);
+                return;
+            }
+        }
+        reject(text, name + " is not a routed routine");
+    }
+
+    static void reject(const std::string &text, const std::string &reason) {
+        std::cerr << "oneMKL: ignoring routing rule \"" << text << "\": " << reason << '\n';
+    }
+
+    // Replaces the rules of rules for each variant that has rules in overrides.
+    static void merge(rule_map &rules, rule_map overrides) {
+        for (auto &variant : overrides) {
+            std::sort(variant.second.begin(), variant.second.end(),
+                      [](const rule &a, const rule &b) { return a.max_size < b.max_size; });
+            rules[variant.first] = std::move(variant.second);
+        }
+    }
+
+    routing_spec spec;
+    rule_map routes;
+    std::string cache_path;
+    std::atomic<bool> pending{ false };
+    std::once_flag prepare_once;
+};
+
+} //namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_BACKEND_ROUTING_HPP_
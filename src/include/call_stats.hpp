@@ -0,0 +1,632 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_CALL_STATS_HPP_
+#define _ONEMKL_CALL_STATS_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "oneapi/mkl/types.hpp"
+#include "oneapi/mkl/detail/backends_table.hpp"
+#include "oneapi/mkl/stats.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+
+// Statistics are collected unless ONEMKL_STATS=0. Setting it to another value also times each
+// call to its completion instead of until it returns, which needs completion_watcher.
+inline const bool stats_enabled = !(std::getenv("ONEMKL_STATS") &&
+                                    std::strcmp(std::getenv("ONEMKL_STATS"), "0") == 0);
+inline const bool stats_completion_time = stats_enabled && std::getenv("ONEMKL_STATS");
+
+// Problem dimensions of a call, as far as the routine has them
+struct call_dims {
+    std::int64_t m = 0, n = 0, k = 0, kl = 0, ku = 0, nrhs = 0, batch_size = 1;
+    bool left = true;
+};
+
+// Real floating point operations and number of matrix/vector elements touched by one problem.
+// Complex routines scale the operation count by 4 (one complex multiply-add is 8 flops).
+using cost_function = void (*)(const call_dims &d, double &flops, double &elements);
+
+namespace cost {
+
+// Level 1 routines: flops and elements proportional to n
+template <int flops_per_element, int elements_per_element>
+inline void vector(const call_dims &d, double &flops, double &elements) {
+    flops = 1.0 * flops_per_element * d.n;
+    elements = 1.0 * elements_per_element * d.n;
+}
+
+inline void gemv(const call_dims &d, double &flops, double &elements) {
+    flops = 2.0 * d.m * d.n;
+    elements = 1.0 * d.m * d.n + d.m + d.n;
+}
+
+inline void gbmv(const call_dims &d, double &flops, double &elements) {
+    flops = 2.0 * (d.kl + d.ku + 1) * d.n;
+    elements = 1.0 * (d.kl + d.ku + 1) * d.n + d.m + d.n;
+}
+
+inline void ger(const call_dims &d, double &flops, double &elements) {
+    flops = 2.0 * d.m * d.n;
+    elements = 2.0 * d.m * d.n;
+}
+
+// symv, hemv, spmv, hpmv
+inline void symv(const call_dims &d, double &flops, double &elements) {
+    flops = 2.0 * d.n * d.n;
+    elements = 0.5 * d.n * d.n + 2.0 * d.n;
+}
+
+// sbmv, hbmv
+inline void sbmv(const call_dims &d, double &flops, double &elements) {
+    flops = 4.0 * d.n * d.k;
+    elements = 1.0 * d.n * (d.k + 1) + 2.0 * d.n;
+}
+
+// trmv, tpmv, trsv, tpsv
+inline void trmv(const call_dims &d, double &flops, double &elements) {
+    flops = 1.0 * d.n * d.n;
+    elements = 0.5 * d.n * d.n + 2.0 * d.n;
+}
+
+// tbmv, tbsv
+inline void tbmv(const call_dims &d, double &flops, double &elements) {
+    flops = 2.0 * d.n * d.k;
+    elements = 1.0 * d.n * (d.k + 1) + 2.0 * d.n;
+}
+
+// syr, her, spr, hpr
+inline void syr(const call_dims &d, double &flops, double &elements) {
+    flops = 1.0 * d.n * d.n;
+    elements = 1.0 * d.n * d.n + d.n;
+}
+
+// syr2, her2, spr2, hpr2
+inline void syr2(const call_dims &d, double &flops, double &elements) {
+    flops = 2.0 * d.n * d.n;
+    elements = 1.0 * d.n * d.n + 2.0 * d.n;
+}
+
+inline void gemm(const call_dims &d, double &flops, double &elements) {
+    flops = 2.0 * d.m * d.n * d.k;
+    elements = 1.0 * d.m * d.k + 1.0 * d.k * d.n + 2.0 * d.m * d.n;
+}
+
+inline void gemmt(const call_dims &d, double &flops, double &elements) {
+    flops = 1.0 * d.n * d.n * d.k;
+    elements = 2.0 * d.n * d.k + 1.0 * d.n * d.n;
+}
+
+// symm, hemm
+inline void symm(const call_dims &d, double &flops, double &elements) {
+    const double a = d.left ? d.m : d.n;
+    flops = 2.0 * a * d.m * d.n;
+    elements = 0.5 * a * a + 3.0 * d.m * d.n;
+}
+
+// syrk, herk
+inline void syrk(const call_dims &d, double &flops, double &elements) {
+    flops = 1.0 * d.n * d.n * d.k;
+    elements = 1.0 * d.n * d.k + 1.0 * d.n * d.n;
+}
+
+// syr2k, her2k
+inline void syr2k(const call_dims &d, double &flops, double &elements) {
+    flops = 2.0 * d.n * d.n * d.k;
+    elements = 2.0 * d.n * d.k + 1.0 * d.n * d.n;
+}
+
+// trmm, trsm
+inline void trmm(const call_dims &d, double &flops, double &elements) {
+    const double a = d.left ? d.m : d.n;
+    flops = a * d.m * d.n;
+    elements = 0.5 * a * a + 2.0 * d.m * d.n;
+}
+
+inline void dgmm(const call_dims &d, double &flops, double &elements) {
+    flops = 1.0 * d.m * d.n;
+    elements = 2.0 * d.m * d.n + std::max(d.m, d.n);
+}
+
+inline void getrf(const call_dims &d, double &flops, double &elements) {
+    const double mn = std::min(d.m, d.n), mx = std::max(d.m, d.n);
+    flops = mx * mn * mn - mn * mn * mn / 3.0;
+    elements = 2.0 * d.m * d.n;
+}
+
+// getrs, potrs, trtrs: one factor applied to nrhs right-hand sides
+inline void getrs(const call_dims &d, double &flops, double &elements) {
+    flops = 2.0 * d.n * d.n * d.nrhs;
+    elements = 1.0 * d.n * d.n + 2.0 * d.n * d.nrhs;
+}
+
+inline void trtrs(const call_dims &d, double &flops, double &elements) {
+    flops = 1.0 * d.n * d.n * d.nrhs;
+    elements = 0.5 * d.n * d.n + 2.0 * d.n * d.nrhs;
+}
+
+inline void getri(const call_dims &d, double &flops, double &elements) {
+    flops = 4.0 * d.n * d.n * d.n / 3.0;
+    elements = 2.0 * d.n * d.n;
+}
+
+// potrf, sytrf, hetrf
+inline void potrf(const call_dims &d, double &flops, double &elements) {
+    flops = 1.0 * d.n * d.n * d.n / 3.0;
+    elements = 1.0 * d.n * d.n;
+}
+
+inline void potri(const call_dims &d, double &flops, double &elements) {
+    flops = 2.0 * d.n * d.n * d.n / 3.0;
+    elements = 1.0 * d.n * d.n;
+}
+
+// geqrf, gerqf
+inline void geqrf(const call_dims &d, double &flops, double &elements) {
+    const double mn = std::min(d.m, d.n), mx = std::max(d.m, d.n);
+    flops = 2.0 * mx * mn * mn - 2.0 * mn * mn * mn / 3.0;
+    elements = 2.0 * d.m * d.n;
+}
+
+// orgqr, ungqr
+inline void orgqr(const call_dims &d, double &flops, double &elements) {
+    flops = 4.0 * d.m * d.n * d.k - 2.0 * (d.m + d.n) * d.k * d.k + 4.0 * d.k * d.k * d.k / 3.0;
+    elements = 2.0 * d.m * d.n;
+}
+
+// ormqr, unmqr, ormrq, unmrq
+inline void ormqr(const call_dims &d, double &flops, double &elements) {
+    flops = 4.0 * d.m * d.n * d.k;
+    elements = 2.0 * d.m * d.n + 1.0 * (d.left ? d.m : d.n) * d.k;
+}
+
+inline void gebrd(const call_dims &d, double &flops, double &elements) {
+    const double mn = std::min(d.m, d.n), mx = std::max(d.m, d.n);
+    flops = 4.0 * mn * mn * (mx - mn / 3.0);
+    elements = 2.0 * d.m * d.n;
+}
+
+// sytrd, hetrd
+inline void sytrd(const call_dims &d, double &flops, double &elements) {
+    flops = 4.0 * d.n * d.n * d.n / 3.0;
+    elements = 1.0 * d.n * d.n;
+}
+
+} // namespace cost
+
+// Cost model of a routine without precision prefix, nullptr if there is none
+inline cost_function find_cost_model(const std::string &base) {
+    static const std::map<std::string, cost_function> models = {
+        // Level 1
+        { "asum", cost::vector<1, 1> },
+        { "axpy", cost::vector<2, 3> },
+        { "axpby", cost::vector<3, 3> },
+        { "copy", cost::vector<0, 2> },
+        { "dot", cost::vector<2, 2> },
+        { "dotc", cost::vector<2, 2> },
+        { "dotu", cost::vector<2, 2> },
+        { "iamax", cost::vector<1, 1> },
+        { "iamin", cost::vector<1, 1> },
+        { "nrm2", cost::vector<2, 1> },
+        { "rot", cost::vector<6, 4> },
+        { "rotm", cost::vector<6, 4> },
+        { "scal", cost::vector<1, 2> },
+        { "swap", cost::vector<0, 4> },
+        // Level 2
+        { "gemv", cost::gemv },
+        { "gbmv", cost::gbmv },
+        { "ger", cost::ger },
+        { "gerc", cost::ger },
+        { "geru", cost::ger },
+        { "symv", cost::symv },
+        { "hemv", cost::symv },
+        { "spmv", cost::symv },
+        { "hpmv", cost::symv },
+        { "sbmv", cost::sbmv },
+        { "hbmv", cost::sbmv },
+        { "trmv", cost::trmv },
+        { "tpmv", cost::trmv },
+        { "trsv", cost::trmv },
+        { "tpsv", cost::trmv },
+        { "tbmv", cost::tbmv },
+        { "tbsv", cost::tbmv },
+        { "syr", cost::syr },
+        { "her", cost::syr },
+        { "spr", cost::syr },
+        { "hpr", cost::syr },
+        { "syr2", cost::syr2 },
+        { "her2", cost::syr2 },
+        { "spr2", cost::syr2 },
+        { "hpr2", cost::syr2 },
+        // Level 3 and extensions
+        { "gemm", cost::gemm },
+        { "gemm_compute", cost::gemm },
+        { "gemm3m", cost::gemm },
+        { "gemmt", cost::gemmt },
+        { "symm", cost::symm },
+        { "hemm", cost::symm },
+        { "syrk", cost::syrk },
+        { "herk", cost::syrk },
+        { "syr2k", cost::syr2k },
+        { "her2k", cost::syr2k },
+        { "trmm", cost::trmm },
+        { "trsm", cost::trmm },
+        { "dgmm", cost::dgmm },
+        // LAPACK
+        { "getrf", cost::getrf },
+        { "getrs", cost::getrs },
+        { "potrs", cost::getrs },
+        { "trtrs", cost::trtrs },
+        { "getri", cost::getri },
+        { "potrf", cost::potrf },
+        { "sytrf", cost::potrf },
+        { "hetrf", cost::potrf },
+        { "potri", cost::potri },
+        { "geqrf", cost::geqrf },
+        { "gerqf", cost::geqrf },
+        { "orgqr", cost::orgqr },
+        { "ungqr", cost::orgqr },
+        { "ormqr", cost::ormqr },
+        { "unmqr", cost::ormqr },
+        { "ormrq", cost::ormqr },
+        { "unmrq", cost::ormqr },
+        { "gebrd", cost::gebrd },
+        { "sytrd", cost::sytrd },
+        { "hetrd", cost::sytrd }
+    };
+    auto model = models.find(base);
+    return model == models.end() ? nullptr : model->second;
+}
+
+// A call site in a loader, registered on its first call
+struct call_site {
+    std::size_t id;
+    oneapi::mkl::domain domain;
+    std::string name; // routine with precision, without layout and USM suffixes
+    std::string routine; // function table member name without layout and _sycl suffix
+    std::string layout;
+    std::string precision;
+    std::vector<std::string> arg_names;
+    cost_function cost = nullptr;
+    double element_size = 0.0;
+    double flops_factor = 1.0;
+    bool batched = false;
+    // Position of each dimension in the argument list, -1 if the routine does not have it
+    int m = -1, n = -1, k = -1, kl = -1, ku = -1, nrhs = -1, batch_size = -1, side = -1;
+};
+
+// Strips the layout prefix and the _sycl suffix from a function table member name, and splits
+// off the precision prefix when there is one, e.g. column_major_sgemm_usm_sycl -> sgemm_usm / s.
+inline void parse_function_name(std::string name, std::string &routine, std::string &layout,
+                                 std::string &precision) {
+    for (const char *prefix : { "column_major_", "row_major_" }) {
+        const std::string p(prefix);
+        if (name.compare(0, p.size(), p) == 0) {
+            layout = p.substr(0, p.size() - 1);
+            name = name.substr(p.size());
+        }
+    }
+    const std::string suffix("_sycl");
+    if (name.size() > suffix.size() &&
+        name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0)
+        name.resize(name.size() - suffix.size());
+    routine = name;
+    if (std::string("sdczh").find(name[0]) != std::string::npos &&
+        name.compare(0, 6, "create") != 0)
+        precision = name.substr(0, 1);
+    else if (name[0] == 'i' && std::string("sdcz").find(name[1]) != std::string::npos)
+        precision = name.substr(1, 1);
+    else if (name.find("gemm_") == 0)
+        precision = name.substr(5, name.find('_', 5) - 5);
+}
+
+inline void remove_suffix(std::string &name, const std::string &suffix, bool *found = nullptr) {
+    const auto pos = name.find(suffix);
+    if (pos != std::string::npos)
+        name.erase(pos, suffix.size());
+    if (found)
+        *found = pos != std::string::npos;
+}
+
+// Resolves the cost model and element type of a call site from its routine name
+inline void describe_cost(call_site &site) {
+    std::string name = site.name;
+    bool group = false, scratchpad = false;
+    remove_suffix(name, "_group", &group);
+    remove_suffix(name, "_scratchpad_size", &scratchpad);
+    remove_suffix(name, "_batch_strided", &site.batched);
+    if (!site.batched)
+        remove_suffix(name, "_batch", &site.batched);
+    remove_suffix(name, "_bias");
+    remove_suffix(name, "_ptr");
+    // pointer-array (group) routines take their sizes by pointer, scratchpad queries do no work
+    if (group || scratchpad || name.compare(0, 6, "create") == 0)
+        return;
+
+    std::string base, prefix;
+    char type = 's';
+    if (name.compare(0, 5, "gemm_") == 0) {
+        // mixed precision gemm, e.g. gemm_f16f16f32 or gemm_s8u8s32
+        base = "gemm";
+        const std::string inputs = name.substr(5);
+        site.element_size = (inputs.compare(0, 2, "s8") == 0 || inputs.compare(0, 2, "u8") == 0)
+                                ? 1.0
+                                : 2.0;
+    }
+    else {
+        if (name[0] == 'i' && (name.find("amax") != std::string::npos ||
+                               name.find("amin") != std::string::npos)) {
+            // isamax -> iamax of s
+            prefix = name.substr(1, name.size() - 5);
+            name = "i" + name.substr(name.size() - 4);
+        }
+        for (std::size_t len = name.size(); len > 0 && base.empty(); len--) {
+            if (find_cost_model(name.substr(name.size() - len))) {
+                base = name.substr(name.size() - len);
+                prefix += name.substr(0, name.size() - len);
+            }
+        }
+        // the data type is the last prefix letter (scasum, dsdot, icamax) except for complex
+        // vectors scaled by a real (csscal, zdscal)
+        if (!prefix.empty())
+            type = (prefix == "cs" || prefix == "zd") ? prefix[0] : prefix.back();
+        switch (type) {
+            case 'd': site.element_size = 8.0; break;
+            case 'c': site.element_size = 8.0; break;
+            case 'z': site.element_size = 16.0; break;
+            case 'h': site.element_size = 2.0; break;
+            default: site.element_size = 4.0; break;
+        }
+        if (type == 'c' || type == 'z')
+            site.flops_factor = 4.0;
+    }
+    site.cost = find_cost_model(base);
+}
+
+// Process-wide registry of call sites and per-thread counters.
+//
+// Each thread owns a block of counters indexed by call site id which only that thread writes,
+// so recording a call needs no atomic read-modify-write or lock. Readers merge all blocks;
+// blocks of exited threads are kept so their calls stay in the totals.
+//
+// A block is a directory of fixed-size chunks of counters. When a call site id is past the end
+// of the directory, the owning thread replaces it with a larger copy; replaced directories are
+// kept until the block is destroyed, as a reader may still be scanning one.
+class call_stats {
+    struct counters {
+        std::atomic<std::uint64_t> calls{ 0 };
+        std::atomic<double> flops{ 0.0 };
+        std::atomic<double> bytes{ 0.0 };
+        std::atomic<double> time{ 0.0 };
+    };
+    static constexpr std::size_t chunk_size = 64;
+    static constexpr std::size_t initial_chunks = 64;
+
+    struct directory {
+        explicit directory(std::size_t size) : chunks(size) {}
+        std::vector<std::atomic<counters *>> chunks;
+    };
+
+    struct thread_block {
+        std::atomic<directory *> current{ nullptr };
+        std::vector<std::unique_ptr<directory>> directories; // written by the owning thread only
+        ~thread_block() {
+            if (directory *d = current.load()) {
+                for (auto &chunk : d->chunks)
+                    delete[] chunk.load();
+            }
+        }
+    };
+
+public:
+    static call_stats &instance() {
+        static call_stats stats;
+        return stats;
+    }
+
+    const call_site &register_site(oneapi::mkl::domain domain, const char *function,
+                                   const char *arg_names) {
+        auto site = std::make_unique<call_site>();
+        site->domain = domain;
+        parse_function_name(function, site->routine, site->layout, site->precision);
+        site->name = site->routine;
+        remove_suffix(site->name, "_usm");
+        describe_cost(*site);
+
+        std::istringstream names(arg_names);
+        std::string name;
+        for (int i = 0; std::getline(names >> std::ws, name, ','); i++) {
+            site->arg_names.push_back(name);
+            for (auto dim : { std::make_pair("m", &site->m), std::make_pair("n", &site->n),
+                              std::make_pair("k", &site->k), std::make_pair("kl", &site->kl),
+                              std::make_pair("ku", &site->ku), std::make_pair("nrhs", &site->nrhs),
+                              std::make_pair("batch_size", &site->batch_size),
+                              std::make_pair("left_right", &site->side),
+                              std::make_pair("side", &site->side) }) {
+                if (name == dim.first)
+                    *dim.second = i;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        site->id = sites.size();
+        sites.push_back(std::move(site));
+        return *sites.back();
+    }
+
+    // Adds to the counters of site in the calling thread's block
+    void add(const call_site &site, std::uint64_t calls, double flops, double bytes,
+             double time) {
+        static thread_local thread_block *block = new_block();
+        directory *dir = block->current.load(std::memory_order_relaxed);
+        if (!dir || site.id / chunk_size >= dir->chunks.size())
+            dir = grow(*block, site.id / chunk_size + 1);
+        auto &chunk = dir->chunks[site.id / chunk_size];
+        counters *c = chunk.load(std::memory_order_acquire);
+        if (!c) {
+            c = new counters[chunk_size];
+            chunk.store(c, std::memory_order_release);
+        }
+        auto &entry = c[site.id % chunk_size];
+        entry.calls.store(entry.calls.load(std::memory_order_relaxed) + calls,
+                          std::memory_order_relaxed);
+        entry.flops.store(entry.flops.load(std::memory_order_relaxed) + flops,
+                          std::memory_order_relaxed);
+        entry.bytes.store(entry.bytes.load(std::memory_order_relaxed) + bytes,
+                          std::memory_order_relaxed);
+        entry.time.store(entry.time.load(std::memory_order_relaxed) + time,
+                         std::memory_order_relaxed);
+    }
+
+    // Totals per routine since the last reset
+    std::vector<oneapi::mkl::stats::routine_stats> snapshot() {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto totals = merge();
+        std::vector<oneapi::mkl::stats::routine_stats> result;
+        for (auto &total : totals) {
+            auto base = baseline.find(total.first);
+            if (base != baseline.end()) {
+                total.second.calls -= base->second.calls;
+                total.second.flops -= base->second.flops;
+                total.second.bytes -= base->second.bytes;
+                total.second.time -= base->second.time;
+            }
+            if (total.second.calls != 0)
+                result.push_back(total.second);
+        }
+        return result;
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex);
+        baseline = merge();
+    }
+
+private:
+    thread_block *new_block() {
+        std::lock_guard<std::mutex> lock(mutex);
+        blocks.push_back(std::make_unique<thread_block>());
+        return blocks.back().get();
+    }
+
+    // Replaces the directory of the calling thread's block by one with at least min_chunks chunks
+    static directory *grow(thread_block &block, std::size_t min_chunks) {
+        directory *old = block.current.load(std::memory_order_relaxed);
+        const std::size_t old_size = old ? old->chunks.size() : 0;
+        auto dir = std::make_unique<directory>(
+            std::max({ min_chunks, 2 * old_size, initial_chunks }));
+        for (std::size_t i = 0; i < old_size; i++)
+            dir->chunks[i].store(old->chunks[i].load(std::memory_order_relaxed),
+                                 std::memory_order_relaxed);
+        block.directories.push_back(std::move(dir));
+        block.current.store(block.directories.back().get(), std::memory_order_release);
+        return block.directories.back().get();
+    }
+
+    // Sums the counters of all threads per (domain, routine). Must be called with the mutex held.
+    std::map<std::pair<oneapi::mkl::domain, std::string>, oneapi::mkl::stats::routine_stats>
+    merge() {
+        std::map<std::pair<oneapi::mkl::domain, std::string>, oneapi::mkl::stats::routine_stats>
+            totals;
+        for (const auto &site : sites) {
+            auto &total = totals[{ site->domain, site->name }];
+            total.domain = site->domain;
+            total.name = site->name;
+            for (const auto &block : blocks) {
+                const directory *dir = block->current.load(std::memory_order_acquire);
+                if (!dir || site->id / chunk_size >= dir->chunks.size())
+                    continue;
+                const auto &chunk = dir->chunks[site->id / chunk_size];
+                const counters *c = chunk.load(std::memory_order_acquire);
+                if (!c)
+                    continue;
+                const auto &entry = c[site->id % chunk_size];
+                total.calls += entry.calls.load(std::memory_order_relaxed);
+                total.flops += entry.flops.load(std::memory_order_relaxed);
+                total.bytes += entry.bytes.load(std::memory_order_relaxed);
+                total.time += entry.time.load(std::memory_order_relaxed);
+            }
+        }
+        return totals;
+    }
+
+    std::vector<std::unique_ptr<call_site>> sites;
+    std::vector<std::unique_ptr<thread_block>> blocks;
+    std::map<std::pair<oneapi::mkl::domain, std::string>, oneapi::mkl::stats::routine_stats>
+        baseline;
+    std::mutex mutex;
+};
+
+// Integer arguments of a call in the order of the site's argument list; other arguments are 0
+template <typename T>
+std::int64_t dim_value(const T &value) {
+    if constexpr (std::is_same_v<T, std::int64_t>)
+        return value;
+    else if constexpr (std::is_enum_v<T>)
+        return static_cast<std::int64_t>(value);
+    else
+        return 0;
+}
+
+// Estimated floating point operations and bytes accessed by a call
+template <typename... Args>
+void call_cost(const call_site &site, double &flops, double &bytes, const Args &... args) {
+    double elements = 0.0;
+    flops = 0.0;
+    if (site.cost) {
+        const std::int64_t values[] = { dim_value(args)... };
+        auto get = [&](int index) { return index < 0 ? 0 : values[index]; };
+        call_dims d;
+        d.m = get(site.m);
+        d.n = get(site.n);
+        d.k = get(site.k);
+        d.kl = get(site.kl);
+        d.ku = get(site.ku);
+        d.nrhs = get(site.nrhs);
+        d.left = get(site.side) == static_cast<std::int64_t>(oneapi::mkl::side::left);
+        site.cost(d, flops, elements);
+        if (site.batched && site.batch_size >= 0) {
+            flops *= get(site.batch_size);
+            elements *= get(site.batch_size);
+        }
+        flops *= site.flops_factor;
+    }
+    bytes = elements * site.element_size;
+}
+
+} //namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_CALL_STATS_HPP_
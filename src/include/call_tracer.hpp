@@ -0,0 +1,247 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_CALL_TRACER_HPP_
+#define _ONEMKL_CALL_TRACER_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <CL/sycl.hpp>
+
+#include "call_stats.hpp"
+#include "completion_watcher.hpp"
+
+#ifdef __linux__
+#include <unistd.h>
+#define GET_PID() getpid()
+#elif defined(_WIN64)
+#include <process.h>
+#define GET_PID() _getpid()
+#endif
+
+// Forwards a call to a loaded function table, counting it for oneapi::mkl::stats unless
+// ONEMKL_STATS=0 and, if ONEMKL_TRACE is set, recording it in the trace. table is the function
+// table expression to call (e.g. table(libkey)); the call site must have the corresponding
+// table_initializer named function_tables in scope. With statistics and tracing disabled the only
+// overhead is a single branch on a constant flag.
+#define TRACE_CALL(table, function, ...)                                                        \
+    (oneapi::mkl::detail::instrumentation_enabled                                               \
+         ? oneapi::mkl::detail::instrumented_call(                                              \
+               []() -> const oneapi::mkl::detail::call_site & {                                 \
+                   static const auto &site =                                                    \
+                       oneapi::mkl::detail::call_stats::instance().register_site(               \
+                           decltype(function_tables)::table_domain, #function, #__VA_ARGS__);   \
+                   return site;                                                                 \
+               }(),                                                                             \
+               function_tables, table, [&](decltype(table) t) { return t.function(__VA_ARGS__); }, \
+               __VA_ARGS__)                                                                     \
+         : (table).function(__VA_ARGS__))
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+
+// Output file of the trace, read once at load time
+inline const char *const trace_file = std::getenv("ONEMKL_TRACE");
+inline const bool tracing_enabled = trace_file != nullptr;
+inline const bool instrumentation_enabled = tracing_enabled || stats_enabled;
+// Trace timestamps are relative to the time the library was loaded
+inline const auto trace_start = std::chrono::steady_clock::now();
+
+// Writes traced calls in Chrome trace-event format (chrome://tracing, Perfetto) to the
+// ONEMKL_TRACE file.
+//
+// Each call is one complete ("X") event on the calling thread spanning from submission to
+// completion, as reported by completion_watcher. A record is kept only until its call completes
+// and is then appended to the file, so memory grows with the calls in flight, not with the length
+// of the run. The file uses the JSON array format, whose closing bracket is written when the
+// library is unloaded but is optional for the readers, so a trace cut short stays readable. Calls
+// whose completion is not known (no event and no buffer argument) end when the call returns;
+// calls still in flight at unload are written as ending when they returned.
+class call_tracer {
+    using clock = std::chrono::steady_clock;
+
+    struct record {
+        std::string name;
+        std::string args;
+        std::size_t tid;
+        clock::time_point submit;
+        clock::time_point returned;
+    };
+
+public:
+    static call_tracer &instance() {
+        static call_tracer tracer;
+        return tracer;
+    }
+
+    static clock::time_point now() {
+        return clock::now();
+    }
+
+    std::size_t add(std::string name, std::string args, clock::time_point submit,
+                    clock::time_point returned) {
+        std::lock_guard<std::mutex> lock(mutex);
+        const std::size_t id = next_id++;
+        in_flight.emplace(id, record{ std::move(name), std::move(args), thread_index(), submit,
+                                      returned });
+        return id;
+    }
+
+    void complete(std::size_t id, clock::time_point completed) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto r = in_flight.find(id);
+        if (r == in_flight.end())
+            return;
+        write(r->second, completed);
+        in_flight.erase(r);
+    }
+
+    ~call_tracer() {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto &r : in_flight)
+            write(r.second, r.second.returned);
+        if (out)
+            out << "\n]\n";
+    }
+
+private:
+    call_tracer() : out(trace_file) {
+        if (!out)
+            std::cerr << "oneMKL: cannot write trace file " << trace_file << '\n';
+        else
+            out << "[";
+    }
+
+    // Small sequential ids keep the trace readable, unlike hashes of std::thread::id
+    std::size_t thread_index() {
+        static thread_local std::size_t index = next_thread_index++;
+        return index;
+    }
+
+    static double microseconds(clock::duration d) {
+        return std::chrono::duration<double, std::micro>(d).count();
+    }
+
+    // Appends one event to the file. Must be called with the mutex held.
+    void write(const record &r, clock::time_point completed) {
+        if (!out)
+            return;
+        out << (written++ ? ",\n" : "\n") << "{\"name\":\"" << r.name << "\",\"ph\":\"X\""
+            << ",\"ts\":" << microseconds(r.submit - trace_start)
+            << ",\"dur\":" << microseconds(completed - r.submit) << ",\"pid\":" << GET_PID()
+            << ",\"tid\":" << r.tid << ",\"args\":{" << r.args
+            << ",\"host_us\":" << microseconds(r.returned - r.submit) << "}}";
+    }
+
+    std::ofstream out;
+    std::unordered_map<std::size_t, record> in_flight;
+    std::size_t next_id = 0;
+    std::size_t written = 0;
+    std::size_t next_thread_index = 0;
+    std::mutex mutex;
+};
+
+template <typename T>
+void trace_arg(std::ostringstream &out, const std::string &name, const T &value) {
+    if constexpr (std::is_same_v<T, std::int64_t> || std::is_same_v<T, std::uint64_t> ||
+                  std::is_same_v<T, std::uint32_t>)
+        out << ",\"" << name << "\":" << value;
+    else if constexpr (std::is_enum_v<T>)
+        out << ",\"" << name << "\":" << static_cast<int>(value);
+}
+
+// Records a call in the trace and returns its id
+template <typename... Args>
+std::size_t trace_call(const call_site &site, const char *library,
+                       std::chrono::steady_clock::time_point submit,
+                       std::chrono::steady_clock::time_point returned, const Args &... args) {
+    std::ostringstream json;
+    json << "\"backend\":\"" << (library ? library : "") << "\"";
+    if (!site.layout.empty())
+        json << ",\"layout\":\"" << site.layout << "\"";
+    if (!site.precision.empty())
+        json << ",\"precision\":\"" << site.precision << "\"";
+    std::size_t i = 0;
+    (trace_arg(json, site.arg_names[i++], args), ...);
+    return call_tracer::instance().add(site.routine, json.str(), submit, returned);
+}
+
+// Counts and traces a call that has returned. Calls, flops and bytes are counted on the calling
+// thread. Only the trace and the completion time of the statistics wait for the call to
+// complete, see completion_watcher; the trace record is added before anything is watched.
+template <typename Result, typename... Args>
+void record_call(const call_site &site, const char *library,
+                 std::chrono::steady_clock::time_point submit,
+                 std::chrono::steady_clock::time_point returned, Result *result,
+                 const Args &... args) {
+    if (stats_enabled) {
+        double flops = 0.0, bytes = 0.0;
+        call_cost(site, flops, bytes, args...);
+        const double host_time =
+            stats_completion_time ? 0.0 : std::chrono::duration<double>(returned - submit).count();
+        call_stats::instance().add(site, 1, flops, bytes, host_time);
+    }
+    if (!tracing_enabled && !stats_completion_time)
+        return;
+    const std::size_t id =
+        tracing_enabled ? trace_call(site, library, submit, returned, args...) : 0;
+    completion_watcher::on_completion(
+        result, returned,
+        [&site, id, submit](std::chrono::steady_clock::time_point completed) {
+            if (tracing_enabled)
+                call_tracer::instance().complete(id, completed);
+            if (stats_completion_time)
+                call_stats::instance().add(
+                    site, 0, 0.0, 0.0, std::chrono::duration<double>(completed - submit).count());
+        },
+        args...);
+}
+
+template <typename Tables, typename Table, typename Call, typename... Args>
+auto instrumented_call(const call_site &site, Tables &tables, Table &table, Call &&call,
+                       const Args &... args) -> decltype(call(table)) {
+    using result_t = decltype(call(table));
+    const auto submit = std::chrono::steady_clock::now();
+    if constexpr (std::is_void_v<result_t>) {
+        call(table);
+        record_call(site, tables.get_library_name(&table), submit,
+                    std::chrono::steady_clock::now(), static_cast<void *>(nullptr), args...);
+    }
+    else {
+        result_t result = call(table);
+        record_call(site, tables.get_library_name(&table), submit,
+                    std::chrono::steady_clock::now(), &result, args...);
+        return result;
+    }
+}
+
+} //namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_CALL_TRACER_HPP_
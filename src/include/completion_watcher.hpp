@@ -0,0 +1,180 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_COMPLETION_WATCHER_HPP_
+#define _ONEMKL_COMPLETION_WATCHER_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <CL/sycl.hpp>
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+
+template <typename T>
+struct is_buffer : std::false_type {};
+
+template <typename T, int dimensions>
+struct is_buffer<cl::sycl::buffer<T, dimensions>> : std::true_type {};
+
+// Reports when the work of a dispatched call has completed.
+//
+// USM calls return an event, which a single watcher thread waits on in the order the calls were
+// made, so nothing is submitted to the caller's queue. The completion time is taken from the
+// event's profiling information when the queue has profiling enabled; otherwise it is the time
+// the watcher saw the event complete, which can be late when calls finish out of order.
+//
+// Buffer calls have no event. Their completion is reported by a host task that reads the
+// call's buffer arguments, which the SYCL runtime runs after the commands writing them. This host
+// task is an extra command on the caller's queue: later commands writing the same buffers wait
+// for it, so tracing can delay them by the time the runtime takes to schedule it.
+//
+// The watcher is created on the first watch(), after the call_stats and call_tracer instances it
+// reports to, so at exit it is destroyed, and runs the pending callbacks, before them.
+class completion_watcher {
+public:
+    using clock = std::chrono::steady_clock;
+    using callback = std::function<void(clock::time_point completed)>;
+
+    static completion_watcher &instance() {
+        static completion_watcher watcher;
+        return watcher;
+    }
+
+    // Calls done on the watcher thread once event has completed. returned is the host time the
+    // call that produced event returned.
+    void watch(const cl::sycl::event &event, clock::time_point returned, callback done) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.push_back({ event, returned, std::move(done) });
+        }
+        wake.notify_one();
+    }
+
+    // Calls done from a host task of queue that runs after the preceding commands accessing the
+    // buffers among args
+    template <typename... Args>
+    static void watch_buffers(cl::sycl::queue &queue, callback done, const Args &... args) {
+        queue.submit([&](cl::sycl::handler &cgh) {
+            (require(cgh, args), ...);
+            cgh.host_task([done]() { done(clock::now()); });
+        });
+    }
+
+    // Calls done with the completion time of a dispatched call: watched through its event when
+    // result is one, through its buffer arguments if it has any, otherwise right away with
+    // returned, as the call completed when it returned.
+    template <typename Result, typename... Args>
+    static void on_completion(Result *result, clock::time_point returned, callback done,
+                              const Args &... args) {
+        if constexpr (std::is_same_v<Result, cl::sycl::event>)
+            instance().watch(*result, returned, std::move(done));
+        else if constexpr ((is_buffer<Args>::value || ...)) {
+            cl::sycl::queue *queue = nullptr;
+            auto find_queue = [&](const auto &value) {
+                if constexpr (std::is_same_v<std::decay_t<decltype(value)>, cl::sycl::queue>)
+                    queue = const_cast<cl::sycl::queue *>(&value);
+            };
+            (find_queue(args), ...);
+            if (queue)
+                watch_buffers(*queue, std::move(done), args...);
+            else
+                done(returned);
+        }
+        else
+            done(returned);
+    }
+
+    ~completion_watcher() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_one();
+        worker.join();
+    }
+
+private:
+    struct entry {
+        cl::sycl::event event;
+        clock::time_point returned;
+        callback done;
+    };
+
+    completion_watcher() : worker([this]() { run(); }) {}
+
+    template <typename T>
+    static void require(cl::sycl::handler &cgh, const T &value) {
+        if constexpr (is_buffer<T>::value) {
+            auto buffer = const_cast<T &>(value);
+            buffer.template get_access<cl::sycl::access::mode::read>(cgh);
+        }
+    }
+
+    static clock::time_point completion_time(entry &e) {
+        e.event.wait();
+        const auto observed = clock::now();
+        try {
+            using namespace cl::sycl::info;
+            const auto submitted = e.event.get_profiling_info<event_profiling::command_submit>();
+            const auto ended = e.event.get_profiling_info<event_profiling::command_end>();
+            const std::chrono::nanoseconds device_time(ended - submitted);
+            return std::min(observed,
+                            e.returned + std::chrono::duration_cast<clock::duration>(device_time));
+        }
+        catch (const cl::sycl::exception &) {
+            // profiling is not enabled on the queue
+            return observed;
+        }
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            wake.wait(lock, [this]() { return stopping || !pending.empty(); });
+            if (pending.empty())
+                return;
+            entry e = std::move(pending.front());
+            pending.pop_front();
+            lock.unlock();
+            e.done(completion_time(e));
+            lock.lock();
+        }
+    }
+
+    std::deque<entry> pending;
+    bool stopping = false;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::thread worker;
+};
+
+} //namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_COMPLETION_WATCHER_HPP_
@@ -20,8 +20,16 @@
 #ifndef _LOADER_HPP_
 #define _LOADER_HPP_
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
-#include <map>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include "oneapi/mkl/detail/backends_table.hpp"
 #include "oneapi/mkl/detail/exceptions.hpp"
@@ -58,14 +66,84 @@ class table_initializer {
     };
     using dlhandle = std::unique_ptr<LIB_TYPE, handle_deleter>;
 
+    static constexpr std::size_t num_devices =
+        static_cast<std::size_t>(oneapi::mkl::device::nvidiagpu) + 1;
+    // maximum number of candidate libraries listed per device in backends_table.hpp
+    static constexpr std::size_t max_libraries = 4;
+
 public:
+    static constexpr oneapi::mkl::domain table_domain = domain_id;
+
+    // Lookups are lock-free once a table is published; only the first call for a given
+    // device takes the mutex to load the backend library.
     function_table_t &operator[](oneapi::mkl::device key) {
-        auto lib = tables.find(key);
-        if (lib != tables.end())
-            return lib->second;
+        function_table_t *t = tables[static_cast<std::size_t>(key)].load(std::memory_order_acquire);
+        if (t)
+            return *t;
         return add_table(key);
     }
 
+    // Returns the table of the named backend (e.g. "netlib") for the device, loading its library
+    // if needed. Falls back to the default table if the backend is not built for the device.
+    function_table_t &get(oneapi::mkl::device key, const char *backend) {
+        const auto &candidates = candidate_libraries(key);
+        for (std::size_t i = 0; i < candidates.size() && i < max_libraries; i++) {
+            if (matches_backend(candidates[i], backend)) {
+                auto t = library_tables[static_cast<std::size_t>(key)][i].load(
+                    std::memory_order_acquire);
+                if (t)
+                    return *t;
+                std::lock_guard<std::mutex> lock(mutex);
+                return *load_library(key, i);
+            }
+        }
+        return (*this)[key];
+    }
+
+    // Loads the table for the device if needed and returns the backend library it came from.
+    const char *get_library_name(oneapi::mkl::device key) {
+        (*this)[key];
+        return library_names[static_cast<std::size_t>(key)];
+    }
+
+    // Returns the backend library a loaded table belongs to, or nullptr if it is not loaded here.
+    const char *get_library_name(const function_table_t *table) {
+        for (std::size_t d = 0; d < num_devices; d++) {
+            for (std::size_t i = 0; i < max_libraries; i++) {
+                if (library_tables[d][i].load(std::memory_order_acquire) == table)
+                    return candidate_libraries(static_cast<oneapi::mkl::device>(d))[i];
+            }
+        }
+        return nullptr;
+    }
+
+    // Backend name of a library, e.g. "netlib" for libonemkl_blas_netlib.so
+    static std::string backend_name(const char *libname) {
+        std::string name(libname);
+        name.resize(name.find('.'));
+        return name.substr(name.rfind('_') + 1);
+    }
+
+    // Backend names of the libraries configured for the device
+    static std::vector<std::string> backend_names(oneapi::mkl::device key) {
+        std::vector<std::string> names;
+        for (const char *libname : candidate_libraries(key))
+            names.push_back(backend_name(libname));
+        return names;
+    }
+
+    // Backend names of the libraries configured for any device
+    static std::vector<std::string> backend_names() {
+        std::vector<std::string> names;
+        for (std::size_t d = 0; d < num_devices; d++) {
+            for (auto &name : backend_names(static_cast<oneapi::mkl::device>(d))) {
+                if (std::find(names.begin(), names.end(), name) == names.end())
+                    names.push_back(name);
+            }
+        }
+        return names;
+    }
+
 private:
 #ifdef _WIN64
     // Create a string with last error message
@@ -90,15 +168,78 @@ private:
     }
 #endif
 
+    // Libraries configured for the device; does not insert into the shared libraries map, so it
+    // is safe to call without holding the mutex.
+    static const std::vector<const char *> &candidate_libraries(oneapi::mkl::device key) {
+        static const std::vector<const char *> none;
+        auto domain_libs = libraries.find(domain_id);
+        if (domain_libs == libraries.end())
+            return none;
+        auto device_libs = domain_libs->second.find(key);
+        return device_libs == domain_libs->second.end() ? none : device_libs->second;
+    }
+
+    static bool matches_backend(const char *libname, const char *backend) {
+        return std::string(libname).find(std::string("_") + backend + ".") != std::string::npos;
+    }
+
+    // Backend requested through ONEMKL_<DOMAIN>_BACKEND, tried before the default order
+    static const char *preferred_backend() {
+        switch (domain_id) {
+            case domain::blas: return std::getenv("ONEMKL_BLAS_BACKEND");
+            case domain::lapack: return std::getenv("ONEMKL_LAPACK_BACKEND");
+            case domain::rng: return std::getenv("ONEMKL_RNG_BACKEND");
+            default: return nullptr;
+        }
+    }
+
     function_table_t &add_table(oneapi::mkl::device key) {
-        dlhandle handle;
+        const auto index = static_cast<std::size_t>(key);
+        std::lock_guard<std::mutex> lock(mutex);
+        // another thread may have loaded the table while we were waiting
+        if (function_table_t *t = tables[index].load(std::memory_order_relaxed))
+            return *t;
+
+        const auto &candidates = candidate_libraries(key);
+        std::vector<std::size_t> order;
+        const char *preferred = preferred_backend();
+        for (std::size_t i = 0; i < candidates.size() && i < max_libraries; i++) {
+            if (preferred && matches_backend(candidates[i], preferred))
+                order.insert(order.begin(), i);
+            else
+                order.push_back(i);
+        }
+
+        function_table_t *t = nullptr;
+        std::size_t selected = 0;
         // check all available libraries for the key(device)
-        for (const char *libname : libraries[domain_id][key]) {
-            handle = dlhandle{ ::GET_LIB_HANDLE(libname) };
-            if (handle)
+        for (std::size_t i : order) {
+            if ((t = load_library(key, i, false))) {
+                selected = i;
                 break;
+            }
         }
+        if (!t) {
+            std::cerr << ERROR_MSG << '\n';
+            throw mkl::backend_not_found();
+        }
+
+        library_names[index] = candidates[selected];
+        tables[index].store(t, std::memory_order_release);
+        return *t;
+    }
+
+    // Opens the i-th candidate library of the device and publishes its table. Must be called
+    // with the mutex held. Returns nullptr if the library cannot be opened and required is false.
+    function_table_t *load_library(oneapi::mkl::device key, std::size_t i, bool required = true) {
+        const auto index = static_cast<std::size_t>(key);
+        if (function_table_t *t = library_tables[index][i].load(std::memory_order_relaxed))
+            return t;
+
+        dlhandle handle{ ::GET_LIB_HANDLE(candidate_libraries(key)[i]) };
         if (!handle) {
+            if (!required)
+                return nullptr;
             std::cerr << ERROR_MSG << '\n';
             throw mkl::backend_not_found();
         }
@@ -112,13 +253,18 @@ private:
         if (t->version != SPEC_VERSION)
             throw mkl::specification_mismatch();
 
-        handles[key] = std::move(handle);
-        tables[key] = *t;
-        return *t;
+        // the table lives in the loaded library, which stays open as long as its handle
+        handles[index][i] = std::move(handle);
+        library_tables[index][i].store(t, std::memory_order_release);
+        return t;
     }
 
-    std::map<oneapi::mkl::device, function_table_t> tables;
-    std::map<oneapi::mkl::device, dlhandle> handles;
+    std::array<std::atomic<function_table_t *>, num_devices> tables{};
+    std::array<std::array<std::atomic<function_table_t *>, max_libraries>, num_devices>
+        library_tables{};
+    std::array<std::array<dlhandle, max_libraries>, num_devices> handles;
+    std::array<const char *, num_devices> library_names{};
+    std::mutex mutex;
 };
 
 } //namespace detail
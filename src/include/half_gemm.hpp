@@ -0,0 +1,154 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_HALF_GEMM_HPP_
+#define _ONEMKL_HALF_GEMM_HPP_
+
+#include <CL/sycl.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "scratch_arena.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace blas {
+namespace detail {
+
+// Half precision gemm for the CPU backends, whose CBLAS libraries have no half gemm. op(A), op(B)
+// and C are converted to float one block at a time. The blocks bound the scratch memory to a few
+// megabytes whatever the matrix sizes, while each sgemm call stays large enough to run at full
+// speed.
+constexpr std::int64_t half_block_mn = 1024;
+constexpr std::int64_t half_block_k = 256;
+
+// Converts the rows x cols block at (row, col) of the column-major matrix src to the contiguous
+// float block dest, whose leading dimension is rows.
+static inline void half_load(const cl::sycl::half *src, std::int64_t ld, std::int64_t row,
+                             std::int64_t col, std::int64_t rows, std::int64_t cols, float *dest) {
+    for (std::int64_t j = 0; j < cols; j++) {
+        const cl::sycl::half *s = src + row + (col + j) * ld;
+        float *d = dest + j * rows;
+        for (std::int64_t i = 0; i < rows; i++)
+            d[i] = static_cast<float>(s[i]);
+    }
+}
+
+// Converts the contiguous float block src back to the rows x cols block at (row, col) of dest.
+static inline void half_store(const float *src, std::int64_t rows, std::int64_t cols,
+                              cl::sycl::half *dest, std::int64_t ld, std::int64_t row,
+                              std::int64_t col) {
+    for (std::int64_t j = 0; j < cols; j++) {
+        const float *s = src + j * rows;
+        cl::sycl::half *d = dest + row + (col + j) * ld;
+        for (std::int64_t i = 0; i < rows; i++)
+            d[i] = static_cast<cl::sycl::half>(s[i]);
+    }
+}
+
+// C = alpha * op(A) * op(B) + beta * C with half A and B, and half or float C. transa and transb
+// are true for transposed operands. The float products are made by
+//
+//     sgemm(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc)
+//
+// on column-major matrices, which the backend implements with its CBLAS sgemm.
+//
+// Blocks of A and B are loaded in their stored orientation so that the conversion loops read
+// contiguous memory, and the transpositions are left to sgemm. Float C is updated in place, half C
+// is accumulated in a float block over the whole k dimension before it is rounded back.
+template <typename T_c, typename Sgemm>
+void half_gemm(Sgemm &&sgemm, bool row_major, bool transa, bool transb, std::int64_t m,
+               std::int64_t n, std::int64_t k, float alpha, const cl::sycl::half *a,
+               std::int64_t lda, const cl::sycl::half *b, std::int64_t ldb, float beta, T_c *c,
+               std::int64_t ldc) {
+    static_assert(std::is_same<T_c, cl::sycl::half>::value || std::is_same<T_c, float>::value,
+                  "C must be half or float");
+    if (row_major) {
+        // Row-major C = op(A) * op(B) is column-major C^T = op(B)^T * op(A)^T.
+        half_gemm(sgemm, false, transb, transa, n, m, k, alpha, b, ldb, a, lda, beta, c, ldc);
+        return;
+    }
+    if (m <= 0 || n <= 0)
+        return;
+
+    oneapi::mkl::detail::scratch_arena::scope scratch("blas", "gemm");
+    const std::int64_t max_mb = std::min(m, half_block_mn);
+    const std::int64_t max_nb = std::min(n, half_block_mn);
+    const std::int64_t max_kb = std::min(k, half_block_k);
+    float *a_block = scratch.allocate<float>(max_mb * max_kb);
+    float *b_block = scratch.allocate<float>(max_kb * max_nb);
+    float *c_block = std::is_same<T_c, float>::value ? nullptr
+                                                     : scratch.allocate<float>(max_mb * max_nb);
+
+    for (std::int64_t jc = 0; jc < n; jc += half_block_mn) {
+        const std::int64_t nb = std::min(n - jc, half_block_mn);
+        for (std::int64_t ic = 0; ic < m; ic += half_block_mn) {
+            const std::int64_t mb = std::min(m - ic, half_block_mn);
+            float *c_ij;
+            std::int64_t ldc_ij;
+            if constexpr (std::is_same<T_c, float>::value) {
+                c_ij = c + ic + jc * ldc;
+                ldc_ij = ldc;
+            }
+            else {
+                c_ij = c_block;
+                ldc_ij = mb;
+                if (beta != 0.0f)
+                    half_load(c, ldc, ic, jc, mb, nb, c_block);
+            }
+            // The first k block applies beta, later ones accumulate. k == 0 still scales C.
+            float beta_p = beta;
+            std::int64_t pc = 0;
+            do {
+                const std::int64_t kb = std::min(k - pc, half_block_k);
+                std::int64_t lda_p, ldb_p;
+                if (!transa) {
+                    half_load(a, lda, ic, pc, mb, kb, a_block);
+                    lda_p = mb;
+                }
+                else {
+                    half_load(a, lda, pc, ic, kb, mb, a_block);
+                    lda_p = std::max<std::int64_t>(kb, 1);
+                }
+                if (!transb) {
+                    half_load(b, ldb, pc, jc, kb, nb, b_block);
+                    ldb_p = std::max<std::int64_t>(kb, 1);
+                }
+                else {
+                    half_load(b, ldb, jc, pc, nb, kb, b_block);
+                    ldb_p = nb;
+                }
+                sgemm(transa, transb, mb, nb, kb, alpha, a_block, lda_p, b_block, ldb_p, beta_p,
+                      c_ij, ldc_ij);
+                beta_p = 1.0f;
+                pc += kb;
+            } while (pc < k);
+            if constexpr (!std::is_same<T_c, float>::value)
+                half_store(c_block, mb, nb, c, ldc, ic, jc);
+        }
+    }
+}
+
+} // namespace detail
+} // namespace blas
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_HALF_GEMM_HPP_
@@ -0,0 +1,152 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMKL_SCRATCH_ARENA_HPP_
+#define _ONEMKL_SCRATCH_ARENA_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "oneapi/mkl/exceptions.hpp"
+#include "allocator_helper.hpp"
+
+namespace oneapi {
+namespace mkl {
+namespace detail {
+
+// Thread-local scratch memory for the temporaries of backend host tasks.
+//
+// Allocations are made through a scope and released together when the scope ends. They are carved
+// from one block owned by the thread. Allocations that do not fit are made separately, and the
+// block is enlarged to the peak usage when the outermost scope ends, so that repeated calls of the
+// same size stop allocating. Blocks larger than max_retained are not kept between calls.
+class scratch_arena {
+public:
+    static constexpr std::size_t alignment = 64;
+    static constexpr std::size_t max_retained = std::size_t(64) << 20;
+
+    class scope {
+    public:
+        scope(const char *domain, const char *function)
+                : arena_(scratch_arena::local()),
+                  used_(arena_.used_),
+                  overflow_(arena_.overflow_.size()),
+                  domain_(domain),
+                  function_(function) {
+            arena_.depth_++;
+        }
+
+        ~scope() {
+            arena_.release(used_, overflow_);
+        }
+
+        scope(const scope &) = delete;
+        scope &operator=(const scope &) = delete;
+
+        // Returns uninitialized memory for count objects of type T, valid until the scope ends.
+        // Throws host_bad_alloc if the memory cannot be allocated.
+        template <typename T>
+        T *allocate(std::int64_t count) {
+            std::size_t n = static_cast<std::size_t>(std::max<std::int64_t>(count, 0));
+            void *p = arena_.allocate(sizeof(T) * n);
+            if (p == nullptr)
+                throw oneapi::mkl::host_bad_alloc(domain_, function_);
+            return static_cast<T *>(p);
+        }
+
+    private:
+        scratch_arena &arena_;
+        std::size_t used_;
+        std::size_t overflow_;
+        const char *domain_;
+        const char *function_;
+    };
+
+    ~scratch_arena() {
+        for (auto &allocation : overflow_)
+            oneapi::mkl::aligned_free(allocation.first);
+        oneapi::mkl::aligned_free(block_);
+    }
+
+private:
+    scratch_arena() = default;
+
+    static scratch_arena &local() {
+        static thread_local scratch_arena arena;
+        return arena;
+    }
+
+    void *allocate(std::size_t bytes) {
+        bytes = (std::max(bytes, std::size_t(1)) + alignment - 1) / alignment * alignment;
+        void *p = nullptr;
+        if (used_ + bytes <= capacity_) {
+            p = block_ + used_;
+            used_ += bytes;
+        }
+        else {
+            p = oneapi::mkl::aligned_alloc(alignment, bytes);
+            if (p == nullptr)
+                return nullptr;
+            overflow_.emplace_back(p, bytes);
+            overflow_bytes_ += bytes;
+        }
+        peak_ = std::max(peak_, used_ + overflow_bytes_);
+        return p;
+    }
+
+    void release(std::size_t used, std::size_t overflow) {
+        while (overflow_.size() > overflow) {
+            oneapi::mkl::aligned_free(overflow_.back().first);
+            overflow_bytes_ -= overflow_.back().second;
+            overflow_.pop_back();
+        }
+        used_ = used;
+        if (--depth_ != 0)
+            return;
+
+        // Outermost scope: resize the block to the peak usage of the scope
+        if (peak_ > capacity_ || capacity_ > max_retained) {
+            oneapi::mkl::aligned_free(block_);
+            capacity_ = (peak_ <= max_retained) ? peak_ : 0;
+            block_ = (capacity_ != 0)
+                         ? static_cast<char *>(oneapi::mkl::aligned_alloc(alignment, capacity_))
+                         : nullptr;
+            if (block_ == nullptr)
+                capacity_ = 0;
+        }
+        peak_ = 0;
+    }
+
+    char *block_ = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t used_ = 0;
+    std::size_t peak_ = 0;
+    std::size_t depth_ = 0;
+    std::vector<std::pair<void *, std::size_t>> overflow_;
+    std::size_t overflow_bytes_ = 0;
+};
+
+} // namespace detail
+} // namespace mkl
+} // namespace oneapi
+
+#endif //_ONEMKL_SCRATCH_ARENA_HPP_
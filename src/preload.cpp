@@ -0,0 +1,84 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include "oneapi/mkl/preload.hpp"
+#include "oneapi/mkl/detail/exceptions.hpp"
+
+#if defined(ONEMKL_LOADER_BLAS) || defined(ONEMKL_STATIC_DISPATCH_BLAS)
+#include "oneapi/mkl/blas/detail/blas_loader.hpp"
+#endif
+#ifdef ONEMKL_LOADER_LAPACK
+#include "oneapi/mkl/lapack/detail/lapack_loader.hpp"
+#endif
+#ifdef ONEMKL_LOADER_RNG
+#include "oneapi/mkl/rng/detail/rng_loader.hpp"
+#endif
+
+namespace oneapi {
+namespace mkl {
+
+std::string preload(oneapi::mkl::domain domain_id, oneapi::mkl::device device_id) {
+    switch (domain_id) {
+#if defined(ONEMKL_LOADER_BLAS) || defined(ONEMKL_STATIC_DISPATCH_BLAS)
+        case domain::blas: return blas::detail::preload(device_id);
+#endif
+#ifdef ONEMKL_LOADER_LAPACK
+        case domain::lapack: return lapack::detail::preload(device_id);
+#endif
+#ifdef ONEMKL_LOADER_RNG
+        case domain::rng: return rng::detail::preload(device_id);
+#endif
+        default: throw backend_not_found("Requested domain is not built into oneMKL");
+    }
+}
+
+std::map<oneapi::mkl::domain, std::string> preload_all(oneapi::mkl::device device_id) {
+    std::map<oneapi::mkl::domain, std::string> selected;
+    for (auto domain_id : { domain::blas, domain::lapack, domain::rng }) {
+        auto domain_libs = libraries.find(domain_id);
+        if (domain_libs == libraries.end())
+            continue;
+        auto device_libs = domain_libs->second.find(device_id);
+        if (device_libs == domain_libs->second.end() || device_libs->second.empty())
+            continue;
+#ifdef ONEMKL_STATIC_DISPATCH_BLAS
+        // the linked BLAS backend only serves x86 CPUs
+        if (domain_id == domain::blas && device_id != device::x86cpu)
+            continue;
+#endif
+        switch (domain_id) {
+#if defined(ONEMKL_LOADER_BLAS) || defined(ONEMKL_STATIC_DISPATCH_BLAS)
+            case domain::blas:
+#endif
+#ifdef ONEMKL_LOADER_LAPACK
+            case domain::lapack:
+#endif
+#ifdef ONEMKL_LOADER_RNG
+            case domain::rng:
+#endif
+                selected[domain_id] = preload(domain_id, device_id);
+                break;
+            default: break;
+        }
+    }
+    return selected;
+}
+
+} //namespace mkl
+} //namespace oneapi
@@ -20,6 +20,7 @@
 #include "oneapi/mkl/rng/detail/rng_loader.hpp"
 
 #include "function_table_initializer.hpp"
+#include "call_tracer.hpp"
 #include "rng/function_table.hpp"
 
 namespace oneapi {
@@ -31,22 +32,26 @@ static oneapi::mkl::detail::table_initializer<domain::rng, rng_function_table_t>
 
 engine_impl* create_philox4x32x10(oneapi::mkl::device libkey, cl::sycl::queue queue,
                                   std::uint64_t seed) {
-    return function_tables[libkey].create_philox4x32x10_sycl(queue, seed);
+    return TRACE_CALL(function_tables[libkey], create_philox4x32x10_sycl, queue, seed);
 }
 
 engine_impl* create_philox4x32x10(oneapi::mkl::device libkey, cl::sycl::queue queue,
                                   std::initializer_list<std::uint64_t> seed) {
-    return function_tables[libkey].create_philox4x32x10_ex_sycl(queue, seed);
+    return TRACE_CALL(function_tables[libkey], create_philox4x32x10_ex_sycl, queue, seed);
 }
 
 engine_impl* create_mrg32k3a(oneapi::mkl::device libkey, cl::sycl::queue queue,
                              std::uint32_t seed) {
-    return function_tables[libkey].create_mrg32k3a_sycl(queue, seed);
+    return TRACE_CALL(function_tables[libkey], create_mrg32k3a_sycl, queue, seed);
 }
 
 engine_impl* create_mrg32k3a(oneapi::mkl::device libkey, cl::sycl::queue queue,
                              std::initializer_list<std::uint32_t> seed) {
-    return function_tables[libkey].create_mrg32k3a_ex_sycl(queue, seed);
+    return TRACE_CALL(function_tables[libkey], create_mrg32k3a_ex_sycl, queue, seed);
+}
+
+const char* preload(oneapi::mkl::device libkey) {
+    return function_tables.get_library_name(libkey);
 }
 
 } // namespace detail
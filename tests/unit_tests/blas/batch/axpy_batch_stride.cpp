@@ -45,7 +45,10 @@ namespace {
 
 template <typename fp>
 int test(device *dev, oneapi::mkl::layout layout, int64_t incx, int64_t incy, fp alpha,
-         int64_t batch_size) {
+         int64_t batch_size, bool netlib) {
+    if (netlib_ct_skipped(netlib, dev))
+        return test_skipped;
+
     // Prepare data.
     int64_t n, i;
 
@@ -116,13 +119,14 @@ int test(device *dev, oneapi::mkl::layout layout, int64_t incx, int64_t incy, fp
 #else
         switch (layout) {
             case oneapi::mkl::layout::column_major:
-                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::axpy_batch, n,
-                                   alpha, x_buffer, incx, stride_x, y_buffer, incy, stride_y,
-                                   batch_size);
+                TEST_RUN_CT_SELECT_NETLIB(
+                    netlib, main_queue, oneapi::mkl::blas::column_major::axpy_batch, n, alpha,
+                    x_buffer, incx, stride_x, y_buffer, incy, stride_y, batch_size);
                 break;
             case oneapi::mkl::layout::row_major:
-                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::axpy_batch, n, alpha,
-                                   x_buffer, incx, stride_x, y_buffer, incy, stride_y, batch_size);
+                TEST_RUN_CT_SELECT_NETLIB(
+                    netlib, main_queue, oneapi::mkl::blas::row_major::axpy_batch, n, alpha,
+                    x_buffer, incx, stride_x, y_buffer, incy, stride_y, batch_size);
                 break;
             default: break;
         }
@@ -155,52 +159,54 @@ int test(device *dev, oneapi::mkl::layout layout, int64_t incx, int64_t incy, fp
 }
 
 class AxpyBatchStrideTests
-        : public ::testing::TestWithParam<std::tuple<cl::sycl::device *, oneapi::mkl::layout>> {};
+        : public ::testing::TestWithParam<
+              std::tuple<cl::sycl::device *, oneapi::mkl::layout, bool>> {};
 
 TEST_P(AxpyBatchStrideTests, RealSinglePrecision) {
     float alpha = 2.0;
-    EXPECT_TRUEORSKIP(
-        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, alpha, 15));
-    EXPECT_TRUEORSKIP(
-        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), -2, -3, alpha, 15));
-    EXPECT_TRUEORSKIP(
-        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1, 1, alpha, 15));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, alpha, 15,
+                                  std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), -2, -3, alpha,
+                                  15, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1, 1, alpha, 15,
+                                  std::get<2>(GetParam())));
 }
 
 TEST_P(AxpyBatchStrideTests, RealDoublePrecision) {
     double alpha = 2.0;
-    EXPECT_TRUEORSKIP(
-        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, alpha, 15));
-    EXPECT_TRUEORSKIP(
-        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), -2, -3, alpha, 15));
-    EXPECT_TRUEORSKIP(
-        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1, 1, alpha, 15));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, alpha,
+                                   15, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), -2, -3, alpha,
+                                   15, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1, 1, alpha,
+                                   15, std::get<2>(GetParam())));
 }
 
 TEST_P(AxpyBatchStrideTests, ComplexSinglePrecision) {
     std::complex<float> alpha = std::complex<float>(2.0, -0.5);
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2,
-                                                3, alpha, 15));
+                                                3, alpha, 15, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                -2, -3, alpha, 15));
+                                                -2, -3, alpha, 15, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1,
-                                                1, alpha, 15));
+                                                1, alpha, 15, std::get<2>(GetParam())));
 }
 
 TEST_P(AxpyBatchStrideTests, ComplexDoublePrecision) {
     std::complex<double> alpha = std::complex<double>(2.0, -0.5);
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 2, 3, alpha, 15));
+                                                 2, 3, alpha, 15, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 -2, -3, alpha, 15));
+                                                 -2, -3, alpha, 15, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 1, 1, alpha, 15));
+                                                 1, 1, alpha, 15, std::get<2>(GetParam())));
 }
 
 INSTANTIATE_TEST_SUITE_P(AxpyBatchStrideTestSuite, AxpyBatchStrideTests,
                          ::testing::Combine(testing::ValuesIn(devices),
                                             testing::Values(oneapi::mkl::layout::column_major,
-                                                            oneapi::mkl::layout::row_major)),
-                         ::LayoutDeviceNamePrint());
+                                                            oneapi::mkl::layout::row_major),
+                                            testing::ValuesIn(netlib_values())),
+                         ::LayoutDeviceNetlibNamePrint());
 
 } // anonymous namespace
@@ -45,7 +45,13 @@ namespace {
 
 template <typename fp>
 int test(device *dev, oneapi::mkl::layout layout, int64_t incx, int64_t incy, fp alpha,
-         int64_t batch_size) {
+         int64_t batch_size, bool netlib, bool shared_x = false, bool shared_y = false) {
+    if (netlib_ct_skipped(netlib, dev))
+        return test_skipped;
+    // Only the netlib backend runs the items of a batch in order when they share one output.
+    if (shared_y && !netlib)
+        return test_skipped;
+
     // Catch asynchronous exceptions.
     auto exception_handler = [](exception_list exceptions) {
         for (std::exception_ptr const &e : exceptions) {
@@ -71,14 +77,14 @@ int test(device *dev, oneapi::mkl::layout layout, int64_t incx, int64_t incy, fp
     n = 1357;
 
     int64_t stride_x, stride_y;
-    stride_x = n * std::abs(incx);
-    stride_y = n * std::abs(incy);
+    stride_x = shared_x ? 0 : n * std::abs(incx);
+    stride_y = shared_y ? 0 : n * std::abs(incy);
 
     auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
     vector<fp, decltype(ua)> x(ua), y(ua), y_ref(ua);
 
-    x.resize(stride_x * batch_size);
-    y.resize(stride_y * batch_size);
+    x.resize(std::max(stride_x * batch_size, n * std::abs(incx)));
+    y.resize(std::max(stride_y * batch_size, n * std::abs(incy)));
 
     for (i = 0; i < batch_size; i++) {
         rand_vector(&x[stride_x * i], n, incx);
@@ -122,14 +128,14 @@ int test(device *dev, oneapi::mkl::layout layout, int64_t incx, int64_t incy, fp
 #else
         switch (layout) {
             case oneapi::mkl::layout::column_major:
-                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::axpy_batch, n,
-                                   alpha, &x[0], incx, stride_x, &y[0], incy, stride_y, batch_size,
-                                   dependencies);
+                TEST_RUN_CT_SELECT_NETLIB(
+                    netlib, main_queue, oneapi::mkl::blas::column_major::axpy_batch, n, alpha,
+                    &x[0], incx, stride_x, &y[0], incy, stride_y, batch_size, dependencies);
                 break;
             case oneapi::mkl::layout::row_major:
-                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::axpy_batch, n, alpha,
-                                   &x[0], incx, stride_x, &y[0], incy, stride_y, batch_size,
-                                   dependencies);
+                TEST_RUN_CT_SELECT_NETLIB(
+                    netlib, main_queue, oneapi::mkl::blas::row_major::axpy_batch, n, alpha, &x[0],
+                    incx, stride_x, &y[0], incy, stride_y, batch_size, dependencies);
                 break;
             default: break;
         }
@@ -162,52 +168,74 @@ int test(device *dev, oneapi::mkl::layout layout, int64_t incx, int64_t incy, fp
 }
 
 class AxpyBatchStrideUsmTests
-        : public ::testing::TestWithParam<std::tuple<cl::sycl::device *, oneapi::mkl::layout>> {};
+        : public ::testing::TestWithParam<
+              std::tuple<cl::sycl::device *, oneapi::mkl::layout, bool>> {};
 
 TEST_P(AxpyBatchStrideUsmTests, RealSinglePrecision) {
     float alpha = 2.0;
-    EXPECT_TRUEORSKIP(
-        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, alpha, 15));
-    EXPECT_TRUEORSKIP(
-        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), -2, -3, alpha, 15));
-    EXPECT_TRUEORSKIP(
-        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1, 1, alpha, 15));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, alpha, 15,
+                                  std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), -2, -3, alpha,
+                                  15, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1, 1, alpha, 15,
+                                  std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, alpha, 15,
+                                  std::get<2>(GetParam()), true, false));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, alpha, 15,
+                                  std::get<2>(GetParam()), false, true));
 }
 
 TEST_P(AxpyBatchStrideUsmTests, RealDoublePrecision) {
     double alpha = 2.0;
-    EXPECT_TRUEORSKIP(
-        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, alpha, 15));
-    EXPECT_TRUEORSKIP(
-        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), -2, -3, alpha, 15));
-    EXPECT_TRUEORSKIP(
-        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1, 1, alpha, 15));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, alpha,
+                                   15, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), -2, -3, alpha,
+                                   15, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1, 1, alpha,
+                                   15, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, alpha,
+                                   15, std::get<2>(GetParam()), true, false));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, alpha,
+                                   15, std::get<2>(GetParam()), false, true));
 }
 
 TEST_P(AxpyBatchStrideUsmTests, ComplexSinglePrecision) {
     std::complex<float> alpha = std::complex<float>(2.0, -0.5);
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2,
-                                                3, alpha, 15));
+                                                3, alpha, 15, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                -2, -3, alpha, 15));
+                                                -2, -3, alpha, 15, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1,
-                                                1, alpha, 15));
+                                                1, alpha, 15, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2,
+                                                3, alpha, 15, std::get<2>(GetParam()), true,
+                                                false));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2,
+                                                3, alpha, 15, std::get<2>(GetParam()), false,
+                                                true));
 }
 
 TEST_P(AxpyBatchStrideUsmTests, ComplexDoublePrecision) {
     std::complex<double> alpha = std::complex<double>(2.0, -0.5);
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 2, 3, alpha, 15));
+                                                 2, 3, alpha, 15, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 -2, -3, alpha, 15, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 1, 1, alpha, 15, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 -2, -3, alpha, 15));
+                                                 2, 3, alpha, 15, std::get<2>(GetParam()), true,
+                                                 false));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 1, 1, alpha, 15));
+                                                 2, 3, alpha, 15, std::get<2>(GetParam()), false,
+                                                 true));
 }
 
 INSTANTIATE_TEST_SUITE_P(AxpyBatchStrideUsmTestSuite, AxpyBatchStrideUsmTests,
                          ::testing::Combine(testing::ValuesIn(devices),
                                             testing::Values(oneapi::mkl::layout::column_major,
-                                                            oneapi::mkl::layout::row_major)),
-                         ::LayoutDeviceNamePrint());
+                                                            oneapi::mkl::layout::row_major),
+                                            testing::ValuesIn(netlib_values())),
+                         ::LayoutDeviceNetlibNamePrint());
 
 } // anonymous namespace
@@ -44,7 +44,11 @@ extern std::vector<cl::sycl::device *> devices;
 namespace {
 
 template <typename fp>
-int test(device *dev, oneapi::mkl::layout layout, int64_t incx, int64_t incy, int64_t batch_size) {
+int test(device *dev, oneapi::mkl::layout layout, int64_t incx, int64_t incy, int64_t batch_size,
+         bool netlib) {
+    if (netlib_ct_skipped(netlib, dev))
+        return test_skipped;
+
     // Prepare data.
     int64_t n, i;
 
@@ -113,12 +117,14 @@ int test(device *dev, oneapi::mkl::layout layout, int64_t incx, int64_t incy, in
 #else
         switch (layout) {
             case oneapi::mkl::layout::column_major:
-                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::copy_batch, n,
-                                   x_buffer, incx, stride_x, y_buffer, incy, stride_y, batch_size);
+                TEST_RUN_CT_SELECT_NETLIB(netlib, main_queue,
+                                          oneapi::mkl::blas::column_major::copy_batch, n, x_buffer,
+                                          incx, stride_x, y_buffer, incy, stride_y, batch_size);
                 break;
             case oneapi::mkl::layout::row_major:
-                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::copy_batch, n,
-                                   x_buffer, incx, stride_x, y_buffer, incy, stride_y, batch_size);
+                TEST_RUN_CT_SELECT_NETLIB(netlib, main_queue,
+                                          oneapi::mkl::blas::row_major::copy_batch, n, x_buffer,
+                                          incx, stride_x, y_buffer, incy, stride_y, batch_size);
                 break;
             default: break;
         }
@@ -151,42 +157,50 @@ int test(device *dev, oneapi::mkl::layout layout, int64_t incx, int64_t incy, in
 }
 
 class CopyBatchStrideTests
-        : public ::testing::TestWithParam<std::tuple<cl::sycl::device *, oneapi::mkl::layout>> {};
+        : public ::testing::TestWithParam<
+              std::tuple<cl::sycl::device *, oneapi::mkl::layout, bool>> {};
 
 TEST_P(CopyBatchStrideTests, RealSinglePrecision) {
-    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, 15));
-    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), -2, -3, 15));
-    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1, 1, 15));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, 15,
+                                  std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), -2, -3, 15,
+                                  std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1, 1, 15,
+                                  std::get<2>(GetParam())));
 }
 
 TEST_P(CopyBatchStrideTests, RealDoublePrecision) {
-    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, 15));
-    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), -2, -3, 15));
-    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1, 1, 15));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, 15,
+                                   std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), -2, -3, 15,
+                                   std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1, 1, 15,
+                                   std::get<2>(GetParam())));
 }
 
 TEST_P(CopyBatchStrideTests, ComplexSinglePrecision) {
-    EXPECT_TRUEORSKIP(
-        test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, 15));
-    EXPECT_TRUEORSKIP(
-        test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), -2, -3, 15));
-    EXPECT_TRUEORSKIP(
-        test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1, 1, 15));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2,
+                                                3, 15, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                -2, -3, 15, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1,
+                                                1, 15, std::get<2>(GetParam())));
 }
 
 TEST_P(CopyBatchStrideTests, ComplexDoublePrecision) {
-    EXPECT_TRUEORSKIP(
-        test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 2, 3, 15));
-    EXPECT_TRUEORSKIP(
-        test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()), -2, -3, 15));
-    EXPECT_TRUEORSKIP(
-        test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1, 1, 15));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 2, 3, 15, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 -2, -3, 15, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 1, 1, 15, std::get<2>(GetParam())));
 }
 
 INSTANTIATE_TEST_SUITE_P(CopyBatchStrideTestSuite, CopyBatchStrideTests,
                          ::testing::Combine(testing::ValuesIn(devices),
                                             testing::Values(oneapi::mkl::layout::column_major,
-                                                            oneapi::mkl::layout::row_major)),
-                         ::LayoutDeviceNamePrint());
+                                                            oneapi::mkl::layout::row_major),
+                                            testing::ValuesIn(netlib_values())),
+                         ::LayoutDeviceNetlibNamePrint());
 
 } // anonymous namespace
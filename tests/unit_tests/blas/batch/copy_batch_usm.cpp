@@ -44,7 +44,10 @@ extern std::vector<cl::sycl::device *> devices;
 namespace {
 
 template <typename fp>
-int test(device *dev, oneapi::mkl::layout layout, int64_t group_count) {
+int test(device *dev, oneapi::mkl::layout layout, int64_t group_count, bool netlib) {
+    if (netlib_ct_skipped(netlib, dev))
+        return test_skipped;
+
     // Catch asynchronous exceptions.
     auto exception_handler = [](exception_list exceptions) {
         for (std::exception_ptr const &e : exceptions) {
@@ -165,14 +168,16 @@ int test(device *dev, oneapi::mkl::layout layout, int64_t group_count) {
 #else
         switch (layout) {
             case oneapi::mkl::layout::column_major:
-                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::copy_batch, n,
-                                   (const fp **)x_array, incx, y_array, incy, group_count,
-                                   group_size, dependencies);
+                TEST_RUN_CT_SELECT_NETLIB(netlib, main_queue,
+                                          oneapi::mkl::blas::column_major::copy_batch, n,
+                                          (const fp **)x_array, incx, y_array, incy, group_count,
+                                          group_size, dependencies);
                 break;
             case oneapi::mkl::layout::row_major:
-                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::copy_batch, n,
-                                   (const fp **)x_array, incx, y_array, incy, group_count,
-                                   group_size, dependencies);
+                TEST_RUN_CT_SELECT_NETLIB(netlib, main_queue,
+                                          oneapi::mkl::blas::row_major::copy_batch, n,
+                                          (const fp **)x_array, incx, y_array, incy, group_count,
+                                          group_size, dependencies);
                 break;
             default: break;
         }
@@ -242,30 +247,34 @@ int test(device *dev, oneapi::mkl::layout layout, int64_t group_count) {
 }
 
 class CopyBatchUsmTests
-        : public ::testing::TestWithParam<std::tuple<cl::sycl::device *, oneapi::mkl::layout>> {};
+        : public ::testing::TestWithParam<
+              std::tuple<cl::sycl::device *, oneapi::mkl::layout, bool>> {};
 
 TEST_P(CopyBatchUsmTests, RealSinglePrecision) {
-    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(
+        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5, std::get<2>(GetParam())));
 }
 
 TEST_P(CopyBatchUsmTests, RealDoublePrecision) {
-    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(
+        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5, std::get<2>(GetParam())));
 }
 
 TEST_P(CopyBatchUsmTests, ComplexSinglePrecision) {
-    EXPECT_TRUEORSKIP(
-        test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5,
+                                                std::get<2>(GetParam())));
 }
 
 TEST_P(CopyBatchUsmTests, ComplexDoublePrecision) {
-    EXPECT_TRUEORSKIP(
-        test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 5, std::get<2>(GetParam())));
 }
 
 INSTANTIATE_TEST_SUITE_P(CopyBatchUsmTestSuite, CopyBatchUsmTests,
                          ::testing::Combine(testing::ValuesIn(devices),
                                             testing::Values(oneapi::mkl::layout::column_major,
-                                                            oneapi::mkl::layout::row_major)),
-                         ::LayoutDeviceNamePrint());
+                                                            oneapi::mkl::layout::row_major),
+                                            testing::ValuesIn(netlib_values())),
+                         ::LayoutDeviceNetlibNamePrint());
 
 } // anonymous namespace
@@ -45,7 +45,10 @@ namespace {
 
 template <typename fp>
 int test(device *dev, oneapi::mkl::layout layout, oneapi::mkl::side left_right, int64_t incx,
-         int64_t batch_size) {
+         int64_t batch_size, bool netlib) {
+    if (netlib_ct_skipped(netlib, dev))
+        return test_skipped;
+
     // Prepare data.
     int64_t m, n;
     int64_t lda, ldc;
@@ -132,14 +135,16 @@ int test(device *dev, oneapi::mkl::layout layout, oneapi::mkl::side left_right,
 #else
         switch (layout) {
             case oneapi::mkl::layout::column_major:
-                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::dgmm_batch,
-                                   left_right, m, n, A_buffer, lda, stride_a, x_buffer, incx,
-                                   stride_x, C_buffer, ldc, stride_c, batch_size);
+                TEST_RUN_CT_SELECT_NETLIB(netlib, main_queue,
+                                          oneapi::mkl::blas::column_major::dgmm_batch, left_right,
+                                          m, n, A_buffer, lda, stride_a, x_buffer, incx, stride_x,
+                                          C_buffer, ldc, stride_c, batch_size);
                 break;
             case oneapi::mkl::layout::row_major:
-                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::dgmm_batch, left_right,
-                                   m, n, A_buffer, lda, stride_a, x_buffer, incx, stride_x,
-                                   C_buffer, ldc, stride_c, batch_size);
+                TEST_RUN_CT_SELECT_NETLIB(netlib, main_queue,
+                                          oneapi::mkl::blas::row_major::dgmm_batch, left_right, m,
+                                          n, A_buffer, lda, stride_a, x_buffer, incx, stride_x,
+                                          C_buffer, ldc, stride_c, batch_size);
                 break;
             default: break;
         }
@@ -173,72 +178,86 @@ int test(device *dev, oneapi::mkl::layout layout, oneapi::mkl::side left_right,
 }
 
 class DgmmBatchStrideTests
-        : public ::testing::TestWithParam<std::tuple<cl::sycl::device *, oneapi::mkl::layout>> {};
+        : public ::testing::TestWithParam<
+              std::tuple<cl::sycl::device *, oneapi::mkl::layout, bool>> {};
 
 TEST_P(DgmmBatchStrideTests, RealSinglePrecision) {
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                  oneapi::mkl::side::right, 2, 5));
+                                  oneapi::mkl::side::right, 2, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                  oneapi::mkl::side::right, -2, 5));
+                                  oneapi::mkl::side::right, -2, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                  oneapi::mkl::side::right, 1, 5));
+                                  oneapi::mkl::side::right, 1, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                  oneapi::mkl::side::left, 2, 5));
+                                  oneapi::mkl::side::left, 2, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                  oneapi::mkl::side::left, -2, 5));
+                                  oneapi::mkl::side::left, -2, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                  oneapi::mkl::side::left, 1, 5));
+                                  oneapi::mkl::side::left, 1, 5, std::get<2>(GetParam())));
 }
 
 TEST_P(DgmmBatchStrideTests, RealDoublePrecision) {
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                   oneapi::mkl::side::right, 2, 5));
+                                   oneapi::mkl::side::right, 2, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                   oneapi::mkl::side::right, -2, 5));
+                                   oneapi::mkl::side::right, -2, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                   oneapi::mkl::side::right, 1, 5));
+                                   oneapi::mkl::side::right, 1, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                   oneapi::mkl::side::left, 2, 5));
+                                   oneapi::mkl::side::left, 2, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                   oneapi::mkl::side::left, -2, 5));
+                                   oneapi::mkl::side::left, -2, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                   oneapi::mkl::side::left, 1, 5));
+                                   oneapi::mkl::side::left, 1, 5, std::get<2>(GetParam())));
 }
 
 TEST_P(DgmmBatchStrideTests, ComplexSinglePrecision) {
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                oneapi::mkl::side::right, 2, 5));
+                                                oneapi::mkl::side::right, 2, 5,
+                                                std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                oneapi::mkl::side::right, -2, 5));
+                                                oneapi::mkl::side::right, -2, 5,
+                                                std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                oneapi::mkl::side::right, 1, 5));
+                                                oneapi::mkl::side::right, 1, 5,
+                                                std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                oneapi::mkl::side::left, 2, 5));
+                                                oneapi::mkl::side::left, 2, 5,
+                                                std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                oneapi::mkl::side::left, -2, 5));
+                                                oneapi::mkl::side::left, -2, 5,
+                                                std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                oneapi::mkl::side::left, 1, 5));
+                                                oneapi::mkl::side::left, 1, 5,
+                                                std::get<2>(GetParam())));
 }
 
 TEST_P(DgmmBatchStrideTests, ComplexDoublePrecision) {
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 oneapi::mkl::side::right, 2, 5));
+                                                 oneapi::mkl::side::right, 2, 5,
+                                                 std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 oneapi::mkl::side::right, -2, 5));
+                                                 oneapi::mkl::side::right, -2, 5,
+                                                 std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 oneapi::mkl::side::right, 1, 5));
+                                                 oneapi::mkl::side::right, 1, 5,
+                                                 std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 oneapi::mkl::side::left, 2, 5));
+                                                 oneapi::mkl::side::left, 2, 5,
+                                                 std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 oneapi::mkl::side::left, -2, 5));
+                                                 oneapi::mkl::side::left, -2, 5,
+                                                 std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 oneapi::mkl::side::left, 1, 5));
+                                                 oneapi::mkl::side::left, 1, 5,
+                                                 std::get<2>(GetParam())));
 }
 
 INSTANTIATE_TEST_SUITE_P(DgmmBatchStrideTestSuite, DgmmBatchStrideTests,
                          ::testing::Combine(testing::ValuesIn(devices),
                                             testing::Values(oneapi::mkl::layout::column_major,
-                                                            oneapi::mkl::layout::row_major)),
-                         ::LayoutDeviceNamePrint());
+                                                            oneapi::mkl::layout::row_major),
+                                            testing::ValuesIn(netlib_values())),
+                         ::LayoutDeviceNetlibNamePrint());
 
 } // anonymous namespace
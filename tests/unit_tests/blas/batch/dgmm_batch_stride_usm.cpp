@@ -45,7 +45,13 @@ namespace {
 
 template <typename fp>
 int test(device *dev, oneapi::mkl::layout layout, oneapi::mkl::side left_right, int64_t incx,
-         int64_t batch_size) {
+         int64_t batch_size, bool netlib, bool shared_x = false, bool shared_c = false) {
+    if (netlib_ct_skipped(netlib, dev))
+        return test_skipped;
+    // Only the netlib backend runs the items of a batch in order when they share one output.
+    if (shared_c && !netlib)
+        return test_skipped;
+
     // Catch asynchronous exceptions.
     auto exception_handler = [](exception_list exceptions) {
         for (std::exception_ptr const &e : exceptions) {
@@ -79,16 +85,16 @@ int test(device *dev, oneapi::mkl::layout layout, oneapi::mkl::side left_right,
     int x_len = (left_right == oneapi::mkl::side::right) ? n : m;
 
     int64_t stride_a, stride_x, stride_c;
-    stride_x = x_len * std::abs(incx);
+    stride_x = shared_x ? 0 : x_len * std::abs(incx);
     stride_a = lda * std::max(m, n);
-    stride_c = ldc * std::max(m, n);
+    stride_c = shared_c ? 0 : ldc * std::max(m, n);
 
     auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
     vector<fp, decltype(ua)> x(ua), A(ua), C(ua), C_ref(ua);
 
-    x.resize(stride_x * batch_size);
+    x.resize(std::max(stride_x * batch_size, x_len * std::abs(incx)));
     A.resize(stride_a * batch_size);
-    C.resize(stride_c * batch_size);
+    C.resize(std::max(stride_c * batch_size, ldc * std::max(m, n)));
 
     for (i = 0; i < batch_size; i++) {
         rand_vector(&x[stride_x * i], x_len, incx);
@@ -138,14 +144,16 @@ int test(device *dev, oneapi::mkl::layout layout, oneapi::mkl::side left_right,
 #else
         switch (layout) {
             case oneapi::mkl::layout::column_major:
-                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::dgmm_batch,
-                                   left_right, m, n, &A[0], lda, stride_a, &x[0], incx, stride_x,
-                                   &C[0], ldc, stride_c, batch_size, dependencies);
+                TEST_RUN_CT_SELECT_NETLIB(netlib, main_queue,
+                                          oneapi::mkl::blas::column_major::dgmm_batch, left_right,
+                                          m, n, &A[0], lda, stride_a, &x[0], incx, stride_x, &C[0],
+                                          ldc, stride_c, batch_size, dependencies);
                 break;
             case oneapi::mkl::layout::row_major:
-                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::dgmm_batch, left_right,
-                                   m, n, &A[0], lda, stride_a, &x[0], incx, stride_x, &C[0], ldc,
-                                   stride_c, batch_size, dependencies);
+                TEST_RUN_CT_SELECT_NETLIB(netlib, main_queue,
+                                          oneapi::mkl::blas::row_major::dgmm_batch, left_right, m,
+                                          n, &A[0], lda, stride_a, &x[0], incx, stride_x, &C[0],
+                                          ldc, stride_c, batch_size, dependencies);
                 break;
             default: break;
         }
@@ -178,72 +186,122 @@ int test(device *dev, oneapi::mkl::layout layout, oneapi::mkl::side left_right,
 }
 
 class DgmmBatchStrideUsmTests
-        : public ::testing::TestWithParam<std::tuple<cl::sycl::device *, oneapi::mkl::layout>> {};
+        : public ::testing::TestWithParam<
+              std::tuple<cl::sycl::device *, oneapi::mkl::layout, bool>> {};
 
 TEST_P(DgmmBatchStrideUsmTests, RealSinglePrecision) {
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                  oneapi::mkl::side::right, 2, 5));
+                                  oneapi::mkl::side::right, 2, 5, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::side::right, -2, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                  oneapi::mkl::side::right, -2, 5));
+                                  oneapi::mkl::side::right, 1, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                  oneapi::mkl::side::right, 1, 5));
+                                  oneapi::mkl::side::left, 2, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                  oneapi::mkl::side::left, 2, 5));
+                                  oneapi::mkl::side::left, -2, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                  oneapi::mkl::side::left, -2, 5));
+                                  oneapi::mkl::side::left, 1, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                  oneapi::mkl::side::left, 1, 5));
+                                  oneapi::mkl::side::right, 2, 5, std::get<2>(GetParam()), true,
+                                  false));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::side::left, 2, 5, std::get<2>(GetParam()), true,
+                                  false));
+    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                  oneapi::mkl::side::left, 1, 5, std::get<2>(GetParam()), false,
+                                  true));
 }
 
 TEST_P(DgmmBatchStrideUsmTests, RealDoublePrecision) {
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                   oneapi::mkl::side::right, 2, 5));
+                                   oneapi::mkl::side::right, 2, 5, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                   oneapi::mkl::side::right, -2, 5, std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                   oneapi::mkl::side::right, 1, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                   oneapi::mkl::side::right, -2, 5));
+                                   oneapi::mkl::side::left, 2, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                   oneapi::mkl::side::right, 1, 5));
+                                   oneapi::mkl::side::left, -2, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                   oneapi::mkl::side::left, 2, 5));
+                                   oneapi::mkl::side::left, 1, 5, std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                   oneapi::mkl::side::left, -2, 5));
+                                   oneapi::mkl::side::right, 2, 5, std::get<2>(GetParam()), true,
+                                   false));
     EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                   oneapi::mkl::side::left, 1, 5));
+                                   oneapi::mkl::side::left, 2, 5, std::get<2>(GetParam()), true,
+                                   false));
+    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                   oneapi::mkl::side::left, 1, 5, std::get<2>(GetParam()), false,
+                                   true));
 }
 
 TEST_P(DgmmBatchStrideUsmTests, ComplexSinglePrecision) {
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                oneapi::mkl::side::right, 2, 5));
+                                                oneapi::mkl::side::right, 2, 5,
+                                                std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                oneapi::mkl::side::right, -2, 5,
+                                                std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                oneapi::mkl::side::right, 1, 5,
+                                                std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                oneapi::mkl::side::left, 2, 5,
+                                                std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                oneapi::mkl::side::right, -2, 5));
+                                                oneapi::mkl::side::left, -2, 5,
+                                                std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                oneapi::mkl::side::right, 1, 5));
+                                                oneapi::mkl::side::left, 1, 5,
+                                                std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                oneapi::mkl::side::left, 2, 5));
+                                                oneapi::mkl::side::right, 2, 5,
+                                                std::get<2>(GetParam()), true, false));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                oneapi::mkl::side::left, -2, 5));
+                                                oneapi::mkl::side::left, 2, 5,
+                                                std::get<2>(GetParam()), true, false));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                oneapi::mkl::side::left, 1, 5));
+                                                oneapi::mkl::side::left, 1, 5,
+                                                std::get<2>(GetParam()), false, true));
 }
 
 TEST_P(DgmmBatchStrideUsmTests, ComplexDoublePrecision) {
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 oneapi::mkl::side::right, 2, 5));
+                                                 oneapi::mkl::side::right, 2, 5,
+                                                 std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 oneapi::mkl::side::right, -2, 5,
+                                                 std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 oneapi::mkl::side::right, 1, 5,
+                                                 std::get<2>(GetParam())));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 oneapi::mkl::side::left, 2, 5,
+                                                 std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 oneapi::mkl::side::right, -2, 5));
+                                                 oneapi::mkl::side::left, -2, 5,
+                                                 std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 oneapi::mkl::side::right, 1, 5));
+                                                 oneapi::mkl::side::left, 1, 5,
+                                                 std::get<2>(GetParam())));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 oneapi::mkl::side::left, 2, 5));
+                                                 oneapi::mkl::side::right, 2, 5,
+                                                 std::get<2>(GetParam()), true, false));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 oneapi::mkl::side::left, -2, 5));
+                                                 oneapi::mkl::side::left, 2, 5,
+                                                 std::get<2>(GetParam()), true, false));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
-                                                 oneapi::mkl::side::left, 1, 5));
+                                                 oneapi::mkl::side::left, 1, 5,
+                                                 std::get<2>(GetParam()), false, true));
 }
 
 INSTANTIATE_TEST_SUITE_P(DgmmBatchStrideUsmTestSuite, DgmmBatchStrideUsmTests,
                          ::testing::Combine(testing::ValuesIn(devices),
                                             testing::Values(oneapi::mkl::layout::column_major,
-                                                            oneapi::mkl::layout::row_major)),
-                         ::LayoutDeviceNamePrint());
+                                                            oneapi::mkl::layout::row_major),
+                                            testing::ValuesIn(netlib_values())),
+                         ::LayoutDeviceNetlibNamePrint());
 
 } // anonymous namespace
@@ -44,7 +44,10 @@ extern std::vector<cl::sycl::device *> devices;
 namespace {
 
 template <typename fp>
-int test(device *dev, oneapi::mkl::layout layout, int64_t group_count) {
+int test(device *dev, oneapi::mkl::layout layout, int64_t group_count, bool netlib) {
+    if (netlib_ct_skipped(netlib, dev))
+        return test_skipped;
+
     // Catch asynchronous exceptions.
     auto exception_handler = [](exception_list exceptions) {
         for (std::exception_ptr const &e : exceptions) {
@@ -201,16 +204,16 @@ int test(device *dev, oneapi::mkl::layout layout, int64_t group_count) {
 #else
         switch (layout) {
             case oneapi::mkl::layout::column_major:
-                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::dgmm_batch,
-                                   &left_right[0], &m[0], &n[0], (const fp **)&a_array[0], &lda[0],
-                                   (const fp **)&x_array[0], &incx[0], &c_array[0], &ldc[0],
-                                   group_count, &group_size[0], dependencies);
+                TEST_RUN_CT_SELECT_NETLIB(
+                    netlib, main_queue, oneapi::mkl::blas::column_major::dgmm_batch, &left_right[0],
+                    &m[0], &n[0], (const fp **)&a_array[0], &lda[0], (const fp **)&x_array[0],
+                    &incx[0], &c_array[0], &ldc[0], group_count, &group_size[0], dependencies);
                 break;
             case oneapi::mkl::layout::row_major:
-                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::dgmm_batch,
-                                   &left_right[0], &m[0], &n[0], (const fp **)&a_array[0], &lda[0],
-                                   (const fp **)&x_array[0], &incx[0], &c_array[0], &ldc[0],
-                                   group_count, &group_size[0], dependencies);
+                TEST_RUN_CT_SELECT_NETLIB(
+                    netlib, main_queue, oneapi::mkl::blas::row_major::dgmm_batch, &left_right[0],
+                    &m[0], &n[0], (const fp **)&a_array[0], &lda[0], (const fp **)&x_array[0],
+                    &incx[0], &c_array[0], &ldc[0], group_count, &group_size[0], dependencies);
                 break;
             default: break;
         }
@@ -281,30 +284,34 @@ int test(device *dev, oneapi::mkl::layout layout, int64_t group_count) {
 }
 
 class DgmmBatchUsmTests
-        : public ::testing::TestWithParam<std::tuple<cl::sycl::device *, oneapi::mkl::layout>> {};
+        : public ::testing::TestWithParam<
+              std::tuple<cl::sycl::device *, oneapi::mkl::layout, bool>> {};
 
 TEST_P(DgmmBatchUsmTests, RealSinglePrecision) {
-    EXPECT_TRUEORSKIP(test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(
+        test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5, std::get<2>(GetParam())));
 }
 
 TEST_P(DgmmBatchUsmTests, RealDoublePrecision) {
-    EXPECT_TRUEORSKIP(test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(
+        test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5, std::get<2>(GetParam())));
 }
 
 TEST_P(DgmmBatchUsmTests, ComplexSinglePrecision) {
-    EXPECT_TRUEORSKIP(
-        test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5,
+                                                std::get<2>(GetParam())));
 }
 
 TEST_P(DgmmBatchUsmTests, ComplexDoublePrecision) {
-    EXPECT_TRUEORSKIP(
-        test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()), 5));
+    EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
+                                                 5, std::get<2>(GetParam())));
 }
 
 INSTANTIATE_TEST_SUITE_P(DgmmBatchUsmTestSuite, DgmmBatchUsmTests,
                          ::testing::Combine(testing::ValuesIn(devices),
                                             testing::Values(oneapi::mkl::layout::column_major,
-                                                            oneapi::mkl::layout::row_major)),
-                         ::LayoutDeviceNamePrint());
+                                                            oneapi::mkl::layout::row_major),
+                                            testing::ValuesIn(netlib_values())),
+                         ::LayoutDeviceNetlibNamePrint());
 
 } // anonymous namespace
@@ -0,0 +1,197 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "oneapi/mkl/blas/detail/mklcpu/gemm_plan.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device*> devices;
+
+namespace {
+
+using oneapi::mkl::blas::mklcpu::gemm_plan;
+
+// Runs a plan of the shape on the calling thread, or in a host task when on_queue is set. With jit
+// false the plan must use the compiled kernels.
+template <typename fp>
+int test(device* dev, oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
+         oneapi::mkl::transpose transb, int m, int n, int k, int lda, int ldb, int ldc, fp alpha,
+         fp beta, bool jit, bool on_queue) {
+    if (!dev->is_cpu())
+        return test_skipped;
+    queue main_queue(*dev);
+    context cxt = main_queue.get_context();
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), C(ua);
+    rand_matrix(A, layout, transa, m, k, lda);
+    rand_matrix(B, layout, transb, k, n, ldb);
+    rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, m, n, ldc);
+    auto C_ref = C;
+
+    // Call Reference GEMM.
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+
+    ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(transa),
+           convert_to_cblas_trans(transb), &m_ref, &n_ref, &k_ref, (fp_ref*)&alpha,
+           (fp_ref*)A.data(), &lda_ref, (fp_ref*)B.data(), &ldb_ref, (fp_ref*)&beta,
+           (fp_ref*)C_ref.data(), &ldc_ref);
+
+    // Call the plan.
+    try {
+        gemm_plan<fp> plan(layout, transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, jit);
+        if (!jit && plan.is_jit()) {
+            std::cout << "Plan created without JIT uses a JIT kernel" << std::endl;
+            return 0;
+        }
+        if (on_queue)
+            plan(main_queue, A.data(), B.data(), C.data()).wait();
+        else
+            plan(A.data(), B.data(), C.data());
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM_PLAN:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of GEMM_PLAN:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and plan.
+    bool good = check_equal_matrix(C, C_ref, layout, m, n, ldc, 10 * k, std::cout);
+
+    return (int)good;
+}
+
+// cached() returns the same plan for the same shape, keeps at most cache_capacity plans, and a plan
+// dropped from the cache stays usable while it is held or run by a host task.
+template <typename fp>
+int test_cache(device* dev, oneapi::mkl::layout layout) {
+    if (!dev->is_cpu())
+        return test_skipped;
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    const int dim = 8;
+    auto first = gemm_plan<fp>::cached(layout, nontrans, nontrans, dim, dim, dim, fp(1), dim, dim,
+                                       fp(0), dim);
+    if (gemm_plan<fp>::cached(layout, nontrans, nontrans, dim, dim, dim, fp(1), dim, dim, fp(0),
+                              dim) != first) {
+        std::cout << "Cache returned a new plan for a cached shape" << std::endl;
+        return 0;
+    }
+    // Shapes with leading dimensions of 32, all different from the first one
+    for (std::size_t i = 0; i < gemm_plan<fp>::cache_capacity; i++) {
+        const int m = 1 + int(i % 32), n = 1 + int(i / 32);
+        gemm_plan<fp>::cached(layout, nontrans, nontrans, m, n, 1, fp(1), 32, 32, fp(0), 32);
+    }
+    if (gemm_plan<fp>::cached(layout, nontrans, nontrans, dim, dim, dim, fp(1), dim, dim, fp(0),
+                              dim) == first) {
+        std::cout << "Cache kept more than " << gemm_plan<fp>::cache_capacity << " plans"
+                  << std::endl;
+        return 0;
+    }
+
+    vector<fp> A, B, C(dim * dim, fp(0)), C_ref(dim * dim, fp(0));
+    rand_matrix(A, layout, nontrans, dim, dim, dim);
+    rand_matrix(B, layout, nontrans, dim, dim, dim);
+    const int dim_ref = dim;
+    using fp_ref = typename ref_type_info<fp>::type;
+    const fp alpha(1), beta(0);
+    ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(nontrans),
+           convert_to_cblas_trans(nontrans), &dim_ref, &dim_ref, &dim_ref, (fp_ref*)&alpha,
+           (fp_ref*)A.data(), &dim_ref, (fp_ref*)B.data(), &dim_ref, (fp_ref*)&beta,
+           (fp_ref*)C_ref.data(), &dim_ref);
+    // The host task keeps the plan alive after its last holder drops it
+    queue main_queue(*dev);
+    auto done = (*first)(main_queue, A.data(), B.data(), C.data());
+    first.reset();
+    done.wait();
+
+    return (int)check_equal_matrix(C, C_ref, layout, dim, dim, dim, 10 * dim, std::cout);
+}
+
+class GemmPlanUsmTests
+        : public ::testing::TestWithParam<std::tuple<cl::sycl::device*, oneapi::mkl::layout>> {};
+
+// Compiled kernels with m fixed at 8, 16, 24 and 32 or not, cblas_?gemm beyond 32, and JIT
+// kernels, for every combination of transposes
+template <typename fp>
+void test_shapes(device* dev, oneapi::mkl::layout layout) {
+    const fp alpha(2.0), beta(3.0);
+    const int ld = 43;
+    for (auto transa : { oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::trans }) {
+        for (auto transb : { oneapi::mkl::transpose::nontrans, oneapi::mkl::transpose::trans }) {
+            EXPECT_TRUEORSKIP(test<fp>(dev, layout, transa, transb, 8, 8, 8, ld, ld, ld, alpha,
+                                       beta, false, false));
+            EXPECT_TRUEORSKIP(test<fp>(dev, layout, transa, transb, 24, 5, 19, ld, ld, ld, alpha,
+                                       fp(0), false, false));
+            EXPECT_TRUEORSKIP(test<fp>(dev, layout, transa, transb, 13, 7, 11, ld, ld, ld, alpha,
+                                       beta, false, false));
+            EXPECT_TRUEORSKIP(test<fp>(dev, layout, transa, transb, 32, 32, 32, ld, ld, ld, alpha,
+                                       beta, false, true));
+            EXPECT_TRUEORSKIP(test<fp>(dev, layout, transa, transb, 40, 9, 33, ld, ld, ld, alpha,
+                                       beta, false, false));
+            EXPECT_TRUEORSKIP(test<fp>(dev, layout, transa, transb, 16, 16, 16, ld, ld, ld, alpha,
+                                       beta, true, false));
+            EXPECT_TRUEORSKIP(test<fp>(dev, layout, transa, transb, 24, 5, 19, ld, ld, ld, alpha,
+                                       beta, true, true));
+        }
+    }
+}
+
+TEST_P(GemmPlanUsmTests, RealSinglePrecision) {
+    test_shapes<float>(std::get<0>(GetParam()), std::get<1>(GetParam()));
+    EXPECT_TRUEORSKIP(test_cache<float>(std::get<0>(GetParam()), std::get<1>(GetParam())));
+}
+TEST_P(GemmPlanUsmTests, RealDoublePrecision) {
+    test_shapes<double>(std::get<0>(GetParam()), std::get<1>(GetParam()));
+    EXPECT_TRUEORSKIP(test_cache<double>(std::get<0>(GetParam()), std::get<1>(GetParam())));
+}
+
+INSTANTIATE_TEST_SUITE_P(GemmPlanUsmTestSuite, GemmPlanUsmTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::column_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
@@ -129,6 +129,193 @@ int test(device *dev, oneapi::mkl::layout layout, int N, int incx, int incy, fp
     return (int)good;
 }
 
+template <typename fp>
+int test_alpha_ptr(device *dev, oneapi::mkl::layout layout, int N, int incx, int incy, fp alpha) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during AXPY:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x(ua), y(ua);
+
+    // alpha is read from shared memory when AXPY runs.
+    vector<fp, decltype(ua)> alpha_ptr(ua);
+    alpha_ptr.push_back(alpha);
+
+    rand_vector(x, N, incx);
+    rand_vector(y, N, incy);
+
+    auto y_ref = y;
+
+    // Call Reference AXPY.
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int N_ref = N, incx_ref = incx, incy_ref = incy;
+
+    ::axpy(&N_ref, (fp_ref *)&alpha, (fp_ref *)x.data(), &incx_ref, (fp_ref *)y_ref.data(),
+           &incy_ref);
+
+    // Call DPC++ AXPY.
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::column_major:
+                done = oneapi::mkl::blas::column_major::axpy(
+                    main_queue, N, alpha_ptr.data(), x.data(), incx, y.data(), incy, dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                done = oneapi::mkl::blas::row_major::axpy(main_queue, N, alpha_ptr.data(), x.data(),
+                                                          incx, y.data(), incy, dependencies);
+                break;
+            default: break;
+        }
+        done.wait();
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::column_major:
+                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::axpy, N,
+                                   alpha_ptr.data(), x.data(), incx, y.data(), incy, dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::axpy, N,
+                                   alpha_ptr.data(), x.data(), incx, y.data(), incy, dependencies);
+                break;
+            default: break;
+        }
+        main_queue.wait();
+#endif
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during AXPY:\n" << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented &e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of AXPY:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+
+    bool good = check_equal_vector(y, y_ref, N, incy, N, std::cout);
+
+    return (int)good;
+}
+
+// Computes alpha = dot(x, y) and updates y with alpha * x once the event of dot completes, with no
+// wait on the host in between. q is a queue or a backend selector.
+template <typename Q, typename fp>
+event dot_then_axpy(Q q, oneapi::mkl::layout layout, int N, fp *alpha, const fp *x, int incx,
+                    fp *y, int incy) {
+    event dot_done;
+    switch (layout) {
+        case oneapi::mkl::layout::column_major:
+            dot_done = oneapi::mkl::blas::column_major::dot(q, N, x, incx, y, incy, alpha);
+            return oneapi::mkl::blas::column_major::axpy(q, N, alpha, x, incx, y, incy,
+                                                         { dot_done });
+        case oneapi::mkl::layout::row_major:
+            dot_done = oneapi::mkl::blas::row_major::dot(q, N, x, incx, y, incy, alpha);
+            return oneapi::mkl::blas::row_major::axpy(q, N, alpha, x, incx, y, incy, { dot_done });
+        default: return dot_done;
+    }
+}
+
+template <typename fp>
+int test_dot_alpha(device *dev, oneapi::mkl::layout layout, int N, int incx, int incy) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const &e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const &e) {
+                std::cout << "Caught asynchronous SYCL exception during DOT and AXPY:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x(ua), y(ua);
+
+    // alpha is written by DOT and read by AXPY.
+    vector<fp, decltype(ua)> alpha_ptr(ua);
+    alpha_ptr.push_back(fp(-1));
+
+    rand_vector(x, N, incx);
+    rand_vector(y, N, incy);
+
+    auto y_ref = y;
+
+    // Call Reference DOT and AXPY.
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int N_ref = N, incx_ref = incx, incy_ref = incy;
+
+    fp alpha = ::dot<fp_ref, fp_ref>(&N_ref, (fp_ref *)x.data(), &incx_ref, (fp_ref *)y.data(),
+                                     &incy_ref);
+    ::axpy(&N_ref, (fp_ref *)&alpha, (fp_ref *)x.data(), &incx_ref, (fp_ref *)y_ref.data(),
+           &incy_ref);
+
+    // Call DPC++ DOT and AXPY.
+
+    try {
+#ifdef CALL_RT_API
+        done = dot_then_axpy(main_queue, layout, N, alpha_ptr.data(), x.data(), incx, y.data(),
+                             incy);
+        done.wait();
+#else
+        TEST_RUN_CT_SELECT(main_queue, dot_then_axpy, layout, N, alpha_ptr.data(), x.data(), incx,
+                           y.data(), incy);
+        main_queue.wait();
+#endif
+    }
+    catch (exception const &e) {
+        std::cout << "Caught synchronous SYCL exception during DOT and AXPY:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented &e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error &error) {
+        std::cout << "Error raised during execution of DOT and AXPY:\n"
+                  << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+
+    bool good = check_equal_vector(y, y_ref, N, incy, N, std::cout);
+
+    return (int)good;
+}
+
 class AxpyUsmTests
         : public ::testing::TestWithParam<std::tuple<cl::sycl::device *, oneapi::mkl::layout>> {};
 
@@ -136,24 +323,34 @@ TEST_P(AxpyUsmTests, RealSinglePrecision) {
     float alpha(2.0);
     EXPECT_TRUEORSKIP(
         test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3, alpha));
+    EXPECT_TRUEORSKIP(
+        test_alpha_ptr<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3, alpha));
     EXPECT_TRUEORSKIP(
         test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 1, 1, alpha));
     EXPECT_TRUEORSKIP(
         test<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, -2, alpha));
+    EXPECT_TRUEORSKIP(
+        test_dot_alpha<float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3));
 }
 TEST_P(AxpyUsmTests, RealDoublePrecision) {
     double alpha(2.0);
     EXPECT_TRUEORSKIP(
         test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3, alpha));
+    EXPECT_TRUEORSKIP(test_alpha_ptr<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357,
+                                             2, 3, alpha));
     EXPECT_TRUEORSKIP(
         test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 1, 1, alpha));
     EXPECT_TRUEORSKIP(
         test<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, -2, alpha));
+    EXPECT_TRUEORSKIP(
+        test_dot_alpha<double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3));
 }
 TEST_P(AxpyUsmTests, ComplexSinglePrecision) {
     std::complex<float> alpha(2.0, -0.5);
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
                                                 1357, 2, 3, alpha));
+    EXPECT_TRUEORSKIP(test_alpha_ptr<std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3, alpha));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
                                                 1357, 1, 1, alpha));
     EXPECT_TRUEORSKIP(test<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
@@ -163,6 +360,8 @@ TEST_P(AxpyUsmTests, ComplexDoublePrecision) {
     std::complex<double> alpha(2.0, -0.5);
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
                                                  1357, 2, 3, alpha));
+    EXPECT_TRUEORSKIP(test_alpha_ptr<std::complex<double>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, 3, alpha));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
                                                  1357, 1, 1, alpha));
     EXPECT_TRUEORSKIP(test<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()),
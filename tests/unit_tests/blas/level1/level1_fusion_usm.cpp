@@ -0,0 +1,262 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "oneapi/mkl/blas/detail/mklcpu/level1_fusion.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device*> devices;
+
+namespace {
+
+using mklcpu_selector = oneapi::mkl::backend_selector<oneapi::mkl::backend::mklcpu>;
+
+// Runs axpy, axpby, dot, nrm2, scal, asum and copy through level1_fusion, which records them all
+// for a single pass, and through the mklcpu backend one call at a time, and compares the results.
+template <typename fp>
+int test_sequence(device* dev, int N, int incx, int incy) {
+    if (!dev->is_cpu())
+        return test_skipped;
+    queue main_queue(*dev);
+    context cxt = main_queue.get_context();
+
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x(ua), y(ua), z(ua), w(ua);
+    rand_vector(x, N, incx);
+    rand_vector(y, N, incy);
+    rand_vector(z, N, 1);
+    rand_vector(w, N, incy);
+    vector<fp, decltype(ua)> y_ref(y, ua), z_ref(z, ua), w_ref(w, ua);
+    fp alpha = rand_scalar<fp>(), beta = rand_scalar<fp>(), gamma = rand_scalar<fp>();
+
+    auto result_p = (fp*)oneapi::mkl::malloc_shared(64, 3 * sizeof(fp), *dev, cxt);
+    auto result_ref_p = (fp*)oneapi::mkl::malloc_shared(64, 3 * sizeof(fp), *dev, cxt);
+    bool good = true;
+
+    try {
+        mklcpu_selector mklcpu{ main_queue };
+        namespace blas = oneapi::mkl::blas::column_major;
+        blas::axpy(mklcpu, N, alpha, x.data(), incx, y_ref.data(), incy).wait();
+        blas::axpby(mklcpu, N, beta, x.data(), incx, alpha, y_ref.data(), incy).wait();
+        blas::dot(mklcpu, N, x.data(), incx, y_ref.data(), incy, result_ref_p).wait();
+        blas::nrm2(mklcpu, N, y_ref.data(), incy, result_ref_p + 1).wait();
+        blas::scal(mklcpu, N, gamma, z_ref.data(), 1).wait();
+        blas::asum(mklcpu, N, z_ref.data(), 1, result_ref_p + 2).wait();
+        blas::copy(mklcpu, N, y_ref.data(), incy, w_ref.data(), incy).wait();
+
+        oneapi::mkl::blas::mklcpu::level1_fusion fusion(main_queue);
+        fusion.axpy(N, alpha, x.data(), incx, y.data(), incy);
+        fusion.axpby(N, beta, x.data(), incx, alpha, y.data(), incy);
+        fusion.dot(N, x.data(), incx, y.data(), incy, result_p);
+        fusion.nrm2(N, y.data(), incy, result_p + 1);
+        fusion.scal(N, gamma, z.data(), 1);
+        fusion.asum(N, z.data(), 1, result_p + 2);
+        fusion.copy(N, y.data(), incy, w.data(), incy);
+        if (fusion.pending() != 7) {
+            std::cout << "Fusion flushed " << 7 - fusion.pending() << " calls early" << std::endl;
+            good = false;
+        }
+        fusion.flush().wait();
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during level 1 fusion:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        oneapi::mkl::free_shared(result_p, cxt);
+        oneapi::mkl::free_shared(result_ref_p, cxt);
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of level 1 fusion:\n"
+                  << error.what() << std::endl;
+    }
+
+    good &= check_equal_vector(y, y_ref, N, incy, N, std::cout);
+    good &= check_equal_vector(z, z_ref, N, 1, N, std::cout);
+    good &= check_equal_vector(w, w_ref, N, incy, N, std::cout);
+    for (int i = 0; i < 3; i++)
+        good &= check_equal(result_p[i], result_ref_p[i], N, std::cout);
+    oneapi::mkl::free_shared(result_p, cxt);
+    oneapi::mkl::free_shared(result_ref_p, cxt);
+
+    return (int)good;
+}
+
+// A call reading memory that a recorded call writes at another offset, and a call writing the
+// result of a recorded reduction, must flush the recorded calls first.
+template <typename fp>
+int test_conflicts(device* dev, int N) {
+    if (!dev->is_cpu())
+        return test_skipped;
+    queue main_queue(*dev);
+    context cxt = main_queue.get_context();
+
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x(ua), y(ua);
+    rand_vector(x, N, 1);
+    rand_vector(y, N, 1);
+    vector<fp, decltype(ua)> x_ref(x, ua), y_ref(y, ua);
+    fp alpha = rand_scalar<fp>(), beta = rand_scalar<fp>();
+
+    auto result_p = (fp*)oneapi::mkl::malloc_shared(64, sizeof(fp), *dev, cxt);
+    auto result_ref_p = (fp*)oneapi::mkl::malloc_shared(64, sizeof(fp), *dev, cxt);
+    bool good = true;
+    auto expect_pending = [&](std::size_t pending, std::size_t expected, const char* after) {
+        if (pending != expected) {
+            std::cout << pending << " calls pending after " << after << " instead of "
+                      << expected << std::endl;
+            good = false;
+        }
+    };
+
+    try {
+        mklcpu_selector mklcpu{ main_queue };
+        namespace blas = oneapi::mkl::blas::column_major;
+        blas::scal(mklcpu, N, alpha, x_ref.data(), 1).wait();
+        blas::axpy(mklcpu, N - 1, beta, x_ref.data() + 1, 1, y_ref.data(), 1).wait();
+        blas::dot(mklcpu, N, x_ref.data(), 1, y_ref.data(), 1, result_ref_p).wait();
+        blas::nrm2(mklcpu, N, y_ref.data(), 1, result_ref_p).wait();
+
+        oneapi::mkl::blas::mklcpu::level1_fusion fusion(main_queue);
+        fusion.scal(N, alpha, x.data(), 1);
+        fusion.axpy(N - 1, beta, x.data() + 1, 1, y.data(), 1);
+        expect_pending(fusion.pending(), 1, "shifted read of a written vector");
+        fusion.dot(N, x.data(), 1, y.data(), 1, result_p);
+        expect_pending(fusion.pending(), 2, "dot");
+        fusion.nrm2(N, y.data(), 1, result_p);
+        expect_pending(fusion.pending(), 1, "second write of a result");
+        fusion.flush().wait();
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during level 1 fusion:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        oneapi::mkl::free_shared(result_p, cxt);
+        oneapi::mkl::free_shared(result_ref_p, cxt);
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of level 1 fusion:\n"
+                  << error.what() << std::endl;
+    }
+
+    good &= check_equal_vector(x, x_ref, N, 1, N, std::cout);
+    good &= check_equal_vector(y, y_ref, N, 1, N, std::cout);
+    good &= check_equal(*result_p, *result_ref_p, N, std::cout);
+    oneapi::mkl::free_shared(result_p, cxt);
+    oneapi::mkl::free_shared(result_ref_p, cxt);
+
+    return (int)good;
+}
+
+// The norm of a vector long enough to be split into chunks and parts, with entries whose squares
+// overflow, must match the reference nrm2.
+template <typename fp>
+int test_nrm2(device* dev, int N, int incx) {
+    if (!dev->is_cpu())
+        return test_skipped;
+    queue main_queue(*dev);
+    context cxt = main_queue.get_context();
+
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x(ua);
+    rand_vector(x, N, incx);
+    const fp scale = std::sqrt(std::numeric_limits<fp>::max()) * fp(4);
+    for (int i = 0; i < N; i++)
+        x[i * incx] *= scale;
+
+    using fp_ref = typename ref_type_info<fp>::type;
+    const int N_ref = N, incx_ref = incx;
+    fp result_ref = ::nrm2<fp_ref, fp>(&N_ref, (fp_ref*)x.data(), &incx_ref);
+
+    auto result_p = (fp*)oneapi::mkl::malloc_shared(64, sizeof(fp), *dev, cxt);
+
+    try {
+        oneapi::mkl::blas::mklcpu::level1_fusion fusion(main_queue);
+        fusion.nrm2(N, x.data(), incx, result_p);
+        fusion.flush().wait();
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during level 1 fusion:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        oneapi::mkl::free_shared(result_p, cxt);
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of level 1 fusion:\n"
+                  << error.what() << std::endl;
+    }
+
+    bool good = check_equal(*result_p, result_ref, N, std::cout);
+    oneapi::mkl::free_shared(result_p, cxt);
+
+    return (int)good;
+}
+
+class Level1FusionUsmTests : public ::testing::TestWithParam<cl::sycl::device*> {};
+
+TEST_P(Level1FusionUsmTests, RealSinglePrecision) {
+    EXPECT_TRUEORSKIP(test_sequence<float>(GetParam(), 1357, 2, 3));
+    EXPECT_TRUEORSKIP(test_sequence<float>(GetParam(), 300007, 1, 1));
+    EXPECT_TRUEORSKIP(test_conflicts<float>(GetParam(), 10007));
+    EXPECT_TRUEORSKIP(test_nrm2<float>(GetParam(), 300007, 1));
+    EXPECT_TRUEORSKIP(test_nrm2<float>(GetParam(), 100003, 3));
+}
+TEST_P(Level1FusionUsmTests, RealDoublePrecision) {
+    EXPECT_TRUEORSKIP(test_sequence<double>(GetParam(), 1357, 2, 3));
+    EXPECT_TRUEORSKIP(test_sequence<double>(GetParam(), 300007, 1, 1));
+    EXPECT_TRUEORSKIP(test_conflicts<double>(GetParam(), 10007));
+    EXPECT_TRUEORSKIP(test_nrm2<double>(GetParam(), 300007, 1));
+    EXPECT_TRUEORSKIP(test_nrm2<double>(GetParam(), 100003, 3));
+}
+
+INSTANTIATE_TEST_SUITE_P(Level1FusionUsmTestSuite, Level1FusionUsmTests,
+                         testing::ValuesIn(devices), ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -129,6 +129,193 @@ int test(device* dev, oneapi::mkl::layout layout, int N, int incx, fp_scalar alp
     return (int)good;
 }
 
+template <typename fp, typename fp_scalar>
+int test_alpha_ptr(device* dev, oneapi::mkl::layout layout, int N, int incx, fp_scalar alpha) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during SCAL:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+    std::vector<event> dependencies;
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x(ua);
+
+    // alpha is read from shared memory when SCAL runs.
+    auto us = usm_allocator<fp_scalar, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp_scalar, decltype(us)> alpha_ptr(us);
+    alpha_ptr.push_back(alpha);
+
+    rand_vector(x, N, incx);
+
+    auto x_ref = x;
+
+    // Call Reference SCAL.
+    using fp_ref = typename ref_type_info<fp>::type;
+    using fp_scalar_mkl = typename ref_type_info<fp_scalar>::type;
+
+    const int N_ref = N, incx_ref = std::abs(incx);
+
+    ::scal(&N_ref, (fp_scalar_mkl*)&alpha, (fp_ref*)x_ref.data(), &incx_ref);
+
+    // Call DPC++ SCAL.
+
+    try {
+#ifdef CALL_RT_API
+        switch (layout) {
+            case oneapi::mkl::layout::column_major:
+                done = oneapi::mkl::blas::column_major::scal(main_queue, N, alpha_ptr.data(),
+                                                             x.data(), incx, dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                done = oneapi::mkl::blas::row_major::scal(main_queue, N, alpha_ptr.data(), x.data(),
+                                                          incx, dependencies);
+                break;
+            default: break;
+        }
+        done.wait();
+#else
+        switch (layout) {
+            case oneapi::mkl::layout::column_major:
+                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::column_major::scal, N,
+                                   alpha_ptr.data(), x.data(), incx, dependencies);
+                break;
+            case oneapi::mkl::layout::row_major:
+                TEST_RUN_CT_SELECT(main_queue, oneapi::mkl::blas::row_major::scal, N,
+                                   alpha_ptr.data(), x.data(), incx, dependencies);
+                break;
+            default: break;
+        }
+        main_queue.wait();
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during SCAL:\n" << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of SCAL:\n" << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+
+    bool good = check_equal_vector(x, x_ref, N, incx, N, std::cout);
+
+    return (int)good;
+}
+
+// Computes alpha = nrm2(y) and scales x by alpha once the event of nrm2 completes, with no wait on
+// the host in between. q is a queue or a backend selector.
+template <typename Q, typename fp, typename fp_scalar>
+event nrm2_then_scal(Q q, oneapi::mkl::layout layout, int N, const fp* y, int incy,
+                     fp_scalar* alpha, fp* x, int incx) {
+    event nrm2_done;
+    switch (layout) {
+        case oneapi::mkl::layout::column_major:
+            nrm2_done = oneapi::mkl::blas::column_major::nrm2(q, N, y, incy, alpha);
+            return oneapi::mkl::blas::column_major::scal(q, N, alpha, x, incx, { nrm2_done });
+        case oneapi::mkl::layout::row_major:
+            nrm2_done = oneapi::mkl::blas::row_major::nrm2(q, N, y, incy, alpha);
+            return oneapi::mkl::blas::row_major::scal(q, N, alpha, x, incx, { nrm2_done });
+        default: return nrm2_done;
+    }
+}
+
+template <typename fp, typename fp_scalar>
+int test_nrm2_alpha(device* dev, oneapi::mkl::layout layout, int N, int incx) {
+    // Catch asynchronous exceptions.
+    auto exception_handler = [](exception_list exceptions) {
+        for (std::exception_ptr const& e : exceptions) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (exception const& e) {
+                std::cout << "Caught asynchronous SYCL exception during NRM2 and SCAL:\n"
+                          << e.what() << std::endl;
+                print_error_code(e);
+            }
+        }
+    };
+
+    queue main_queue(*dev, exception_handler);
+    context cxt = main_queue.get_context();
+    event done;
+
+    // Prepare data.
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> x(ua), y(ua);
+
+    // alpha is written by NRM2 and read by SCAL.
+    auto us = usm_allocator<fp_scalar, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp_scalar, decltype(us)> alpha_ptr(us);
+    alpha_ptr.push_back(fp_scalar(-1));
+
+    rand_vector(x, N, incx);
+    rand_vector(y, N, 1);
+
+    auto x_ref = x;
+
+    // Call Reference NRM2 and SCAL.
+    using fp_ref = typename ref_type_info<fp>::type;
+    using fp_scalar_mkl = typename ref_type_info<fp_scalar>::type;
+
+    const int N_ref = N, incx_ref = std::abs(incx), incy_ref = 1;
+
+    fp_scalar alpha = ::nrm2<fp_ref, fp_scalar>(&N_ref, (fp_ref*)y.data(), &incy_ref);
+    ::scal(&N_ref, (fp_scalar_mkl*)&alpha, (fp_ref*)x_ref.data(), &incx_ref);
+
+    // Call DPC++ NRM2 and SCAL.
+
+    try {
+#ifdef CALL_RT_API
+        done = nrm2_then_scal(main_queue, layout, N, y.data(), 1, alpha_ptr.data(), x.data(), incx);
+        done.wait();
+#else
+        TEST_RUN_CT_SELECT(main_queue, nrm2_then_scal, layout, N, y.data(), 1, alpha_ptr.data(),
+                           x.data(), incx);
+        main_queue.wait();
+#endif
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during NRM2 and SCAL:\n"
+                  << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const oneapi::mkl::unimplemented& e) {
+        return test_skipped;
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of NRM2 and SCAL:\n"
+                  << error.what() << std::endl;
+    }
+
+    // Compare the results of reference implementation and DPC++ implementation.
+
+    bool good = check_equal_vector(x, x_ref, N, incx, N, std::cout);
+
+    return (int)good;
+}
+
 class ScalUsmTests
         : public ::testing::TestWithParam<std::tuple<cl::sycl::device*, oneapi::mkl::layout>> {};
 
@@ -136,20 +323,30 @@ TEST_P(ScalUsmTests, RealSinglePrecision) {
     float alpha(2.0);
     EXPECT_TRUEORSKIP(
         (test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, alpha)));
+    EXPECT_TRUEORSKIP((test_alpha_ptr<float, float>(std::get<0>(GetParam()),
+                                                    std::get<1>(GetParam()), 1357, 2, alpha)));
     EXPECT_TRUEORSKIP(
         (test<float, float>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, alpha)));
+    EXPECT_TRUEORSKIP((test_nrm2_alpha<float, float>(std::get<0>(GetParam()),
+                                                     std::get<1>(GetParam()), 1357, 2)));
 }
 TEST_P(ScalUsmTests, RealDoublePrecision) {
     double alpha(2.0);
     EXPECT_TRUEORSKIP(
         (test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, alpha)));
+    EXPECT_TRUEORSKIP((test_alpha_ptr<double, double>(std::get<0>(GetParam()),
+                                                      std::get<1>(GetParam()), 1357, 2, alpha)));
     EXPECT_TRUEORSKIP(
         (test<double, double>(std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, alpha)));
+    EXPECT_TRUEORSKIP((test_nrm2_alpha<double, double>(std::get<0>(GetParam()),
+                                                       std::get<1>(GetParam()), 1357, 2)));
 }
 TEST_P(ScalUsmTests, ComplexSinglePrecision) {
     std::complex<float> alpha(2.0, -0.5);
     EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, alpha)));
+    EXPECT_TRUEORSKIP((test_alpha_ptr<std::complex<float>, std::complex<float>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, alpha)));
     EXPECT_TRUEORSKIP((test<std::complex<float>, std::complex<float>>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, alpha)));
 }
@@ -157,6 +354,8 @@ TEST_P(ScalUsmTests, ComplexDoublePrecision) {
     std::complex<double> alpha(2.0, -0.5);
     EXPECT_TRUEORSKIP((test<std::complex<double>, std::complex<double>>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, alpha)));
+    EXPECT_TRUEORSKIP((test_alpha_ptr<std::complex<double>, std::complex<double>>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, alpha)));
     EXPECT_TRUEORSKIP((test<std::complex<double>, std::complex<double>>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, alpha)));
 }
@@ -164,15 +363,23 @@ TEST_P(ScalUsmTests, ComplexRealSinglePrecision) {
     float alpha(2.0);
     EXPECT_TRUEORSKIP((test<std::complex<float>, float>(std::get<0>(GetParam()),
                                                         std::get<1>(GetParam()), 1357, 2, alpha)));
+    EXPECT_TRUEORSKIP((test_alpha_ptr<std::complex<float>, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, alpha)));
     EXPECT_TRUEORSKIP((test<std::complex<float>, float>(std::get<0>(GetParam()),
                                                         std::get<1>(GetParam()), 1357, -3, alpha)));
+    EXPECT_TRUEORSKIP((test_nrm2_alpha<std::complex<float>, float>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2)));
 }
 TEST_P(ScalUsmTests, ComplexRealDoublePrecision) {
     double alpha(2.0);
     EXPECT_TRUEORSKIP((test<std::complex<double>, double>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, alpha)));
+    EXPECT_TRUEORSKIP((test_alpha_ptr<std::complex<double>, double>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2, alpha)));
     EXPECT_TRUEORSKIP((test<std::complex<double>, double>(
         std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, -3, alpha)));
+    EXPECT_TRUEORSKIP((test_nrm2_alpha<std::complex<double>, double>(
+        std::get<0>(GetParam()), std::get<1>(GetParam()), 1357, 2)));
 }
 
 INSTANTIATE_TEST_SUITE_P(ScalUsmTestSuite, ScalUsmTests,
@@ -0,0 +1,404 @@
+/*******************************************************************************
+* Copyright 2020-2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <complex>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+#include "cblas.h"
+#include "oneapi/mkl/detail/config.hpp"
+#include "oneapi/mkl.hpp"
+#include "oneapi/mkl/blas/detail/netlib/onemkl_blas_netlib.hpp"
+#include "onemkl_blas_helper.hpp"
+#include "reference_blas_templates.hpp"
+#include "test_common.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cl::sycl;
+using std::vector;
+
+extern std::vector<cl::sycl::device*> devices;
+
+namespace {
+
+// The netlib level 3 routines with a level3_threads_scope of more than one thread, which splits
+// them into tiles of at least 64 rows or columns. The sizes are not multiples of the tile sizes, so
+// the last tiles are smaller than the others.
+const int level3_threads = 4;
+
+// Runs the column or row major netlib routine on the queue and waits for it.
+#define RUN_NETLIB(layout, q, routine, ...)                                                    \
+    do {                                                                                       \
+        switch (layout) {                                                                      \
+            case oneapi::mkl::layout::column_major:                                            \
+                TEST_RUN_NETLIB_SELECT(q, oneapi::mkl::blas::column_major::routine,            \
+                                       __VA_ARGS__);                                           \
+                break;                                                                         \
+            case oneapi::mkl::layout::row_major:                                               \
+                TEST_RUN_NETLIB_SELECT(q, oneapi::mkl::blas::row_major::routine, __VA_ARGS__); \
+                break;                                                                         \
+            default: break;                                                                    \
+        }                                                                                      \
+        q.wait();                                                                              \
+    } while (0)
+
+template <typename fp>
+int test_gemm(device* dev, oneapi::mkl::layout layout, oneapi::mkl::transpose transa,
+              oneapi::mkl::transpose transb, int m, int n, int k) {
+    if (!(dev->is_host() || dev->is_cpu()))
+        return test_skipped;
+    queue main_queue(*dev);
+    context cxt = main_queue.get_context();
+    std::vector<event> dependencies;
+
+    const int lda = std::max(m, k) + 3, ldb = std::max(k, n) + 5, ldc = std::max(m, n) + 7;
+    fp alpha(2.0), beta(3.0);
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), C(ua);
+    rand_matrix(A, layout, transa, m, k, lda);
+    rand_matrix(B, layout, transb, k, n, ldb);
+    rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, m, n, ldc);
+    auto C_ref = C;
+
+    const int m_ref = m, n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+    using fp_ref = typename ref_type_info<fp>::type;
+    ::gemm(convert_to_cblas_layout(layout), convert_to_cblas_trans(transa),
+           convert_to_cblas_trans(transb), &m_ref, &n_ref, &k_ref, (fp_ref*)&alpha,
+           (fp_ref*)A.data(), &lda_ref, (fp_ref*)B.data(), &ldb_ref, (fp_ref*)&beta,
+           (fp_ref*)C_ref.data(), &ldc_ref);
+
+    try {
+        oneapi::mkl::blas::netlib::level3_threads_scope threads(main_queue, level3_threads);
+        RUN_NETLIB(layout, main_queue, gemm, transa, transb, m, n, k, alpha, A.data(), lda,
+                   B.data(), ldb, beta, C.data(), ldc, dependencies);
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during GEMM:\n" << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of GEMM:\n" << error.what() << std::endl;
+    }
+
+    return (int)check_equal_matrix(C, C_ref, layout, m, n, ldc, 10 * k, std::cout);
+}
+
+template <typename fp>
+int test_symm(device* dev, oneapi::mkl::layout layout, oneapi::mkl::side left_right,
+              oneapi::mkl::uplo upper_lower, int m, int n) {
+    if (!(dev->is_host() || dev->is_cpu()))
+        return test_skipped;
+    queue main_queue(*dev);
+    context cxt = main_queue.get_context();
+    std::vector<event> dependencies;
+
+    const int dim_a = left_right == oneapi::mkl::side::left ? m : n;
+    const int lda = dim_a + 3, ldb = std::max(m, n) + 5, ldc = std::max(m, n) + 7;
+    fp alpha(2.0), beta(3.0);
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), C(ua);
+    rand_matrix(A, layout, oneapi::mkl::transpose::nontrans, dim_a, dim_a, lda);
+    rand_matrix(B, layout, oneapi::mkl::transpose::nontrans, m, n, ldb);
+    rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, m, n, ldc);
+    auto C_ref = C;
+
+    const int m_ref = m, n_ref = n;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+    using fp_ref = typename ref_type_info<fp>::type;
+    ::symm(convert_to_cblas_layout(layout), convert_to_cblas_side(left_right),
+           convert_to_cblas_uplo(upper_lower), &m_ref, &n_ref, (fp_ref*)&alpha, (fp_ref*)A.data(),
+           &lda_ref, (fp_ref*)B.data(), &ldb_ref, (fp_ref*)&beta, (fp_ref*)C_ref.data(), &ldc_ref);
+
+    try {
+        oneapi::mkl::blas::netlib::level3_threads_scope threads(main_queue, level3_threads);
+        RUN_NETLIB(layout, main_queue, symm, left_right, upper_lower, m, n, alpha, A.data(), lda,
+                   B.data(), ldb, beta, C.data(), ldc, dependencies);
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during SYMM:\n" << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of SYMM:\n" << error.what() << std::endl;
+    }
+
+    return (int)check_equal_matrix(C, C_ref, layout, m, n, ldc, 10 * std::max(m, n), std::cout);
+}
+
+template <typename fp>
+int test_hemm(device* dev, oneapi::mkl::layout layout, oneapi::mkl::side left_right,
+              oneapi::mkl::uplo upper_lower, int m, int n) {
+    if (!(dev->is_host() || dev->is_cpu()))
+        return test_skipped;
+    queue main_queue(*dev);
+    context cxt = main_queue.get_context();
+    std::vector<event> dependencies;
+
+    const int dim_a = left_right == oneapi::mkl::side::left ? m : n;
+    const int lda = dim_a + 3, ldb = std::max(m, n) + 5, ldc = std::max(m, n) + 7;
+    fp alpha(2.0), beta(3.0);
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), B(ua), C(ua);
+    rand_matrix(A, layout, oneapi::mkl::transpose::nontrans, dim_a, dim_a, lda);
+    rand_matrix(B, layout, oneapi::mkl::transpose::nontrans, m, n, ldb);
+    rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, m, n, ldc);
+    auto C_ref = C;
+
+    const int m_ref = m, n_ref = n;
+    const int lda_ref = lda, ldb_ref = ldb, ldc_ref = ldc;
+    using fp_ref = typename ref_type_info<fp>::type;
+    ::hemm(convert_to_cblas_layout(layout), convert_to_cblas_side(left_right),
+           convert_to_cblas_uplo(upper_lower), &m_ref, &n_ref, (fp_ref*)&alpha, (fp_ref*)A.data(),
+           &lda_ref, (fp_ref*)B.data(), &ldb_ref, (fp_ref*)&beta, (fp_ref*)C_ref.data(), &ldc_ref);
+
+    try {
+        oneapi::mkl::blas::netlib::level3_threads_scope threads(main_queue, level3_threads);
+        RUN_NETLIB(layout, main_queue, hemm, left_right, upper_lower, m, n, alpha, A.data(), lda,
+                   B.data(), ldb, beta, C.data(), ldc, dependencies);
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during HEMM:\n" << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of HEMM:\n" << error.what() << std::endl;
+    }
+
+    return (int)check_equal_matrix(C, C_ref, layout, m, n, ldc, 10 * std::max(m, n), std::cout);
+}
+
+template <typename fp>
+int test_syrk(device* dev, oneapi::mkl::layout layout, oneapi::mkl::uplo upper_lower,
+              oneapi::mkl::transpose trans, int n, int k) {
+    if (!(dev->is_host() || dev->is_cpu()))
+        return test_skipped;
+    queue main_queue(*dev);
+    context cxt = main_queue.get_context();
+    std::vector<event> dependencies;
+
+    const int lda = std::max(n, k) + 3, ldc = n + 7;
+    fp alpha(2.0), beta(3.0);
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), C(ua);
+    rand_matrix(A, layout, trans, n, k, lda);
+    rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, n, n, ldc);
+    auto C_ref = C;
+
+    const int n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldc_ref = ldc;
+    using fp_ref = typename ref_type_info<fp>::type;
+    ::syrk(convert_to_cblas_layout(layout), convert_to_cblas_uplo(upper_lower),
+           convert_to_cblas_trans(trans), &n_ref, &k_ref, (fp_ref*)&alpha, (fp_ref*)A.data(),
+           &lda_ref, (fp_ref*)&beta, (fp_ref*)C_ref.data(), &ldc_ref);
+
+    try {
+        oneapi::mkl::blas::netlib::level3_threads_scope threads(main_queue, level3_threads);
+        RUN_NETLIB(layout, main_queue, syrk, upper_lower, trans, n, k, alpha, A.data(), lda, beta,
+                   C.data(), ldc, dependencies);
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during SYRK:\n" << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of SYRK:\n" << error.what() << std::endl;
+    }
+
+    return (int)check_equal_matrix(C, C_ref, layout, n, n, ldc, 10 * std::max(n, k), std::cout);
+}
+
+template <typename fp>
+int test_herk(device* dev, oneapi::mkl::layout layout, oneapi::mkl::uplo upper_lower,
+              oneapi::mkl::transpose trans, int n, int k) {
+    if (!(dev->is_host() || dev->is_cpu()))
+        return test_skipped;
+    queue main_queue(*dev);
+    context cxt = main_queue.get_context();
+    std::vector<event> dependencies;
+
+    using fp_scalar = typename fp::value_type;
+    const int lda = std::max(n, k) + 3, ldc = n + 7;
+    fp_scalar alpha(2.0), beta(3.0);
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), C(ua);
+    rand_matrix(A, layout, trans, n, k, lda);
+    rand_matrix(C, layout, oneapi::mkl::transpose::nontrans, n, n, ldc);
+    auto C_ref = C;
+
+    const int n_ref = n, k_ref = k;
+    const int lda_ref = lda, ldc_ref = ldc;
+    using fp_ref = typename ref_type_info<fp>::type;
+    ::herk(convert_to_cblas_layout(layout), convert_to_cblas_uplo(upper_lower),
+           convert_to_cblas_trans(trans), &n_ref, &k_ref, (fp_scalar*)&alpha, (fp_ref*)A.data(),
+           &lda_ref, (fp_scalar*)&beta, (fp_ref*)C_ref.data(), &ldc_ref);
+
+    try {
+        oneapi::mkl::blas::netlib::level3_threads_scope threads(main_queue, level3_threads);
+        RUN_NETLIB(layout, main_queue, herk, upper_lower, trans, n, k, alpha, A.data(), lda, beta,
+                   C.data(), ldc, dependencies);
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during HERK:\n" << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of HERK:\n" << error.what() << std::endl;
+    }
+
+    return (int)check_equal_matrix(C, C_ref, layout, n, n, ldc, 10 * std::max(n, k), std::cout);
+}
+
+// trmm, or trsm with solve set.
+template <typename fp>
+int test_trmm(device* dev, oneapi::mkl::layout layout, bool solve, oneapi::mkl::side left_right,
+              oneapi::mkl::uplo upper_lower, oneapi::mkl::transpose transa, int m, int n) {
+    if (!(dev->is_host() || dev->is_cpu()))
+        return test_skipped;
+    queue main_queue(*dev);
+    context cxt = main_queue.get_context();
+    std::vector<event> dependencies;
+
+    const oneapi::mkl::diag unit_nonunit = oneapi::mkl::diag::nonunit;
+    const int dim_a = left_right == oneapi::mkl::side::left ? m : n;
+    const int lda = dim_a + 3, ldb = std::max(m, n) + 5;
+    fp alpha(2.0);
+    auto ua = usm_allocator<fp, usm::alloc::shared, 64>(cxt, *dev);
+    vector<fp, decltype(ua)> A(ua), B(ua);
+    if (solve)
+        rand_trsm_matrix(A, layout, transa, dim_a, dim_a, lda);
+    else
+        rand_matrix(A, layout, transa, dim_a, dim_a, lda);
+    rand_matrix(B, layout, oneapi::mkl::transpose::nontrans, m, n, ldb);
+    auto B_ref = B;
+
+    const int m_ref = m, n_ref = n;
+    const int lda_ref = lda, ldb_ref = ldb;
+    using fp_ref = typename ref_type_info<fp>::type;
+    if (solve)
+        ::trsm(convert_to_cblas_layout(layout), convert_to_cblas_side(left_right),
+               convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
+               convert_to_cblas_diag(unit_nonunit), &m_ref, &n_ref, (fp_ref*)&alpha,
+               (fp_ref*)A.data(), &lda_ref, (fp_ref*)B_ref.data(), &ldb_ref);
+    else
+        ::trmm(convert_to_cblas_layout(layout), convert_to_cblas_side(left_right),
+               convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
+               convert_to_cblas_diag(unit_nonunit), &m_ref, &n_ref, (fp_ref*)&alpha,
+               (fp_ref*)A.data(), &lda_ref, (fp_ref*)B_ref.data(), &ldb_ref);
+
+    try {
+        oneapi::mkl::blas::netlib::level3_threads_scope threads(main_queue, level3_threads);
+        if (solve)
+            RUN_NETLIB(layout, main_queue, trsm, left_right, upper_lower, transa, unit_nonunit, m,
+                       n, alpha, A.data(), lda, B.data(), ldb, dependencies);
+        else
+            RUN_NETLIB(layout, main_queue, trmm, left_right, upper_lower, transa, unit_nonunit, m,
+                       n, alpha, A.data(), lda, B.data(), ldb, dependencies);
+    }
+    catch (exception const& e) {
+        std::cout << "Caught synchronous SYCL exception during TRMM:\n" << e.what() << std::endl;
+        print_error_code(e);
+    }
+
+    catch (const std::runtime_error& error) {
+        std::cout << "Error raised during execution of TRMM:\n" << error.what() << std::endl;
+    }
+
+    if (solve)
+        return (int)check_equal_trsm_matrix(B, B_ref, layout, m, n, ldb, 10 * std::max(m, n),
+                                            std::cout);
+    return (int)check_equal_matrix(B, B_ref, layout, m, n, ldb, 10 * std::max(m, n), std::cout);
+}
+
+// gemm splits C in both dimensions, syrk and herk split its triangle, and symm, hemm, trmm and trsm
+// split the rows or the columns of C (of B) depending on the side.
+template <typename fp>
+void test_all(device* dev, oneapi::mkl::layout layout) {
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    const auto trans = oneapi::mkl::transpose::trans;
+    for (auto transa : { nontrans, trans }) {
+        EXPECT_TRUEORSKIP(test_gemm<fp>(dev, layout, transa, nontrans, 257, 193, 65));
+        EXPECT_TRUEORSKIP(test_gemm<fp>(dev, layout, nontrans, transa, 130, 321, 96));
+    }
+    for (auto left_right : { oneapi::mkl::side::left, oneapi::mkl::side::right }) {
+        for (auto upper_lower : { oneapi::mkl::uplo::lower, oneapi::mkl::uplo::upper }) {
+            EXPECT_TRUEORSKIP(test_symm<fp>(dev, layout, left_right, upper_lower, 200, 131));
+            EXPECT_TRUEORSKIP(
+                test_trmm<fp>(dev, layout, false, left_right, upper_lower, trans, 195, 142));
+            EXPECT_TRUEORSKIP(
+                test_trmm<fp>(dev, layout, true, left_right, upper_lower, nontrans, 195, 142));
+        }
+    }
+    for (auto upper_lower : { oneapi::mkl::uplo::lower, oneapi::mkl::uplo::upper }) {
+        EXPECT_TRUEORSKIP(test_syrk<fp>(dev, layout, upper_lower, nontrans, 300, 41));
+        EXPECT_TRUEORSKIP(test_syrk<fp>(dev, layout, upper_lower, trans, 300, 41));
+    }
+}
+
+template <typename fp>
+void test_all_hermitian(device* dev, oneapi::mkl::layout layout) {
+    for (auto upper_lower : { oneapi::mkl::uplo::lower, oneapi::mkl::uplo::upper }) {
+        EXPECT_TRUEORSKIP(test_hemm<fp>(dev, layout, oneapi::mkl::side::left, upper_lower,
+                                        200, 131));
+        EXPECT_TRUEORSKIP(test_hemm<fp>(dev, layout, oneapi::mkl::side::right, upper_lower,
+                                        200, 131));
+        EXPECT_TRUEORSKIP(
+            test_herk<fp>(dev, layout, upper_lower, oneapi::mkl::transpose::nontrans, 300, 41));
+        EXPECT_TRUEORSKIP(
+            test_herk<fp>(dev, layout, upper_lower, oneapi::mkl::transpose::conjtrans, 300, 41));
+    }
+}
+
+class Level3ThreadsUsmTests
+        : public ::testing::TestWithParam<std::tuple<cl::sycl::device*, oneapi::mkl::layout>> {};
+
+TEST_P(Level3ThreadsUsmTests, RealSinglePrecision) {
+    test_all<float>(std::get<0>(GetParam()), std::get<1>(GetParam()));
+}
+TEST_P(Level3ThreadsUsmTests, RealDoublePrecision) {
+    test_all<double>(std::get<0>(GetParam()), std::get<1>(GetParam()));
+}
+TEST_P(Level3ThreadsUsmTests, ComplexSinglePrecision) {
+    test_all<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()));
+    test_all_hermitian<std::complex<float>>(std::get<0>(GetParam()), std::get<1>(GetParam()));
+}
+TEST_P(Level3ThreadsUsmTests, ComplexDoublePrecision) {
+    test_all<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()));
+    test_all_hermitian<std::complex<double>>(std::get<0>(GetParam()), std::get<1>(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(Level3ThreadsUsmTestSuite, Level3ThreadsUsmTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(oneapi::mkl::layout::column_major,
+                                                            oneapi::mkl::layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
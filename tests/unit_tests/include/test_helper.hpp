@@ -23,6 +23,7 @@
 #include <iostream>
 #include <string>
 #include <tuple>
+#include <vector>
 #include <gtest/gtest.h>
 #include <CL/sycl.hpp>
 
@@ -97,6 +98,41 @@
         }                                                                      \
     } while (0);
 
+#ifdef ENABLE_NETLIB_BACKEND
+#define TEST_RUN_NETLIB_SELECT(q, func, ...) \
+    func(oneapi::mkl::backend_selector<oneapi::mkl::backend::netlib>{ q }, __VA_ARGS__)
+#else
+#define TEST_RUN_NETLIB_SELECT(q, func, ...)
+#endif
+
+// TEST_RUN_CT_SELECT runs CPU queues on mklcpu when both CPU backends are built. With netlib true,
+// this runs them on netlib instead, so that tests can cover both; check netlib_ct_skipped first.
+#define TEST_RUN_CT_SELECT_NETLIB(netlib, q, func, ...)   \
+    do {                                                  \
+        if (netlib) {                                     \
+            TEST_RUN_NETLIB_SELECT(q, func, __VA_ARGS__); \
+        }                                                 \
+        else {                                            \
+            TEST_RUN_CT_SELECT(q, func, __VA_ARGS__);     \
+        }                                                 \
+    } while (0);
+
+// Values of the netlib parameter of the tests that cover both CPU backends. true is only added
+// when TEST_RUN_CT_SELECT would not reach netlib by itself: in the compile-time build with both
+// mklcpu and netlib.
+static inline std::vector<bool> netlib_values() {
+#if defined(ENABLE_MKLCPU_BACKEND) && defined(ENABLE_NETLIB_BACKEND) && !defined(CALL_RT_API)
+    return { false, true };
+#else
+    return { false };
+#endif
+}
+
+// True when a test asked to run on netlib cannot: netlib only serves CPU devices.
+static inline bool netlib_ct_skipped(bool netlib, cl::sycl::device *dev) {
+    return netlib && !(dev->is_host() || dev->is_cpu());
+}
+
 void print_error_code(cl::sycl::exception const &e);
 
 class DeviceNamePrint {
@@ -128,6 +164,28 @@ public:
     }
 };
 
+// Names the tests parameterized on the device, the layout and the netlib flag of
+// TEST_RUN_CT_SELECT_NETLIB.
+class LayoutDeviceNetlibNamePrint {
+public:
+    std::string operator()(
+        testing::TestParamInfo<std::tuple<cl::sycl::device *, oneapi::mkl::layout, bool>> dev)
+        const {
+        std::string layout_name = std::get<1>(dev.param) == oneapi::mkl::layout::column_major
+                                      ? "Column_Major"
+                                      : "Row_Major";
+        std::string dev_name = std::get<0>(dev.param)->get_info<cl::sycl::info::device::name>();
+        for (std::string::size_type i = 0; i < dev_name.size(); ++i) {
+            if (!isalnum(dev_name[i]))
+                dev_name[i] = '_';
+        }
+        std::string info_name = (layout_name.append("_")).append(dev_name);
+        if (std::get<2>(dev.param))
+            info_name.append("_Netlib");
+        return info_name;
+    }
+};
+
 /* to accommodate Windows and Linux differences between alligned_alloc and
    _aligned_malloc calls use oneapi::mkl::aligned_alloc and oneapi::mkl::aligned_free instead */
 namespace oneapi {